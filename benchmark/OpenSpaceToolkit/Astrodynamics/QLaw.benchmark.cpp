@@ -0,0 +1,381 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+
+using ostk::math::object::Vector6d;
+using Vector5d = Eigen::Matrix<double, 5, 1>;
+
+using ostk::physics::units::Angle;
+using ostk::physics::units::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astro::guidancelaw::QLaw;
+using ostk::astro::trajectory::orbit::models::kepler::COE;
+
+static const double REFERENCE_THRUST_ACCELERATION = 2.0 / 2000.0;
+
+static const Vector6d REFERENCE_COE_VECTOR = {
+    24505900.0,
+    0.725,
+    0.001047197551196598,
+    0.05235987755982989,
+    0.08726646259971647,
+    0.0,
+};
+
+static QLaw buildQLaw(const QLaw::GradientStrategy& aGradientStrategy)
+{
+    const COE targetCOE = {
+        Length::Meters(26500.0e3),
+        0.7,
+        Angle::Degrees(116.0),
+        Angle::Degrees(180.0),
+        Angle::Degrees(270.0),
+        Angle::Degrees(0.0),
+    };
+
+    const QLaw::Parameters parameters = {
+        {
+            {COE::Element::SemiMajorAxis, {1.0, 100.0}},
+            {COE::Element::Eccentricity, {1.0, 1e-3}},
+            {COE::Element::Inclination, {1.0, 1e-4}},
+            {COE::Element::Raan, {1.0, 1e-4}},
+            {COE::Element::Aop, {1.0, 1e-4}},
+        },
+        3,
+        4,
+        2,
+        0.01,
+        100,
+        1.0,
+        Length::Kilometers(6578.0),
+    };
+
+    return {targetCOE, EarthGravitationalModel::EGM2008.gravitationalParameter_, parameters, aGradientStrategy};
+}
+
+// Closed-form dQ/dOE expression evaluated by QLaw before Q, the maximal element changes and the gradient were fused
+// into a single kernel, kept as a baseline for the fused analytical gradient.
+class UnfusedAnalytical_dQ_dOE
+{
+   public:
+    UnfusedAnalytical_dQ_dOE(const QLaw& aQLaw)
+        : parameters_(aQLaw.getParameters()),
+          mu_(EarthGravitationalModel::EGM2008.gravitationalParameter_.in(
+              EarthGravitationalModel::EGM2008.gravitationalParameter_.getUnit()
+          )),
+          targetCOEVector_(aQLaw.getTargetCOE().getSIVector(COE::AnomalyType::True)),
+          controlWeights_(parameters_.getControlWeights()),
+          minimumPeriapsisRadius_(parameters_.getMinimumPeriapsisRadius().inMeters())
+    {
+    }
+
+    Vector5d compute(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+    {
+        const double& semiMajorAxis = aCOEVector(0);
+        const double& eccentricity = aCOEVector(1);
+        const double& inclination = aCOEVector(2);
+        const double& rightAscensionOfAscendingNode = aCOEVector(3);
+        const double& argumentOfPeriapsis = aCOEVector(4);
+
+        const double& semiMajorAxisTarget = targetCOEVector_(0);
+        const double& eccentricityTarget = targetCOEVector_(1);
+        const double& inclinationTarget = targetCOEVector_(2);
+        const double& rightAscensionOfAscendingNodeTarget = targetCOEVector_(3);
+        const double& argumentOfPeriapsisTarget = targetCOEVector_(4);
+
+        const double& semiMajorAxisWeight = controlWeights_(0);
+        const double& eccentricityWeight = controlWeights_(1);
+        const double& inclinationWeight = controlWeights_(2);
+        const double& rightAscensionOfAscendingNodeWeight = controlWeights_(3);
+        const double& argumentOfPeriapsisWeight = controlWeights_(4);
+
+        const double& periapsisWeight = parameters_.periapsisWeight;
+        const double& minimumPeriapsisRadius = minimumPeriapsisRadius_;
+
+        // common grouped expressions
+        const double x0 = 1.0 / minimumPeriapsisRadius;
+        const double x1 = eccentricity - 1.0;
+        const double x2 = x0 * x1;
+        const double x3 = eccentricity - eccentricityTarget;
+        const double x4 = eccentricityWeight * std::pow(x3, 2.0);
+        const double x5 = 1.0 / semiMajorAxis;
+        const double x6 = std::pow(eccentricity, 2.0);
+        const double x7 = x6 - 1.0;
+        const double x8 = 1.0 / x7;
+        const double x9 = x5 * x8;
+        const double x10 = semiMajorAxis - semiMajorAxisTarget;
+        const double x11 = std::pow(x10, 2.0);
+        const double x12 = std::pow(semiMajorAxis, -3.0);
+        const double x13 = eccentricity + 1.0;
+        const double x14 = 1.0 / x13;
+        const double x15 = std::pow(x10 / (parameters_.m * semiMajorAxisTarget), parameters_.n);
+        const double x16 = x15 + 1.0;
+        const double x17 = 1.0 / parameters_.r;
+        const double x18 = std::pow(x16, x17);
+        const double x19 = semiMajorAxisWeight * x12 * x14 * x18;
+        const double x20 = x11 * x19;
+        const double x21 = 4.0 * x9;
+        const double x22 = inclination - inclinationTarget;
+        const double x23 = std::pow(x22, 2.0);
+        const double x24 = std::cos(argumentOfPeriapsis);
+        const double x25 = std::fabs(x24);
+        const double x26 = std::sin(argumentOfPeriapsis);
+        const double x27 = std::pow(x26, 2.0);
+        const double x28 = std::sqrt(-x27 * x6 + 1.0);
+        const double x29 = eccentricity * x25 - x28;
+        const double x30 = inclinationWeight * std::pow(x29, 2.0);
+        const double x31 = x23 * x30;
+        const double x32 = std::fabs(x26);
+        const double x33 = std::pow(x24, 2.0);
+        const double x34 = std::sqrt(-x33 * x6 + 1.0);
+        const double x35 = eccentricity * x32 - x34;
+        const double x36 = std::pow(x35, 2.0);
+        const double x37 = rightAscensionOfAscendingNode - rightAscensionOfAscendingNodeTarget;
+        const double x38 = std::cos(x37);
+        const double x39 = std::acos(x38);
+        const double x40 = std::pow(x39, 2.0);
+        const double x41 = std::sin(inclination);
+        const double x42 = std::pow(x41, 2.0);
+        const double x43 = rightAscensionOfAscendingNodeWeight * x40 * x42;
+        const double x44 = x36 * x43;
+        const double x45 = semiMajorAxis * x7;
+        const double x46 = std::pow(parameters_.b + 1.0, 2.0);
+        const double x47 = 1.0 / x35;
+        const double x48 = std::cos(inclination);
+        const double x49 = std::fabs(x48);
+        const double x50 = parameters_.b * x49 / x41;
+        const double x51 = 1.0 / eccentricity;
+        const double x52 = -x7;
+        const double x53 = x52 / std::pow(eccentricity, 3.0);
+        const double x54 = std::sqrt(0.14814814814814814 + std::pow(x52, 2.0) / std::pow(eccentricity, 6.0));
+        const double x55 = x53 + x54;
+        const double x56 = std::max(0.0, -x53 + x54);
+        const double x57 =
+            x51 - 0.79370052598409979 * std::pow(x55, (1.0 / 3.0)) + 0.79370052598409979 * std::pow(x56, (1.0 / 3.0));
+        const double x58 = -x57;
+        const double x59 = std::pow(x58, 2.0);
+        const double x60 = x59 - 1.0;
+        const double x61 = std::fabs(semiMajorAxis);
+        const double x62 = std::fabs(x7);
+        const double x63 = x51 * x61 * x62;
+        const double x64 =
+            x45 * x47 * x50 +
+            x63 * std::sqrt(std::pow(x57, 2.0) - x60 * std::pow(1.0 + 1.0 / (-eccentricity * x57 + 1.0), 2.0));
+        const double x65 = std::pow(x64, -2.0);
+        const double x66 = argumentOfPeriapsis - argumentOfPeriapsisTarget;
+        const double x67 = std::cos(x66);
+        const double x68 = std::acos(x67);
+        const double x69 = std::pow(x68, 2.0);
+        const double x70 = 4.0 * x69;
+        const double x71 = periapsisWeight * std::exp(parameters_.k * (semiMajorAxis * x2 + 1.0));
+        const double x72 =
+            parameters_.k * x71 *
+            (argumentOfPeriapsisWeight * x45 * x46 * x65 * x70 + x1 * x20 + x21 * x31 + x21 * x44 + x4 * x9);
+        const double x73 = x71 + 1.0;
+        const double x74 = mu_ * x4;
+        const double x75 = std::pow(semiMajorAxis, 2.0);
+        const double x76 = 1.0 / x52;
+        const double x77 = x76 / x75;
+        const double x78 = -x1;
+        const double x79 = mu_ * x10 * x19 * x78;
+        const double x80 = inclinationWeight * x23;
+        const double x81 = 4.0 * mu_ * x77;
+        const double x82 = mu_ * semiMajorAxisWeight * x11 * x18;
+        const double x83 = -x35;
+        const double x84 = std::pow(x83, 2.0);
+        const double x85 = x50 / x83;
+        const double x86 = x52 * x85;
+        const double x87 = -x60;
+        const double x88 = eccentricity * x58 + 1.0;
+        const double x89 = 1.0 / x88;
+        const double x90 = x89 + 1.0;
+        const double x91 = std::pow(x90, 2.0);
+        const double x92 = std::sqrt(x59 + x87 * x91);
+        const double x93 = x51 * x52 / (x61 * x62 * x92);
+        const double x94 = 2.0 * semiMajorAxis;
+        const double x95 = mu_ * semiMajorAxis;
+        const double x96 = x52 * x95;
+        const double x97 = argumentOfPeriapsisWeight * x46 * x70;
+        const double x98 = std::pow(aThrustAcceleration, -2.0);
+        const double x99 = (1.0 / 4.0) * x98;
+        const double x100 = mu_ * x9;
+        const double x101 = 2.0 * eccentricity;
+        const double x102 = std::pow(x7, 2.0);
+        const double x103 = x5 / x102;
+        const double x104 = eccentricity * mu_;
+        const double x105 = 8.0 * x103 * x104;
+        const double x106 = eccentricity / x28;
+        const double x107 = 8.0 * x100;
+        const double x108 = eccentricity / x34;
+        const double x109 = x108 * x33 + x32;
+        const double x110 = x35 * x43;
+        const double x111 = std::pow(x64, -3.0);
+        const double x112 = 1.0 / x6;
+        const double x113 = 2.0 * x61 * x62 * x92;
+        const double x114 = x112 * x52;
+        const double x115 = (1.0 / 3.0) * x53 * (3.0 * x114 + 2.0) / x54;
+        const double x116 = x112 * (1.0 - 1.0 * x6) + (2.0 / 3.0);
+        const double x117 = std::pow(x55, -(2.0 / 3.0)) * (x115 + x116);
+        const double x118 = std::pow(std::max(x56, 1e-15), -(2.0 / 3.0)) * (-x115 + x116);
+        const double x119 = -1.5874010519681996 * x117 - 1.5874010519681996 * x118 + 2.0;
+        const double x120 = rightAscensionOfAscendingNodeWeight * x100 * x36;
+        const double x121 = argumentOfPeriapsisWeight * x102 * x111 * x46 * x69 * x75;
+        const double x122 = 2.0 * x73 * x98;
+        const double x123 = x24 * (x108 * x26 - (((x26) > 0) - ((x26) < 0)));
+
+        double dQ_dSemiMajorAxis =
+            -x99 * (mu_ * x2 * x72 + x73 * (-parameters_.n * x15 * x17 * x79 / x16 + std::pow(x29, 2.0) * x80 * x81 +
+                                            x43 * x81 * x84 + x74 * x77 - 2.0 * x79 -
+                                            x96 * x97 *
+                                                (x5 * x51 * x61 * x62 * x92 - x86 -
+                                                 x93 * x94 * (x52 * x59 + x87 * x90 * (x52 * x89 - x6 + 1.0))) /
+                                                std::pow(semiMajorAxis * x86 + x63 * x92, 3.0) +
+                                            3.0 * x14 * x78 * x82 / std::pow(semiMajorAxis, 4.0)));
+
+        double dQ_dEccentricity =
+            -x99 *
+            (x0 * x72 * x95 +
+             x73 *
+                 (2.0 * eccentricityWeight * x100 * x3 + mu_ * x20 - x1 * x12 * x82 / std::pow(x13, 2.0) -
+                  x101 * x103 * x74 - x105 * x31 - x105 * x44 + x107 * x109 * x110 +
+                  x107 * x29 * x80 * (x106 * x27 + x25) +
+                  x111 * x97 * std::pow(-x7 * x95, 3.0 / 2.0) *
+                      (-semiMajorAxis * x101 * x85 + x109 * x50 * x52 * x94 / x84 - x112 * x113 + x113 * x76 +
+                       x75 * x93 *
+                           (-4.0 * eccentricity * x59 + x112 * x119 * x52 * x58 - x114 * x119 * x58 * x91 +
+                            2.0 * x87 * x90 *
+                                (-x101 * x89 - x101 +
+                                 x52 * (-x51 * (-0.79370052598409979 * x117 - 0.79370052598409979 * x118 + 1.0) + x57) /
+                                     std::pow(x88, 2.0)))) /
+                      std::sqrt(x96)));
+
+        double dQ_dInclination =
+            -x122 * (mu_ * parameters_.b * x121 * x47 * ((((x48) > 0) - ((x48) < 0)) + x48 * x49 / x42) +
+                     x100 * x22 * x30 + x120 * x40 * x41 * x48);
+
+        double x124 = std::sin(x37) / std::sqrt(1.0 - std::pow(x38, 2.0));
+        if (!std::isfinite(x124))
+        {
+            x124 = 0.0;
+        }
+
+        double dQ_dRightAscensionOfAscendingNode = -x120 * x122 * x39 * x42 * x124;
+
+        double x125 = std::sin(x66) / std::sqrt(1.0 - std::pow(x67, 2.0));
+        if (!std::isfinite(x125))
+        {
+            x125 = 0.0;
+        }
+
+        double dQ_dArgumentOfPeriapsis =
+            -x122 * (argumentOfPeriapsisWeight * mu_ * semiMajorAxis * x46 * x65 * x68 * x7 * x125 +
+                     eccentricity * inclinationWeight * mu_ * x23 * x26 * x29 * x5 * x8 *
+                         (x106 * x24 - (((x24) > 0) - ((x24) < 0))) -
+                     eccentricity * x100 * x110 * x123 - x104 * x121 * x123 * x50 / x36);
+
+        return {
+            dQ_dSemiMajorAxis,
+            dQ_dEccentricity,
+            dQ_dInclination,
+            dQ_dRightAscensionOfAscendingNode,
+            dQ_dArgumentOfPeriapsis,
+        };
+    }
+    }
+
+   private:
+    const QLaw::Parameters parameters_;
+    const double mu_;
+    const Vector6d targetCOEVector_;
+    const Vector5d controlWeights_;
+    const double minimumPeriapsisRadius_;
+};
+
+static void computeQ(benchmark::State& state)
+{
+    const QLaw qlaw = buildQLaw(QLaw::GradientStrategy::Analytical);
+    const Vector5d coeVector = REFERENCE_COE_VECTOR.segment(0, 5);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(qlaw.computeQ(coeVector, REFERENCE_THRUST_ACCELERATION));
+    }
+}
+
+static void compute_dQ_dOE(benchmark::State& state, const QLaw::GradientStrategy& aGradientStrategy)
+{
+    const QLaw qlaw = buildQLaw(aGradientStrategy);
+    const Vector5d coeVector = REFERENCE_COE_VECTOR.segment(0, 5);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(qlaw.compute_dQ_dOE(coeVector, REFERENCE_THRUST_ACCELERATION));
+    }
+}
+
+static void computeUnfusedAnalytical_dQ_dOE(benchmark::State& state)
+{
+    const UnfusedAnalytical_dQ_dOE unfused_dQ_dOE = {buildQLaw(QLaw::GradientStrategy::Analytical)};
+    const Vector5d coeVector = REFERENCE_COE_VECTOR.segment(0, 5);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(unfused_dQ_dOE.compute(coeVector, REFERENCE_THRUST_ACCELERATION));
+    }
+}
+
+static void computeThrustDirection(benchmark::State& state, const QLaw::GradientStrategy& aGradientStrategy)
+{
+    const QLaw qlaw = buildQLaw(aGradientStrategy);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(qlaw.computeThrustDirection(REFERENCE_COE_VECTOR, REFERENCE_THRUST_ACCELERATION));
+    }
+}
+
+static void benchmark001(benchmark::State& state)
+{
+    computeQ(state);
+}
+
+static void benchmark002(benchmark::State& state)
+{
+    compute_dQ_dOE(state, QLaw::GradientStrategy::Analytical);
+}
+
+static void benchmark003(benchmark::State& state)
+{
+    compute_dQ_dOE(state, QLaw::GradientStrategy::FiniteDifference);
+}
+
+static void benchmark004(benchmark::State& state)
+{
+    computeThrustDirection(state, QLaw::GradientStrategy::Analytical);
+}
+
+static void benchmark005(benchmark::State& state)
+{
+    computeThrustDirection(state, QLaw::GradientStrategy::FiniteDifference);
+}
+
+static void benchmark006(benchmark::State& state)
+{
+    computeUnfusedAnalytical_dQ_dOE(state);
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmark001)->Name("QLaw | Q");
+BENCHMARK(benchmark002)->Name("QLaw | dQ/dOE | Analytical");
+BENCHMARK(benchmark003)->Name("QLaw | dQ/dOE | Finite Difference");
+BENCHMARK(benchmark004)->Name("QLaw | Thrust Direction | Analytical");
+BENCHMARK(benchmark005)->Name("QLaw | Thrust Direction | Finite Difference");
+BENCHMARK(benchmark006)->Name("QLaw | dQ/dOE | Analytical (Unfused Baseline)");
@@ -4,6 +4,7 @@
 
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/AtmosphericDrag.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/CentralBodyGravity.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/FidelitySchedule.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/PositionDerivative.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/Tabulated.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/ThirdBodyGravity.cpp>
@@ -13,6 +14,7 @@ using namespace pybind11;
 
 using ostk::core::types::Shared;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 using ostk::math::object::Vector3d;
 
@@ -66,6 +68,21 @@ class PyDynamics : public Dynamics
             VectorXd, Dynamics, "compute_contribution", computeContribution, anInstant, x, aFrameSPtr
         );
     }
+
+    MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override
+    {
+        PYBIND11_OVERRIDE_NAME(
+            MatrixXd,
+            Dynamics,
+            "compute_contribution_jacobian",
+            computeContributionJacobian,
+            anInstant,
+            x,
+            aFrameSPtr
+        );
+    }
 };
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
@@ -81,6 +98,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
                 - get_read_coordinates_subsets
                 - get_write_coordinates_subsets
                 - compute_contribution
+                - compute_contribution_jacobian (optional, defaults to central differences)
             to create a custom dynamics class
 
         )doc"
@@ -166,6 +184,26 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "compute_contribution_jacobian",
+            &Dynamics::computeContributionJacobian,
+            arg("instant"),
+            arg("state_vector"),
+            arg("frame"),
+            R"doc(
+                Compute the Jacobian of the contribution of the dynamics with respect to its read coordinates.
+
+                Args:
+                    instant (Instant): The instant at which to compute the Jacobian.
+                    state_vector (numpy.ndarray): The read coordinates at the instant.
+                    frame (Frame): The reference frame in which to compute the Jacobian.
+
+                Returns:
+                    jacobian (numpy.ndarray): The Jacobian, with one row per write coordinate and one column per read
+                        coordinate.
+            )doc"
+        )
+
         .def_static(
             "from_environment",
             &Dynamics::FromEnvironment,
@@ -193,4 +231,5 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_Tabulated(dynamics);
+    OpenSpaceToolkitAstrodynamicsPy_Dynamics_FidelitySchedule(dynamics);
 }
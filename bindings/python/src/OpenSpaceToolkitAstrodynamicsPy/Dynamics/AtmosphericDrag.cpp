@@ -2,6 +2,8 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/AtmosphericDrag/DensityCache.cpp>
+
 inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::module& aModule)
 {
     using namespace pybind11;
@@ -12,6 +14,15 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
 
     using ostk::astro::Dynamics;
     using ostk::astro::dynamics::AtmosphericDrag;
+    using ostk::astro::dynamics::atmosphericdrag::DensityCache;
+
+    {
+        // Create "atmospheric_drag" python submodule
+        auto atmospheric_drag = aModule.def_submodule("atmospheric_drag");
+
+        // Add objects to "atmospheric_drag" submodule
+        OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag_DensityCache(atmospheric_drag);
+    }
 
     {
         class_<AtmosphericDrag, Dynamics, Shared<AtmosphericDrag>>(
@@ -33,6 +44,17 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
 
                 )doc"
             )
+            .def(
+                init<const Shared<const DensityCache>&>(),
+                arg("density_cache"),
+                R"doc(
+                    Constructor, with a density cache used in place of the atmospheric model of the celestial body.
+
+                    Args:
+                        density_cache (DensityCache): The density cache.
+
+                )doc"
+            )
 
             .def("__str__", &(shiftToString<AtmosphericDrag>))
             .def("__repr__", &(shiftToString<AtmosphericDrag>))
@@ -61,6 +83,30 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
                 )doc"
             )
 
+            .def(
+                "has_density_cache",
+                &AtmosphericDrag::hasDensityCache,
+                R"doc(
+                    Check if the atmospheric drag uses a density cache.
+
+                    Returns:
+                        bool: True if the atmospheric drag uses a density cache, False otherwise.
+
+                )doc"
+            )
+
+            .def(
+                "get_density_cache",
+                &AtmosphericDrag::getDensityCache,
+                R"doc(
+                    Get the density cache.
+
+                    Returns:
+                        DensityCache: The density cache.
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &AtmosphericDrag::computeContribution,
@@ -0,0 +1,177 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag/DensityCache.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag_DensityCache(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::types::Real;
+    using ostk::core::types::Shared;
+
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+    using ostk::physics::units::Angle;
+    using ostk::physics::units::Length;
+
+    using ostk::astro::dynamics::atmosphericdrag::DensityCache;
+
+    {
+        class_<DensityCache, Shared<DensityCache>>(
+            aModule,
+            "DensityCache",
+            R"doc(
+                A thread-safe atmospheric density cache, tabulated on an altitude x latitude x local solar time x time
+                grid and interpolated. Cells whose interpolation error exceeds the relative tolerance are evaluated
+                directly.
+
+            )doc"
+        )
+            .def(
+                init<
+                    const Shared<const Celestial>&,
+                    const Interval&,
+                    const Length&,
+                    const Angle&,
+                    const Duration&,
+                    const Duration&,
+                    const Real&>(),
+                arg("celestial"),
+                arg("interval"),
+                arg("altitude_step") = Length::Kilometers(5.0),
+                arg("latitude_step") = Angle::Degrees(5.0),
+                arg("local_solar_time_step") = Duration::Hours(1.0),
+                arg("time_step") = Duration::Hours(1.0),
+                arg("relative_tolerance") = 1.0e-2,
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        celestial (Celestial): The celestial body, with an atmospheric model.
+                        interval (Interval): The interval over which densities are tabulated.
+                        altitude_step (Length): The altitude step of the grid. Defaults to 5 km.
+                        latitude_step (Angle): The latitude step of the grid. Defaults to 5 deg.
+                        local_solar_time_step (Duration): The local solar time step of the grid, dividing a day into
+                            at most 4096 nodes. Defaults to 1 hour.
+                        time_step (Duration): The time step of the grid. Defaults to 1 hour.
+                        relative_tolerance (float): The maximum relative interpolation error of a cell. Defaults to 1%.
+
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<DensityCache>))
+            .def("__repr__", &(shiftToString<DensityCache>))
+
+            .def(
+                "is_defined",
+                &DensityCache::isDefined,
+                R"doc(
+                    Check if the density cache is defined.
+
+                    Returns:
+                        bool: True if the density cache is defined, False otherwise.
+
+                )doc"
+            )
+
+            .def(
+                "get_celestial",
+                &DensityCache::getCelestial,
+                R"doc(
+                    Get the celestial body.
+
+                    Returns:
+                        Celestial: The celestial body.
+
+                )doc"
+            )
+
+            .def(
+                "get_interval",
+                &DensityCache::getInterval,
+                R"doc(
+                    Get the interval over which densities are tabulated.
+
+                    Returns:
+                        Interval: The interval.
+
+                )doc"
+            )
+
+            .def(
+                "get_relative_tolerance",
+                &DensityCache::getRelativeTolerance,
+                R"doc(
+                    Get the maximum relative interpolation error of a cell.
+
+                    Returns:
+                        float: The relative tolerance.
+
+                )doc"
+            )
+
+            .def(
+                "get_node_count",
+                &DensityCache::getNodeCount,
+                R"doc(
+                    Get the number of evaluated grid nodes.
+
+                    Returns:
+                        int: The number of evaluated grid nodes.
+
+                )doc"
+            )
+
+            .def(
+                "get_interpolated_query_count",
+                &DensityCache::getInterpolatedQueryCount,
+                R"doc(
+                    Get the number of queries answered by interpolation.
+
+                    Returns:
+                        int: The number of interpolated queries.
+
+                )doc"
+            )
+
+            .def(
+                "get_direct_query_count",
+                &DensityCache::getDirectQueryCount,
+                R"doc(
+                    Get the number of queries answered by a direct evaluation of the atmospheric model.
+
+                    Returns:
+                        int: The number of direct queries.
+
+                )doc"
+            )
+
+            .def(
+                "get_density_at",
+                &DensityCache::getDensityAt,
+                arg("position_coordinates"),
+                arg("instant"),
+                R"doc(
+                    Get the atmospheric density at a position.
+
+                    Args:
+                        position_coordinates (numpy.ndarray): The position coordinates, in meters, expressed in ITRF.
+                        instant (Instant): The instant.
+
+                    Returns:
+                        float: The atmospheric density, in kg/m^3.
+
+                )doc"
+            )
+
+            .def(
+                "clear",
+                &DensityCache::clear,
+                R"doc(
+                    Clear all tabulated densities.
+
+                )doc"
+            );
+    }
+}
@@ -0,0 +1,262 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/FidelitySchedule.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_FidelitySchedule(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::ctnr::Array;
+    using ostk::core::types::Shared;
+    using ostk::core::types::String;
+
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::units::Length;
+
+    using ostk::astro::Dynamics;
+    using ostk::astro::dynamics::FidelitySchedule;
+
+    {
+        class_<FidelitySchedule, Dynamics, Shared<FidelitySchedule>> fidelitySchedule(
+            aModule,
+            "FidelitySchedule",
+            R"doc(
+                Select a set of dynamics (force model fidelity) according to the altitude above, or distance from, a
+                celestial object.
+
+                The criterion range is split into regimes by increasing thresholds, each regime being modeled by its
+                own set of dynamics. When propagated, the schedule keeps its regime until the criterion leaves the
+                regime range widened by the hysteresis, and each switch is an integration restart point.
+
+            )doc"
+        );
+
+        enum_<FidelitySchedule::Criterion>(
+            fidelitySchedule,
+            "Criterion",
+            R"doc(
+                The criterion selecting the regime.
+
+            )doc"
+        )
+
+            .value(
+                "Altitude",
+                FidelitySchedule::Criterion::Altitude,
+                "Distance from the center of the celestial object, minus its equatorial radius"
+            )
+            .value(
+                "Distance", FidelitySchedule::Criterion::Distance, "Distance from the center of the celestial object"
+            )
+
+            ;
+
+        fidelitySchedule
+
+            .def(
+                init<
+                    const Shared<const Celestial>&,
+                    const FidelitySchedule::Criterion&,
+                    const Array<Length>&,
+                    const Array<Array<Shared<Dynamics>>>&,
+                    const Length&,
+                    const String&>(),
+                arg("celestial"),
+                arg("criterion"),
+                arg("thresholds"),
+                arg("dynamics"),
+                arg("hysteresis") = Length::Meters(0.0),
+                arg("name") = String("Fidelity Schedule"),
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        celestial (Celestial): The celestial object, from which the criterion is measured.
+                        criterion (FidelitySchedule.Criterion): The criterion.
+                        thresholds (list[Length]): The N - 1 thresholds between the N regimes, strictly increasing.
+                        dynamics (list[list[Dynamics]]): The dynamics of each of the N regimes, in increasing
+                            criterion order.
+                        hysteresis (Length, optional): The hysteresis, smaller than half the smallest gap between
+                            thresholds. Defaults to zero.
+                        name (str, optional): The name. Defaults to "Fidelity Schedule".
+
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<FidelitySchedule>))
+            .def("__repr__", &(shiftToString<FidelitySchedule>))
+
+            .def(
+                "is_defined",
+                &FidelitySchedule::isDefined,
+                R"doc(
+                    Check if the fidelity schedule is defined.
+
+                    Returns:
+                        bool: True if the fidelity schedule is defined, False otherwise.
+
+                )doc"
+            )
+
+            .def(
+                "get_celestial",
+                &FidelitySchedule::getCelestial,
+                R"doc(
+                    Get the celestial object.
+
+                    Returns:
+                        Celestial: The celestial object.
+
+                )doc"
+            )
+            .def(
+                "get_criterion",
+                &FidelitySchedule::getCriterion,
+                R"doc(
+                    Get the criterion.
+
+                    Returns:
+                        FidelitySchedule.Criterion: The criterion.
+
+                )doc"
+            )
+            .def(
+                "get_thresholds",
+                &FidelitySchedule::getThresholds,
+                R"doc(
+                    Get the thresholds between the regimes.
+
+                    Returns:
+                        list[Length]: The thresholds.
+
+                )doc"
+            )
+            .def(
+                "get_hysteresis",
+                &FidelitySchedule::getHysteresis,
+                R"doc(
+                    Get the hysteresis.
+
+                    Returns:
+                        Length: The hysteresis.
+
+                )doc"
+            )
+            .def(
+                "get_regime_count",
+                &FidelitySchedule::getRegimeCount,
+                R"doc(
+                    Get the number of regimes.
+
+                    Returns:
+                        int: The number of regimes.
+
+                )doc"
+            )
+            .def(
+                "get_regime_dynamics",
+                &FidelitySchedule::getRegimeDynamics,
+                arg("index"),
+                R"doc(
+                    Get the dynamics of a regime.
+
+                    Args:
+                        index (int): The regime index.
+
+                    Returns:
+                        list[Dynamics]: The dynamics of the regime.
+
+                )doc"
+            )
+
+            .def(
+                "calculate_criterion_value",
+                &FidelitySchedule::calculateCriterionValue,
+                arg("instant"),
+                arg("position_coordinates"),
+                arg("frame"),
+                R"doc(
+                    Calculate the criterion value at a position.
+
+                    Args:
+                        instant (Instant): The instant.
+                        position_coordinates (numpy.ndarray): The position coordinates, in meters.
+                        frame (Frame): The frame in which the position is expressed.
+
+                    Returns:
+                        float: The criterion value, in meters.
+
+                )doc"
+            )
+            .def(
+                "calculate_regime_index",
+                &FidelitySchedule::calculateRegimeIndex,
+                arg("criterion_value"),
+                R"doc(
+                    Calculate the index of the regime holding a criterion value, without hysteresis.
+
+                    Args:
+                        criterion_value (float): The criterion value, in meters.
+
+                    Returns:
+                        int: The regime index.
+
+                )doc"
+            )
+            .def(
+                "is_in_regime",
+                &FidelitySchedule::isInRegime,
+                arg("criterion_value"),
+                arg("index"),
+                R"doc(
+                    Check if a criterion value lies in the range of a regime, widened by the hysteresis.
+
+                    Args:
+                        criterion_value (float): The criterion value, in meters.
+                        index (int): The regime index.
+
+                    Returns:
+                        bool: True if the regime holds the criterion value.
+
+                )doc"
+            )
+
+            .def(
+                "compute_contribution",
+                &FidelitySchedule::computeContribution,
+                arg("instant"),
+                arg("x"),
+                arg("frame"),
+                R"doc(
+                    Compute the contribution of the dynamics of the regime holding the criterion to the state vector.
+
+                    Args:
+                        instant (Instant): The instant of the state vector.
+                        x (numpy.ndarray): The state vector.
+                        frame (Frame): The reference frame.
+
+                    Returns:
+                        numpy.ndarray: The contribution to the state vector.
+
+                )doc"
+            )
+
+            .def_static(
+                "string_from_criterion",
+                &FidelitySchedule::StringFromCriterion,
+                arg("criterion"),
+                R"doc(
+                    Get the string of a criterion.
+
+                    Args:
+                        criterion (FidelitySchedule.Criterion): The criterion.
+
+                    Returns:
+                        str: The criterion string.
+
+                )doc"
+            )
+
+            ;
+    }
+}
@@ -9,6 +9,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
     using ostk::core::types::Shared;
 
     using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
 
     using ostk::astro::Dynamics;
     using ostk::astro::dynamics::ThirdBodyGravity;
@@ -78,6 +79,59 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
                     Returns:
                         numpy.ndarray: The contribution of the third-body gravity to the state vector.
 
+                )doc"
+            )
+
+            .def(
+                "precompute_ephemeris",
+                &ThirdBodyGravity::precomputeEphemeris,
+                arg("interval"),
+                arg("segment_duration") = Duration::Days(1.0),
+                arg("degree") = 13,
+                R"doc(
+                    Precompute the position of the third body in GCRF over an interval, as piecewise Chebyshev polynomials.
+
+                    Contributions computed in GCRF within the interval then use the fitted position and an analytical
+                    point mass acceleration, instead of querying the ephemeris of the celestial body.
+
+                    Args:
+                        interval (Interval): The interval, typically the propagation span.
+                        segment_duration (Duration): The duration covered by each Chebyshev segment. Defaults to 1 day.
+                        degree (int): The degree of the Chebyshev polynomials. Defaults to 13.
+
+                )doc"
+            )
+
+            .def(
+                "has_precomputed_ephemeris",
+                &ThirdBodyGravity::hasPrecomputedEphemeris,
+                R"doc(
+                    Check if the third body ephemeris has been precomputed.
+
+                    Returns:
+                        bool: True if the third body ephemeris has been precomputed, False otherwise.
+
+                )doc"
+            )
+
+            .def(
+                "get_precomputed_ephemeris_interval",
+                &ThirdBodyGravity::getPrecomputedEphemerisInterval,
+                R"doc(
+                    Get the interval over which the third body ephemeris has been precomputed.
+
+                    Returns:
+                        Interval: The precomputed ephemeris interval (undefined if not precomputed).
+
+                )doc"
+            )
+
+            .def(
+                "clear_precomputed_ephemeris",
+                &ThirdBodyGravity::clearPrecomputedEphemeris,
+                R"doc(
+                    Clear the precomputed third body ephemeris.
+
                 )doc"
             );
     }
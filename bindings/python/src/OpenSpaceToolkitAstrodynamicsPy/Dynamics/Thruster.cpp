@@ -10,6 +10,7 @@ using ostk::core::ctnr::Array;
 
 using ostk::math::object::VectorXd;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::coord::Frame;
 
@@ -66,7 +67,7 @@ class PyThruster : public Thruster
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(pybind11::module& aModule)
 {
-    class_<Thruster, PyThruster, Dynamics, Shared<Thruster>>(
+    class_<Thruster, PyThruster, Dynamics, Shared<Thruster>> thruster(
         aModule,
         "Thruster",
         R"doc(
@@ -74,14 +75,161 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(pybind11::module&
 
             Base class to derive other thruster classes from. Cannot be instantiated.
 
+        )doc"
+    );
+
+    class_<Thruster::GuidanceUpdatePolicy> guidanceUpdatePolicy(
+        thruster,
+        "GuidanceUpdatePolicy",
+        R"doc(
+            Policy for updating the thrust direction from the guidance law during an integration.
+
+            With a step start policy, the guidance law is evaluated at the start of each accepted integration step,
+            and the thrust direction and throttle are held over the step. With a fixed cadence, time is split into
+            windows of the given duration, aligned on J2000: the guidance law is evaluated at the start of the
+            integration and at the first accepted step in each new window, and held until the end of the window.
+            Held values are never updated at the intermediate stages or rejected steps of the numerical solver, and
+            are updated anew at the start of each integration. Evaluations outside of a propagation always use the
+            guidance law.
+
+        )doc"
+    );
+
+    enum_<Thruster::GuidanceUpdatePolicy::Type>(
+        guidanceUpdatePolicy,
+        "Type",
+        R"doc(
+            Guidance update policy type.
+
         )doc"
     )
 
+        .value(
+            "Continuous",
+            Thruster::GuidanceUpdatePolicy::Type::Continuous,
+            "Evaluate the guidance law at every evaluation of the dynamics."
+        )
+        .value(
+            "StepStart",
+            Thruster::GuidanceUpdatePolicy::Type::StepStart,
+            "Evaluate the guidance law at the start of each step, and hold it over the step."
+        )
+        .value(
+            "FixedCadence",
+            Thruster::GuidanceUpdatePolicy::Type::FixedCadence,
+            "Evaluate the guidance law once per window, and hold it in between."
+        )
+
+        ;
+
+    guidanceUpdatePolicy
+
         .def(
-            init<const SatelliteSystem&, const Shared<const GuidanceLaw>&, const String&>(),
+            init<const Thruster::GuidanceUpdatePolicy::Type&, const Duration&>(),
+            arg("type"),
+            arg("interval"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    type (Thruster.GuidanceUpdatePolicy.Type): The type.
+                    interval (Duration): The update interval (FixedCadence).
+
+            )doc"
+        )
+
+        .def(self == self)
+
+        .def(
+            "get_type",
+            &Thruster::GuidanceUpdatePolicy::getType,
+            R"doc(
+                Get the type.
+
+                Returns:
+                    Thruster.GuidanceUpdatePolicy.Type: The type.
+
+            )doc"
+        )
+        .def(
+            "get_interval",
+            &Thruster::GuidanceUpdatePolicy::getInterval,
+            R"doc(
+                Get the update interval (FixedCadence).
+
+                Returns:
+                    Duration: The update interval.
+
+            )doc"
+        )
+
+        .def_static(
+            "continuous",
+            &Thruster::GuidanceUpdatePolicy::Continuous,
+            R"doc(
+                Evaluate the guidance law at every evaluation of the dynamics.
+
+                Returns:
+                    Thruster.GuidanceUpdatePolicy: The guidance update policy.
+
+            )doc"
+        )
+        .def_static(
+            "step_start",
+            &Thruster::GuidanceUpdatePolicy::StepStart,
+            R"doc(
+                Evaluate the guidance law at the start of each accepted step, and hold it over the step.
+
+                Returns:
+                    Thruster.GuidanceUpdatePolicy: The guidance update policy.
+
+            )doc"
+        )
+        .def_static(
+            "fixed_cadence",
+            &Thruster::GuidanceUpdatePolicy::FixedCadence,
+            arg("interval"),
+            R"doc(
+                Evaluate the guidance law once per window of a given duration, and hold it in between.
+
+                Args:
+                    interval (Duration): The update interval, strictly positive.
+
+                Returns:
+                    Thruster.GuidanceUpdatePolicy: The guidance update policy.
+
+            )doc"
+        )
+        .def_static(
+            "string_from_type",
+            &Thruster::GuidanceUpdatePolicy::StringFromType,
+            arg("type"),
+            R"doc(
+                Get the string representation of a type.
+
+                Args:
+                    type (Thruster.GuidanceUpdatePolicy.Type): The type.
+
+                Returns:
+                    str: The string representation.
+
+            )doc"
+        )
+
+        ;
+
+    thruster
+
+        .def(
+            init<
+                const SatelliteSystem&,
+                const Shared<const GuidanceLaw>&,
+                const String&,
+                const Thruster::GuidanceUpdatePolicy&>(),
             arg("satellite_system"),
             arg("guidance_law"),
             arg("name") = String::Empty(),
+            arg("guidance_update_policy") = Thruster::GuidanceUpdatePolicy::Continuous(),
             R"doc(
                 Constructor.
 
@@ -89,6 +237,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(pybind11::module&
                     satellite_system (SatelliteSystem): The satellite system.
                     guidance_law (GuidanceLaw): The guidance law used to compute the acceleration vector.
                     name (str): The name of the thruster.
+                    guidance_update_policy (Thruster.GuidanceUpdatePolicy, optional): The guidance update policy.
+                        Defaults to continuous.
 
             )doc"
         )
@@ -116,6 +266,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(pybind11::module&
             )doc"
         )
 
+        .def(
+            "get_guidance_update_policy",
+            &Thruster::getGuidanceUpdatePolicy,
+            R"doc(
+                Get the guidance update policy of the thruster.
+
+                Returns:
+                    Thruster.GuidanceUpdatePolicy: The guidance update policy.
+
+            )doc"
+        )
+
         .def("__str__", &(shiftToString<Thruster>))
         .def("__repr__", &(shiftToString<Thruster>))
 
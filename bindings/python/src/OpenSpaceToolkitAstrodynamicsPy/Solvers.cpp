@@ -1,6 +1,9 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Solvers/DifferentialCorrector.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Solvers/FiniteDifferenceSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Solvers/MonteCarloSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Solvers/QLawTradeStudy.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Solvers/TemporalConditionSolver.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Solvers(pybind11::module& aModule)
@@ -11,4 +14,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers(pybind11::module& aModule)
     // Add objects to "solvers" submodule
     OpenSpaceToolkitAstrodynamicsPy_Solvers_TemporalConditionSolver(solvers);
     OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(solvers);
+    OpenSpaceToolkitAstrodynamicsPy_Solvers_MonteCarloSolver(solvers);
+    OpenSpaceToolkitAstrodynamicsPy_Solvers_DifferentialCorrector(solvers);
+    OpenSpaceToolkitAstrodynamicsPy_Solvers_QLawTradeStudy(solvers);
 }
@@ -0,0 +1,469 @@
+/// Apache License 2.0
+
+#include <pybind11/functional.h>  // To pass anonymous functions directly
+
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/DifferentialCorrector.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_DifferentialCorrector(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::types::Index;
+    using ostk::core::types::Real;
+    using ostk::core::types::Shared;
+    using ostk::core::types::Size;
+    using ostk::core::types::String;
+
+    using ostk::astro::EventCondition;
+    using ostk::astro::solvers::DifferentialCorrector;
+    using ostk::astro::trajectory::state::CoordinatesSubset;
+
+    class_<DifferentialCorrector> differentialCorrector(
+        aModule,
+        "DifferentialCorrector",
+        R"doc(
+            A differential corrector targeting constraints at the final state of a sequence.
+
+            Control variables are parameters passed to a sequence generator (e.g. segment durations, thrust
+            magnitudes), or coordinates of the initial state. Constraints are event condition targets (e.g. COE
+            conditions), evaluated at the final state. The Jacobian is computed by forward differences, solving the
+            perturbed sequences in parallel, and is updated from the steps taken with the Broyden method.
+
+        )doc"
+    );
+
+    enum_<DifferentialCorrector::Method>(
+        differentialCorrector,
+        "Method",
+        R"doc(
+            Jacobian update method.
+
+        )doc"
+    )
+        .value(
+            "Newton",
+            DifferentialCorrector::Method::Newton,
+            "Recompute the Jacobian by finite differences at each iteration."
+        )
+        .value(
+            "Broyden",
+            DifferentialCorrector::Method::Broyden,
+            "Update the Jacobian from the steps taken, recompute it when a step fails."
+        )
+
+        ;
+
+    class_<DifferentialCorrector::ControlVariable>(
+        differentialCorrector,
+        "ControlVariable",
+        R"doc(
+            A control variable.
+
+        )doc"
+    )
+
+        .def(
+            init<
+                const String&,
+                const Real&,
+                const Real&,
+                const Real&,
+                const Real&,
+                const Shared<const CoordinatesSubset>&,
+                const Index&>(),
+            arg("name"),
+            arg("initial_value"),
+            arg("perturbation"),
+            arg("lower_bound") = Real::Undefined(),
+            arg("upper_bound") = Real::Undefined(),
+            arg("coordinates_subset") = nullptr,
+            arg("coordinate_index") = 0,
+            R"doc(
+                Constructor.
+
+                Args:
+                    name (str): The name.
+                    initial_value (float): The initial value, undefined for an initial state coordinate.
+                    perturbation (float): The positive finite difference perturbation.
+                    lower_bound (float, optional): The lower bound. Defaults to unbounded.
+                    upper_bound (float, optional): The upper bound. Defaults to unbounded.
+                    coordinates_subset (CoordinatesSubset, optional): The subset of the controlled initial state
+                        coordinate. Defaults to None.
+                    coordinate_index (int, optional): The index of the controlled coordinate in its subset.
+                        Defaults to 0.
+
+            )doc"
+        )
+
+        .def_readonly(
+            "name",
+            &DifferentialCorrector::ControlVariable::name,
+            R"doc(
+                The name.
+
+                :type: str
+            )doc"
+        )
+        .def_readonly(
+            "initial_value",
+            &DifferentialCorrector::ControlVariable::initialValue,
+            R"doc(
+                The initial value, undefined for an initial state coordinate.
+
+                :type: float
+            )doc"
+        )
+        .def_readonly(
+            "perturbation",
+            &DifferentialCorrector::ControlVariable::perturbation,
+            R"doc(
+                The finite difference perturbation.
+
+                :type: float
+            )doc"
+        )
+        .def_readonly(
+            "lower_bound",
+            &DifferentialCorrector::ControlVariable::lowerBound,
+            R"doc(
+                The lower bound, undefined if unbounded.
+
+                :type: float
+            )doc"
+        )
+        .def_readonly(
+            "upper_bound",
+            &DifferentialCorrector::ControlVariable::upperBound,
+            R"doc(
+                The upper bound, undefined if unbounded.
+
+                :type: float
+            )doc"
+        )
+        .def_readonly(
+            "coordinates_subset",
+            &DifferentialCorrector::ControlVariable::coordinatesSubset,
+            R"doc(
+                The subset of the controlled initial state coordinate, if any.
+
+                :type: CoordinatesSubset
+            )doc"
+        )
+        .def_readonly(
+            "coordinate_index",
+            &DifferentialCorrector::ControlVariable::coordinateIndex,
+            R"doc(
+                The index of the controlled coordinate in its subset.
+
+                :type: int
+            )doc"
+        )
+
+        .def(
+            "is_initial_state_coordinate",
+            &DifferentialCorrector::ControlVariable::isInitialStateCoordinate,
+            R"doc(
+                Check if the control variable is a coordinate of the initial state.
+
+                Returns:
+                    bool: True if the control variable is a coordinate of the initial state.
+
+            )doc"
+        )
+
+        .def_static(
+            "parameter",
+            &DifferentialCorrector::ControlVariable::Parameter,
+            arg("name"),
+            arg("initial_value"),
+            arg("perturbation"),
+            arg("lower_bound") = Real::Undefined(),
+            arg("upper_bound") = Real::Undefined(),
+            R"doc(
+                Construct a parameter of the sequence, passed to the sequence generator.
+
+                Args:
+                    name (str): The name.
+                    initial_value (float): The initial value.
+                    perturbation (float): The positive finite difference perturbation.
+                    lower_bound (float, optional): The lower bound. Defaults to unbounded.
+                    upper_bound (float, optional): The upper bound. Defaults to unbounded.
+
+                Returns:
+                    DifferentialCorrector.ControlVariable: The control variable.
+
+            )doc"
+        )
+        .def_static(
+            "initial_state_coordinate",
+            &DifferentialCorrector::ControlVariable::InitialStateCoordinate,
+            arg("coordinates_subset"),
+            arg("coordinate_index"),
+            arg("perturbation"),
+            arg("lower_bound") = Real::Undefined(),
+            arg("upper_bound") = Real::Undefined(),
+            R"doc(
+                Construct a coordinate of the initial state, its initial value read from the initial state.
+
+                Args:
+                    coordinates_subset (CoordinatesSubset): The coordinates subset of the initial state.
+                    coordinate_index (int): The index of the coordinate in the subset.
+                    perturbation (float): The positive finite difference perturbation.
+                    lower_bound (float, optional): The lower bound. Defaults to unbounded.
+                    upper_bound (float, optional): The upper bound. Defaults to unbounded.
+
+                Returns:
+                    DifferentialCorrector.ControlVariable: The control variable.
+
+            )doc"
+        )
+
+        ;
+
+    class_<DifferentialCorrector::Constraint>(
+        differentialCorrector,
+        "Constraint",
+        R"doc(
+            A constraint on the final state: the evaluation of an event condition minus its target.
+
+        )doc"
+    )
+
+        .def(
+            init<const Shared<const EventCondition>&, const Real&>(),
+            arg("event_condition"),
+            arg("tolerance"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    event_condition (EventCondition): The targeted event condition.
+                    tolerance (float): The positive tolerance on the residual.
+
+            )doc"
+        )
+
+        .def_readonly(
+            "event_condition",
+            &DifferentialCorrector::Constraint::eventCondition,
+            R"doc(
+                The targeted event condition.
+
+                :type: EventCondition
+            )doc"
+        )
+        .def_readonly(
+            "tolerance",
+            &DifferentialCorrector::Constraint::tolerance,
+            R"doc(
+                The tolerance on the residual.
+
+                :type: float
+            )doc"
+        )
+
+        .def(
+            "evaluate",
+            &DifferentialCorrector::Constraint::evaluate,
+            arg("initial_state"),
+            arg("final_state"),
+            R"doc(
+                Evaluate the residual.
+
+                Args:
+                    initial_state (State): The initial state of the sequence.
+                    final_state (State): The final state of the sequence.
+
+                Returns:
+                    float: The residual.
+
+            )doc"
+        )
+
+        ;
+
+    class_<DifferentialCorrector::Solution>(
+        differentialCorrector,
+        "Solution",
+        R"doc(
+            The result of a differential correction.
+
+        )doc"
+    )
+
+        .def("__str__", &(shiftToString<DifferentialCorrector::Solution>))
+        .def("__repr__", &(shiftToString<DifferentialCorrector::Solution>))
+
+        .def_readonly(
+            "has_converged",
+            &DifferentialCorrector::Solution::hasConverged,
+            R"doc(
+                True if all residuals are within their tolerances.
+
+                :type: bool
+            )doc"
+        )
+        .def_readonly(
+            "iteration_count",
+            &DifferentialCorrector::Solution::iterationCount,
+            R"doc(
+                The number of iterations.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "jacobian_evaluation_count",
+            &DifferentialCorrector::Solution::jacobianEvaluationCount,
+            R"doc(
+                The number of finite difference Jacobians computed.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "sequence_solve_count",
+            &DifferentialCorrector::Solution::sequenceSolveCount,
+            R"doc(
+                The number of solved sequences.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "control_vector",
+            &DifferentialCorrector::Solution::controlVector,
+            R"doc(
+                The final control values.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "residuals",
+            &DifferentialCorrector::Solution::residuals,
+            R"doc(
+                The final constraint residuals.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "initial_state",
+            &DifferentialCorrector::Solution::initialState,
+            R"doc(
+                The initial state of the final sequence.
+
+                :type: State
+            )doc"
+        )
+        .def_readonly(
+            "sequence_solution",
+            &DifferentialCorrector::Solution::sequenceSolution,
+            R"doc(
+                The solution of the final sequence.
+
+                :type: Sequence.Solution
+            )doc"
+        )
+
+        ;
+
+    differentialCorrector
+
+        .def(
+            init<const DifferentialCorrector::Method&, const Size&, const Size&>(),
+            arg("method") = DifferentialCorrector::Method::Broyden,
+            arg("maximum_iteration_count") = 20,
+            arg("thread_count") = 0,
+            R"doc(
+                Constructor.
+
+                Args:
+                    method (DifferentialCorrector.Method, optional): The Jacobian update method. Defaults to Broyden.
+                    maximum_iteration_count (int, optional): The maximum number of iterations. Defaults to 20.
+                    thread_count (int, optional): The number of threads solving the perturbed sequences, zero
+                        meaning the hardware concurrency. Defaults to 0.
+
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<DifferentialCorrector>))
+        .def("__repr__", &(shiftToString<DifferentialCorrector>))
+
+        .def(
+            "get_method",
+            &DifferentialCorrector::getMethod,
+            R"doc(
+                Get the Jacobian update method.
+
+                Returns:
+                    DifferentialCorrector.Method: The Jacobian update method.
+
+            )doc"
+        )
+        .def(
+            "get_maximum_iteration_count",
+            &DifferentialCorrector::getMaximumIterationCount,
+            R"doc(
+                Get the maximum number of iterations.
+
+                Returns:
+                    int: The maximum number of iterations.
+
+            )doc"
+        )
+        .def(
+            "get_thread_count",
+            &DifferentialCorrector::getThreadCount,
+            R"doc(
+                Get the number of threads.
+
+                Returns:
+                    int: The number of threads.
+
+            )doc"
+        )
+
+        .def(
+            "solve",
+            &DifferentialCorrector::solve,
+            arg("initial_state"),
+            arg("sequence_generator"),
+            arg("control_variables"),
+            arg("constraints"),
+            call_guard<gil_scoped_release>(),  // The sequence generator acquires the GIL from the worker threads
+            R"doc(
+                Target the constraints.
+
+                Args:
+                    initial_state (State): The initial state.
+                    sequence_generator (callable[[np.ndarray], Sequence]): Generates the sequence to solve for a
+                        control vector. Called once per solve, possibly from several threads.
+                    control_variables (list[DifferentialCorrector.ControlVariable]): The control variables.
+                    constraints (list[DifferentialCorrector.Constraint]): The constraints.
+
+                Returns:
+                    DifferentialCorrector.Solution: The solution.
+
+            )doc"
+        )
+
+        .def_static(
+            "string_from_method",
+            &DifferentialCorrector::StringFromMethod,
+            arg("method"),
+            R"doc(
+                Get the string representation of a method.
+
+                Args:
+                    method (DifferentialCorrector.Method): The method.
+
+                Returns:
+                    str: The string representation.
+
+            )doc"
+        )
+
+        ;
+}
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <pybind11/functional.h>  // To pass anonymous functions directly
+
 #include <OpenSpaceToolkit/Astrodynamics/Solvers/FiniteDifferenceSolver.hpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybind11::module& aModule)
@@ -11,6 +13,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
 
     using ostk::math::object::VectorXd;
     using ostk::math::object::MatrixXd;
+    using Eigen::VectorXcd;
+    using Eigen::MatrixXcd;
 
     using ostk::physics::time::Instant;
     using ostk::physics::time::Duration;
@@ -44,7 +48,11 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
     finiteDifferenceSolver
 
         .def(
-            init<const ostk::astro::solvers::FiniteDifferenceSolver::Type&, const Real&, const Duration&>(),
+            init<
+                const ostk::astro::solvers::FiniteDifferenceSolver::Type&,
+                const Real&,
+                const Duration&,
+                const Size&>(),
             R"doc(
                 Construct a FiniteDifferenceSolver.
 
@@ -52,13 +60,16 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
                     type (FiniteDifferenceSolver.Type): Type of finite difference scheme.
                     step_percentage (float): The step percentage to use for computing the STM.
                     step_duration (Duration): The step duration to use for computing the gradient.
+                    thread_count (int, optional): The number of threads computing the Jacobian columns, zero meaning
+                        the hardware concurrency. Defaults to 1.
 
                 Returns:
                     FiniteDifferenceSolver: The FiniteDifferenceSolver.
             )doc",
             arg("type"),
             arg("step_percentage"),
-            arg("step_duration")
+            arg("step_duration"),
+            arg("thread_count") = 1
         )
 
         .def("__str__", &(shiftToString<FiniteDifferenceSolver>))
@@ -94,6 +105,16 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
                     Duration: The step duration.
             )doc"
         )
+        .def(
+            "get_thread_count",
+            &FiniteDifferenceSolver::getThreadCount,
+            R"doc(
+                Get the number of threads computing the Jacobian columns.
+
+                Returns:
+                    int: The number of threads, zero meaning the hardware concurrency.
+            )doc"
+        )
 
         .def(
             "compute_jacobian",
@@ -120,7 +141,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
             arg("state"),
             arg("instants"),
             arg("generate_states_coordinates"),
-            arg("coordinates_dimension")
+            arg("coordinates_dimension"),
+            call_guard<gil_scoped_release>()  // The generator acquires the GIL from the worker threads
         )
         .def(
             "compute_jacobian",
@@ -147,7 +169,43 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_FiniteDifferenceSolver(pybin
             arg("state"),
             arg("instant"),
             arg("generate_state_coordinates"),
-            arg("coordinates_dimension")
+            arg("coordinates_dimension"),
+            call_guard<gil_scoped_release>()  // The generator acquires the GIL from the worker threads
+        )
+        .def(
+            "compute_complex_step_jacobian",
+            +[](const ostk::astro::solvers::FiniteDifferenceSolver& solver,
+                const State& aState,
+                const Array<Instant>& anInstantArray,
+                const std::function<MatrixXcd(const VectorXcd&, const Array<Instant>&)>& generateStateCoordinates,
+                const Size& aCoordinatesDimension) -> MatrixXd
+            {
+                return solver.computeComplexStepJacobian(
+                    aState, anInstantArray, generateStateCoordinates, aCoordinatesDimension
+                );
+            },
+            R"doc(
+                Compute the jacobian by complex-step differentiation.
+
+                Accurate to machine precision without step tuning, for generators written with complex-safe
+                operations.
+
+                Args:
+                    state (State): The state.
+                    instants (Array(Instant)): The instants at which to calculate the STM.
+                    generate_states_coordinates (function): The function to get the states coordinates, from the
+                        complex coordinates of the state and the instants.
+                    coordinates_dimension (int): The dimension of the coordinates produced by
+                        `generate_states_coordinates`.
+
+                Returns:
+                    np.array: The jacobian.
+            )doc",
+            arg("state"),
+            arg("instants"),
+            arg("generate_states_coordinates"),
+            arg("coordinates_dimension"),
+            call_guard<gil_scoped_release>()  // The generator acquires the GIL from the worker threads
         )
         .def(
             "compute_gradient",
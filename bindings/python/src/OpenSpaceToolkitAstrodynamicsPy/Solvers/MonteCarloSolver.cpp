@@ -0,0 +1,604 @@
+/// Apache License 2.0
+
+#include <pybind11/functional.h>  // To pass anonymous functions directly
+
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/MonteCarloSolver.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_MonteCarloSolver(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::ctnr::Array;
+    using ostk::core::types::Real;
+    using ostk::core::types::Shared;
+    using ostk::core::types::Size;
+
+    using ostk::math::object::MatrixXd;
+    using ostk::math::object::VectorXd;
+
+    using ostk::physics::coord::Frame;
+
+    using ostk::astro::flight::system::SatelliteSystem;
+    using ostk::astro::solvers::MonteCarloSolver;
+    using ostk::astro::trajectory::State;
+    using ostk::astro::trajectory::state::CoordinatesSubset;
+
+    class_<MonteCarloSolver> monteCarloSolver(
+        aModule,
+        "MonteCarloSolver",
+        R"doc(
+            A Monte Carlo dispersion solver for sequences.
+
+            Each sample disperses a nominal state and a nominal satellite system, generates a sequence for the
+            dispersed satellite system, and solves it from the dispersed state. Samples draw from their own random
+            streams, and are aggregated in sample order: results do not depend on the thread count.
+
+        )doc"
+    );
+
+    enum_<MonteCarloSolver::Distribution>(
+        monteCarloSolver,
+        "Distribution",
+        R"doc(
+            Distribution of a dispersion.
+
+        )doc"
+    )
+        .value("Normal", MonteCarloSolver::Distribution::Normal, "Standard normal distribution, scaled.")
+        .value("Uniform", MonteCarloSolver::Distribution::Uniform, "Uniform distribution over [-1, 1], scaled.")
+
+        ;
+
+    class_<MonteCarloSolver::StateDispersion>(
+        monteCarloSolver,
+        "StateDispersion",
+        R"doc(
+            Dispersion of the coordinates of a subset of the state, added to the nominal coordinates.
+
+        )doc"
+    )
+
+        .def(
+            init<const Shared<const CoordinatesSubset>&, const MonteCarloSolver::Distribution&, const MatrixXd&>(),
+            arg("coordinates_subset"),
+            arg("distribution"),
+            arg("scale_matrix"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    coordinates_subset (CoordinatesSubset): A coordinates subset of the nominal state.
+                    distribution (MonteCarloSolver.Distribution): The distribution of the draws.
+                    scale_matrix (np.ndarray): A square scale matrix, of the size of the subset.
+
+            )doc"
+        )
+
+        .def_readonly(
+            "coordinates_subset",
+            &MonteCarloSolver::StateDispersion::coordinatesSubset,
+            R"doc(
+                The dispersed coordinates subset.
+
+                :type: CoordinatesSubset
+            )doc"
+        )
+        .def_readonly(
+            "distribution",
+            &MonteCarloSolver::StateDispersion::distribution,
+            R"doc(
+                The distribution of the draws.
+
+                :type: MonteCarloSolver.Distribution
+            )doc"
+        )
+        .def_readonly(
+            "scale_matrix",
+            &MonteCarloSolver::StateDispersion::scaleMatrix,
+            R"doc(
+                The scale matrix applied to the draws.
+
+                :type: np.ndarray
+            )doc"
+        )
+
+        .def_static(
+            "normal",
+            &MonteCarloSolver::StateDispersion::Normal,
+            arg("coordinates_subset"),
+            arg("standard_deviation"),
+            R"doc(
+                Construct an uncorrelated normal dispersion.
+
+                Args:
+                    coordinates_subset (CoordinatesSubset): A coordinates subset of the nominal state.
+                    standard_deviation (np.ndarray): The standard deviation of each coordinate.
+
+                Returns:
+                    MonteCarloSolver.StateDispersion: The state dispersion.
+
+            )doc"
+        )
+        .def_static(
+            "covariance",
+            &MonteCarloSolver::StateDispersion::Covariance,
+            arg("coordinates_subset"),
+            arg("covariance"),
+            R"doc(
+                Construct a correlated normal dispersion, scaled by the Cholesky factor of a covariance.
+
+                Args:
+                    coordinates_subset (CoordinatesSubset): A coordinates subset of the nominal state.
+                    covariance (np.ndarray): A symmetric positive definite covariance matrix.
+
+                Returns:
+                    MonteCarloSolver.StateDispersion: The state dispersion.
+
+            )doc"
+        )
+        .def_static(
+            "uniform",
+            &MonteCarloSolver::StateDispersion::Uniform,
+            arg("coordinates_subset"),
+            arg("half_width"),
+            R"doc(
+                Construct an uncorrelated uniform dispersion.
+
+                Args:
+                    coordinates_subset (CoordinatesSubset): A coordinates subset of the nominal state.
+                    half_width (np.ndarray): The half width of the interval of each coordinate.
+
+                Returns:
+                    MonteCarloSolver.StateDispersion: The state dispersion.
+
+            )doc"
+        )
+
+        ;
+
+    class_<MonteCarloSolver::SatelliteSystemDispersion> satelliteSystemDispersion(
+        monteCarloSolver,
+        "SatelliteSystemDispersion",
+        R"doc(
+            Dispersion of a parameter of the satellite system, added to its nominal value.
+
+        )doc"
+    );
+
+    enum_<MonteCarloSolver::SatelliteSystemDispersion::Parameter>(
+        satelliteSystemDispersion,
+        "Parameter",
+        R"doc(
+            Dispersed parameter.
+
+        )doc"
+    )
+        .value("DryMass", MonteCarloSolver::SatelliteSystemDispersion::Parameter::DryMass, "Dry mass [kg].")
+        .value(
+            "CrossSectionalSurfaceArea",
+            MonteCarloSolver::SatelliteSystemDispersion::Parameter::CrossSectionalSurfaceArea,
+            "Cross-sectional surface area [m^2]."
+        )
+        .value(
+            "DragCoefficient",
+            MonteCarloSolver::SatelliteSystemDispersion::Parameter::DragCoefficient,
+            "Drag coefficient [-]."
+        )
+        .value("Thrust", MonteCarloSolver::SatelliteSystemDispersion::Parameter::Thrust, "Thrust [N].")
+        .value(
+            "SpecificImpulse",
+            MonteCarloSolver::SatelliteSystemDispersion::Parameter::SpecificImpulse,
+            "Specific impulse [s]."
+        )
+
+        ;
+
+    satelliteSystemDispersion
+
+        .def(
+            init<
+                const MonteCarloSolver::SatelliteSystemDispersion::Parameter&,
+                const MonteCarloSolver::Distribution&,
+                const Real&>(),
+            arg("parameter"),
+            arg("distribution"),
+            arg("scale"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    parameter (MonteCarloSolver.SatelliteSystemDispersion.Parameter): The dispersed parameter.
+                    distribution (MonteCarloSolver.Distribution): The distribution of the draw.
+                    scale (float): A positive scale applied to the draw, in the unit of the parameter.
+
+            )doc"
+        )
+
+        .def_readonly(
+            "parameter",
+            &MonteCarloSolver::SatelliteSystemDispersion::parameter,
+            R"doc(
+                The dispersed parameter.
+
+                :type: MonteCarloSolver.SatelliteSystemDispersion.Parameter
+            )doc"
+        )
+        .def_readonly(
+            "distribution",
+            &MonteCarloSolver::SatelliteSystemDispersion::distribution,
+            R"doc(
+                The distribution of the draw.
+
+                :type: MonteCarloSolver.Distribution
+            )doc"
+        )
+        .def_readonly(
+            "scale",
+            &MonteCarloSolver::SatelliteSystemDispersion::scale,
+            R"doc(
+                The scale applied to the draw.
+
+                :type: float
+            )doc"
+        )
+
+        .def_static(
+            "normal",
+            &MonteCarloSolver::SatelliteSystemDispersion::Normal,
+            arg("parameter"),
+            arg("standard_deviation"),
+            R"doc(
+                Construct a normal dispersion.
+
+                Args:
+                    parameter (MonteCarloSolver.SatelliteSystemDispersion.Parameter): The dispersed parameter.
+                    standard_deviation (float): The standard deviation.
+
+                Returns:
+                    MonteCarloSolver.SatelliteSystemDispersion: The satellite system dispersion.
+
+            )doc"
+        )
+        .def_static(
+            "uniform",
+            &MonteCarloSolver::SatelliteSystemDispersion::Uniform,
+            arg("parameter"),
+            arg("half_width"),
+            R"doc(
+                Construct a uniform dispersion.
+
+                Args:
+                    parameter (MonteCarloSolver.SatelliteSystemDispersion.Parameter): The dispersed parameter.
+                    half_width (float): The half width of the interval, around the nominal value.
+
+                Returns:
+                    MonteCarloSolver.SatelliteSystemDispersion: The satellite system dispersion.
+
+            )doc"
+        )
+        .def_static(
+            "string_from_parameter",
+            &MonteCarloSolver::SatelliteSystemDispersion::StringFromParameter,
+            arg("parameter"),
+            R"doc(
+                Get the string representation of a parameter.
+
+                Args:
+                    parameter (MonteCarloSolver.SatelliteSystemDispersion.Parameter): The parameter.
+
+                Returns:
+                    str: The string representation.
+
+            )doc"
+        )
+
+        ;
+
+    class_<MonteCarloSolver::Sample>(
+        monteCarloSolver,
+        "Sample",
+        R"doc(
+            The dispersed inputs of a sample.
+
+        )doc"
+    )
+
+        .def_readonly(
+            "index",
+            &MonteCarloSolver::Sample::index,
+            R"doc(
+                The index of the sample.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "state",
+            &MonteCarloSolver::Sample::state,
+            R"doc(
+                The dispersed initial state.
+
+                :type: State
+            )doc"
+        )
+        .def_readonly(
+            "satellite_system",
+            &MonteCarloSolver::Sample::satelliteSystem,
+            R"doc(
+                The dispersed satellite system.
+
+                :type: SatelliteSystem
+            )doc"
+        )
+
+        ;
+
+    class_<MonteCarloSolver::Statistics>(
+        monteCarloSolver,
+        "Statistics",
+        R"doc(
+            The statistics of a quantity over the samples.
+
+        )doc"
+    )
+
+        .def_readonly(
+            "mean",
+            &MonteCarloSolver::Statistics::mean,
+            R"doc(
+                The mean of each component.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "covariance",
+            &MonteCarloSolver::Statistics::covariance,
+            R"doc(
+                The sample covariance of the components.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "percentiles",
+            &MonteCarloSolver::Statistics::percentiles,
+            R"doc(
+                The percentile estimates, one row per percentile and one column per component.
+
+                :type: np.ndarray
+            )doc"
+        )
+
+        ;
+
+    class_<MonteCarloSolver::Solution>(
+        monteCarloSolver,
+        "Solution",
+        R"doc(
+            The aggregated results of the samples.
+
+        )doc"
+    )
+
+        .def("__str__", &(shiftToString<MonteCarloSolver::Solution>))
+        .def("__repr__", &(shiftToString<MonteCarloSolver::Solution>))
+
+        .def_readonly(
+            "sample_count",
+            &MonteCarloSolver::Solution::sampleCount,
+            R"doc(
+                The number of solved samples.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "complete_sample_count",
+            &MonteCarloSolver::Solution::completeSampleCount,
+            R"doc(
+                The number of samples whose sequence executed completely, aggregated in the statistics.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "incomplete_sample_count",
+            &MonteCarloSolver::Solution::incompleteSampleCount,
+            R"doc(
+                The number of samples whose sequence did not execute completely.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "failed_sample_count",
+            &MonteCarloSolver::Solution::failedSampleCount,
+            R"doc(
+                The number of samples whose generation or solve raised.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "percentiles",
+            &MonteCarloSolver::Solution::percentiles,
+            R"doc(
+                The estimated percentiles, in percent.
+
+                :type: list[float]
+            )doc"
+        )
+        .def_readonly(
+            "frame",
+            &MonteCarloSolver::Solution::frame,
+            R"doc(
+                The frame of the final coordinates.
+
+                :type: Frame
+            )doc"
+        )
+        .def_readonly(
+            "final_coordinates",
+            &MonteCarloSolver::Solution::finalCoordinates,
+            R"doc(
+                The statistics of the final state coordinates.
+
+                :type: MonteCarloSolver.Statistics
+            )doc"
+        )
+        .def_readonly(
+            "delta_v",
+            &MonteCarloSolver::Solution::deltaV,
+            R"doc(
+                The statistics of the delta-v [m/s].
+
+                :type: MonteCarloSolver.Statistics
+            )doc"
+        )
+        .def_readonly(
+            "propagation_duration",
+            &MonteCarloSolver::Solution::propagationDuration,
+            R"doc(
+                The statistics of the propagation duration [s].
+
+                :type: MonteCarloSolver.Statistics
+            )doc"
+        )
+
+        ;
+
+    monteCarloSolver
+
+        .def(
+            init<
+                const State&,
+                const SatelliteSystem&,
+                const MonteCarloSolver::SequenceGenerator&,
+                const Array<MonteCarloSolver::StateDispersion>&,
+                const Array<MonteCarloSolver::SatelliteSystemDispersion>&,
+                const Size&>(),
+            arg("nominal_state"),
+            arg("nominal_satellite_system"),
+            arg("sequence_generator"),
+            arg("state_dispersions") = Array<MonteCarloSolver::StateDispersion>::Empty(),
+            arg("satellite_system_dispersions") = Array<MonteCarloSolver::SatelliteSystemDispersion>::Empty(),
+            arg("seed") = 0,
+            R"doc(
+                Constructor.
+
+                Args:
+                    nominal_state (State): The nominal initial state.
+                    nominal_satellite_system (SatelliteSystem): The nominal satellite system.
+                    sequence_generator (callable[[SatelliteSystem], Sequence]): Generates the sequence of a sample
+                        from its dispersed satellite system. Called once per sample, possibly from several threads.
+                    state_dispersions (list[MonteCarloSolver.StateDispersion], optional): The state dispersions.
+                        Defaults to none.
+                    satellite_system_dispersions (list[MonteCarloSolver.SatelliteSystemDispersion], optional): The
+                        satellite system dispersions. Defaults to none.
+                    seed (int, optional): The seed of the random streams. Defaults to 0.
+
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<MonteCarloSolver>))
+        .def("__repr__", &(shiftToString<MonteCarloSolver>))
+
+        .def(
+            "get_nominal_state",
+            &MonteCarloSolver::getNominalState,
+            R"doc(
+                Get the nominal state.
+
+                Returns:
+                    State: The nominal state.
+
+            )doc"
+        )
+        .def(
+            "get_nominal_satellite_system",
+            &MonteCarloSolver::getNominalSatelliteSystem,
+            R"doc(
+                Get the nominal satellite system.
+
+                Returns:
+                    SatelliteSystem: The nominal satellite system.
+
+            )doc"
+        )
+        .def(
+            "get_state_dispersions",
+            &MonteCarloSolver::getStateDispersions,
+            R"doc(
+                Get the state dispersions.
+
+                Returns:
+                    list[MonteCarloSolver.StateDispersion]: The state dispersions.
+
+            )doc"
+        )
+        .def(
+            "get_satellite_system_dispersions",
+            &MonteCarloSolver::getSatelliteSystemDispersions,
+            R"doc(
+                Get the satellite system dispersions.
+
+                Returns:
+                    list[MonteCarloSolver.SatelliteSystemDispersion]: The satellite system dispersions.
+
+            )doc"
+        )
+        .def(
+            "get_seed",
+            &MonteCarloSolver::getSeed,
+            R"doc(
+                Get the seed.
+
+                Returns:
+                    int: The seed.
+
+            )doc"
+        )
+
+        .def(
+            "generate_sample",
+            &MonteCarloSolver::generateSample,
+            arg("index"),
+            R"doc(
+                Generate the dispersed inputs of a sample.
+
+                Args:
+                    index (int): The sample index.
+
+                Returns:
+                    MonteCarloSolver.Sample: The sample.
+
+            )doc"
+        )
+        .def(
+            "solve",
+            &MonteCarloSolver::solve,
+            arg("sample_count"),
+            arg("thread_count") = 0,
+            arg("percentiles") = Array<Real>({5.0, 50.0, 95.0}),
+            arg("frame") = Frame::GCRF(),
+            call_guard<gil_scoped_release>(),  // The sequence generator acquires the GIL from the worker threads
+            R"doc(
+                Solve samples, and aggregate their results.
+
+                Args:
+                    sample_count (int): The number of samples, indexed from zero.
+                    thread_count (int, optional): The number of threads, zero meaning the hardware concurrency.
+                        Defaults to 0.
+                    percentiles (list[float], optional): The percentiles to estimate, in percent. Defaults to 5, 50
+                        and 95.
+                    frame (Frame, optional): The frame of the final coordinates. Defaults to GCRF.
+
+                Returns:
+                    MonteCarloSolver.Solution: The solution.
+
+            )doc"
+        )
+
+        ;
+}
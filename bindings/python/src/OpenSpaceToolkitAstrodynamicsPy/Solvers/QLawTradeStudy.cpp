@@ -0,0 +1,382 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/QLawTradeStudy.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Solvers_QLawTradeStudy(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::ctnr::Array;
+    using ostk::core::types::Shared;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::units::Derived;
+
+    using ostk::astro::Dynamics;
+    using ostk::astro::flight::system::SatelliteSystem;
+    using ostk::astro::guidancelaw::QLaw;
+    using ostk::astro::solvers::QLawTradeStudy;
+    using ostk::astro::trajectory::State;
+    using ostk::astro::trajectory::orbit::models::kepler::COE;
+    using ostk::astro::trajectory::state::NumericalSolver;
+
+    class_<QLawTradeStudy> qlawTradeStudy(
+        aModule,
+        "QLawTradeStudy",
+        R"doc(
+            A trade study of QLaw transfers.
+
+            Each case is a QLaw transfer from a shared initial state, with a shared satellite system, towards a target
+            orbit with a set of QLaw parameters. A transfer thrusts along the QLaw direction until the targeted
+            elements have converged, or the maximum time of flight is reached. Cases are solved on a pool of threads,
+            sharing the environment dynamics.
+
+        )doc"
+    );
+
+    enum_<QLawTradeStudy::Status>(
+        qlawTradeStudy,
+        "Status",
+        R"doc(
+            Outcome of a transfer.
+
+        )doc"
+    )
+        .value("Converged", QLawTradeStudy::Status::Converged, "The targeted elements have converged.")
+        .value(
+            "NotConverged",
+            QLawTradeStudy::Status::NotConverged,
+            "The maximum time of flight was reached before convergence."
+        )
+        .value("Failed", QLawTradeStudy::Status::Failed, "The transfer raised.")
+
+        ;
+
+    class_<QLawTradeStudy::Case>(
+        qlawTradeStudy,
+        "Case",
+        R"doc(
+            A transfer of the study.
+
+        )doc"
+    )
+
+        .def(
+            init(
+                [](const COE& aTargetCOE, const QLaw::Parameters& aParameters)
+                {
+                    return QLawTradeStudy::Case {aTargetCOE, aParameters};
+                }
+            ),
+            arg("target_coe"),
+            arg("parameters"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    target_coe (COE): The target orbit.
+                    parameters (QLaw.Parameters): The QLaw parameters.
+
+            )doc"
+        )
+
+        .def_readonly(
+            "target_coe",
+            &QLawTradeStudy::Case::targetCOE,
+            R"doc(
+                The target orbit.
+
+                :type: COE
+            )doc"
+        )
+        .def_readonly(
+            "parameters",
+            &QLawTradeStudy::Case::parameters,
+            R"doc(
+                The QLaw parameters.
+
+                :type: QLaw.Parameters
+            )doc"
+        )
+
+        ;
+
+    class_<QLawTradeStudy::Result>(
+        qlawTradeStudy,
+        "Result",
+        R"doc(
+            The summary metrics of a transfer.
+
+        )doc"
+    )
+
+        .def("__str__", &(shiftToString<QLawTradeStudy::Result>))
+        .def("__repr__", &(shiftToString<QLawTradeStudy::Result>))
+
+        .def_readonly(
+            "index",
+            &QLawTradeStudy::Result::index,
+            R"doc(
+                The index of the case.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "status",
+            &QLawTradeStudy::Result::status,
+            R"doc(
+                The outcome of the transfer.
+
+                :type: QLawTradeStudy.Status
+            )doc"
+        )
+        .def_readonly(
+            "time_of_flight",
+            &QLawTradeStudy::Result::timeOfFlight,
+            R"doc(
+                The time of flight, undefined if failed.
+
+                :type: Duration
+            )doc"
+        )
+        .def_readonly(
+            "delta_v",
+            &QLawTradeStudy::Result::deltaV,
+            R"doc(
+                The delta-v [m/s], undefined if failed.
+
+                :type: Real
+            )doc"
+        )
+        .def_readonly(
+            "propellant_mass",
+            &QLawTradeStudy::Result::propellantMass,
+            R"doc(
+                The propellant mass, undefined if failed.
+
+                :type: Mass
+            )doc"
+        )
+        .def_readonly(
+            "final_elements_error",
+            &QLawTradeStudy::Result::finalElementsError,
+            R"doc(
+                The final errors of the semi-major axis, eccentricity, inclination, RAAN and AOP, NaN if failed.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "trajectory",
+            &QLawTradeStudy::Result::trajectory,
+            R"doc(
+                The decimated trajectory, empty if not requested or failed.
+
+                :type: list[State]
+            )doc"
+        )
+
+        ;
+
+    qlawTradeStudy
+
+        .def(
+            init<
+                const State&,
+                const SatelliteSystem&,
+                const Array<Shared<Dynamics>>&,
+                const NumericalSolver&,
+                const Derived&,
+                const Duration&,
+                const QLaw::GradientStrategy&>(),
+            arg("initial_state"),
+            arg("satellite_system"),
+            arg("environment_dynamics"),
+            arg("numerical_solver"),
+            arg("gravitational_parameter"),
+            arg("maximum_time_of_flight"),
+            arg("gradient_strategy") = QLaw::GradientStrategy::Analytical,
+            R"doc(
+                Constructor.
+
+                Args:
+                    initial_state (State): The initial state, with position, velocity and mass coordinates.
+                    satellite_system (SatelliteSystem): The satellite system, with a propulsion system.
+                    environment_dynamics (list[Dynamics]): The dynamics other than the thruster, shared by the
+                        concurrent transfers.
+                    numerical_solver (NumericalSolver): The numerical solver.
+                    gravitational_parameter (Derived): The gravitational parameter of the central body.
+                    maximum_time_of_flight (Duration): The maximum time of flight of a transfer.
+                    gradient_strategy (QLaw.GradientStrategy, optional): The QLaw gradient strategy. Defaults to
+                        Analytical.
+
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<QLawTradeStudy>))
+        .def("__repr__", &(shiftToString<QLawTradeStudy>))
+
+        .def(
+            "get_initial_state",
+            &QLawTradeStudy::getInitialState,
+            R"doc(
+                Get the initial state.
+
+                Returns:
+                    State: The initial state.
+
+            )doc"
+        )
+        .def(
+            "get_satellite_system",
+            &QLawTradeStudy::getSatelliteSystem,
+            R"doc(
+                Get the satellite system.
+
+                Returns:
+                    SatelliteSystem: The satellite system.
+
+            )doc"
+        )
+        .def(
+            "get_environment_dynamics",
+            &QLawTradeStudy::getEnvironmentDynamics,
+            R"doc(
+                Get the environment dynamics.
+
+                Returns:
+                    list[Dynamics]: The environment dynamics.
+
+            )doc"
+        )
+        .def(
+            "get_numerical_solver",
+            &QLawTradeStudy::getNumericalSolver,
+            R"doc(
+                Get the numerical solver.
+
+                Returns:
+                    NumericalSolver: The numerical solver.
+
+            )doc"
+        )
+        .def(
+            "get_maximum_time_of_flight",
+            &QLawTradeStudy::getMaximumTimeOfFlight,
+            R"doc(
+                Get the maximum time of flight.
+
+                Returns:
+                    Duration: The maximum time of flight.
+
+            )doc"
+        )
+        .def(
+            "get_gradient_strategy",
+            &QLawTradeStudy::getGradientStrategy,
+            R"doc(
+                Get the QLaw gradient strategy.
+
+                Returns:
+                    QLaw.GradientStrategy: The QLaw gradient strategy.
+
+            )doc"
+        )
+
+        .def(
+            "solve_case",
+            &QLawTradeStudy::solveCase,
+            arg("case"),
+            arg("index") = 0,
+            arg("trajectory_stride") = 0,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Solve a transfer.
+
+                Args:
+                    case (QLawTradeStudy.Case): The case.
+                    index (int, optional): The index of the case. Defaults to 0.
+                    trajectory_stride (int, optional): Keep one state every stride states, and the final state.
+                        Defaults to 0, keeping no trajectory.
+
+                Returns:
+                    QLawTradeStudy.Result: The result.
+
+            )doc"
+        )
+        .def(
+            "solve",
+            &QLawTradeStudy::solve,
+            arg("cases"),
+            arg("thread_count") = 0,
+            arg("trajectory_stride") = 0,
+            call_guard<gil_scoped_release>(),  // Python dynamics acquire the GIL from the worker threads
+            R"doc(
+                Solve transfers in parallel. Failed transfers are reported with the Failed status.
+
+                Args:
+                    cases (list[QLawTradeStudy.Case]): The cases.
+                    thread_count (int, optional): The number of threads, zero meaning the hardware concurrency.
+                        Defaults to 0.
+                    trajectory_stride (int, optional): Keep one state every stride states, and the final state.
+                        Defaults to 0, keeping no trajectory.
+
+                Returns:
+                    list[QLawTradeStudy.Result]: The results, in the order of the cases.
+
+            )doc"
+        )
+
+        .def_static(
+            "parameter_cases",
+            &QLawTradeStudy::ParameterCases,
+            arg("target_coe"),
+            arg("parameters"),
+            R"doc(
+                Construct cases sweeping QLaw parameters, towards a single target orbit.
+
+                Args:
+                    target_coe (COE): The target orbit.
+                    parameters (list[QLaw.Parameters]): The QLaw parameters.
+
+                Returns:
+                    list[QLawTradeStudy.Case]: The cases, one per parameters.
+
+            )doc"
+        )
+        .def_static(
+            "target_cases",
+            &QLawTradeStudy::TargetCases,
+            arg("target_coes"),
+            arg("parameters"),
+            R"doc(
+                Construct cases sweeping target orbits, with a single set of QLaw parameters.
+
+                Args:
+                    target_coes (list[COE]): The target orbits.
+                    parameters (QLaw.Parameters): The QLaw parameters.
+
+                Returns:
+                    list[QLawTradeStudy.Case]: The cases, one per target orbit.
+
+            )doc"
+        )
+        .def_static(
+            "string_from_status",
+            &QLawTradeStudy::StringFromStatus,
+            arg("status"),
+            R"doc(
+                Get the string representation of a status.
+
+                Args:
+                    status (QLawTradeStudy.Status): The status.
+
+                Returns:
+                    str: The string representation.
+
+            )doc"
+        )
+
+        ;
+}
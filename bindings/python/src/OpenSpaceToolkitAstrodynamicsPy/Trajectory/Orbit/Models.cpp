@@ -4,6 +4,7 @@
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Models/Kepler/BrouwerLyddaneMean.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Models/Propagated.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Models/SGP4.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Models/SemiAnalytic.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Models/Tabulated.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models(pybind11::module& aModule)
@@ -17,4 +18,5 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models(pybind11::mo
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Tabulated(models);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Propagated(models);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_BrouwerLyddaneMean(models);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_SemiAnalytic(models);
 }
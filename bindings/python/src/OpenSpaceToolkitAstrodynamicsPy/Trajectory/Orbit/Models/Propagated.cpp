@@ -8,8 +8,10 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Propagated(p
 
     using ostk::core::types::Shared;
     using ostk::core::types::Integer;
+    using ostk::core::types::Size;
     using ostk::core::ctnr::Array;
 
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using ostk::astro::trajectory::State;
@@ -28,6 +30,32 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Propagated(p
             )doc"
         );
 
+        enum_<Propagated::InterpolationType>(
+            propagated_class,
+            "InterpolationType",
+            R"doc(
+                The interpolation between cached states.
+
+                Blended interpolation propagates each instant forward from the previous cached state and backward from
+                the next one, and weights both linearly. Continuity corrected interpolation propagates forward only, and
+                removes the mismatch with the next cached state linearly in time.
+
+            )doc"
+        )
+
+            .value(
+                "Blended",
+                Propagated::InterpolationType::Blended,
+                "Blend forward and backward propagations from the surrounding cached states"
+            )
+            .value(
+                "ContinuityCorrected",
+                Propagated::InterpolationType::ContinuityCorrected,
+                "Propagate forward only, and spread the mismatch with the next cached state linearly"
+            )
+
+            ;
+
         propagated_class
 
             .def(
@@ -154,6 +182,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Propagated(p
                 )doc"
             )
 
+            .def(
+                "get_ascending_node_instant_array",
+                &Propagated::getAscendingNodeInstantArray,
+                R"doc(
+                    Get the ascending node instants found so far by revolution number queries, sorted.
+
+                    Returns:
+                        list[Instant]: The ascending node instants.
+
+                )doc"
+            )
+
             .def(
                 "access_cached_state_array",
                 &Propagated::accessCachedStateArray,
@@ -191,6 +231,144 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_Propagated(p
                 )doc"
             )
 
+            .def(
+                "is_checkpointing_enabled",
+                &Propagated::isCheckpointingEnabled,
+                R"doc(
+                    Check if checkpointing is enabled.
+
+                    Returns:
+                        bool: True if checkpointing is enabled.
+
+                )doc"
+            )
+            .def(
+                "get_checkpoint_interval",
+                &Propagated::getCheckpointInterval,
+                R"doc(
+                    Get the interval between checkpoints.
+
+                    Returns:
+                        Duration: The checkpoint interval, undefined if checkpointing is disabled.
+
+                )doc"
+            )
+            .def(
+                "get_maximum_checkpoint_count",
+                &Propagated::getMaximumCheckpointCount,
+                R"doc(
+                    Get the maximum number of checkpoints.
+
+                    Returns:
+                        int: The maximum checkpoint count, zero if checkpointing is disabled.
+
+                )doc"
+            )
+            .def(
+                "get_checkpoint_state_array",
+                &Propagated::getCheckpointStateArray,
+                R"doc(
+                    Get the checkpoint states, sorted by instant.
+
+                    Returns:
+                        list[State]: The checkpoint state array.
+
+                )doc"
+            )
+            .def(
+                "enable_checkpointing",
+                &Propagated::enableCheckpointing,
+                arg("checkpoint_interval") = Duration::Undefined(),
+                arg("maximum_checkpoint_count") = 1000,
+                R"doc(
+                    Enable checkpointing.
+
+                    Queries outside of the cached state array store checkpoint states, every checkpoint interval, as
+                    propagation advances away from the cached states. Later queries propagate from the nearest
+                    checkpoint. When the maximum checkpoint count is exceeded, every other checkpoint is dropped and
+                    the checkpoint interval is doubled.
+
+                    Args:
+                        checkpoint_interval (Duration, optional): The interval between checkpoints. Defaults to the
+                            orbital period at epoch.
+                        maximum_checkpoint_count (int, optional): The maximum number of checkpoints. Defaults to 1000.
+
+                )doc"
+            )
+            .def(
+                "get_interpolation_type",
+                &Propagated::getInterpolationType,
+                R"doc(
+                    Get the interpolation type between cached states.
+
+                    Returns:
+                        Propagated.InterpolationType: The interpolation type.
+
+                )doc"
+            )
+            .def(
+                "set_interpolation_type",
+                &Propagated::setInterpolationType,
+                arg("interpolation_type"),
+                R"doc(
+                    Set the interpolation type between cached states.
+
+                    Args:
+                        interpolation_type (Propagated.InterpolationType): The interpolation type.
+
+                )doc"
+            )
+            .def(
+                "get_thread_count",
+                &Propagated::getThreadCount,
+                R"doc(
+                    Get the thread count used to propagate between cached states.
+
+                    Returns:
+                        int: The thread count, zero meaning the hardware concurrency.
+
+                )doc"
+            )
+            .def(
+                "set_thread_count",
+                &Propagated::setThreadCount,
+                arg("thread_count"),
+                R"doc(
+                    Set the thread count used to propagate between cached states.
+
+                    Propagations between cached states, i.e. each interval and each direction, run concurrently on up
+                    to this many threads, sharing the propagator. Defaults to 1.
+
+                    Args:
+                        thread_count (int): The thread count, zero meaning the hardware concurrency.
+
+                )doc"
+            )
+            .def(
+                "disable_checkpointing",
+                &Propagated::disableCheckpointing,
+                R"doc(
+                    Disable checkpointing, and clear the checkpoints.
+
+                )doc"
+            )
+
+            .def_static(
+                "string_from_interpolation_type",
+                &Propagated::StringFromInterpolationType,
+                arg("interpolation_type"),
+                R"doc(
+                    Get the string representation of an interpolation type.
+
+                    Args:
+                        interpolation_type (Propagated.InterpolationType): The interpolation type.
+
+                    Returns:
+                        str: The string representation.
+
+                )doc"
+            )
+
             ;
     }
 }
@@ -0,0 +1,240 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/SemiAnalytic.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Models_SemiAnalytic(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::ctnr::Array;
+    using ostk::core::types::Shared;
+    using ostk::core::types::Size;
+
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+    using ostk::physics::units::Length;
+
+    using ostk::astro::Dynamics;
+    using ostk::astro::trajectory::State;
+    using ostk::astro::trajectory::orbit::models::SemiAnalytic;
+
+    class_<SemiAnalytic, ostk::astro::trajectory::orbit::Model>(
+        aModule,
+        "SemiAnalytic",
+        R"doc(
+            A semi-analytic orbit model, integrating averaged equations of motion for mean elements with day-scale
+            steps.
+
+            The mean element rates are the Gauss variational equations averaged over one revolution, by quadrature, of
+            the zonal harmonics (J2 and J4) of the central body and of any perturbing dynamics (e.g. atmospheric drag,
+            third body gravity). Mean elements are interpolated between steps, and short-period variations due to J2
+            are recovered with the Brouwer-Lyddane theory, defined for the Earth only. Suited to multi-year lifetime
+            studies.
+
+        )doc"
+    )
+
+        .def(
+            init<
+                const State&,
+                const Shared<const Celestial>&,
+                const Array<Shared<Dynamics>>&,
+                const Duration&,
+                const Size&,
+                const bool&>(),
+            arg("state"),
+            arg("celestial"),
+            arg("perturbations") = Array<Shared<Dynamics>>::Empty(),
+            arg("step_duration") = Duration::Days(1.0),
+            arg("quadrature_point_count") = 16,
+            arg("is_short_period_recovery_enabled") = true,
+            R"doc(
+                Constructor.
+
+                Args:
+                    state (State): The osculating initial state, holding the coordinates read by the perturbations.
+                    celestial (Celestial): The central body.
+                    perturbations (list[Dynamics], optional): The perturbing dynamics, writing to the cartesian
+                        velocity only. Defaults to none.
+                    step_duration (Duration, optional): The integration step duration. Defaults to one day.
+                    quadrature_point_count (int, optional): The number of quadrature points over one revolution.
+                        Defaults to 16.
+                    is_short_period_recovery_enabled (bool, optional): If True, recover short-period variations due
+                        to J2. Only defined for the Earth, and must be disabled for other central bodies. Defaults to
+                        True.
+
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<SemiAnalytic>))
+        .def("__repr__", &(shiftToString<SemiAnalytic>))
+
+        .def(
+            "is_defined",
+            &SemiAnalytic::isDefined,
+            R"doc(
+                Check if the semi-analytic model is defined.
+
+                Returns:
+                    bool: True if the semi-analytic model is defined, False otherwise.
+
+            )doc"
+        )
+
+        .def(
+            "get_epoch",
+            &SemiAnalytic::getEpoch,
+            R"doc(
+                Get the epoch, the instant of the initial state.
+
+                Returns:
+                    Instant: The epoch.
+
+            )doc"
+        )
+        .def(
+            "get_revolution_number_at_epoch",
+            &SemiAnalytic::getRevolutionNumberAtEpoch,
+            R"doc(
+                Get the revolution number at epoch.
+
+                Returns:
+                    int: The revolution number at epoch.
+
+            )doc"
+        )
+        .def(
+            "get_state",
+            &SemiAnalytic::getState,
+            R"doc(
+                Get the initial state, in GCRF.
+
+                Returns:
+                    State: The initial state.
+
+            )doc"
+        )
+        .def(
+            "get_celestial",
+            &SemiAnalytic::getCelestial,
+            R"doc(
+                Get the central body.
+
+                Returns:
+                    Celestial: The central body.
+
+            )doc"
+        )
+        .def(
+            "get_perturbations",
+            &SemiAnalytic::getPerturbations,
+            R"doc(
+                Get the perturbing dynamics.
+
+                Returns:
+                    list[Dynamics]: The perturbing dynamics.
+
+            )doc"
+        )
+        .def(
+            "get_step_duration",
+            &SemiAnalytic::getStepDuration,
+            R"doc(
+                Get the integration step duration.
+
+                Returns:
+                    Duration: The step duration.
+
+            )doc"
+        )
+        .def(
+            "get_quadrature_point_count",
+            &SemiAnalytic::getQuadraturePointCount,
+            R"doc(
+                Get the number of quadrature points over one revolution.
+
+                Returns:
+                    int: The number of quadrature points.
+
+            )doc"
+        )
+        .def(
+            "is_short_period_recovery_enabled",
+            &SemiAnalytic::isShortPeriodRecoveryEnabled,
+            R"doc(
+                Check if short-period variations are recovered.
+
+                Returns:
+                    bool: True if short-period variations are recovered.
+
+            )doc"
+        )
+
+        .def(
+            "calculate_mean_elements_at",
+            &SemiAnalytic::calculateMeanElementsAt,
+            arg("instant"),
+            R"doc(
+                Calculate the mean elements at an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    COE: The mean elements.
+
+            )doc"
+        )
+        .def(
+            "calculate_state_at",
+            &SemiAnalytic::calculateStateAt,
+            arg("instant"),
+            R"doc(
+                Calculate the osculating state at an instant, in GCRF.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    State: The state.
+
+            )doc"
+        )
+        .def(
+            "calculate_revolution_number_at",
+            &SemiAnalytic::calculateRevolutionNumberAt,
+            arg("instant"),
+            R"doc(
+                Calculate the revolution number at an instant, counted at the mean ascending node.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    int: The revolution number.
+
+            )doc"
+        )
+        .def(
+            "calculate_decay_instant",
+            &SemiAnalytic::calculateDecayInstant,
+            arg("end_instant"),
+            arg("decay_altitude") = Length::Kilometers(100.0),
+            R"doc(
+                Calculate the instant at which the mean perigee altitude falls below a decay altitude.
+
+                Args:
+                    end_instant (Instant): The last instant of the search, after the epoch.
+                    decay_altitude (Length, optional): The decay altitude. Defaults to 100 km.
+
+                Returns:
+                    Instant: The decay instant, undefined if the orbit has not decayed by the end instant.
+
+            )doc"
+        )
+
+        ;
+}
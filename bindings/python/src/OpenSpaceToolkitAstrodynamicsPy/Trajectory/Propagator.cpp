@@ -6,6 +6,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 {
     using namespace pybind11;
 
+    using ostk::core::types::Real;
     using ostk::core::types::Shared;
     using ostk::core::ctnr::Array;
 
@@ -19,25 +20,57 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
     using ostk::astro::trajectory::Propagator;
     using ostk::astro::trajectory::State;
 
-    class_<Propagator>(
+    class_<Propagator> propagator(
         aModule,
         "Propagator",
         R"doc(
             A `Propagator` that proapgates the provided `State` using it's `NumericalSolver` under the set `Dynamics`.
 
         )doc"
+    );
+
+    enum_<Propagator::Formulation>(
+        propagator,
+        "Formulation",
+        R"doc(
+            The formulation of the equations of motion.
+
+            The Encke formulation integrates the deviation from an osculating Keplerian reference orbit of the central
+            body, which is rectified when the deviation grows.
+
+            The Kustaanheimo-Stiefel formulation integrates regularized coordinates in a fictitious time (Sundman
+            transformation), so that steps do not cluster around the perigee of highly eccentric orbits.
+
+            Both require central body gravity and position derivative dynamics.
+        )doc"
     )
 
+        .value("Cowell", Propagator::Formulation::Cowell, "Integrate the full state")
+        .value(
+            "Encke", Propagator::Formulation::Encke, "Integrate the deviation from an osculating Keplerian reference orbit"
+        )
+        .value(
+            "KustaanheimoStiefel",
+            Propagator::Formulation::KustaanheimoStiefel,
+            "Integrate the Kustaanheimo-Stiefel coordinates, in Sundman fictitious time"
+        )
+
+        ;
+
+    propagator
+
         .def(
-            init<const NumericalSolver&, const Array<Shared<Dynamics>>&>(),
+            init<const NumericalSolver&, const Array<Shared<Dynamics>>&, const Propagator::Formulation&>(),
             arg("numerical_solver"),
             arg("dynamics") = Array<Shared<Dynamics>>::Empty(),
+            arg("formulation") = Propagator::Formulation::Cowell,
             R"doc(
                 Construct a new `Propagator` object.
 
                 Args:
                     numerical_solver (NumericalSolver) The numerical solver.
                     dynamics (list[Dynamics], optional) The dynamics.
+                    formulation (Propagator.Formulation, optional) The formulation of the equations of motion. Defaults to Cowell.
 
                 Returns:
                     Propagator: The new `Propagator` object.
@@ -62,12 +95,39 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
         .def(
             "access_numerical_solver",
-            &Propagator::accessNumericalSolver,
+            &Propagator::getNumericalSolver,
             R"doc(
                 Access the numerical solver.
 
+                Returns a copy taken under the lock of the propagator, as queries may run on other threads.
+
+                Returns:
+                    NumericalSolver: The numerical solver.
+
+            )doc"
+        )
+        .def(
+            "get_numerical_solver",
+            &Propagator::getNumericalSolver,
+            R"doc(
+                Get a copy of the numerical solver, taken under its lock.
+
+                Safe to call while queries run on other threads.
+
+                Returns:
+                    NumericalSolver: The numerical solver.
+
+            )doc"
+        )
+
+        .def(
+            "get_formulation",
+            &Propagator::getFormulation,
+            R"doc(
+                Get the formulation of the equations of motion.
+
                 Returns:
-                    NumericalSolver&: The numerical solver.
+                    Propagator.Formulation: The formulation.
 
             )doc"
         )
@@ -150,6 +210,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
             arg("state"),
             arg("instant"),
             arg("event_condition"),
+            arg("initial_time_step") = Real::Undefined(),
             R"doc(
                 Calculate the state up to a given event condition.
 
@@ -157,6 +218,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
                     state (State) The state.
                     instant (Instant) The instant.
                     event_condition (EventCondition) The event condition.
+                    initial_time_step (Real, optional) The first step size [s], e.g. the next time step of a previous
+                        condition solution. Defaults to the time step of the numerical solver.
 
                 Returns:
                     State: The state up to the given event condition.
@@ -221,5 +284,19 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
                 Returns:
                     Propagator: The propagator.
             )doc"
+        )
+        .def_static(
+            "string_from_formulation",
+            &Propagator::StringFromFormulation,
+            arg("formulation"),
+            R"doc(
+                Get the string representation of a formulation.
+
+                Args:
+                    formulation (Propagator.Formulation) The formulation.
+
+                Returns:
+                    str: The string representation.
+            )doc"
         );
 }
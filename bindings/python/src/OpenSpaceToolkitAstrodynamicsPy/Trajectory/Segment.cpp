@@ -15,6 +15,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
     using ostk::astro::trajectory::state::NumericalSolver;
     using ostk::astro::trajectory::state::CoordinatesSubset;
     using ostk::astro::trajectory::Segment;
+    using ostk::astro::trajectory::State;
+    using ostk::astro::trajectory::Propagator;
     using ostk::astro::Dynamics;
 
     class_<Segment> segment(
@@ -104,6 +106,25 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                 :type: Type
             )doc"
         )
+        .def_readonly(
+            "diagnostics",
+            &Segment::Solution::diagnostics,
+            R"doc(
+                The diagnostics of the propagation, recorded if enabled on the numerical solver.
+
+                :type: NumericalSolver.Diagnostics
+            )doc"
+        )
+        .def_readonly(
+            "dense_output_is_available",
+            &Segment::Solution::denseOutputIsAvailable,
+            R"doc(
+                True if every step is recorded, without any dynamics holding values over the steps, so that states are
+                interpolated from the state derivatives.
+
+                :type: bool
+            )doc"
+        )
 
         .def(
             "access_start_instant",
@@ -189,6 +210,20 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             )doc"
         )
 
+        .def(
+            "get_state_derivatives",
+            &Segment::Solution::getStateDerivatives,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Get the time derivatives of the states, for dense output.
+
+                Computed from the segment dynamics at the first call, then cached on the solution. Empty unless the
+                dense output is available.
+
+                Returns:
+                    list[np.ndarray]: The state derivatives, in the layout of the state coordinates.
+            )doc"
+        )
         .def(
             "calculate_states_at",
             &Segment::Solution::calculateStatesAt,
@@ -197,6 +232,9 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             R"doc(
                 Calculate the states in this segment's solution at the given instants.
 
+                When the state derivatives are available, states are interpolated from them by Hermite polynomials,
+                without any integration, and the numerical solver is unused.
+
                 Args:
                     instants (list[Instant]): The instants at which the states will be calculated.
                     numerical_solver (NumericalSolver): The numerical solver used to calculate the states.
@@ -211,6 +249,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             arg("dynamics"),
             arg("frame"),
             arg("coordinates_subsets") = Array<Shared<const CoordinatesSubset>>::Empty(),
+            call_guard<gil_scoped_release>(),
             R"doc(
                 Compute the contribution of the provided dynamics in the provided frame for all states associated with the segment.
 
@@ -245,11 +284,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             "get_all_dynamics_contributions",
             &Segment::Solution::getAllDynamicsContributions,
             arg("frame"),
+            arg("thread_count") = 1,
+            call_guard<gil_scoped_release>(),  // Dynamics implemented in Python acquire the GIL from the worker threads
             R"doc(
                 Compute the contributions of all segment's dynamics in the provided frame for all states assocated with the segment.
 
+                The contributions are computed in a single pass over the states, optionally in parallel, and cached on
+                the solution per frame.
+
                 Args:
                     frame (Frame): The frame.
+                    thread_count (int, optional): The number of threads, zero meaning the hardware concurrency.
+                        Defaults to 1.
 
                 Returns:
                     dict[Dynamics, np.ndarray]: The list of matrices with individual dynamics contributions.
@@ -333,9 +379,21 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             )doc"
         )
 
+        .def(
+            "get_formulation",
+            &Segment::getFormulation,
+            R"doc(
+                Get the formulation of the equations of motion of the segment.
+
+                Returns:
+                    Propagator.Formulation: The formulation.
+
+            )doc"
+        )
+
         .def(
             "solve",
-            &Segment::solve,
+            overload_cast<const State&, const Duration&>(&Segment::solve, const_),
             arg("state"),
             arg("maximum_propagation_duration") = Duration::Days(30.0),
             R"doc(
@@ -358,6 +416,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             arg("event_condition"),
             arg("dynamics"),
             arg("numerical_solver"),
+            arg("formulation") = Propagator::Formulation::Cowell,
             R"doc(
                 Create a coast segment.
 
@@ -366,6 +425,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                     event_condition (EventCondition): The event condition.
                     dynamics (Dynamics): The dynamics.
                     numerical_solver (NumericalSolver): The numerical solver.
+                    formulation (Propagator.Formulation, optional): The formulation of the equations of motion. Defaults to Cowell.
 
                 Returns:
                     Segment: The coast segment.
@@ -380,6 +440,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             arg("thruster_dynamics"),
             arg("dynamics"),
             arg("numerical_solver"),
+            arg("formulation") = Propagator::Formulation::Cowell,
             R"doc(
                 Create a maneuver segment.
 
@@ -389,6 +450,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                     thruster_dynamics (ThrusterDynamics): The thruster dynamics.
                     dynamics (Dynamics): The dynamics.
                     numerical_solver (NumericalSolver): The numerical solver.
+                    formulation (Propagator.Formulation, optional): The formulation of the equations of motion. Defaults to Cowell.
 
                 Returns:
                     Segment: The maneuver segment.
@@ -15,6 +15,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
 
     using ostk::astro::trajectory::state::NumericalSolver;
     using ostk::astro::trajectory::Sequence;
+    using ostk::astro::trajectory::State;
     using ostk::astro::trajectory::Segment;
     using ostk::astro::Dynamics;
     using ostk::astro::flight::system::SatelliteSystem;
@@ -189,6 +190,60 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
 
         ;
 
+    class_<Sequence::SolutionCache>(
+        sequence,
+        "SolutionCache",
+        R"doc(
+            The segment solutions of a previous solve, reused when a `Sequence` is solved again after edits.
+
+            Each segment solution is keyed on its initial state and on the definition of its segment. A solve reuses the
+            cached solutions up to the first changed segment, and re-integrates from there. Event conditions and
+            dynamics are compared by identity: edit a segment by replacing them, rather than by mutating them.
+
+        )doc"
+    )
+
+        .def(
+            init<>(),
+            R"doc(
+                Construct an empty solution cache.
+
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &Sequence::SolutionCache::getSize,
+            R"doc(
+                Get the number of cached segment solutions.
+
+                Returns:
+                    int: The number of cached segment solutions.
+
+            )doc"
+        )
+        .def(
+            "get_reuse_count",
+            &Sequence::SolutionCache::getReuseCount,
+            R"doc(
+                Get the number of segment solutions reused since construction, or the last clear.
+
+                Returns:
+                    int: The number of reused segment solutions.
+
+            )doc"
+        )
+        .def(
+            "clear",
+            &Sequence::SolutionCache::clear,
+            R"doc(
+                Clear the cache.
+
+            )doc"
+        )
+
+        ;
+
     {
         sequence
 
@@ -321,7 +376,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
 
             .def(
                 "solve",
-                &Sequence::solve,
+                overload_cast<const State&, const Size&>(&Sequence::solve, const_),
                 R"doc(
                     Solve the sequence.
 
@@ -336,6 +391,27 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
                 arg("state"),
                 arg("repetition_count") = 1
             )
+            .def(
+                "solve",
+                overload_cast<const State&, Sequence::SolutionCache&, const Size&>(&Sequence::solve, const_),
+                R"doc(
+                    Solve the sequence, reusing the segment solutions of a previous solve up to the first changed
+                    segment.
+
+                    Args:
+                        state (State): The state.
+                        solution_cache (Sequence.SolutionCache): The solution cache, updated with the segment
+                            solutions of this solve.
+                        repetition_count (int, optional): The repetition count. Defaults to 1.
+
+                    Returns:
+                        SequenceSolution: The sequence solution.
+
+                )doc",
+                arg("state"),
+                arg("solution_cache"),
+                arg("repetition_count") = 1
+            )
 
             .def(
                 "solve_to_condition",
@@ -5,6 +5,8 @@
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/CoordinatesBroker.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/CoordinatesSubset.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/NumericalSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/StateSink.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/StateWriter.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& aModule)
 {
@@ -275,5 +277,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& a
 
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinatesBroker(state);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinatesSubset(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriter(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateSink(state);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(state);
 }
@@ -8,6 +8,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
 
     using ostk::core::ctnr::Array;
 
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using MathNumericalSolver = ostk::math::solvers::NumericalSolver;
@@ -33,6 +34,184 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
             )doc"
     );
 
+    enum_<NumericalSolver::MultistepType>(
+        numericalSolver,
+        "MultistepType",
+        R"doc(
+            The multistep method, used in place of the stepper type when defined.
+        )doc"
+    )
+
+        .value("Undefined", NumericalSolver::MultistepType::Undefined, "No multistep method")
+        .value(
+            "AdamsBashforthMoulton",
+            NumericalSolver::MultistepType::AdamsBashforthMoulton,
+            "Variable step, variable order Adams-Bashforth-Moulton"
+        )
+
+        ;
+
+    class_<NumericalSolver::ObservationPolicy> observationPolicy(
+        numericalSolver,
+        "ObservationPolicy",
+        R"doc(
+            The policy for recording the states observed during an integration.
+
+            The decimating policies always keep the initial state and the latest observed state, so that the recorded
+            states span the whole integration and end with the final or event state.
+
+        )doc"
+    );
+
+    enum_<NumericalSolver::ObservationPolicy::Type>(
+        observationPolicy,
+        "Type",
+        R"doc(
+            The observation policy type.
+        )doc"
+    )
+
+        .value("All", NumericalSolver::ObservationPolicy::Type::All, "Record every observed state")
+        .value("None_", NumericalSolver::ObservationPolicy::Type::None, "Record no state")
+        .value("EveryNthStep", NumericalSolver::ObservationPolicy::Type::EveryNthStep, "Record every Nth step")
+        .value(
+            "FixedSpacing",
+            NumericalSolver::ObservationPolicy::Type::FixedSpacing,
+            "Record the first step at least a given duration after the last recorded state"
+        )
+        .value("RingBuffer", NumericalSolver::ObservationPolicy::Type::RingBuffer, "Record the last N observed states")
+        .value(
+            "Boundaries",
+            NumericalSolver::ObservationPolicy::Type::Boundaries,
+            "Record the initial state, and the final or event state"
+        )
+
+        ;
+
+    observationPolicy
+
+        .def(self == self)
+
+        .def(
+            "get_type",
+            &NumericalSolver::ObservationPolicy::getType,
+            R"doc(
+                Get the type.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy.Type: The type.
+            )doc"
+        )
+        .def(
+            "get_count",
+            &NumericalSolver::ObservationPolicy::getCount,
+            R"doc(
+                Get the count, i.e. the step interval (EveryNthStep) or the capacity (RingBuffer).
+
+                Returns:
+                    int: The count.
+            )doc"
+        )
+        .def(
+            "get_spacing",
+            &NumericalSolver::ObservationPolicy::getSpacing,
+            R"doc(
+                Get the spacing (FixedSpacing).
+
+                Returns:
+                    Duration: The spacing.
+            )doc"
+        )
+
+        .def_static(
+            "all",
+            &NumericalSolver::ObservationPolicy::All,
+            R"doc(
+                Record every observed state.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc"
+        )
+        .def_static(
+            "none",
+            &NumericalSolver::ObservationPolicy::None,
+            R"doc(
+                Record no state.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc"
+        )
+        .def_static(
+            "every_nth_step",
+            &NumericalSolver::ObservationPolicy::EveryNthStep,
+            R"doc(
+                Record every Nth step.
+
+                Args:
+                    step_interval (int): The step interval, strictly positive.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc",
+            arg("step_interval")
+        )
+        .def_static(
+            "fixed_spacing",
+            &NumericalSolver::ObservationPolicy::FixedSpacing,
+            R"doc(
+                Record the first step at least a given duration after the last recorded state.
+
+                Args:
+                    spacing (Duration): The spacing, strictly positive.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc",
+            arg("spacing")
+        )
+        .def_static(
+            "ring_buffer",
+            &NumericalSolver::ObservationPolicy::RingBuffer,
+            R"doc(
+                Record the last N observed states.
+
+                Args:
+                    capacity (int): The capacity, strictly positive.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc",
+            arg("capacity")
+        )
+        .def_static(
+            "boundaries",
+            &NumericalSolver::ObservationPolicy::Boundaries,
+            R"doc(
+                Record the initial state, and the final or event state.
+
+                Returns:
+                    NumericalSolver.ObservationPolicy: The observation policy.
+            )doc"
+        )
+        .def_static(
+            "string_from_type",
+            &NumericalSolver::ObservationPolicy::StringFromType,
+            R"doc(
+                Get the string representation of a type.
+
+                Args:
+                    type (NumericalSolver.ObservationPolicy.Type): The type.
+
+                Returns:
+                    str: The string representation.
+            )doc",
+            arg("type")
+        )
+
+        ;
+
     class_<NumericalSolver::ConditionSolution>(
         numericalSolver,
         "ConditionSolution",
@@ -81,6 +260,107 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                     bool
             )doc"
         )
+        .def_readonly(
+            "next_time_step",
+            &NumericalSolver::ConditionSolution::nextTimeStep,
+            R"doc(
+                The step size proposed to continue the integration, if any.
+
+                Type:
+                    Real
+            )doc"
+        )
+
+        ;
+
+    class_<NumericalSolver::Diagnostics>(
+        numericalSolver,
+        "Diagnostics",
+        R"doc(
+            The diagnostics of the integrations, recorded when enabled.
+
+        )doc"
+    )
+        .def_readonly(
+            "system_of_equations_evaluation_count",
+            &NumericalSolver::Diagnostics::systemOfEquationsEvaluationCount,
+            R"doc(
+                The number of evaluations of the system of equations.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "accepted_step_count",
+            &NumericalSolver::Diagnostics::acceptedStepCount,
+            R"doc(
+                The number of accepted steps.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "rejected_step_count",
+            &NumericalSolver::Diagnostics::rejectedStepCount,
+            R"doc(
+                The number of rejected steps.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_property_readonly(
+            "step_size_histogram",
+            +[](const NumericalSolver::Diagnostics& aDiagnostics) -> std::map<int, std::size_t>
+            {
+                std::map<int, std::size_t> histogram;
+
+                for (const auto& bin : aDiagnostics.stepSizeHistogram)
+                {
+                    histogram[int(bin.first)] = bin.second;
+                }
+
+                return histogram;
+            },
+            R"doc(
+                The number of accepted steps per decade of step size: key k counts the step sizes in [1e{k}, 1e{k+1}).
+
+                Type:
+                    dict[int, int]
+            )doc"
+        )
+        .def_readonly(
+            "root_solver_iteration_count",
+            &NumericalSolver::Diagnostics::rootSolverIterationCount,
+            R"doc(
+                The number of root solver iterations, to locate events.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_property_readonly(
+            "dynamics_wall_times",
+            +[](const NumericalSolver::Diagnostics& aDiagnostics) -> std::map<std::string, Duration>
+            {
+                std::map<std::string, Duration> wallTimes;
+
+                for (const auto& wallTime : aDiagnostics.dynamicsWallTimes)
+                {
+                    wallTimes.insert({wallTime.first, wallTime.second});
+                }
+
+                return wallTimes;
+            },
+            R"doc(
+                The cumulative wall time spent in each dynamics, by name.
+
+                Type:
+                    dict[str, Duration]
+            )doc"
+        )
 
         ;
 
@@ -132,6 +412,37 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                 )doc"
             )
 
+            .def(
+                "is_multistep",
+                &NumericalSolver::isMultistep,
+                R"doc(
+                    Check if a multistep method is used.
+
+                    Returns:
+                        bool: True if a multistep method is used, False otherwise.
+                )doc"
+            )
+            .def(
+                "get_multistep_type",
+                &NumericalSolver::getMultistepType,
+                R"doc(
+                    Get the multistep type.
+
+                    Returns:
+                        NumericalSolver.MultistepType: The multistep type.
+                )doc"
+            )
+            .def(
+                "get_maximum_order",
+                &NumericalSolver::getMaximumOrder,
+                R"doc(
+                    Get the maximum order of the multistep method.
+
+                    Returns:
+                        int: The maximum order.
+                )doc"
+            )
+
             .def(
                 "get_observed_states",
                 &NumericalSolver::getObservedStates,
@@ -153,6 +464,90 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                 )doc"
             )
 
+            .def(
+                "get_observation_policy",
+                &NumericalSolver::getObservationPolicy,
+                R"doc(
+                    Get the observation policy.
+
+                    Returns:
+                        NumericalSolver.ObservationPolicy: The observation policy.
+                )doc"
+            )
+            .def(
+                "set_observation_policy",
+                &NumericalSolver::setObservationPolicy,
+                R"doc(
+                    Set the observation policy. The observed states of the last integration are cleared.
+
+                    Args:
+                        observation_policy (NumericalSolver.ObservationPolicy): The observation policy.
+                )doc",
+                arg("observation_policy")
+            )
+
+            .def(
+                "get_state_sink",
+                &NumericalSolver::getStateSink,
+                R"doc(
+                    Get the state sink.
+
+                    Returns:
+                        StateSink: The state sink, None if none.
+                )doc"
+            )
+            .def(
+                "set_state_sink",
+                &NumericalSolver::setStateSink,
+                R"doc(
+                    Set the state sink, to which the observed states of the following integrations are streamed,
+                    regardless of the observation policy. Copies of the numerical solver share the sink.
+
+                    Args:
+                        state_sink (StateSink): A state sink, None to stop streaming.
+                )doc",
+                arg("state_sink")
+            )
+
+            .def(
+                "is_diagnostics_enabled",
+                &NumericalSolver::isDiagnosticsEnabled,
+                R"doc(
+                    Check if diagnostics are enabled.
+
+                    Returns:
+                        bool: True if diagnostics are enabled, False otherwise.
+                )doc"
+            )
+            .def(
+                "get_diagnostics",
+                &NumericalSolver::getDiagnostics,
+                R"doc(
+                    Get the diagnostics, accumulated since the last reset.
+
+                    Returns:
+                        NumericalSolver.Diagnostics: The diagnostics.
+                )doc"
+            )
+            .def(
+                "set_diagnostics_enabled",
+                &NumericalSolver::setDiagnosticsEnabled,
+                R"doc(
+                    Enable or disable diagnostics.
+
+                    Args:
+                        is_enabled (bool): True to enable diagnostics.
+                )doc",
+                arg("is_enabled")
+            )
+            .def(
+                "reset_diagnostics",
+                &NumericalSolver::resetDiagnostics,
+                R"doc(
+                    Reset the diagnostics.
+                )doc"
+            )
+
             .def(
                 "integrate_time",
                 +[](NumericalSolver& aNumericalSolver,
@@ -319,6 +714,28 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                     Returns:
                         NumericalSolver: The conditional numerical solver.
                 )doc"
+            )
+            .def_static(
+                "adams_bashforth_moulton",
+                &NumericalSolver::AdamsBashforthMoulton,
+                R"doc(
+                    Return a variable step, variable order Adams-Bashforth-Moulton numerical solver.
+
+                    Args:
+                        time_step (float): The initial time step.
+                        relative_tolerance (float): The relative tolerance.
+                        absolute_tolerance (float): The absolute tolerance.
+                        maximum_order (int, optional): The maximum order, between 1 and 12. Defaults to 12.
+                        state_logger (StateLogger, optional): The state logger. Defaults to None.
+
+                    Returns:
+                        NumericalSolver: The Adams-Bashforth-Moulton numerical solver.
+                )doc",
+                arg("time_step"),
+                arg("relative_tolerance"),
+                arg("absolute_tolerance"),
+                arg("maximum_order") = 12,
+                arg("state_logger") = nullptr
             );
     }
 }
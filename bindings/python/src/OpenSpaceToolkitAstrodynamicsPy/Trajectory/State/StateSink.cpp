@@ -0,0 +1,169 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateSink(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::filesystem::File;
+    using ostk::core::types::Shared;
+    using ostk::core::types::Size;
+
+    using ostk::astro::trajectory::state::StateSink;
+    using ostk::astro::trajectory::state::StateWriter;
+
+    class_<StateSink, Shared<StateSink>>(
+        aModule,
+        "StateSink",
+        R"doc(
+            Stream states to a state writer, from a background thread.
+
+            States are pushed to a bounded lock-free queue, which a background thread drains into the state writer.
+            When the queue is full, pushing threads wait for the writer thread rather than dropping states.
+
+            A sink belongs to a single producer, e.g. a propagation: the decimation by step interval counts the pushed
+            states regardless of their thread.
+
+            Errors raised by the state writer are reported by the next call to flush or close.
+
+        )doc"
+    )
+
+        .def(
+            init<const Shared<StateWriter>&, const Size&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    state_writer (StateWriter): A state writer.
+                    queue_capacity (int, optional): The queue capacity, rounded up to a power of 2. Defaults to 1024.
+                    step_interval (int, optional): Write one out of every N pushed states. Defaults to 1.
+            )doc",
+            arg("state_writer"),
+            arg("queue_capacity") = 1024,
+            arg("step_interval") = 1
+        )
+
+        .def(
+            "is_open",
+            &StateSink::isOpen,
+            R"doc(
+                Check if the sink is open.
+
+                Returns:
+                    bool: True if the sink is open.
+            )doc"
+        )
+        .def(
+            "get_queue_capacity",
+            &StateSink::getQueueCapacity,
+            R"doc(
+                Get the queue capacity.
+
+                Returns:
+                    int: The queue capacity.
+            )doc"
+        )
+        .def(
+            "get_step_interval",
+            &StateSink::getStepInterval,
+            R"doc(
+                Get the step interval.
+
+                Returns:
+                    int: The step interval.
+            )doc"
+        )
+        .def(
+            "get_pushed_state_count",
+            &StateSink::getPushedStateCount,
+            R"doc(
+                Get the number of states pushed to the sink, before decimation.
+
+                Returns:
+                    int: The number of pushed states.
+            )doc"
+        )
+        .def(
+            "get_written_state_count",
+            &StateSink::getWrittenStateCount,
+            R"doc(
+                Get the number of states written by the state writer.
+
+                Returns:
+                    int: The number of written states.
+            )doc"
+        )
+        .def(
+            "get_stall_count",
+            &StateSink::getStallCount,
+            R"doc(
+                Get the number of times a pushing thread found the queue full.
+
+                Returns:
+                    int: The number of stalls.
+            )doc"
+        )
+
+        .def(
+            "push",
+            &StateSink::push,
+            R"doc(
+                Push a state.
+
+                Args:
+                    state (State): A state.
+            )doc",
+            arg("state")
+        )
+        .def(
+            "flush",
+            &StateSink::flush,
+            R"doc(
+                Wait until the states pushed so far are written, and flush the state writer.
+            )doc"
+        )
+        .def(
+            "close",
+            &StateSink::close,
+            R"doc(
+                Write the queued states, flush the state writer and stop the background thread.
+            )doc"
+        )
+
+        .def_static(
+            "csv",
+            &StateSink::CSV,
+            R"doc(
+                Construct a sink streaming states to a CSV file.
+
+                Args:
+                    file (File): A file, created or truncated.
+                    step_interval (int, optional): Write one out of every N pushed states. Defaults to 1.
+
+                Returns:
+                    StateSink: The state sink.
+            )doc",
+            arg("file"),
+            arg("step_interval") = 1
+        )
+        .def_static(
+            "binary",
+            &StateSink::Binary,
+            R"doc(
+                Construct a sink streaming states to a binary file.
+
+                Args:
+                    file (File): A file, created or truncated.
+                    step_interval (int, optional): Write one out of every N pushed states. Defaults to 1.
+
+                Returns:
+                    StateSink: The state sink.
+            )doc",
+            arg("file"),
+            arg("step_interval") = 1
+        )
+
+        ;
+}
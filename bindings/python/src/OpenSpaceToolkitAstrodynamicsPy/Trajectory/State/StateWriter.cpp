@@ -0,0 +1,54 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/StateWriters/Binary.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/StateWriters/CSV.cpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriter(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::types::Shared;
+
+    using ostk::astro::trajectory::state::StateWriter;
+
+    class_<StateWriter, Shared<StateWriter>>(
+        aModule,
+        "StateWriter",
+        R"doc(
+            Write states to a destination, e.g. a file.
+
+            State writers are driven by a state sink, from a single background thread.
+
+        )doc"
+    )
+
+        .def(
+            "write",
+            &StateWriter::write,
+            R"doc(
+                Write a state.
+
+                Args:
+                    state (State): A state.
+            )doc",
+            arg("state")
+        )
+        .def(
+            "flush",
+            &StateWriter::flush,
+            R"doc(
+                Flush the written states to the destination.
+            )doc"
+        )
+
+        ;
+
+    // Create "state_writer" python submodule
+    auto state_writer = aModule.def_submodule("state_writer");
+
+    // Add objects to "state_writer" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriters_Binary(state_writer);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriters_CSV(state_writer);
+}
@@ -0,0 +1,51 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/Binary.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriters_Binary(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::filesystem::File;
+    using ostk::core::types::Shared;
+
+    using ostk::astro::trajectory::state::StateWriter;
+    using ostk::astro::trajectory::state::statewriters::Binary;
+
+    class_<Binary, Shared<Binary>, StateWriter>(
+        aModule,
+        "Binary",
+        R"doc(
+            Write states to a binary file.
+
+            The file starts with the magic string "OSTKSTAT" and a 32-bit version number. Each state is then written as
+            the instant (64-bit float, seconds since J2000), the number of coordinates (32-bit unsigned integer) and the
+            coordinates (64-bit floats), in the native byte order.
+
+        )doc"
+    )
+
+        .def(
+            init<const File&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    file (File): A file, created or truncated.
+            )doc",
+            arg("file")
+        )
+
+        .def(
+            "get_file",
+            &Binary::getFile,
+            R"doc(
+                Get the file.
+
+                Returns:
+                    File: The file.
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,53 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/CSV.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateWriters_CSV(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::filesystem::File;
+    using ostk::core::types::Shared;
+    using ostk::core::types::Size;
+
+    using ostk::astro::trajectory::state::StateWriter;
+    using ostk::astro::trajectory::state::statewriters::CSV;
+
+    class_<CSV, Shared<CSV>, StateWriter>(
+        aModule,
+        "CSV",
+        R"doc(
+            Write states to a CSV file.
+
+            Each row holds the instant (ISO 8601, UTC), the frame name and the coordinates of a state. A new header row
+            is written whenever the coordinates subsets change from one state to the next.
+
+        )doc"
+    )
+
+        .def(
+            init<const File&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    file (File): A file, created or truncated.
+                    precision (int, optional): The number of significant digits of the coordinates. Defaults to 17.
+            )doc",
+            arg("file"),
+            arg("precision") = 17
+        )
+
+        .def(
+            "get_file",
+            &CSV::getFile,
+            R"doc(
+                Get the file.
+
+                Returns:
+                    File: The file.
+            )doc"
+        )
+
+        ;
+}
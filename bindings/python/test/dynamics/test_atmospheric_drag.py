@@ -10,6 +10,8 @@ from ostk.mathematics.geometry.d3.objects import Point
 
 from ostk.physics.units import Mass
 from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -33,6 +35,7 @@ from ostk.astrodynamics.trajectory.state.coordinates_subset import (
 )
 from ostk.astrodynamics import Dynamics
 from ostk.astrodynamics.dynamics import AtmosphericDrag
+from ostk.astrodynamics.dynamics.atmospheric_drag import DensityCache
 
 
 @pytest.fixture
@@ -126,3 +129,30 @@ class TestAtmosphericDrag:
         )
 
         assert len(contribution) == 3
+
+    def test_density_cache(self, dynamics: AtmosphericDrag, earth: Earth, state: State):
+        assert dynamics.has_density_cache() is False
+
+        density_cache: DensityCache = DensityCache(
+            earth,
+            Interval.closed(state.get_instant(), state.get_instant() + Duration.days(1.0)),
+        )
+
+        cached_dynamics: AtmosphericDrag = AtmosphericDrag(density_cache)
+
+        assert cached_dynamics.is_defined()
+        assert cached_dynamics.has_density_cache() is True
+        assert cached_dynamics.get_density_cache() is not None
+
+        contribution = dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+        cached_contribution = cached_dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+
+        assert cached_contribution == pytest.approx(contribution, rel=1e-2)
+        assert (
+            density_cache.get_interpolated_query_count()
+            + density_cache.get_direct_query_count()
+        ) == 1
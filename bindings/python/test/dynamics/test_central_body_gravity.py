@@ -56,3 +56,15 @@ class TestCentralBodyGravity:
 
         assert len(contribution) == 3
         assert contribution == pytest.approx([-8.134702887755102, 0.0, 0.0])
+
+    def test_compute_contribution_jacobian(self, dynamics: CentralBodyGravity, state: State):
+        jacobian = dynamics.compute_contribution_jacobian(
+            state.get_instant(), state.get_coordinates()[:3], state.get_frame()
+        )
+
+        gradient: float = 398600441500000.0 / 7000000.0**3
+
+        assert jacobian.shape == (3, 3)
+        assert jacobian == pytest.approx(
+            np.diag([2.0 * gradient, -gradient, -gradient]), rel=1e-6, abs=1e-15
+        )
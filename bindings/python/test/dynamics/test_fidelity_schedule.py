@@ -0,0 +1,108 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.units import Length
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.objects.celestial_bodies import Earth
+
+from ostk.astrodynamics import Dynamics
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import FidelitySchedule
+
+
+@pytest.fixture
+def earth() -> Earth:
+    return Earth.spherical()
+
+
+@pytest.fixture
+def central_body_gravity(earth: Earth) -> CentralBodyGravity:
+    return CentralBodyGravity(earth)
+
+
+@pytest.fixture
+def dynamics(earth: Earth, central_body_gravity: CentralBodyGravity) -> FidelitySchedule:
+    return FidelitySchedule(
+        celestial=earth,
+        criterion=FidelitySchedule.Criterion.Distance,
+        thresholds=[Length.kilometers(10000.0)],
+        dynamics=[[central_body_gravity], []],
+        hysteresis=Length.kilometers(10.0),
+    )
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC)
+
+
+class TestFidelitySchedule:
+    def test_constructors(
+        self,
+        dynamics: FidelitySchedule,
+    ):
+        assert dynamics is not None
+        assert isinstance(dynamics, FidelitySchedule)
+        assert isinstance(dynamics, Dynamics)
+        assert dynamics.is_defined()
+
+    def test_constructors_failure(
+        self,
+        earth: Earth,
+        central_body_gravity: CentralBodyGravity,
+    ):
+        with pytest.raises(RuntimeError):
+            FidelitySchedule(
+                earth,
+                FidelitySchedule.Criterion.Distance,
+                [Length.kilometers(10000.0)],
+                [[central_body_gravity]],
+            )
+
+    def test_getters(self, dynamics: FidelitySchedule, earth: Earth):
+        assert dynamics.get_celestial() == earth
+        assert dynamics.get_criterion() == FidelitySchedule.Criterion.Distance
+        assert dynamics.get_thresholds() == [Length.kilometers(10000.0)]
+        assert dynamics.get_hysteresis() == Length.kilometers(10.0)
+        assert dynamics.get_regime_count() == 2
+        assert len(dynamics.get_regime_dynamics(0)) == 1
+        assert len(dynamics.get_regime_dynamics(1)) == 0
+
+    def test_calculate_criterion_value(self, dynamics: FidelitySchedule, instant: Instant):
+        assert dynamics.calculate_criterion_value(
+            instant, np.array([7000000.0, 0.0, 0.0]), Frame.GCRF()
+        ) == pytest.approx(7000000.0)
+
+    def test_calculate_regime_index(self, dynamics: FidelitySchedule):
+        assert dynamics.calculate_regime_index(7000000.0) == 0
+        assert dynamics.calculate_regime_index(12000000.0) == 1
+
+    def test_is_in_regime(self, dynamics: FidelitySchedule):
+        assert dynamics.is_in_regime(10005000.0, 0)
+        assert dynamics.is_in_regime(10005000.0, 1)
+        assert not dynamics.is_in_regime(10015000.0, 0)
+        assert not dynamics.is_in_regime(9985000.0, 1)
+
+    def test_compute_contribution(self, dynamics: FidelitySchedule, instant: Instant):
+        contribution = dynamics.compute_contribution(
+            instant, np.array([7000000.0, 0.0, 0.0]), Frame.GCRF()
+        )
+
+        assert len(contribution) == 3
+        assert contribution == pytest.approx([-8.134702887755102, 0.0, 0.0])
+
+        contribution = dynamics.compute_contribution(
+            instant, np.array([12000000.0, 0.0, 0.0]), Frame.GCRF()
+        )
+
+        assert contribution == pytest.approx([0.0, 0.0, 0.0])
+
+    def test_string_from_criterion(self):
+        assert FidelitySchedule.string_from_criterion(FidelitySchedule.Criterion.Altitude) == "Altitude"
+        assert FidelitySchedule.string_from_criterion(FidelitySchedule.Criterion.Distance) == "Distance"
@@ -49,3 +49,11 @@ class TestPositionDerivative:
         )
         assert len(contribution) == 3
         assert contribution == pytest.approx(state.get_coordinates()[:3])
+
+    def test_compute_contribution_jacobian(self, dynamics: PositionDerivative, state: State):
+        jacobian = dynamics.compute_contribution_jacobian(
+            state.get_instant(), state.get_coordinates()[3:], state.get_frame()
+        )
+
+        assert jacobian.shape == (3, 3)
+        assert np.array_equal(jacobian, np.eye(3))
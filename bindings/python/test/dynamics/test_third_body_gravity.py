@@ -5,6 +5,8 @@ import pytest
 import numpy as np
 
 from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -65,3 +67,33 @@ class TestThirdBodyGravity:
         assert contribution == pytest.approx(
             [-4.620543790697659e-07, 2.948717888154649e-07, 1.301648617451192e-07]
         )
+
+    def test_precompute_ephemeris(
+        self,
+        moon: Moon,
+        state: State,
+    ):
+        dynamics: ThirdBodyGravity = ThirdBodyGravity(moon)
+
+        assert dynamics.has_precomputed_ephemeris() is False
+
+        interval: Interval = Interval.closed(
+            state.get_instant(), state.get_instant() + Duration.days(1.0)
+        )
+
+        dynamics.precompute_ephemeris(interval)
+
+        assert dynamics.has_precomputed_ephemeris() is True
+        assert dynamics.get_precomputed_ephemeris_interval() == interval
+
+        contribution = dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+        assert contribution == pytest.approx(
+            [-4.620543790697659e-07, 2.948717888154649e-07, 1.301648617451192e-07],
+            rel=1e-8,
+        )
+
+        dynamics.clear_precomputed_ephemeris()
+
+        assert dynamics.has_precomputed_ephemeris() is False
@@ -9,6 +9,7 @@ from ostk.mathematics.geometry.d3.objects import Composite
 from ostk.mathematics.geometry.d3.objects import Point
 
 from ostk.physics.units import Mass
+from ostk.physics.time import Duration
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
@@ -108,6 +109,57 @@ class TestThruster:
         assert dynamics.get_read_coordinates_subsets() is not None
         assert dynamics.get_write_coordinates_subsets() is not None
 
+    def test_guidance_update_policy(
+        self,
+        satellite_system: SatelliteSystem,
+        guidance_law: ConstantThrust,
+        dynamics: Thruster,
+        state: State,
+    ):
+        assert (
+            dynamics.get_guidance_update_policy().get_type()
+            == Thruster.GuidanceUpdatePolicy.Type.Continuous
+        )
+
+        policy = Thruster.GuidanceUpdatePolicy.fixed_cadence(Duration.seconds(10.0))
+
+        assert policy.get_type() == Thruster.GuidanceUpdatePolicy.Type.FixedCadence
+        assert policy.get_interval() == Duration.seconds(10.0)
+        assert (
+            Thruster.GuidanceUpdatePolicy.string_from_type(policy.get_type())
+            == "FixedCadence"
+        )
+
+        thruster = Thruster(
+            satellite_system=satellite_system,
+            guidance_law=guidance_law,
+            name="Held Thruster",
+            guidance_update_policy=policy,
+        )
+
+        assert thruster.get_guidance_update_policy() == policy
+
+        step_start_policy = Thruster.GuidanceUpdatePolicy.step_start()
+
+        assert (
+            step_start_policy.get_type() == Thruster.GuidanceUpdatePolicy.Type.StepStart
+        )
+        assert (
+            Thruster.GuidanceUpdatePolicy.string_from_type(step_start_policy.get_type())
+            == "StepStart"
+        )
+        assert step_start_policy != policy
+
+        # Outside of an integration, the guidance law is always evaluated
+        assert thruster.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        ) == pytest.approx(
+            dynamics.compute_contribution(
+                state.get_instant(), state.get_coordinates(), state.get_frame()
+            ),
+            abs=1e-15,
+        )
+
     def test_compute_contribution_success(self, dynamics: Thruster, state: State):
         contribution = dynamics.compute_contribution(
             state.get_instant(), state.get_coordinates(), state.get_frame()
@@ -102,6 +102,7 @@ class TestQLawParameters:
 
     def test_getters(self, parameters: QLaw.Parameters):
         assert parameters.get_control_weights() is not None
+        assert parameters.get_convergence_thresholds() is not None
         assert parameters.m is not None
         assert parameters.n is not None
         assert parameters.r is not None
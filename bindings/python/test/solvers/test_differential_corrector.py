@@ -0,0 +1,172 @@
+# Apache License 2.0
+
+import pytest
+
+import math
+
+import numpy as np
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
+from ostk.physics.environment.objects.celestial_bodies import Earth
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Scale
+from ostk.physics.units import Length
+
+from ostk.astrodynamics import EventCondition
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.event_condition import COECondition
+from ostk.astrodynamics.event_condition import RealCondition
+from ostk.astrodynamics.solvers import DifferentialCorrector
+from ostk.astrodynamics.trajectory import Segment
+from ostk.astrodynamics.trajectory import Sequence
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import CoordinatesBroker
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianPosition
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianVelocity
+
+# Earth spherical gravitational parameter [m^3/s^2]
+GRAVITATIONAL_PARAMETER: float = 398600441500000.0
+
+
+@pytest.fixture
+def state() -> State:
+    return State(
+        Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC),
+        [7000000.0, 0.0, 0.0, 0.0, math.sqrt(GRAVITATIONAL_PARAMETER / 7000000.0), 0.0],
+        Frame.GCRF(),
+        CoordinatesBroker([CartesianPosition.default(), CartesianVelocity.default()]),
+    )
+
+
+@pytest.fixture
+def sequence_generator():
+    def generate(control_vector: np.ndarray) -> Sequence:
+        dynamics = [PositionDerivative(), CentralBodyGravity(Earth.spherical())]
+        numerical_solver: NumericalSolver = NumericalSolver.default_conditional()
+
+        return Sequence(
+            segments=[
+                Segment.coast(
+                    name="Coast",
+                    event_condition=RealCondition.duration_condition(
+                        RealCondition.Criterion.PositiveCrossing,
+                        Duration.seconds(60.0),
+                    ),
+                    dynamics=dynamics,
+                    numerical_solver=numerical_solver,
+                )
+            ],
+            dynamics=dynamics,
+            numerical_solver=numerical_solver,
+        )
+
+    return generate
+
+
+@pytest.fixture
+def control_variables() -> list[DifferentialCorrector.ControlVariable]:
+    return [
+        DifferentialCorrector.ControlVariable.initial_state_coordinate(
+            coordinates_subset=CartesianVelocity.default(),
+            coordinate_index=1,
+            perturbation=1.0e-3,
+        )
+    ]
+
+
+@pytest.fixture
+def constraints() -> list[DifferentialCorrector.Constraint]:
+    return [
+        DifferentialCorrector.Constraint(
+            event_condition=COECondition.semi_major_axis(
+                RealCondition.Criterion.AnyCrossing,
+                Frame.GCRF(),
+                EventCondition.Target(Length.kilometers(7100.0)),
+                EarthGravitationalModel.spherical.gravitational_parameter,
+            ),
+            tolerance=1.0,
+        )
+    ]
+
+
+@pytest.fixture
+def differential_corrector() -> DifferentialCorrector:
+    return DifferentialCorrector(
+        method=DifferentialCorrector.Method.Broyden,
+        maximum_iteration_count=20,
+        thread_count=2,
+    )
+
+
+class TestDifferentialCorrector:
+    def test_constructor(self, differential_corrector: DifferentialCorrector):
+        assert differential_corrector is not None
+        assert isinstance(differential_corrector, DifferentialCorrector)
+
+    def test_getters(self, differential_corrector: DifferentialCorrector):
+        assert differential_corrector.get_method() == DifferentialCorrector.Method.Broyden
+        assert differential_corrector.get_maximum_iteration_count() == 20
+        assert differential_corrector.get_thread_count() == 2
+
+    def test_string_from_method(self):
+        assert (
+            DifferentialCorrector.string_from_method(DifferentialCorrector.Method.Newton)
+            == "Newton"
+        )
+
+    def test_control_variable(self):
+        control_variable = DifferentialCorrector.ControlVariable.parameter(
+            name="Coast Duration",
+            initial_value=600.0,
+            perturbation=1.0,
+            lower_bound=0.0,
+        )
+
+        assert control_variable.name == "Coast Duration"
+        assert control_variable.initial_value == 600.0
+        assert control_variable.perturbation == 1.0
+        assert control_variable.lower_bound == 0.0
+        assert not control_variable.is_initial_state_coordinate()
+
+    def test_constraint(
+        self,
+        constraints: list[DifferentialCorrector.Constraint],
+        state: State,
+    ):
+        assert constraints[0].tolerance == 1.0
+        assert constraints[0].evaluate(state, state) == pytest.approx(-100000.0, abs=1.0)
+
+    def test_solve(
+        self,
+        differential_corrector: DifferentialCorrector,
+        state: State,
+        sequence_generator,
+        control_variables: list[DifferentialCorrector.ControlVariable],
+        constraints: list[DifferentialCorrector.Constraint],
+    ):
+        solution: DifferentialCorrector.Solution = differential_corrector.solve(
+            initial_state=state,
+            sequence_generator=sequence_generator,
+            control_variables=control_variables,
+            constraints=constraints,
+        )
+
+        expected_velocity: float = math.sqrt(
+            GRAVITATIONAL_PARAMETER * (2.0 / 7000000.0 - 1.0 / 7100000.0)
+        )
+
+        assert solution.has_converged
+        assert solution.iteration_count > 0
+        assert solution.jacobian_evaluation_count >= 1
+        assert solution.sequence_solve_count > solution.iteration_count
+        assert solution.control_vector[0] == pytest.approx(expected_velocity, abs=1.0e-3)
+        assert abs(solution.residuals[0]) <= 1.0
+        assert solution.initial_state.get_coordinates()[4] == pytest.approx(
+            expected_velocity, abs=1.0e-3
+        )
+        assert solution.sequence_solution.execution_is_complete
@@ -119,6 +119,7 @@ class TestFiniteDifferenceSolver:
         )
         assert finite_difference_solver.get_step_percentage() is not None
         assert isinstance(finite_difference_solver.get_step_duration(), Duration)
+        assert finite_difference_solver.get_thread_count() == 1
 
     def test_string_from_type(self):
         assert (
@@ -164,6 +165,78 @@ class TestFiniteDifferenceSolver:
             len(state.get_coordinates()),
         )
 
+    def test_compute_jacobian_parallel(
+        self,
+        step_percentage: float,
+        step_duration: Duration,
+        state: State,
+        instants: list[Instant],
+        generate_states_coordinates: callable,
+    ):
+        serial_solver = FiniteDifferenceSolver(
+            FiniteDifferenceSolver.Type.Forward, step_percentage, step_duration
+        )
+        parallel_solver = FiniteDifferenceSolver(
+            FiniteDifferenceSolver.Type.Forward,
+            step_percentage,
+            step_duration,
+            thread_count=2,
+        )
+
+        assert parallel_solver.get_thread_count() == 2
+        assert np.array_equal(
+            parallel_solver.compute_jacobian(
+                state=state,
+                instants=instants,
+                generate_states_coordinates=generate_states_coordinates,
+                coordinates_dimension=2,
+            ),
+            serial_solver.compute_jacobian(
+                state=state,
+                instants=instants,
+                generate_states_coordinates=generate_states_coordinates,
+                coordinates_dimension=2,
+            ),
+        )
+
+    def test_compute_complex_step_jacobian(
+        self,
+        finite_difference_solver: FiniteDifferenceSolver,
+        state: State,
+        instants: list[Instant],
+        initial_instant: Instant,
+    ):
+        def generate_states_coordinates(coordinates, instants) -> np.ndarray:
+            states_coordinates: list[list[complex]] = []
+
+            for instant in instants:
+                t: float = (instant - initial_instant).in_seconds()
+                x: complex = coordinates[0] * math.cos(t) + coordinates[1] * math.sin(t)
+                v: complex = -coordinates[0] * math.sin(t) + coordinates[1] * math.cos(t)
+
+                states_coordinates.append([x, v])
+
+            return np.array(states_coordinates).T
+
+        jacobian = finite_difference_solver.compute_complex_step_jacobian(
+            state=state,
+            instants=instants,
+            generate_states_coordinates=generate_states_coordinates,
+            coordinates_dimension=2,
+        )
+
+        assert isinstance(jacobian, np.ndarray)
+        assert jacobian.shape == (4, 2)
+        assert jacobian[0:2, :] == pytest.approx(
+            np.array(
+                [
+                    [math.cos(100.0), math.sin(100.0)],
+                    [-math.sin(100.0), math.cos(100.0)],
+                ]
+            ),
+            abs=1e-14,
+        )
+
     def test_compute_gradient(
         self,
         finite_difference_solver: FiniteDifferenceSolver,
@@ -0,0 +1,221 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.geometry.d3.objects import Composite
+from ostk.mathematics.geometry.d3.objects import Cuboid
+from ostk.mathematics.geometry.d3.objects import Point
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.objects.celestial_bodies import Earth
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Scale
+from ostk.physics.units import Mass
+
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.event_condition import InstantCondition
+from ostk.astrodynamics.event_condition import RealCondition
+from ostk.astrodynamics.flight.system import PropulsionSystem
+from ostk.astrodynamics.flight.system import SatelliteSystem
+from ostk.astrodynamics.solvers import MonteCarloSolver
+from ostk.astrodynamics.trajectory import Segment
+from ostk.astrodynamics.trajectory import Sequence
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import CoordinatesBroker
+from ostk.astrodynamics.trajectory.state import CoordinatesSubset
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianPosition
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianVelocity
+
+
+@pytest.fixture
+def state() -> State:
+    return State(
+        Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC),
+        [7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 100.0],
+        Frame.GCRF(),
+        CoordinatesBroker(
+            [
+                CartesianPosition.default(),
+                CartesianVelocity.default(),
+                CoordinatesSubset.mass(),
+            ]
+        ),
+    )
+
+
+@pytest.fixture
+def satellite_system() -> SatelliteSystem:
+    return SatelliteSystem(
+        Mass.kilograms(90.0),
+        Composite(
+            Cuboid(
+                Point(0.0, 0.0, 0.0),
+                [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]],
+                [1.0, 2.0, 3.0],
+            )
+        ),
+        np.identity(3),
+        1.0,
+        2.2,
+        PropulsionSystem(1.0, 1500.0),
+    )
+
+
+@pytest.fixture
+def sequence_generator(state: State):
+    def generate(satellite_system: SatelliteSystem) -> Sequence:
+        dynamics = [PositionDerivative(), CentralBodyGravity(Earth.spherical())]
+        numerical_solver: NumericalSolver = NumericalSolver.default_conditional()
+
+        return Sequence(
+            segments=[
+                Segment.coast(
+                    name="Coast",
+                    event_condition=InstantCondition(
+                        RealCondition.Criterion.AnyCrossing,
+                        state.get_instant() + Duration.minutes(5.0),
+                    ),
+                    dynamics=dynamics,
+                    numerical_solver=numerical_solver,
+                )
+            ],
+            dynamics=dynamics,
+            numerical_solver=numerical_solver,
+        )
+
+    return generate
+
+
+@pytest.fixture
+def state_dispersions() -> list[MonteCarloSolver.StateDispersion]:
+    return [
+        MonteCarloSolver.StateDispersion.normal(
+            CartesianPosition.default(), [100.0, 100.0, 100.0]
+        ),
+        MonteCarloSolver.StateDispersion.uniform(CoordinatesSubset.mass(), [5.0]),
+    ]
+
+
+@pytest.fixture
+def satellite_system_dispersions() -> list[MonteCarloSolver.SatelliteSystemDispersion]:
+    return [
+        MonteCarloSolver.SatelliteSystemDispersion.normal(
+            MonteCarloSolver.SatelliteSystemDispersion.Parameter.Thrust, 0.1
+        ),
+    ]
+
+
+@pytest.fixture
+def monte_carlo_solver(
+    state: State,
+    satellite_system: SatelliteSystem,
+    sequence_generator,
+    state_dispersions: list[MonteCarloSolver.StateDispersion],
+    satellite_system_dispersions: list[MonteCarloSolver.SatelliteSystemDispersion],
+) -> MonteCarloSolver:
+    return MonteCarloSolver(
+        nominal_state=state,
+        nominal_satellite_system=satellite_system,
+        sequence_generator=sequence_generator,
+        state_dispersions=state_dispersions,
+        satellite_system_dispersions=satellite_system_dispersions,
+        seed=42,
+    )
+
+
+class TestMonteCarloSolver:
+    def test_state_dispersion(self):
+        state_dispersion = MonteCarloSolver.StateDispersion.covariance(
+            CartesianPosition.default(), np.diag([4.0, 9.0, 16.0])
+        )
+
+        assert state_dispersion.coordinates_subset == CartesianPosition.default()
+        assert state_dispersion.distribution == MonteCarloSolver.Distribution.Normal
+        assert np.allclose(state_dispersion.scale_matrix, np.diag([2.0, 3.0, 4.0]))
+
+        with pytest.raises(RuntimeError):
+            MonteCarloSolver.StateDispersion.normal(
+                CartesianPosition.default(), [1.0, 2.0]
+            )
+
+    def test_satellite_system_dispersion(self):
+        satellite_system_dispersion = MonteCarloSolver.SatelliteSystemDispersion(
+            MonteCarloSolver.SatelliteSystemDispersion.Parameter.DragCoefficient,
+            MonteCarloSolver.Distribution.Uniform,
+            0.2,
+        )
+
+        assert (
+            satellite_system_dispersion.parameter
+            == MonteCarloSolver.SatelliteSystemDispersion.Parameter.DragCoefficient
+        )
+        assert (
+            satellite_system_dispersion.distribution
+            == MonteCarloSolver.Distribution.Uniform
+        )
+        assert satellite_system_dispersion.scale == 0.2
+
+        assert (
+            MonteCarloSolver.SatelliteSystemDispersion.string_from_parameter(
+                MonteCarloSolver.SatelliteSystemDispersion.Parameter.DryMass
+            )
+            == "Dry Mass"
+        )
+
+    def test_getters(
+        self,
+        monte_carlo_solver: MonteCarloSolver,
+        state: State,
+        satellite_system: SatelliteSystem,
+    ):
+        assert monte_carlo_solver.get_nominal_state() == state
+        assert monte_carlo_solver.get_nominal_satellite_system() == satellite_system
+        assert len(monte_carlo_solver.get_state_dispersions()) == 2
+        assert len(monte_carlo_solver.get_satellite_system_dispersions()) == 1
+        assert monte_carlo_solver.get_seed() == 42
+
+    def test_generate_sample(self, monte_carlo_solver: MonteCarloSolver, state: State):
+        sample: MonteCarloSolver.Sample = monte_carlo_solver.generate_sample(3)
+
+        assert sample.index == 3
+        assert sample.state == monte_carlo_solver.generate_sample(3).state
+        assert sample.state != monte_carlo_solver.generate_sample(4).state
+        assert sample.state.get_instant() == state.get_instant()
+        assert abs(sample.state.get_coordinates()[6] - 100.0) <= 5.0
+
+    def test_solve(self, monte_carlo_solver: MonteCarloSolver):
+        solution: MonteCarloSolver.Solution = monte_carlo_solver.solve(
+            sample_count=8,
+            thread_count=2,
+            percentiles=[10.0, 50.0, 90.0],
+        )
+
+        assert solution is not None
+        assert solution.sample_count == 8
+        assert solution.complete_sample_count == 8
+        assert solution.incomplete_sample_count == 0
+        assert solution.failed_sample_count == 0
+        assert solution.percentiles == [10.0, 50.0, 90.0]
+        assert solution.frame == Frame.GCRF()
+
+        assert solution.final_coordinates.mean.shape == (7,)
+        assert solution.final_coordinates.covariance.shape == (7, 7)
+        assert solution.final_coordinates.percentiles.shape == (3, 7)
+        assert solution.delta_v.mean[0] == 0.0
+        assert solution.propagation_duration.mean[0] == pytest.approx(300.0, abs=1e-3)
+
+        sequential_solution: MonteCarloSolver.Solution = monte_carlo_solver.solve(
+            sample_count=8,
+            thread_count=1,
+            percentiles=[10.0, 50.0, 90.0],
+        )
+
+        assert np.array_equal(
+            solution.final_coordinates.mean, sequential_solution.final_coordinates.mean
+        )
@@ -0,0 +1,161 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.geometry.d3.objects import Composite
+from ostk.mathematics.geometry.d3.objects import Cuboid
+from ostk.mathematics.geometry.d3.objects import Point
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
+from ostk.physics.environment.objects.celestial_bodies import Earth
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Scale
+from ostk.physics.units import Angle
+from ostk.physics.units import Length
+from ostk.physics.units import Mass
+
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.flight.system import PropulsionSystem
+from ostk.astrodynamics.flight.system import SatelliteSystem
+from ostk.astrodynamics.guidance_law import QLaw
+from ostk.astrodynamics.solvers import QLawTradeStudy
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.orbit.models.kepler import COE
+from ostk.astrodynamics.trajectory.state import CoordinatesBroker
+from ostk.astrodynamics.trajectory.state import CoordinatesSubset
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianPosition
+from ostk.astrodynamics.trajectory.state.coordinates_subset import CartesianVelocity
+
+
+@pytest.fixture
+def state() -> State:
+    # Slightly eccentric orbit, with a semi-major axis of about 7071 km
+    return State(
+        Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC),
+        [7000000.0, 0.0, 0.0, 0.0, 7546.05329 * 1.005, 0.0, 100.0],
+        Frame.GCRF(),
+        CoordinatesBroker(
+            [
+                CartesianPosition.default(),
+                CartesianVelocity.default(),
+                CoordinatesSubset.mass(),
+            ]
+        ),
+    )
+
+
+@pytest.fixture
+def satellite_system() -> SatelliteSystem:
+    return SatelliteSystem(
+        Mass.kilograms(90.0),
+        Composite(
+            Cuboid(
+                Point(0.0, 0.0, 0.0),
+                [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]],
+                [1.0, 2.0, 3.0],
+            )
+        ),
+        np.identity(3),
+        1.0,
+        2.2,
+        PropulsionSystem(1.0, 1500.0),
+    )
+
+
+@pytest.fixture
+def parameters() -> QLaw.Parameters:
+    return QLaw.Parameters(
+        element_weights={
+            COE.Element.SemiMajorAxis: (1.0, 100.0),
+        },
+    )
+
+
+def target_coe(semi_major_axis: Length) -> COE:
+    return COE(
+        semi_major_axis,
+        0.01,
+        Angle.degrees(0.0),
+        Angle.degrees(0.0),
+        Angle.degrees(0.0),
+        Angle.degrees(0.0),
+    )
+
+
+@pytest.fixture
+def qlaw_trade_study(state: State, satellite_system: SatelliteSystem) -> QLawTradeStudy:
+    return QLawTradeStudy(
+        initial_state=state,
+        satellite_system=satellite_system,
+        environment_dynamics=[PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+        numerical_solver=NumericalSolver.default_conditional(),
+        gravitational_parameter=EarthGravitationalModel.EGM2008.gravitational_parameter,
+        maximum_time_of_flight=Duration.hours(1.0),
+    )
+
+
+class TestQLawTradeStudy:
+    def test_constructor(self, qlaw_trade_study: QLawTradeStudy):
+        assert qlaw_trade_study is not None
+        assert isinstance(qlaw_trade_study, QLawTradeStudy)
+
+    def test_getters(self, qlaw_trade_study: QLawTradeStudy, state: State):
+        assert qlaw_trade_study.get_initial_state() == state
+        assert qlaw_trade_study.get_satellite_system() is not None
+        assert len(qlaw_trade_study.get_environment_dynamics()) == 2
+        assert qlaw_trade_study.get_numerical_solver() is not None
+        assert qlaw_trade_study.get_maximum_time_of_flight() == Duration.hours(1.0)
+        assert qlaw_trade_study.get_gradient_strategy() == QLaw.GradientStrategy.Analytical
+
+    def test_cases(self, parameters: QLaw.Parameters):
+        parameter_cases = QLawTradeStudy.parameter_cases(
+            target_coe(Length.kilometers(7080.0)), [parameters, parameters]
+        )
+
+        assert len(parameter_cases) == 2
+        assert parameter_cases[0].target_coe == target_coe(Length.kilometers(7080.0))
+
+        target_cases = QLawTradeStudy.target_cases(
+            [target_coe(Length.kilometers(7080.0)), target_coe(Length.kilometers(7500.0))],
+            parameters,
+        )
+
+        assert len(target_cases) == 2
+        assert target_cases[1].target_coe == target_coe(Length.kilometers(7500.0))
+
+    def test_string_from_status(self):
+        assert (
+            QLawTradeStudy.string_from_status(QLawTradeStudy.Status.NotConverged)
+            == "Not Converged"
+        )
+
+    def test_solve(self, qlaw_trade_study: QLawTradeStudy, parameters: QLaw.Parameters):
+        results: list[QLawTradeStudy.Result] = qlaw_trade_study.solve(
+            cases=QLawTradeStudy.target_cases(
+                [target_coe(Length.kilometers(7080.0)), target_coe(Length.kilometers(7500.0))],
+                parameters,
+            ),
+            thread_count=2,
+            trajectory_stride=10,
+        )
+
+        assert len(results) == 2
+
+        assert results[0].index == 0
+        assert results[0].status == QLawTradeStudy.Status.Converged
+        assert results[0].time_of_flight < Duration.hours(1.0)
+        assert results[0].delta_v > 0.0
+        assert results[0].propellant_mass.in_kilograms() > 0.0
+        assert abs(results[0].final_elements_error[0]) <= 100.0
+        assert len(results[0].trajectory) > 0
+
+        assert results[1].index == 1
+        assert results[1].status == QLawTradeStudy.Status.NotConverged
+        assert results[1].time_of_flight == Duration.hours(1.0)
@@ -5,6 +5,7 @@ import pytest
 import numpy as np
 
 from ostk.physics.time import Instant
+from ostk.physics.time import Duration
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -203,6 +204,9 @@ class TestPropagated:
         assert propagated.calculate_revolution_number_at(instant) == revolution_number + 1
         assert orbit.get_revolution_number_at(instant) == revolution_number + 1
 
+        # The epoch state lies on the ascending node, the next one is crossed after one orbital period
+        assert len(propagated.get_ascending_node_instant_array()) == 0
+
     def test_access_cached_state_array(
         self,
         propagated: Propagated,
@@ -232,3 +236,81 @@ class TestPropagated:
 
         with pytest.raises(Exception) as e:
             propagated.set_cached_state_array([])
+
+    def test_checkpointing(
+        self,
+        propagated: Propagated,
+        state: State,
+    ):
+        assert propagated.is_checkpointing_enabled() is False
+        assert propagated.get_maximum_checkpoint_count() == 0
+
+        propagated.enable_checkpointing(Duration.minutes(30.0), 100)
+
+        assert propagated.is_checkpointing_enabled() is True
+        assert propagated.get_checkpoint_interval() == Duration.minutes(30.0)
+        assert propagated.get_maximum_checkpoint_count() == 100
+
+        propagated.calculate_state_at(state.get_instant() + Duration.hours(3.0))
+
+        checkpoint_state_array = propagated.get_checkpoint_state_array()
+
+        assert len(checkpoint_state_array) == 6
+        assert checkpoint_state_array[-1].get_instant() == state.get_instant() + Duration.hours(3.0)
+        assert len(propagated.access_cached_state_array()) == 1
+
+        propagated.disable_checkpointing()
+
+        assert propagated.is_checkpointing_enabled() is False
+        assert len(propagated.get_checkpoint_state_array()) == 0
+
+    def test_interpolation_type(
+        self,
+        propagator: Propagator,
+        state: State,
+    ):
+        end_state: State = propagator.calculate_state_at(
+            state, state.get_instant() + Duration.hours(1.0)
+        )
+
+        propagated: Propagated = Propagated(propagator, [state, end_state])
+
+        assert propagated.get_interpolation_type() == Propagated.InterpolationType.Blended
+        assert propagated.get_thread_count() == 1
+
+        instant_array = [
+            state.get_instant() + Duration.minutes(10.0),
+            state.get_instant() + Duration.minutes(40.0),
+        ]
+
+        blended_state_array = propagated.calculate_states_at(instant_array)
+
+        propagated.set_interpolation_type(
+            Propagated.InterpolationType.ContinuityCorrected
+        )
+        propagated.set_thread_count(2)
+
+        assert (
+            propagated.get_interpolation_type()
+            == Propagated.InterpolationType.ContinuityCorrected
+        )
+        assert propagated.get_thread_count() == 2
+
+        corrected_state_array = propagated.calculate_states_at(instant_array)
+
+        for blended_state, corrected_state in zip(
+            blended_state_array, corrected_state_array
+        ):
+            assert blended_state.get_instant() == corrected_state.get_instant()
+            assert np.allclose(
+                blended_state.get_position().get_coordinates(),
+                corrected_state.get_position().get_coordinates(),
+                atol=1e-3,
+            )
+
+        assert (
+            Propagated.string_from_interpolation_type(
+                Propagated.InterpolationType.ContinuityCorrected
+            )
+            == "ContinuityCorrected"
+        )
@@ -0,0 +1,110 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.objects.celestial_bodies import Earth
+from ostk.physics.environment.objects.celestial_bodies import Moon
+
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.models import SemiAnalytic
+from ostk.astrodynamics.trajectory.orbit.models.kepler import COE
+
+
+@pytest.fixture
+def state() -> State:
+    frame: Frame = Frame.GCRF()
+    position: Position = Position.meters([7000000.0, 0.0, 0.0], frame)
+    velocity: Velocity = Velocity.meters_per_second(
+        [0.0, 5335.865450622126, 5335.865450622126], frame
+    )
+
+    instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+    return State(instant, position, velocity)
+
+
+@pytest.fixture
+def earth() -> Earth:
+    return Earth.default()
+
+
+@pytest.fixture
+def semi_analytic(state: State, earth: Earth) -> SemiAnalytic:
+    return SemiAnalytic(
+        state=state,
+        celestial=earth,
+        step_duration=Duration.hours(12.0),
+    )
+
+
+class TestSemiAnalytic:
+    def test_constructors(self, semi_analytic: SemiAnalytic, earth: Earth):
+        assert semi_analytic is not None
+        assert isinstance(semi_analytic, SemiAnalytic)
+        assert semi_analytic.is_defined()
+
+        orbit: Orbit = Orbit(semi_analytic, earth)
+
+        assert orbit is not None
+        assert orbit.is_defined()
+
+    def test_constructor_short_period_recovery_requires_earth(self, state: State):
+        with pytest.raises(RuntimeError):
+            SemiAnalytic(state=state, celestial=Moon.default())
+
+    def test_comparators(self, semi_analytic: SemiAnalytic):
+        assert semi_analytic == semi_analytic
+        assert (semi_analytic != semi_analytic) is False
+
+    def test_getters(self, semi_analytic: SemiAnalytic, state: State):
+        assert semi_analytic.get_epoch() == state.get_instant()
+        assert semi_analytic.get_revolution_number_at_epoch() == 1
+        assert semi_analytic.get_state() == state
+        assert semi_analytic.get_perturbations() == []
+        assert semi_analytic.get_step_duration() == Duration.hours(12.0)
+        assert semi_analytic.get_quadrature_point_count() == 16
+        assert semi_analytic.is_short_period_recovery_enabled()
+
+    def test_calculate_state_at(self, semi_analytic: SemiAnalytic, state: State):
+        instant: Instant = state.get_instant() + Duration.days(3.0)
+
+        calculated_state: State = semi_analytic.calculate_state_at(instant)
+
+        assert calculated_state.get_instant() == instant
+        assert calculated_state.get_frame() == Frame.GCRF()
+
+    def test_calculate_mean_elements_at(
+        self, semi_analytic: SemiAnalytic, state: State
+    ):
+        mean_elements: COE = semi_analytic.calculate_mean_elements_at(
+            state.get_instant() + Duration.days(3.0)
+        )
+
+        assert mean_elements.get_semi_major_axis().in_meters() == pytest.approx(
+            semi_analytic.calculate_mean_elements_at(state.get_instant())
+            .get_semi_major_axis()
+            .in_meters(),
+            abs=1.0,
+        )
+
+    def test_calculate_revolution_number_at(
+        self, semi_analytic: SemiAnalytic, state: State
+    ):
+        assert (
+            semi_analytic.calculate_revolution_number_at(
+                state.get_instant() + Duration.days(1.0)
+            )
+            > 1
+        )
+
+    def test_calculate_decay_instant(self, semi_analytic: SemiAnalytic, state: State):
+        assert not semi_analytic.calculate_decay_instant(
+            state.get_instant() + Duration.days(2.0)
+        ).is_defined()
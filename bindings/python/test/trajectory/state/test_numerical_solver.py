@@ -312,3 +312,131 @@ class TestNumericalSolver:
             )
             is not None
         )
+
+    def test_adams_bashforth_moulton(
+        self,
+        initial_state: State,
+        custom_condition: RealCondition,
+    ):
+        numerical_solver: NumericalSolver = NumericalSolver.adams_bashforth_moulton(
+            1e-3, 1e-12, 1e-12
+        )
+
+        assert numerical_solver.is_multistep()
+        assert (
+            numerical_solver.get_multistep_type()
+            == NumericalSolver.MultistepType.AdamsBashforthMoulton
+        )
+        assert numerical_solver.get_maximum_order() == 12
+
+        end_instant: Instant = initial_state.get_instant() + Duration.seconds(100.0)
+
+        state_vector: np.ndarray = numerical_solver.integrate_time(
+            initial_state, end_instant, oscillator
+        ).get_coordinates()
+
+        assert 5e-9 >= abs(state_vector[0] - math.sin(100.0))
+        assert 5e-9 >= abs(state_vector[1] - math.cos(100.0))
+
+        condition_solution = numerical_solver.integrate_time(
+            initial_state, end_instant, oscillator, custom_condition
+        )
+
+        assert condition_solution.condition_is_satisfied
+        assert condition_solution.root_solver_has_converged
+
+    def test_diagnostics(
+        self,
+        numerical_solver: NumericalSolver,
+        initial_state: State,
+    ):
+        assert not numerical_solver.is_diagnostics_enabled()
+
+        numerical_solver.set_diagnostics_enabled(True)
+
+        assert numerical_solver.is_diagnostics_enabled()
+
+        end_instant: Instant = initial_state.get_instant() + Duration.seconds(100.0)
+
+        state_vector: np.ndarray = numerical_solver.integrate_time(
+            initial_state, end_instant, oscillator
+        ).get_coordinates()
+
+        assert 5e-9 >= abs(state_vector[0] - math.sin(100.0))
+
+        diagnostics: NumericalSolver.Diagnostics = numerical_solver.get_diagnostics()
+
+        assert diagnostics.accepted_step_count > 0
+        assert (
+            diagnostics.system_of_equations_evaluation_count
+            > diagnostics.accepted_step_count
+        )
+        assert (
+            sum(diagnostics.step_size_histogram.values())
+            == diagnostics.accepted_step_count
+        )
+        assert diagnostics.rejected_step_count >= 0
+        assert diagnostics.root_solver_iteration_count == 0
+        assert diagnostics.dynamics_wall_times == {}
+
+        numerical_solver.reset_diagnostics()
+
+        assert numerical_solver.get_diagnostics().accepted_step_count == 0
+
+    def test_observation_policy(
+        self,
+        numerical_solver: NumericalSolver,
+        initial_state: State,
+    ):
+        assert (
+            numerical_solver.get_observation_policy()
+            == NumericalSolver.ObservationPolicy.all()
+        )
+
+        with pytest.raises(RuntimeError):
+            NumericalSolver.ObservationPolicy.every_nth_step(0)
+
+        end_instant: Instant = initial_state.get_instant() + Duration.seconds(100.0)
+
+        numerical_solver.integrate_time(initial_state, end_instant, oscillator)
+
+        observed_state_count: int = len(numerical_solver.get_observed_states())
+
+        policy: NumericalSolver.ObservationPolicy = (
+            NumericalSolver.ObservationPolicy.every_nth_step(10)
+        )
+
+        assert policy.get_type() == NumericalSolver.ObservationPolicy.Type.EveryNthStep
+        assert policy.get_count() == 10
+
+        numerical_solver.set_observation_policy(policy)
+
+        assert numerical_solver.get_observation_policy() == policy
+        assert len(numerical_solver.get_observed_states()) == 0
+
+        numerical_solver.integrate_time(initial_state, end_instant, oscillator)
+
+        observed_states: list[State] = numerical_solver.get_observed_states()
+
+        assert len(observed_states) < observed_state_count
+        assert observed_states[0].get_instant() == initial_state.get_instant()
+        assert observed_states[-1].get_instant() == end_instant
+
+        numerical_solver.set_observation_policy(
+            NumericalSolver.ObservationPolicy.ring_buffer(5)
+        )
+        numerical_solver.integrate_time(initial_state, end_instant, oscillator)
+
+        assert len(numerical_solver.get_observed_states()) == 5
+
+        numerical_solver.set_observation_policy(
+            NumericalSolver.ObservationPolicy.boundaries()
+        )
+        numerical_solver.integrate_time(initial_state, end_instant, oscillator)
+
+        assert len(numerical_solver.get_observed_states()) == 2
+
+        numerical_solver.set_observation_policy(NumericalSolver.ObservationPolicy.none())
+        numerical_solver.integrate_time(initial_state, end_instant, oscillator)
+
+        assert len(numerical_solver.get_observed_states()) == 0
@@ -0,0 +1,108 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
+from ostk.physics.time import Instant, Duration
+from ostk.physics.coordinate import Frame
+
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import (
+    NumericalSolver,
+    CoordinatesBroker,
+    CoordinatesSubset,
+    StateSink,
+)
+from ostk.astrodynamics.trajectory.state.state_writer import CSV, Binary
+
+
+def oscillator(x, dxdt, _):
+    dxdt[0] = x[1]
+    dxdt[1] = -x[0]
+    return dxdt
+
+
+@pytest.fixture
+def initial_state() -> State:
+    return State(
+        Instant.J2000(),
+        np.array([0.0, 1.0]),
+        Frame.GCRF(),
+        CoordinatesBroker([CoordinatesSubset("Subset", 2)]),
+    )
+
+
+@pytest.fixture
+def csv_file(tmp_path) -> File:
+    return File.path(Path.parse(str(tmp_path / "states.csv")))
+
+
+@pytest.fixture
+def binary_file(tmp_path) -> File:
+    return File.path(Path.parse(str(tmp_path / "states.bin")))
+
+
+class TestStateSink:
+    def test_constructors(self, csv_file: File, binary_file: File):
+        state_sink = StateSink(CSV(csv_file), queue_capacity=100, step_interval=2)
+
+        assert state_sink.is_open()
+        assert state_sink.get_queue_capacity() == 128
+        assert state_sink.get_step_interval() == 2
+
+        state_sink.close()
+
+        assert not state_sink.is_open()
+
+        assert StateSink.csv(csv_file) is not None
+        assert StateSink.binary(binary_file, step_interval=10) is not None
+
+        assert StateSink(Binary(binary_file)) is not None
+
+    def test_push(self, initial_state: State, csv_file: File):
+        state_sink: StateSink = StateSink.csv(csv_file, step_interval=2)
+
+        for _ in range(10):
+            state_sink.push(initial_state)
+
+        state_sink.flush()
+
+        assert state_sink.get_pushed_state_count() == 10
+        assert state_sink.get_written_state_count() == 5
+        assert state_sink.get_stall_count() == 0
+
+        state_sink.close()
+
+        assert len(csv_file.get_contents().splitlines()) == 6
+
+        with pytest.raises(RuntimeError):
+            state_sink.push(initial_state)
+
+    def test_numerical_solver(self, initial_state: State, binary_file: File):
+        numerical_solver: NumericalSolver = NumericalSolver.default_conditional()
+
+        assert numerical_solver.get_state_sink() is None
+
+        state_sink: StateSink = StateSink.binary(binary_file)
+
+        numerical_solver.set_state_sink(state_sink)
+        numerical_solver.set_observation_policy(
+            NumericalSolver.ObservationPolicy.boundaries()
+        )
+
+        numerical_solver.integrate_time(
+            initial_state, initial_state.get_instant() + Duration.seconds(100.0), oscillator
+        )
+
+        state_sink.close()
+
+        assert len(numerical_solver.get_observed_states()) == 2
+        assert state_sink.get_written_state_count() > 2
+
+        numerical_solver.set_state_sink(None)
+
+        assert numerical_solver.get_state_sink() is None
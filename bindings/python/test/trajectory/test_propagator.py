@@ -251,6 +251,110 @@ class TestPropagator:
         assert isinstance(propagator, Propagator)
         assert propagator.is_defined()
 
+    def test_get_formulation(self, propagator: Propagator):
+        assert propagator.get_formulation() == Propagator.Formulation.Cowell
+
+    def test_encke(
+        self,
+        numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        propagator: Propagator,
+        state: State,
+    ):
+        encke_propagator: Propagator = Propagator(
+            numerical_solver, dynamics, Propagator.Formulation.Encke
+        )
+
+        assert encke_propagator.get_formulation() == Propagator.Formulation.Encke
+        assert encke_propagator != propagator
+        assert Propagator.string_from_formulation(Propagator.Formulation.Encke) == "Encke"
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 6, 0, 0), Scale.UTC)
+
+        encke_state: State = encke_propagator.calculate_state_at(state, instant)
+        cowell_state: State = propagator.calculate_state_at(state, instant)
+
+        assert encke_state.get_instant() == instant
+        assert np.allclose(
+            encke_state.get_position().get_coordinates(),
+            cowell_state.get_position().get_coordinates(),
+            rtol=0.0,
+            atol=1e-3,
+        )
+
+    def test_kustaanheimo_stiefel(
+        self,
+        numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        propagator: Propagator,
+        state: State,
+    ):
+        kustaanheimo_stiefel_propagator: Propagator = Propagator(
+            numerical_solver, dynamics, Propagator.Formulation.KustaanheimoStiefel
+        )
+
+        assert (
+            kustaanheimo_stiefel_propagator.get_formulation()
+            == Propagator.Formulation.KustaanheimoStiefel
+        )
+        assert (
+            Propagator.string_from_formulation(Propagator.Formulation.KustaanheimoStiefel)
+            == "KustaanheimoStiefel"
+        )
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 6, 0, 0), Scale.UTC)
+
+        kustaanheimo_stiefel_state: State = (
+            kustaanheimo_stiefel_propagator.calculate_state_at(state, instant)
+        )
+        cowell_state: State = propagator.calculate_state_at(state, instant)
+
+        assert kustaanheimo_stiefel_state.get_instant() == instant
+        assert np.allclose(
+            kustaanheimo_stiefel_state.get_position().get_coordinates(),
+            cowell_state.get_position().get_coordinates(),
+            rtol=0.0,
+            atol=1e-2,
+        )
+
+    def test_diagnostics(
+        self,
+        conditional_numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        state: State,
+        event_condition: InstantCondition,
+    ):
+        conditional_numerical_solver.set_diagnostics_enabled(True)
+
+        propagator: Propagator = Propagator(conditional_numerical_solver, dynamics)
+
+        propagator.calculate_state_at(state, state.get_instant() + Duration.minutes(10.0))
+
+        diagnostics: NumericalSolver.Diagnostics = (
+            propagator.access_numerical_solver().get_diagnostics()
+        )
+
+        assert diagnostics.accepted_step_count > 0
+        assert (
+            sum(diagnostics.step_size_histogram.values())
+            == diagnostics.accepted_step_count
+        )
+        assert set(diagnostics.dynamics_wall_times.keys()) == {
+            dynamic.get_name() for dynamic in dynamics
+        }
+
+        condition_solution = propagator.calculate_state_to_condition(
+            state, state.get_instant() + Duration.minutes(10.0), event_condition
+        )
+
+        assert condition_solution.condition_is_satisfied
+        assert (
+            propagator.access_numerical_solver()
+            .get_diagnostics()
+            .root_solver_iteration_count
+            == condition_solution.iteration_count
+        )
+
     def test_access_numerical_solver(
         self, propagator: Propagator, numerical_solver: NumericalSolver
     ):
@@ -335,6 +439,19 @@ class TestPropagator:
         assert pytest.approx(42.0, abs=1e-3) == float(
             (solution.state.get_instant() - state.get_instant()).in_seconds()
         )
+        assert solution.next_time_step.is_defined()
+
+        continued_solution = propagator.calculate_state_to_condition(
+            state=state,
+            instant=instant,
+            event_condition=event_condition,
+            initial_time_step=solution.next_time_step,
+        )
+
+        assert continued_solution.condition_is_satisfied
+        assert pytest.approx(42.0, abs=1e-3) == float(
+            (continued_solution.state.get_instant() - state.get_instant()).in_seconds()
+        )
 
     def test_calculate_states_at(self, propagator: Propagator, state: State):
         instant_array = [
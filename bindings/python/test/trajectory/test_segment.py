@@ -19,6 +19,7 @@ from ostk.astrodynamics.dynamics import Thruster
 from ostk.astrodynamics.guidance_law import ConstantThrust
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory import Segment
+from ostk.astrodynamics.trajectory import Propagator
 from ostk.astrodynamics.event_condition import InstantCondition
 from ostk.astrodynamics.trajectory.state import CoordinatesSubset
 from ostk.astrodynamics.trajectory.state import CoordinatesBroker
@@ -165,6 +166,26 @@ class TestSegment:
     ):
         assert coast_duration_segment.get_type() == Segment.Type.Coast
 
+    def test_get_formulation(
+        self,
+        name: str,
+        instant_condition: InstantCondition,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+        coast_duration_segment: Segment,
+    ):
+        assert coast_duration_segment.get_formulation() == Propagator.Formulation.Cowell
+
+        segment: Segment = Segment.coast(
+            name,
+            instant_condition,
+            dynamics,
+            numerical_solver,
+            Propagator.Formulation.Encke,
+        )
+
+        assert segment.get_formulation() == Propagator.Formulation.Encke
+
     def test_coast(
         self,
         name: str,
@@ -256,6 +277,9 @@ class TestSegment:
         assert propagated_states is not None
         assert len(propagated_states) == len(instants)
 
+        assert solution.dense_output_is_available
+        assert len(solution.get_state_derivatives()) == len(solution.states)
+
         first_dynamics_contribution = solution.get_dynamics_contribution(
             solution.dynamics[0], state_frame
         )
@@ -290,6 +314,12 @@ class TestSegment:
             all_contributions[solution.dynamics[2]], third_dynamics_contribution
         )
 
+        cached_contributions = solution.get_all_dynamics_contributions(
+            state_frame, thread_count=2
+        )
+        for dynamics in solution.dynamics:
+            assert np.array_equal(cached_contributions[dynamics], all_contributions[dynamics])
+
         acceleration_contribution = solution.get_dynamics_acceleration_contribution(
             solution.dynamics[1], state_frame
         )
@@ -301,3 +331,27 @@ class TestSegment:
             solution.get_dynamics_acceleration_contribution(
                 solution.dynamics[0], state_frame
             )
+
+    def test_solve_with_diagnostics(
+        self,
+        state: State,
+        name: str,
+        instant_condition: InstantCondition,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+    ):
+        numerical_solver.set_diagnostics_enabled(True)
+
+        segment: Segment = Segment.coast(name, instant_condition, dynamics, numerical_solver)
+
+        solution = segment.solve(state)
+
+        assert solution.diagnostics.accepted_step_count > 0
+        assert solution.diagnostics.system_of_equations_evaluation_count > 0
+        assert len(solution.diagnostics.dynamics_wall_times) == len(dynamics)
+
+        default_solution = Segment.coast(
+            name, instant_condition, dynamics, NumericalSolver.default_conditional()
+        ).solve(state)
+
+        assert default_solution.diagnostics.accepted_step_count == 0
@@ -460,6 +460,32 @@ class TestSequence:
         assert propagated_states is not None
         assert len(propagated_states) == len(instants)
 
+    def test_solve_with_solution_cache(
+        self,
+        state: State,
+        sequence: Sequence,
+        segments: list[Segment],
+    ):
+        solution_cache = Sequence.SolutionCache()
+
+        assert solution_cache.get_size() == 0
+
+        solution = sequence.solve(state=state, solution_cache=solution_cache)
+
+        assert len(solution.segment_solutions) == len(segments)
+        assert solution_cache.get_size() == len(segments)
+        assert solution_cache.get_reuse_count() == 0
+
+        solution = sequence.solve(state, solution_cache)
+
+        assert len(solution.segment_solutions) == len(segments)
+        assert solution_cache.get_reuse_count() == len(segments)
+
+        solution_cache.clear()
+
+        assert solution_cache.get_size() == 0
+        assert solution_cache.get_reuse_count() == 0
+
     def test_solve_to_condition(
         self,
         state: State,
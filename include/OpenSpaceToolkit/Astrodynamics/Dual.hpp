@@ -0,0 +1,102 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Dual__
+#define __OpenSpaceToolkit_Astrodynamics_Dual__
+
+#include <unsupported/Eigen/AutoDiff>
+
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace dual
+{
+
+using ostk::core::types::Index;
+using ostk::core::types::Size;
+
+using ostk::math::object::MatrixXd;
+using ostk::math::object::VectorXd;
+
+/// @brief Forward-mode automatic differentiation scalar
+///
+/// A dual number holds a value and its derivatives with respect to a set of seeded variables. Evaluating an
+/// expression templated on its scalar type with dual numbers yields the exact derivatives of the result alongside its
+/// value, in a single augmented evaluation. Constants hold no derivatives, and are treated as having zero derivatives.
+///
+/// Mathematical functions must be called unqualified (e.g. `using std::sqrt; sqrt(x)`), so that the dual overloads
+/// are found by argument-dependent lookup.
+typedef Eigen::AutoDiffScalar<VectorXd> Scalar;
+
+typedef Eigen::Matrix<Scalar, 3, 1> Vector3;
+typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorX;
+typedef Eigen::Matrix<Scalar, 3, 3> Matrix3;
+
+/// @brief Seed a vector of variables
+///
+/// @param aVector A vector of variable values
+/// @param anOffset (optional) The index of the first variable among all the differentiation variables. Defaults to 0.
+/// @param aVariableCount (optional) The number of differentiation variables. Defaults to the vector size.
+/// @return The dual variables, each with a unit derivative with respect to itself
+inline VectorX Seed(const VectorXd& aVector, const Index& anOffset = 0, const Size& aVariableCount = 0)
+{
+    const Size variableCount = (aVariableCount == 0) ? Size(aVector.size()) : aVariableCount;
+
+    VectorX variables(aVector.size());
+
+    for (Index i = 0; i < Index(aVector.size()); ++i)
+    {
+        variables(i) = Scalar(aVector(i), variableCount, anOffset + i);
+    }
+
+    return variables;
+}
+
+/// @brief Get the values of dual numbers
+///
+/// @param aDualVector A vector of dual numbers
+/// @return The values
+template <int Rows>
+VectorXd Value(const Eigen::Matrix<Scalar, Rows, 1>& aDualVector)
+{
+    VectorXd values(aDualVector.size());
+
+    for (Index i = 0; i < Index(aDualVector.size()); ++i)
+    {
+        values(i) = aDualVector(i).value();
+    }
+
+    return values;
+}
+
+/// @brief Get the Jacobian of dual numbers with respect to the seeded variables
+///
+/// @param aDualVector A vector of dual numbers
+/// @param aVariableCount The number of differentiation variables
+/// @return The Jacobian, with one row per dual number and one column per variable
+template <int Rows>
+MatrixXd Jacobian(const Eigen::Matrix<Scalar, Rows, 1>& aDualVector, const Size& aVariableCount)
+{
+    MatrixXd jacobian = MatrixXd::Zero(aDualVector.size(), aVariableCount);
+
+    for (Index i = 0; i < Index(aDualVector.size()); ++i)
+    {
+        if (aDualVector(i).derivatives().size() > 0)
+        {
+            jacobian.row(i) = aDualVector(i).derivatives().transpose();
+        }
+    }
+
+    return jacobian;
+}
+
+}  // namespace dual
+}  // namespace astro
+}  // namespace ostk
+
+#endif
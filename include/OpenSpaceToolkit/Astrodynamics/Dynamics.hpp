@@ -15,6 +15,7 @@
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
@@ -33,10 +34,12 @@ using ostk::core::types::Shared;
 using ostk::core::types::Size;
 using ostk::core::types::String;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 using ostk::math::object::Vector3d;
 
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::coord::Frame;
 
@@ -48,6 +51,13 @@ using ostk::astro::trajectory::state::CoordinatesSubset;
 class Dynamics
 {
    public:
+    /// @brief Value held by a dynamics over the accepted steps of an integration, e.g. a piecewise-constant guidance
+    class Hold
+    {
+       public:
+        virtual ~Hold();
+    };
+
     struct Context
     {
         Context(
@@ -60,6 +70,7 @@ class Dynamics
         Array<Pair<Index, Size>> readIndexes;
         Array<Pair<Index, Size>> writeIndexes;
         Size readStateSize;
+        Shared<Hold> hold;
     };
 
     /// @brief Constructor
@@ -120,15 +131,102 @@ class Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const = 0;
 
+    /// @brief Compute the Jacobian of the contribution to the state derivative with respect to the reduced state
+    /// vector.
+    ///
+    /// The default implementation uses central differences. Dynamics evaluating their contribution with dual numbers
+    /// (see dual::Scalar) override it to return the exact Jacobian, from a single augmented evaluation.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian, with one row per 'write' coordinate and one column per 'read' coordinate
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const;
+
+    /// @brief Create the value held by the instance over the accepted steps of an integration
+    ///
+    /// The default implementation holds nothing: the contribution is computed at each evaluation.
+    ///
+    /// @return A hold, null if the instance holds nothing
+    virtual Shared<Hold> createHold() const;
+
+    /// @brief Update the held value, at the start of an integration or at an accepted step
+    ///
+    /// @param aHold A hold, created by the instance
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param isIntegrationStart True at the start of the integration
+    ///
+    /// @return True if the held value changed
+    virtual bool updateHold(
+        Hold& aHold,
+        const Instant& anInstant,
+        const VectorXd& x,
+        const Shared<const Frame>& aFrameSPtr,
+        const bool& isIntegrationStart
+    ) const;
+
+    /// @brief Compute the contribution to the state derivative, with a held value
+    ///
+    /// The default implementation ignores the held value.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aHold A hold, created by the instance
+    ///
+    /// @return The reduced derivative state vector (this vector must follow the structure determined by
+    /// the 'write' coordinate subsets) expressed in the given frame
+    virtual VectorXd computeHeldContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, const Hold& aHold
+    ) const;
+
     /// @brief Get system of equations wrapper
     ///
+    /// Dynamics holding values over the accepted steps of an integration (see createHold) get fresh holds, updated by
+    /// the step observer if requested. Without a step observer, their contribution is computed at each evaluation.
+    ///
     /// @param aContextArray An array of Dynamics Information
     /// @param anInstant An instant
     /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    /// @param aWallTimeArrayPtr (optional) If defined, the wall time spent in the contribution of each dynamics is
+    /// added to it, in the order of the contexts. It must outlive the system of equations.
+    /// @param aStepObserverPtr (optional) If defined, set to the step observer updating the holds of the system of
+    /// equations, or to null if no dynamics holds values. It must be set on the numerical solver integrating the
+    /// system of equations.
     ///
     /// @return std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
     static NumericalSolver::SystemOfEquationsWrapper GetSystemOfEquations(
-        const Array<Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        Array<Duration>* aWallTimeArrayPtr = nullptr,
+        NumericalSolver::StepObserver* aStepObserverPtr = nullptr
+    );
+
+    /// @brief Compute the Jacobian of the state derivative with respect to the state
+    ///
+    /// The contribution Jacobians of the dynamics are summed into the full state Jacobian, following their read and
+    /// write indexes.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param anInstant An instant
+    /// @param aStateVector A full state vector
+    /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    ///
+    /// @return The Jacobian of the state derivative, a square matrix of the state size
+    static MatrixXd ComputeJacobian(
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const VectorXd& aStateVector,
+        const Shared<const Frame>& aFrameSPtr
     );
 
     /// @brief Get a list of dynamics from the envrionment
@@ -138,6 +236,22 @@ class Dynamics
     /// @return A list of dynamics
     static Array<Shared<Dynamics>> FromEnvironment(const Environment& anEnvironment);
 
+   protected:
+    static VectorXd extractReadState(
+        const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
+    );
+
+    static void applyContribution(
+        NumericalSolver::StateVector& dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
+    );
+
+    static void applyContributionJacobian(
+        MatrixXd& aJacobian,
+        const MatrixXd& aContributionJacobian,
+        const Array<Pair<Index, Size>>& readInfo,
+        const Array<Pair<Index, Size>>& writeInfo
+    );
+
    private:
     const String name_;
 
@@ -147,15 +261,8 @@ class Dynamics
         const double& t,
         const Array<Context>& aContextArray,
         const Instant& anInstant,
-        const Shared<const Frame>& aFrameSPtr
-    );
-
-    static VectorXd extractReadState(
-        const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
-    );
-
-    static void applyContribution(
-        NumericalSolver::StateVector& dxdt, const VectorXd& contribution, const Array<Pair<Index, Size>>& writeInfo
+        const Shared<const Frame>& aFrameSPtr,
+        Array<Duration>* aWallTimeArrayPtr
     );
 };
 
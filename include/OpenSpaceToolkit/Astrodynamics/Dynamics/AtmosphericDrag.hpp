@@ -5,11 +5,13 @@
 
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag/DensityCache.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 
 namespace ostk
@@ -22,11 +24,13 @@ namespace dynamics
 using ostk::core::types::Integer;
 using ostk::core::types::String;
 
+using ostk::physics::coord::Transform;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
 using ostk::physics::units::Mass;
 
 using ostk::astro::Dynamics;
+using ostk::astro::dynamics::atmosphericdrag::DensityCache;
 using ostk::astro::flight::system::SatelliteSystem;
 
 /// @brief Define the acceleration experienced by a spacecraft due to atmospheric drag
@@ -55,6 +59,19 @@ class AtmosphericDrag : public Dynamics
     /// @param aName A name
     AtmosphericDrag(const Shared<const Celestial>& aCelestial, const String& aName);
 
+    /// @brief Constructor, with a density cache
+    ///
+    /// The density cache is used in place of the atmospheric model of the celestial object to compute the
+    /// atmospheric density. It can be shared between several atmospheric drag dynamics.
+    ///
+    /// @code{.cpp}
+    ///                  const Shared<const DensityCache> densityCacheSPtr = { ... };
+    ///                  AtmosphericDrag atmosphericDrag = { densityCacheSPtr };
+    /// @endcode
+    ///
+    /// @param aDensityCacheSPtr A density cache
+    AtmosphericDrag(const Shared<const DensityCache>& aDensityCacheSPtr);
+
     /// @brief Destructor
     virtual ~AtmosphericDrag() override;
 
@@ -75,6 +92,16 @@ class AtmosphericDrag : public Dynamics
     /// @return A celestial object
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Check if atmospheric drag dynamics uses a density cache
+    ///
+    /// @return True if atmospheric drag dynamics uses a density cache
+    bool hasDensityCache() const;
+
+    /// @brief Get density cache
+    ///
+    /// @return A density cache
+    Shared<const DensityCache> getDensityCache() const;
+
     /// @brief Return the coordinates subsets that the instance reads from
     ///
     /// @return The coordinates subsets that the instance reads from
@@ -98,6 +125,21 @@ class AtmosphericDrag : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the Jacobian of the contribution to the state derivative.
+    ///
+    /// The drag acceleration is differentiated exactly with dual numbers, with respect to the position, velocity,
+    /// mass, surface area and drag coefficient. The atmospheric density gradient is computed with central differences.
+    ///
+    /// @param anInstant        An instant
+    /// @param x                The reduced state vector (this vector will follow the structure determined by the 'read'
+    /// coordinate subsets)
+    /// @param aFrameSPtr       The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian, with one row per 'write' coordinate and one column per 'read' coordinate
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
     /// @brief Print atmospheric drag dynamics
     ///
     /// @param anOutputStream An output stream
@@ -106,6 +148,14 @@ class AtmosphericDrag : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+    Shared<const DensityCache> densityCacheSPtr_;
+
+    Real computeAtmosphericDensity(
+        const Instant& anInstant,
+        const Vector3d& aPositionCoordinates,
+        const Transform& aTransform,
+        const Shared<const Frame>& aFrameSPtr
+    ) const;
 };
 
 }  // namespace dynamics
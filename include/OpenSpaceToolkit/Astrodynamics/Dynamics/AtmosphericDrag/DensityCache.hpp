@@ -0,0 +1,203 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache__
+#define __OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache__
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace dynamics
+{
+namespace atmosphericdrag
+{
+
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::math::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Length;
+
+/// @brief Tabulate the atmospheric density of a celestial object on an altitude x latitude x local solar time x
+/// time grid, and interpolate it.
+///
+/// Grid nodes are evaluated lazily with the atmospheric model of the celestial object, the first time a cell is
+/// visited. Each visited cell is validated once against a direct evaluation at its center: cells where the
+/// interpolation error exceeds the relative tolerance are evaluated directly from then on. Queries outside of the
+/// cache interval are evaluated directly as well.
+///
+/// The cache is thread-safe, and is meant to be shared (through a shared pointer) between the AtmosphericDrag
+/// dynamics of several propagations, e.g. the members of an ensemble.
+class DensityCache
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                  DensityCache densityCache = { aCelestialSPtr, anInterval };
+    /// @endcode
+    ///
+    /// @param aCelestialSPtr A celestial object, with an atmospheric model
+    /// @param anInterval The interval over which densities are tabulated
+    /// @param anAltitudeStep (optional) The altitude step of the grid. Defaults to 5 km.
+    /// @param aLatitudeStep (optional) The latitude step of the grid. Defaults to 5 deg.
+    /// @param aLocalSolarTimeStep (optional) The local solar time step of the grid, dividing a day into at most 4096
+    ///                  nodes. Defaults to 1 hour.
+    /// @param aTimeStep (optional) The time step of the grid. Defaults to 1 hour.
+    /// @param aRelativeTolerance (optional) The maximum relative interpolation error of a cell. Defaults to 1%.
+    DensityCache(
+        const Shared<const Celestial>& aCelestialSPtr,
+        const Interval& anInterval,
+        const Length& anAltitudeStep = Length::Kilometers(5.0),
+        const Angle& aLatitudeStep = Angle::Degrees(5.0),
+        const Duration& aLocalSolarTimeStep = Duration::Hours(1.0),
+        const Duration& aTimeStep = Duration::Hours(1.0),
+        const Real& aRelativeTolerance = 1.0e-2
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aDensityCache A density cache
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const DensityCache& aDensityCache);
+
+    /// @brief Check if density cache is defined
+    ///
+    /// @return True if density cache is defined
+    bool isDefined() const;
+
+    /// @brief Get celestial
+    ///
+    /// @return A celestial object
+    Shared<const Celestial> getCelestial() const;
+
+    /// @brief Get interval
+    ///
+    /// @return The interval over which densities are tabulated
+    Interval getInterval() const;
+
+    /// @brief Get relative tolerance
+    ///
+    /// @return The maximum relative interpolation error of a cell
+    Real getRelativeTolerance() const;
+
+    /// @brief Get the number of evaluated grid nodes
+    ///
+    /// @return The number of evaluated grid nodes
+    Size getNodeCount() const;
+
+    /// @brief Get the number of queries answered by interpolation
+    ///
+    /// @return The number of interpolated queries
+    Size getInterpolatedQueryCount() const;
+
+    /// @brief Get the number of queries answered by a direct evaluation of the atmospheric model
+    ///
+    /// @return The number of direct queries
+    Size getDirectQueryCount() const;
+
+    /// @brief Get the atmospheric density at a position
+    ///
+    /// @param aPositionCoordinates The position coordinates, in meters, expressed in the ITRF
+    /// @param anInstant An instant
+    /// @return The atmospheric density, in kg/m^3
+    Real getDensityAt(const Vector3d& aPositionCoordinates, const Instant& anInstant) const;
+
+    /// @brief Clear all tabulated densities
+    void clear();
+
+    /// @brief Print density cache
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+   private:
+    Shared<const Celestial> celestialObjectSPtr_;
+    Shared<const Celestial> sunSPtr_;
+    Interval interval_;
+
+    double altitudeStepSI_;
+    double latitudeStepDeg_;
+    double localSolarTimeStepHours_;
+    double timeStepSI_;
+    double relativeTolerance_;
+
+    std::int64_t localSolarTimeNodeCount_;
+
+    mutable std::shared_mutex mutex_;
+    mutable std::unordered_map<std::uint64_t, double> logDensities_;
+    mutable std::unordered_map<std::uint64_t, bool> cellValidities_;
+    mutable std::unordered_map<std::int64_t, double> sunLongitudesDeg_;
+
+    mutable std::atomic<Size> interpolatedQueryCount_;
+    mutable std::atomic<Size> directQueryCount_;
+
+    double evaluateDensityAt(
+        const double& anAltitudeSI, const double& aLatitudeDeg, const double& aLongitudeDeg, const Instant& anInstant
+    ) const;
+
+    double accessSunLongitudeAt(const std::int64_t& aTimeIndex) const;
+
+    double accessLogDensityAt(
+        const std::int64_t& anAltitudeIndex,
+        const std::int64_t& aLatitudeIndex,
+        const std::int64_t& aLocalSolarTimeIndex,
+        const std::int64_t& aTimeIndex
+    ) const;
+
+    double interpolateLogDensity(
+        const std::int64_t& anAltitudeIndex,
+        const std::int64_t& aLatitudeIndex,
+        const std::int64_t& aLocalSolarTimeIndex,
+        const std::int64_t& aTimeIndex,
+        const double (&aFractionArray)[4]
+    ) const;
+
+    bool isCellInterpolable(
+        const std::int64_t& anAltitudeIndex,
+        const std::int64_t& aLatitudeIndex,
+        const std::int64_t& aLocalSolarTimeIndex,
+        const std::int64_t& aTimeIndex
+    ) const;
+
+    static std::uint64_t Key(
+        const std::int64_t& anAltitudeIndex,
+        const std::int64_t& aLatitudeIndex,
+        const std::int64_t& aLocalSolarTimeIndex,
+        const std::int64_t& aTimeIndex
+    );
+};
+
+}  // namespace atmosphericdrag
+}  // namespace dynamics
+}  // namespace astro
+}  // namespace ostk
+
+#endif
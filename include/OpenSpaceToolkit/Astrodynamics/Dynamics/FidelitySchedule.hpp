@@ -0,0 +1,237 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule__
+#define __OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule__
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace dynamics
+{
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Index;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::Vector3d;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+using ostk::physics::units::Length;
+
+using ostk::astro::Dynamics;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+
+/// @brief Select a set of dynamics (force model fidelity) according to the altitude above, or distance from, a
+/// celestial object
+///
+/// The criterion range is split into regimes by increasing thresholds, and each regime is modeled by its own set of
+/// dynamics, e.g. a high degree gravity field and atmospheric drag at low altitude, and a low degree gravity field
+/// without drag higher up. A gravity degree change is expressed with central body gravity dynamics built on celestial
+/// objects of different degrees.
+///
+/// When propagated, the schedule keeps its regime until the criterion leaves the regime range widened by the
+/// hysteresis on both sides, so that a trajectory grazing a threshold does not switch back and forth. Each switch is
+/// an integration restart point: the force model is smooth over every integrated arc, and the step size control keeps
+/// the accuracy of each regime. Outside of a propagation, the contribution is the one of the regime holding the
+/// criterion, without hysteresis.
+///
+/// @code{.cpp}
+///     FidelitySchedule schedule = {
+///         earthSPtr,
+///         FidelitySchedule::Criterion::Altitude,
+///         {Length::Kilometers(1000.0)},
+///         {{highDegreeGravitySPtr, atmosphericDragSPtr}, {lowDegreeGravitySPtr}},
+///         Length::Kilometers(10.0),
+///     };
+/// @endcode
+class FidelitySchedule : public Dynamics
+{
+   public:
+    enum class Criterion
+    {
+        Altitude,  ///< Distance from the center of the celestial object, minus its equatorial radius
+        Distance   ///< Distance from the center of the celestial object
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param aCelestialObjectSPtr A celestial object, from which the criterion is measured
+    /// @param aCriterion A criterion
+    /// @param aThresholdArray The N - 1 thresholds between the N regimes, strictly increasing
+    /// @param aDynamicsArrays The dynamics of each of the N regimes, in increasing criterion order
+    /// @param aHysteresis (optional) The hysteresis, smaller than half the smallest gap between thresholds. Defaults
+    /// to zero.
+    /// @param aName (optional) A name
+    FidelitySchedule(
+        const Shared<const Celestial>& aCelestialObjectSPtr,
+        const Criterion& aCriterion,
+        const Array<Length>& aThresholdArray,
+        const Array<Array<Shared<Dynamics>>>& aDynamicsArrays,
+        const Length& aHysteresis = Length::Meters(0.0),
+        const String& aName = "Fidelity Schedule"
+    );
+
+    /// @brief Destructor
+    virtual ~FidelitySchedule() override;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aFidelitySchedule A fidelity schedule
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const FidelitySchedule& aFidelitySchedule);
+
+    /// @brief Check if fidelity schedule is defined
+    ///
+    /// @return True if fidelity schedule is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Get celestial
+    ///
+    /// @return A celestial object
+    Shared<const Celestial> getCelestial() const;
+
+    /// @brief Get criterion
+    ///
+    /// @return The criterion
+    Criterion getCriterion() const;
+
+    /// @brief Get thresholds
+    ///
+    /// @return The thresholds between the regimes
+    Array<Length> getThresholds() const;
+
+    /// @brief Get hysteresis
+    ///
+    /// @return The hysteresis
+    Length getHysteresis() const;
+
+    /// @brief Get number of regimes
+    ///
+    /// @return The number of regimes
+    Size getRegimeCount() const;
+
+    /// @brief Get the dynamics of a regime
+    ///
+    /// @param anIndex A regime index
+    /// @return The dynamics of the regime
+    Array<Shared<Dynamics>> getRegimeDynamics(const Index& anIndex) const;
+
+    /// @brief Access a regime, as a dynamics with the coordinates subsets of the schedule
+    ///
+    /// @param anIndex A regime index
+    /// @return The regime
+    const Shared<Dynamics>& accessRegime(const Index& anIndex) const;
+
+    /// @brief Calculate the criterion value at a position
+    ///
+    /// @param anInstant An instant
+    /// @param aPositionCoordinates Position coordinates, in meters
+    /// @param aFrameSPtr The frame in which the position is expressed
+    /// @return The criterion value, in meters
+    Real calculateCriterionValue(
+        const Instant& anInstant, const Vector3d& aPositionCoordinates, const Shared<const Frame>& aFrameSPtr
+    ) const;
+
+    /// @brief Calculate the index of the regime holding a criterion value, without hysteresis
+    ///
+    /// @param aCriterionValue A criterion value, in meters
+    /// @return The regime index
+    Index calculateRegimeIndex(const Real& aCriterionValue) const;
+
+    /// @brief Check if a criterion value lies in the range of a regime, widened by the hysteresis
+    ///
+    /// @param aCriterionValue A criterion value, in meters
+    /// @param anIndex A regime index
+    /// @return True if the regime holds the criterion value
+    bool isInRegime(const Real& aCriterionValue, const Index& anIndex) const;
+
+    /// @brief Return the coordinates subsets that the instance reads from: the cartesian position, and the subsets
+    /// read by the dynamics of every regime
+    ///
+    /// @return The coordinates subsets that the instance reads from
+    virtual Array<Shared<const CoordinatesSubset>> getReadCoordinatesSubsets() const override;
+
+    /// @brief Return the coordinates subsets that the instance writes to: the subsets written by the dynamics of every
+    /// regime
+    ///
+    /// @return The coordinates subsets that the instance writes to
+    virtual Array<Shared<const CoordinatesSubset>> getWriteCoordinatesSubsets() const override;
+
+    /// @brief Compute the contribution to the state derivative, from the dynamics of the regime holding the criterion
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the 'read' coordinate
+    /// subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The reduced derivative state vector (this vector must follow the structure determined by the 'write'
+    /// coordinate subsets) expressed in the given frame
+    virtual VectorXd computeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative, from the dynamics of the regime holding
+    /// the criterion
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the 'read' coordinate
+    /// subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian, with one row per 'write' coordinate and one column per 'read' coordinate
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Print fidelity schedule
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+    /// @brief Get string from criterion
+    ///
+    /// @param aCriterion A criterion
+    /// @return The criterion string
+    static String StringFromCriterion(const Criterion& aCriterion);
+
+   private:
+    Shared<const Celestial> celestialObjectSPtr_;
+    Criterion criterion_;
+    Array<Real> thresholds_;
+    Array<Array<Shared<Dynamics>>> dynamicsArrays_;
+    Real hysteresis_;
+    Array<Shared<const CoordinatesSubset>> readCoordinatesSubsets_;
+    Array<Shared<const CoordinatesSubset>> writeCoordinatesSubsets_;
+    Array<Shared<Dynamics>> regimes_;
+};
+
+}  // namespace dynamics
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -72,6 +72,18 @@ class PositionDerivative : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Compute the Jacobian of the contribution to the state derivative, the identity.
+    ///
+    /// @param anInstant        An instant
+    /// @param x                The reduced state vector (this vector will follow the structure determined by the 'read'
+    /// coordinate subsets)
+    /// @param aFrameSPtr       The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian, with one row per 'write' coordinate and one column per 'read' coordinate
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
     /// @brief Print
     ///
     /// @param anOutputStream An output stream
@@ -3,10 +3,16 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity__
 
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 
@@ -17,11 +23,18 @@ namespace astro
 namespace dynamics
 {
 
+using ostk::core::ctnr::Array;
 using ostk::core::types::Integer;
+using ostk::core::types::Size;
 using ostk::core::types::String;
 
+using ostk::math::object::MatrixXd;
+using ostk::math::object::Vector3d;
+
 using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 
 using ostk::astro::Dynamics;
 
@@ -94,6 +107,37 @@ class ThirdBodyGravity : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Precompute the position of the third body in GCRF over an interval, as piecewise Chebyshev
+    /// polynomials.
+    ///
+    /// Once precomputed, contributions requested in GCRF at an instant within the interval are computed
+    /// analytically (point mass and indirect term) from the fitted position, without querying the ephemeris of
+    /// the celestial object. Other requests fall back to the celestial gravitational model.
+    ///
+    /// @code{.cpp}
+    ///                  thirdBodyGravity.precomputeEphemeris(Interval::Closed(startInstant, endInstant));
+    /// @endcode
+    ///
+    /// @param anInterval An interval, typically the propagation span
+    /// @param aSegmentDuration (optional) The duration covered by each Chebyshev segment. Defaults to 1 day.
+    /// @param aDegree (optional) The degree of the Chebyshev polynomials. Defaults to 13.
+    void precomputeEphemeris(
+        const Interval& anInterval, const Duration& aSegmentDuration = Duration::Days(1.0), const Size& aDegree = 13
+    );
+
+    /// @brief Check if the third body ephemeris has been precomputed
+    ///
+    /// @return True if the third body ephemeris has been precomputed
+    bool hasPrecomputedEphemeris() const;
+
+    /// @brief Get the interval over which the third body ephemeris has been precomputed
+    ///
+    /// @return The precomputed ephemeris interval (undefined if not precomputed)
+    Interval getPrecomputedEphemerisInterval() const;
+
+    /// @brief Clear the precomputed third body ephemeris
+    void clearPrecomputedEphemeris();
+
     /// @brief Print third body gravity dynamics
     ///
     /// @param anOutputStream An output stream
@@ -102,6 +146,13 @@ class ThirdBodyGravity : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+
+    Interval ephemerisInterval_;
+    double ephemerisSegmentDurationSI_;
+    Array<MatrixXd> ephemerisCoefficients_;  // One (3 x degree + 1) coefficients matrix per segment
+    double gravitationalParameterSI_;
+
+    Vector3d evaluatePrecomputedPositionAt(const Instant& anInstant) const;
 };
 
 }  // namespace dynamics
@@ -6,6 +6,9 @@
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
@@ -23,6 +26,8 @@ using ostk::core::types::String;
 using ostk::core::types::Shared;
 using ostk::core::ctnr::Array;
 
+using ostk::physics::time::Duration;
+
 using ostk::astro::Dynamics;
 using ostk::astro::flight::system::SatelliteSystem;
 using ostk::astro::trajectory::state::CoordinatesSubset;
@@ -32,15 +37,89 @@ using ostk::astro::GuidanceLaw;
 class Thruster : public Dynamics
 {
    public:
+    /// @brief Policy for updating the thrust direction from the guidance law during an integration
+    ///
+    /// With a step start policy, the guidance law is evaluated at the start of each accepted integration step, and
+    /// the thrust direction and throttle are held over the step. With a fixed cadence, time is split into windows of
+    /// the given duration, aligned on J2000: the guidance law is evaluated at the start of the integration and at the
+    /// first accepted step in each new window, and held until the end of the window, as flight software would command
+    /// them.
+    ///
+    /// Held values are only updated at the start of an integration and at accepted steps, never at the intermediate
+    /// stages or rejected steps of the numerical solver. They belong to a system of equations (see
+    /// Dynamics::GetSystemOfEquations), so that a thruster can be shared across concurrent propagations, and they are
+    /// updated anew at the start of each integration (e.g. each arc of a piecewise propagation). Evaluations outside
+    /// of an integration with a step observer (e.g. contribution breakdowns) always use the guidance law.
+    class GuidanceUpdatePolicy
+    {
+       public:
+        enum class Type
+        {
+            Continuous,   ///< Evaluate the guidance law at every evaluation of the dynamics
+            StepStart,    ///< Evaluate the guidance law at the start of each step, and hold it over the step
+            FixedCadence  ///< Evaluate the guidance law once per window, and hold it in between
+        };
+
+        /// @brief Constructor
+        ///
+        /// @param aType A type
+        /// @param anInterval The update interval (FixedCadence)
+        GuidanceUpdatePolicy(const Type& aType, const Duration& anInterval);
+
+        /// @brief Equal to operator
+        ///
+        /// @param aGuidanceUpdatePolicy A guidance update policy
+        /// @return True if guidance update policies are equal
+        bool operator==(const GuidanceUpdatePolicy& aGuidanceUpdatePolicy) const;
+
+        /// @brief Get type
+        ///
+        /// @return Type
+        Type getType() const;
+
+        /// @brief Get update interval (FixedCadence)
+        ///
+        /// @return Update interval
+        Duration getInterval() const;
+
+        /// @brief Evaluate the guidance law at every evaluation of the dynamics
+        ///
+        /// @return A guidance update policy
+        static GuidanceUpdatePolicy Continuous();
+
+        /// @brief Evaluate the guidance law at the start of each accepted step, and hold it over the step
+        ///
+        /// @return A guidance update policy
+        static GuidanceUpdatePolicy StepStart();
+
+        /// @brief Evaluate the guidance law once per window of a given duration, and hold it in between
+        ///
+        /// @param anInterval An update interval, strictly positive
+        /// @return A guidance update policy
+        static GuidanceUpdatePolicy FixedCadence(const Duration& anInterval);
+
+        /// @brief Get string from type
+        ///
+        /// @param aType A type
+        /// @return String
+        static String StringFromType(const Type& aType);
+
+       private:
+        Type type_;
+        Duration interval_;
+    };
+
     /// @brief Constructor
     ///
     /// @param aSatelliteSystem A satellite system
     /// @param aGuidanceLaw A guidance law
     /// @param aName A name
+    /// @param aGuidanceUpdatePolicy (optional) A guidance update policy. Defaults to continuous.
     Thruster(
         const SatelliteSystem& aSatelliteSystem,
         const Shared<const GuidanceLaw>& aGuidanceLaw,
-        const String& aName = "Thruster"
+        const String& aName = "Thruster",
+        const GuidanceUpdatePolicy& aGuidanceUpdatePolicy = GuidanceUpdatePolicy::Continuous()
     );
 
     ~Thruster();
@@ -55,6 +134,11 @@ class Thruster : public Dynamics
     /// @return Guidance law
     Shared<const GuidanceLaw> getGuidanceLaw() const;
 
+    /// @brief Get guidance update policy
+    ///
+    /// @return Guidance update policy
+    GuidanceUpdatePolicy getGuidanceUpdatePolicy() const;
+
     /// @brief Return the coordinates subsets that the instance reads from
     ///
     /// @return The coordinates subsets that the instance reads from
@@ -83,6 +167,59 @@ class Thruster : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Create the thrust held over the accepted steps of an integration
+    ///
+    /// @return A hold, null with a continuous guidance update policy
+    virtual Shared<Hold> createHold() const override;
+
+    /// @brief Update the held thrust from the guidance law, following the guidance update policy
+    ///
+    /// @param aHold A hold, created by the instance
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param isIntegrationStart True at the start of the integration
+    ///
+    /// @return True if the held thrust was updated
+    virtual bool updateHold(
+        Hold& aHold,
+        const Instant& anInstant,
+        const VectorXd& x,
+        const Shared<const Frame>& aFrameSPtr,
+        const bool& isIntegrationStart
+    ) const override;
+
+    /// @brief Compute the contribution to the state derivative, with the held thrust direction and throttle
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aHold A hold, created by the instance
+    ///
+    /// @return The reduced derivative state vector (this vector must follow the structure determined by
+    /// the 'write' coordinate subsets) expressed in the given frame
+    virtual VectorXd computeHeldContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, const Hold& aHold
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution to the state derivative.
+    ///
+    /// The Jacobian of the guidance law acceleration is chained with the derivative of the maximum thrust
+    /// acceleration with respect to the mass. The guidance law is evaluated continuously, regardless of the guidance
+    /// update policy.
+    ///
+    /// @param anInstant        An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian, with one row per 'write' coordinate and one column per 'read' coordinate
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
     /// @brief Print thruster
     ///
     /// @param anOutputStream An output stream
@@ -93,8 +230,13 @@ class Thruster : public Dynamics
     const SatelliteSystem satelliteSystem_;
     const Shared<const GuidanceLaw> guidanceLaw_;
     const String name_;
+    const GuidanceUpdatePolicy guidanceUpdatePolicy_;
 
     const Real massFlowRateCache_;
+
+    double calculateMaximumThrustAccelerationMagnitude(const double& aMass) const;
+
+    VectorXd assembleContribution(const Vector3d& anAcceleration, const double& aThrustFraction) const;
 };
 
 }  // namespace dynamics
@@ -21,6 +21,7 @@ using ostk::core::types::String;
 using ostk::core::types::Shared;
 using ostk::core::types::Real;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::Vector3d;
 
 using ostk::physics::coord::Frame;
@@ -80,6 +81,28 @@ class GuidanceLaw
         const Shared<const Frame>& outputFrameSPtr
     ) const = 0;
 
+    /// @brief Compute the Jacobian of the thrust acceleration with respect to the position coordinates, the velocity
+    /// coordinates and the thrust acceleration
+    ///
+    /// The default implementation uses central differences. Guidance laws evaluating their acceleration with dual
+    /// numbers (see dual::Scalar) override it to return the exact Jacobian.
+    ///
+    /// @param anInstant An instant
+    /// @param aPositionCoordinates The position coordinates
+    /// @param aVelocityCoordinates The velocity coordinates
+    /// @param aThrustAcceleration The thrust acceleration
+    /// @param outputFrameSPtr The frame in which the acceleration is expressed
+    ///
+    /// @return The 3x7 Jacobian, its columns being the position coordinates, the velocity coordinates and the thrust
+    /// acceleration
+    virtual MatrixXd calculateThrustAccelerationJacobianAt(
+        const Instant& anInstant,
+        const Vector3d& aPositionCoordinates,
+        const Vector3d& aVelocityCoordinates,
+        const Real& aThrustAcceleration,
+        const Shared<const Frame>& outputFrameSPtr
+    ) const;
+
    protected:
     const String name_;
 };
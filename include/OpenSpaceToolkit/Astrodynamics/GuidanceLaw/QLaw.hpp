@@ -77,6 +77,7 @@ class QLaw : public GuidanceLaw
         );
 
         Vector5d getControlWeights() const;
+        Vector5d getConvergenceThresholds() const;
         Length getMinimumPeriapsisRadius() const;
 
         const double m;
@@ -176,6 +177,30 @@ class QLaw : public GuidanceLaw
         const Shared<const Frame>& outputFrameSPtr
     ) const override;
 
+    /// @brief Compute the Jacobian of the thrust acceleration with respect to the position coordinates, the velocity
+    /// coordinates and the thrust acceleration
+    ///
+    /// The conversion to orbital elements, the analytical gradient of Q and the thrust direction are evaluated with
+    /// dual numbers, yielding the exact Jacobian of the thrust acceleration computed with the analytical gradient
+    /// strategy. Falls back to central differences for near-circular or near-equatorial orbits, where the orbital
+    /// elements are floored.
+    ///
+    /// @param anInstant An instant
+    /// @param aPositionCoordinates The position coordinates
+    /// @param aVelocityCoordinates The velocity coordinates
+    /// @param aThrustAcceleration The thrust acceleration
+    /// @param outputFrameSPtr The frame in which the acceleration is expressed
+    ///
+    /// @return The 3x7 Jacobian, its columns being the position coordinates, the velocity coordinates and the thrust
+    /// acceleration
+    virtual MatrixXd calculateThrustAccelerationJacobianAt(
+        const Instant& anInstant,
+        const Vector3d& aPositionCoordinates,
+        const Vector3d& aVelocityCoordinates,
+        const Real& aThrustAcceleration,
+        const Shared<const Frame>& outputFrameSPtr
+    ) const override;
+
     /// @brief Compute the maximal change in orbital elements
     ///
     /// @param aCOEVector A vector of classical orbital elements
@@ -184,6 +209,17 @@ class QLaw : public GuidanceLaw
     /// @return The maximal change in orbital elements
     Vector5d computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, const double& aThrustAcceleration) const;
 
+    /// @brief Compute the error of orbital elements with respect to the target orbital elements
+    ///
+    /// The errors of the semi-major axis, eccentricity and inclination are signed, the errors of the RAAN and AOP are
+    /// the unsigned angular distances to their targets. The targeted elements have converged when their weighted
+    /// absolute errors are within their convergence thresholds.
+    ///
+    /// @param aCOEVector A vector of classical orbital elements
+    ///
+    /// @return The error of the orbital elements
+    Vector5d computeOrbitalElementsError(const Vector5d& aCOEVector) const;
+
     /// @brief Compute the Proximity Quotient value
     ///
     /// @param aCOEVector The vector of classical orbital elements
@@ -235,7 +271,25 @@ class QLaw : public GuidanceLaw
 
     const VectorXd trueAnomalyAngles_ = VectorXd::LinSpaced(50, 0.0, 2.0 * M_PI);
 
-    Vector5d computeDeltaCOE(const Vector5d& aCOEVector) const;
+    template <typename Scalar>
+    Eigen::Matrix<Scalar, 5, 1> computeDeltaCOE(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector) const;
+
+    /// @brief Compute the Proximity Quotient, its gradient and the maximal change in orbital elements in a single pass
+    ///
+    /// Intermediate terms are shared between the three outputs, and the gradient is obtained by applying the chain
+    /// rule to each of them, so that it is the exact derivative of the returned Q value. Evaluated with dual numbers,
+    /// the derivatives of the gradient are the exact second derivatives of Q.
+    ///
+    /// @param aCOEVector The vector of classical orbital elements
+    /// @param aThrustAcceleration The thrust acceleration
+    /// @param computeGradient If false, skip the gradient computation and return NaN values instead
+    ///
+    /// @return The Q value, the derivative of Q with respect to the orbital elements and the maximal change in orbital
+    /// elements
+    template <typename Scalar>
+    Tuple<Scalar, Eigen::Matrix<Scalar, 5, 1>, Eigen::Matrix<Scalar, 5, 1>> computeProximityQuotient(
+        const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration, const bool& computeGradient
+    ) const;
 
     Vector5d computeAnalytical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const;
     Vector5d computeNumerical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const;
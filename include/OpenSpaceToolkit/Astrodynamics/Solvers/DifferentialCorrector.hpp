@@ -0,0 +1,269 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector__
+#define __OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Index;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::MatrixXd;
+using ostk::math::object::VectorXd;
+
+using ostk::astro::EventCondition;
+using ostk::astro::trajectory::Sequence;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+
+/// @brief Differential corrector targeting constraints at the final state of a sequence
+///
+/// Control variables are either parameters of the sequence (e.g. segment durations, thrust magnitudes), passed to a
+/// sequence generator, or coordinates of the initial state. Constraints are event condition targets (e.g. COE
+/// conditions), evaluated at the final state of the sequence.
+///
+/// Each iteration takes a Newton step on the constraint residuals, scaled by their tolerances, using the minimum-norm
+/// least squares solution when the number of controls and constraints differ. The Jacobian is computed by forward
+/// differences, solving the perturbed sequences in parallel. With the Broyden method, the Jacobian is then updated
+/// from the steps taken, and only recomputed when a step does not decrease the residuals.
+///
+/// @code{.cpp}
+///     const DifferentialCorrector differentialCorrector = {DifferentialCorrector::Method::Broyden};
+///
+///     const DifferentialCorrector::Solution solution = differentialCorrector.solve(
+///         state,
+///         [](const VectorXd& aControlVector) -> Sequence { ... },  // Coast for aControlVector(0) seconds
+///         {DifferentialCorrector::ControlVariable::Parameter("Coast Duration", 600.0, 1.0)},
+///         {{std::make_shared<RealCondition>(COECondition::SemiMajorAxis(...)), 1.0}}
+///     );
+/// @endcode
+class DifferentialCorrector
+{
+   public:
+    /// @brief Jacobian update method
+    enum class Method
+    {
+        Newton,  ///< Recompute the Jacobian by finite differences at each iteration
+        Broyden  ///< Update the Jacobian from the steps taken, recompute it when a step fails
+    };
+
+    /// @brief Generate the sequence to solve for a control vector
+    ///
+    /// The generator is called once per solve, possibly concurrently: it must create new event conditions, as
+    /// solving a sequence updates the targets of its event conditions.
+    typedef std::function<Sequence(const VectorXd&)> SequenceGenerator;
+
+    /// @brief Control variable
+    struct ControlVariable
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aName A name
+        /// @param anInitialValue An initial value, undefined for an initial state coordinate
+        /// @param aPerturbation A positive finite difference perturbation
+        /// @param aLowerBound (optional) A lower bound
+        /// @param anUpperBound (optional) An upper bound
+        /// @param aCoordinatesSubsetSPtr (optional) The subset of the controlled initial state coordinate
+        /// @param aCoordinateIndex (optional) The index of the controlled coordinate in its subset
+        ControlVariable(
+            const String& aName,
+            const Real& anInitialValue,
+            const Real& aPerturbation,
+            const Real& aLowerBound = Real::Undefined(),
+            const Real& anUpperBound = Real::Undefined(),
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr = nullptr,
+            const Index& aCoordinateIndex = 0
+        );
+
+        /// @brief Construct a parameter of the sequence, passed to the sequence generator
+        ///
+        /// @param aName A name
+        /// @param anInitialValue An initial value
+        /// @param aPerturbation A positive finite difference perturbation
+        /// @param aLowerBound (optional) A lower bound
+        /// @param anUpperBound (optional) An upper bound
+        /// @return A control variable
+        static ControlVariable Parameter(
+            const String& aName,
+            const Real& anInitialValue,
+            const Real& aPerturbation,
+            const Real& aLowerBound = Real::Undefined(),
+            const Real& anUpperBound = Real::Undefined()
+        );
+
+        /// @brief Construct a coordinate of the initial state, its initial value read from the initial state
+        ///
+        /// @param aCoordinatesSubsetSPtr A coordinates subset of the initial state
+        /// @param aCoordinateIndex The index of the coordinate in the subset
+        /// @param aPerturbation A positive finite difference perturbation
+        /// @param aLowerBound (optional) A lower bound
+        /// @param anUpperBound (optional) An upper bound
+        /// @return A control variable
+        static ControlVariable InitialStateCoordinate(
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr,
+            const Index& aCoordinateIndex,
+            const Real& aPerturbation,
+            const Real& aLowerBound = Real::Undefined(),
+            const Real& anUpperBound = Real::Undefined()
+        );
+
+        /// @brief Check if the control variable is a coordinate of the initial state
+        ///
+        /// @return True if the control variable is a coordinate of the initial state
+        bool isInitialStateCoordinate() const;
+
+        String name;                                        // Name.
+        Real initialValue;                                  // Initial value, undefined for a state coordinate.
+        Real perturbation;                                  // Finite difference perturbation.
+        Real lowerBound;                                    // Lower bound, undefined if unbounded.
+        Real upperBound;                                    // Upper bound, undefined if unbounded.
+        Shared<const CoordinatesSubset> coordinatesSubset;  // Subset of the controlled state coordinate, if any.
+        Index coordinateIndex;                              // Index of the controlled coordinate in its subset.
+    };
+
+    /// @brief Constraint on the final state
+    ///
+    /// The residual is the evaluation of the event condition at the final state minus its target, relative targets
+    /// being offset by the evaluation at the initial state. Residuals of angular conditions are wrapped to [-pi, pi).
+    struct Constraint
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param anEventConditionSPtr An event condition
+        /// @param aTolerance A positive tolerance on the residual
+        Constraint(const Shared<const EventCondition>& anEventConditionSPtr, const Real& aTolerance);
+
+        /// @brief Evaluate the residual
+        ///
+        /// @param anInitialState The initial state of the sequence
+        /// @param aFinalState The final state of the sequence
+        /// @return The residual
+        Real evaluate(const State& anInitialState, const State& aFinalState) const;
+
+        Shared<const EventCondition> eventCondition;  // Targeted event condition.
+        Real tolerance;                               // Tolerance on the residual.
+    };
+
+    /// @brief Result of a differential correction
+    struct Solution
+    {
+       public:
+        /// @brief Print the solution
+        ///
+        /// @param anOutputStream An output stream
+        /// @param (optional) displayDecorators If true, display decorators
+        void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+        /// @brief Output stream operator
+        ///
+        /// @param anOutputStream An output stream
+        /// @param aSolution A solution
+        /// @return An output stream
+        friend std::ostream& operator<<(std::ostream& anOutputStream, const Solution& aSolution);
+
+        bool hasConverged;                    // True if all residuals are within their tolerances.
+        Size iterationCount;                  // Number of iterations.
+        Size jacobianEvaluationCount;         // Number of finite difference Jacobians computed.
+        Size sequenceSolveCount;              // Number of solved sequences.
+        VectorXd controlVector;               // Final control values.
+        VectorXd residuals;                   // Final constraint residuals.
+        State initialState;                   // Initial state of the final sequence.
+        Sequence::Solution sequenceSolution;  // Solution of the final sequence.
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param aMethod (optional) A Jacobian update method. Defaults to Broyden.
+    /// @param aMaximumIterationCount (optional) A maximum number of iterations. Defaults to 20.
+    /// @param aThreadCount (optional) A number of threads solving the perturbed sequences, zero meaning the hardware
+    /// concurrency. Defaults to 0.
+    DifferentialCorrector(
+        const Method& aMethod = Method::Broyden, const Size& aMaximumIterationCount = 20, const Size& aThreadCount = 0
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aDifferentialCorrector A differential corrector
+    /// @return An output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const DifferentialCorrector& aDifferentialCorrector);
+
+    /// @brief Get the Jacobian update method
+    ///
+    /// @return The Jacobian update method
+    Method getMethod() const;
+
+    /// @brief Get the maximum number of iterations
+    ///
+    /// @return The maximum number of iterations
+    Size getMaximumIterationCount() const;
+
+    /// @brief Get the number of threads
+    ///
+    /// @return The number of threads
+    Size getThreadCount() const;
+
+    /// @brief Target the constraints
+    ///
+    /// @param anInitialState An initial state
+    /// @param aSequenceGenerator A sequence generator, called with the full control vector
+    /// @param aControlVariableArray Control variables
+    /// @param aConstraintArray Constraints
+    /// @return The solution
+    Solution solve(
+        const State& anInitialState,
+        const SequenceGenerator& aSequenceGenerator,
+        const Array<ControlVariable>& aControlVariableArray,
+        const Array<Constraint>& aConstraintArray
+    ) const;
+
+    /// @brief Print the differential corrector
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Convert a method to string
+    ///
+    /// @param aMethod A method
+    /// @return A string
+    static String StringFromMethod(const Method& aMethod);
+
+   private:
+    Method method_;
+    Size maximumIterationCount_;
+    Size threadCount_;
+};
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -28,6 +28,8 @@ using ostk::core::ctnr::Array;
 
 using ostk::math::object::VectorXd;
 using ostk::math::object::MatrixXd;
+using Eigen::VectorXcd;
+using Eigen::MatrixXcd;
 
 using ostk::physics::time::Instant;
 using ostk::physics::time::Duration;
@@ -35,6 +37,9 @@ using ostk::physics::time::Duration;
 using ostk::astro::trajectory::State;
 
 /// @brief Finite Difference solver
+///
+/// The Jacobian columns are independent, and can be computed in parallel when the coordinates generator is
+/// thread-safe (e.g. when each call propagates its own copy of the dynamics).
 class FiniteDifferenceSolver
 {
    public:
@@ -51,15 +56,21 @@ class FiniteDifferenceSolver
     ///                  const Type aType = FiniteDifferenceSolver::Type::Forward;
     ///                  const Real aStepPercentage = 1e-3;
     ///                  const Duration aStepDuration = Duration::Milliseconds(1e-3);
+    ///                  const Size aThreadCount = 4;
     ///
-    ///                  FiniteDifferenceSolver finiteDifferenceSolver = {aType};
+    ///                  FiniteDifferenceSolver finiteDifferenceSolver = {aType, aStepPercentage, aStepDuration,
+    ///                  aThreadCount};
     ///
     /// @endcode
     ///
     /// @param aType A Finite Difference type.
     /// @param aStepPercentage The step percentage to use for computing the STM.
     /// @param aStepDuration The step duration to use for computing the gradient.
-    FiniteDifferenceSolver(const Type& aType, const Real& aStepPercentage, const Duration& aStepDuration);
+    /// @param aThreadCount (optional) The number of threads computing the Jacobian columns, zero meaning the hardware
+    /// concurrency. Defaults to 1, the coordinates generator then being called from the calling thread only.
+    FiniteDifferenceSolver(
+        const Type& aType, const Real& aStepPercentage, const Duration& aStepDuration, const Size& aThreadCount = 1
+    );
 
     /// @brief Output stream operator.
     ///
@@ -83,8 +94,16 @@ class FiniteDifferenceSolver
     /// @return The step duration.
     Duration getStepDuration() const;
 
+    /// @brief Get the number of threads computing the Jacobian columns.
+    ///
+    /// @return The number of threads, zero meaning the hardware concurrency.
+    Size getThreadCount() const;
+
     /// @brief Compute the Jacobian by perturbing the coordinates
     ///
+    /// The one-sided schemes evaluate the unperturbed coordinates once, for a total of n + 1 calls to
+    /// `generateStateCoordinates`, and the central scheme 2n calls, n being the state size.
+    ///
     /// @param aState A state.
     /// @param anInstantArray An array of instants.
     /// @param generateStateCoordinates Callable to generate coordinates of States at the
@@ -116,6 +135,27 @@ class FiniteDifferenceSolver
         const Size& aCoordinatesDimension
     ) const;
 
+    /// @brief Compute the Jacobian by complex-step differentiation
+    ///
+    /// Each coordinate is perturbed along the imaginary axis, the derivatives being the imaginary parts of the
+    /// generated coordinates divided by the step. There is no subtractive cancellation, so the step can be made
+    /// negligible and the derivatives are accurate to machine precision, without step tuning. Requires a generator
+    /// written with complex-safe operations (no `abs`, comparisons or branches on the imaginary part).
+    ///
+    /// @param aState A state.
+    /// @param anInstantArray An array of instants.
+    /// @param generateStateCoordinates Callable to generate coordinates at the requested Instants, from complex
+    /// coordinates of the state at its instant, in its frame.
+    /// @param aCoordinatesDimension The dimension of the coordinates produced by `generateStateCoordinates`.
+    ///
+    /// @return The Jacobian
+    MatrixXd computeComplexStepJacobian(
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const std::function<MatrixXcd(const VectorXcd&, const Array<Instant>&)>& generateStateCoordinates,
+        const Size& aCoordinatesDimension
+    ) const;
+
     /// @brief Compute the gradient.
     ///
     /// @param aState The state to compute the gradient of.
@@ -149,6 +189,7 @@ class FiniteDifferenceSolver
     const Type type_;
     const Real stepPercentage_;
     const Duration stepDuration_;
+    const Size threadCount_;
 };
 
 }  // namespace solvers
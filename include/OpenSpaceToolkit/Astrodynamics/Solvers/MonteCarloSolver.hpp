@@ -0,0 +1,320 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver__
+#define __OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Index;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::MatrixXd;
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+
+using ostk::astro::flight::system::SatelliteSystem;
+using ostk::astro::trajectory::Sequence;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+
+/// @brief Monte Carlo dispersion solver for sequences
+///
+/// Each sample disperses a nominal state and a nominal satellite system, generates a sequence for the dispersed
+/// satellite system, and solves it from the dispersed state. A sample draws from its own random stream, seeded from
+/// the solver seed and the sample index: samples do not depend on each other, nor on the thread count.
+///
+/// Samples are solved on a pool of threads. Their final states, delta-v and propagation durations are aggregated on
+/// the fly, in sample order: mean, covariance and percentiles (P-square estimates) are computed without keeping the
+/// trajectories, and are reproducible regardless of the thread count.
+///
+/// @code{.cpp}
+///     const MonteCarloSolver monteCarloSolver = {
+///         state,
+///         satelliteSystem,
+///         [](const SatelliteSystem& aSatelliteSystem) -> Sequence { ... },
+///         {MonteCarloSolver::StateDispersion::Normal(CartesianPosition::Default(), {10.0, 10.0, 10.0})},
+///         {MonteCarloSolver::SatelliteSystemDispersion::Normal(Parameter::Thrust, 0.01)},
+///     };
+///
+///     const MonteCarloSolver::Solution solution = monteCarloSolver.solve(10000);
+/// @endcode
+class MonteCarloSolver
+{
+   public:
+    /// @brief Distribution of a dispersion
+    enum class Distribution
+    {
+        Normal,  ///< Standard normal distribution, scaled
+        Uniform  ///< Uniform distribution over [-1, 1], scaled
+    };
+
+    /// @brief Generate the sequence of a sample from its dispersed satellite system
+    ///
+    /// The generator is called once per sample, possibly concurrently: it must create new event conditions and
+    /// dynamics, as solving a sequence updates the targets of its event conditions.
+    typedef std::function<Sequence(const SatelliteSystem&)> SequenceGenerator;
+
+    /// @brief Dispersion of the coordinates of a subset of the state, added to the nominal coordinates
+    ///
+    /// The dispersion is the scale matrix times a vector of independent draws, expressed in the frame of the nominal
+    /// state. Dynamics reading coordinates from the state (e.g. mass, surface area and drag coefficient for
+    /// atmospheric drag) are dispersed through the matching subsets.
+    struct StateDispersion
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aCoordinatesSubsetSPtr A coordinates subset of the nominal state
+        /// @param aDistribution A distribution
+        /// @param aScaleMatrix A square scale matrix, of the size of the subset
+        StateDispersion(
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr,
+            const Distribution& aDistribution,
+            const MatrixXd& aScaleMatrix
+        );
+
+        /// @brief Construct an uncorrelated normal dispersion
+        ///
+        /// @param aCoordinatesSubsetSPtr A coordinates subset of the nominal state
+        /// @param aStandardDeviationVector The standard deviation of each coordinate
+        /// @return A state dispersion
+        static StateDispersion Normal(
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const VectorXd& aStandardDeviationVector
+        );
+
+        /// @brief Construct a correlated normal dispersion, scaled by the Cholesky factor of a covariance
+        ///
+        /// @param aCoordinatesSubsetSPtr A coordinates subset of the nominal state
+        /// @param aCovarianceMatrix A symmetric positive definite covariance matrix
+        /// @return A state dispersion
+        static StateDispersion Covariance(
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const MatrixXd& aCovarianceMatrix
+        );
+
+        /// @brief Construct an uncorrelated uniform dispersion
+        ///
+        /// @param aCoordinatesSubsetSPtr A coordinates subset of the nominal state
+        /// @param aHalfWidthVector The half width of the interval of each coordinate, around its nominal value
+        /// @return A state dispersion
+        static StateDispersion Uniform(
+            const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const VectorXd& aHalfWidthVector
+        );
+
+        Shared<const CoordinatesSubset> coordinatesSubset;  // Dispersed coordinates subset.
+        Distribution distribution;                          // Distribution of the draws.
+        MatrixXd scaleMatrix;                               // Scale matrix applied to the draws.
+    };
+
+    /// @brief Dispersion of a parameter of the satellite system, added to its nominal value
+    struct SatelliteSystemDispersion
+    {
+       public:
+        /// @brief Dispersed parameter
+        enum class Parameter
+        {
+            DryMass,                    ///< Dry mass [kg]
+            CrossSectionalSurfaceArea,  ///< Cross-sectional surface area [m^2]
+            DragCoefficient,            ///< Drag coefficient [-]
+            Thrust,                     ///< Thrust of the propulsion system [N]
+            SpecificImpulse             ///< Specific impulse of the propulsion system [s]
+        };
+
+        /// @brief Constructor
+        ///
+        /// @param aParameter A parameter
+        /// @param aDistribution A distribution
+        /// @param aScale A positive scale applied to the draw, in the unit of the parameter
+        SatelliteSystemDispersion(const Parameter& aParameter, const Distribution& aDistribution, const Real& aScale);
+
+        /// @brief Construct a normal dispersion
+        ///
+        /// @param aParameter A parameter
+        /// @param aStandardDeviation A standard deviation
+        /// @return A satellite system dispersion
+        static SatelliteSystemDispersion Normal(const Parameter& aParameter, const Real& aStandardDeviation);
+
+        /// @brief Construct a uniform dispersion
+        ///
+        /// @param aParameter A parameter
+        /// @param aHalfWidth The half width of the interval, around the nominal value
+        /// @return A satellite system dispersion
+        static SatelliteSystemDispersion Uniform(const Parameter& aParameter, const Real& aHalfWidth);
+
+        /// @brief Convert parameter to string
+        ///
+        /// @param aParameter A parameter
+        /// @return A string
+        static String StringFromParameter(const Parameter& aParameter);
+
+        Parameter parameter;        // Dispersed parameter.
+        Distribution distribution;  // Distribution of the draw.
+        Real scale;                 // Scale applied to the draw.
+    };
+
+    /// @brief Dispersed inputs of a sample
+    struct Sample
+    {
+        Index index;                      // Index of the sample.
+        State state;                      // Dispersed initial state.
+        SatelliteSystem satelliteSystem;  // Dispersed satellite system.
+    };
+
+    /// @brief Statistics of a quantity over the samples
+    struct Statistics
+    {
+        VectorXd mean;         // Mean of each component.
+        MatrixXd covariance;   // Sample covariance of the components.
+        MatrixXd percentiles;  // Percentile estimates, one row per percentile and one column per component.
+    };
+
+    /// @brief Aggregated results of the samples
+    struct Solution
+    {
+       public:
+        /// @brief Print the solution
+        ///
+        /// @param anOutputStream An output stream
+        /// @param (optional) displayDecorators If true, display decorators
+        void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+        /// @brief Output stream operator
+        ///
+        /// @param anOutputStream An output stream
+        /// @param aSolution A solution
+        /// @return An output stream
+        friend std::ostream& operator<<(std::ostream& anOutputStream, const Solution& aSolution);
+
+        Size sampleCount;                // Number of solved samples.
+        Size completeSampleCount;        // Number of samples whose sequence executed completely, aggregated.
+        Size incompleteSampleCount;      // Number of samples whose sequence did not execute completely.
+        Size failedSampleCount;          // Number of samples whose generation or solve threw.
+        Array<Real> percentiles;         // Estimated percentiles, in percent.
+        Shared<const Frame> frame;       // Frame of the final coordinates.
+        Statistics finalCoordinates;     // Statistics of the final state coordinates.
+        Statistics deltaV;               // Statistics of the delta-v [m/s].
+        Statistics propagationDuration;  // Statistics of the propagation duration [s].
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param aNominalState A nominal initial state
+    /// @param aNominalSatelliteSystem A nominal satellite system
+    /// @param aSequenceGenerator A sequence generator
+    /// @param aStateDispersionArray (optional) State dispersions, applied in order
+    /// @param aSatelliteSystemDispersionArray (optional) Satellite system dispersions, applied in order
+    /// @param aSeed (optional) The seed of the random streams. Defaults to 0.
+    MonteCarloSolver(
+        const State& aNominalState,
+        const SatelliteSystem& aNominalSatelliteSystem,
+        const SequenceGenerator& aSequenceGenerator,
+        const Array<StateDispersion>& aStateDispersionArray = Array<StateDispersion>::Empty(),
+        const Array<SatelliteSystemDispersion>& aSatelliteSystemDispersionArray =
+            Array<SatelliteSystemDispersion>::Empty(),
+        const Size& aSeed = 0
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aMonteCarloSolver A Monte Carlo solver
+    /// @return An output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const MonteCarloSolver& aMonteCarloSolver);
+
+    /// @brief Get the nominal state
+    ///
+    /// @return The nominal state
+    State getNominalState() const;
+
+    /// @brief Get the nominal satellite system
+    ///
+    /// @return The nominal satellite system
+    SatelliteSystem getNominalSatelliteSystem() const;
+
+    /// @brief Get the state dispersions
+    ///
+    /// @return The state dispersions
+    Array<StateDispersion> getStateDispersions() const;
+
+    /// @brief Get the satellite system dispersions
+    ///
+    /// @return The satellite system dispersions
+    Array<SatelliteSystemDispersion> getSatelliteSystemDispersions() const;
+
+    /// @brief Get the seed
+    ///
+    /// @return The seed
+    Size getSeed() const;
+
+    /// @brief Generate the dispersed inputs of a sample
+    ///
+    /// @param anIndex A sample index
+    /// @return The sample
+    Sample generateSample(const Index& anIndex) const;
+
+    /// @brief Solve samples, and aggregate their results
+    ///
+    /// @code{.cpp}
+    ///     MonteCarloSolver::Solution solution = monteCarloSolver.solve(10000, 0, {1.0, 50.0, 99.0}) ;
+    ///     VectorXd finalCoordinatesMedian = solution.finalCoordinates.percentiles.row(1) ;
+    /// @endcode
+    ///
+    /// @param aSampleCount A number of samples, indexed from zero
+    /// @param aThreadCount (optional) A number of threads, zero meaning the hardware concurrency. Defaults to 0.
+    /// @param aPercentileArray (optional) Percentiles to estimate, in percent. Defaults to 5, 50 and 95.
+    /// @param aFrameSPtr (optional) The frame of the final coordinates. Defaults to GCRF.
+    /// @return The solution
+    Solution solve(
+        const Size& aSampleCount,
+        const Size& aThreadCount = 0,
+        const Array<Real>& aPercentileArray = {5.0, 50.0, 95.0},
+        const Shared<const Frame>& aFrameSPtr = Frame::GCRF()
+    ) const;
+
+    /// @brief Print the solver
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+   private:
+    State nominalState_;
+    SatelliteSystem nominalSatelliteSystem_;
+    SequenceGenerator sequenceGenerator_;
+    Array<StateDispersion> stateDispersions_;
+    Array<SatelliteSystemDispersion> satelliteSystemDispersions_;
+    Size seed_;
+};
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,238 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy__
+#define __OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy__
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Index;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using Vector5d = Eigen::Matrix<double, 5, 1>;
+
+using ostk::physics::time::Duration;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Mass;
+
+using ostk::astro::Dynamics;
+using ostk::astro::flight::system::SatelliteSystem;
+using ostk::astro::guidancelaw::QLaw;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::orbit::models::kepler::COE;
+using ostk::astro::trajectory::state::NumericalSolver;
+
+/// @brief Trade study of QLaw transfers
+///
+/// Each case of the study is a QLaw transfer from a shared initial state, with a shared satellite system, towards a
+/// target orbit with a set of QLaw parameters. A transfer is a maneuver segment thrusting along the QLaw direction,
+/// until the targeted elements have converged or the maximum time of flight is reached.
+///
+/// Cases are solved on a pool of threads. Each case creates its own guidance law, thruster and convergence condition,
+/// while the environment dynamics are shared by the concurrent transfers. Only summary metrics are kept, and
+/// optionally trajectories decimated to every few states, so that large studies fit in memory.
+///
+/// @code{.cpp}
+///     const QLawTradeStudy tradeStudy = {
+///         state,
+///         satelliteSystem,
+///         {std::make_shared<PositionDerivative>(), std::make_shared<CentralBodyGravity>(earthSPtr)},
+///         numericalSolver,
+///         EarthGravitationalModel::EGM2008.gravitationalParameter_,
+///         Duration::Days(30.0),
+///     };
+///
+///     const Array<QLawTradeStudy::Result> results =
+///         tradeStudy.solve(QLawTradeStudy::ParameterCases(targetCOE, parametersArray));
+/// @endcode
+class QLawTradeStudy
+{
+   public:
+    /// @brief A transfer of the study
+    struct Case
+    {
+        COE targetCOE;                // Target orbit.
+        QLaw::Parameters parameters;  // QLaw parameters.
+    };
+
+    /// @brief Outcome of a transfer
+    enum class Status
+    {
+        Converged,     ///< The targeted elements have converged
+        NotConverged,  ///< The maximum time of flight was reached before convergence
+        Failed         ///< The transfer threw (e.g. out of fuel, or a degenerate orbit)
+    };
+
+    /// @brief Summary metrics of a transfer
+    struct Result
+    {
+       public:
+        /// @brief Print the result
+        ///
+        /// @param anOutputStream An output stream
+        /// @param (optional) displayDecorators If true, display decorators
+        void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+        /// @brief Output stream operator
+        ///
+        /// @param anOutputStream An output stream
+        /// @param aResult A result
+        /// @return An output stream
+        friend std::ostream& operator<<(std::ostream& anOutputStream, const Result& aResult);
+
+        Index index;                  // Index of the case.
+        Status status;                // Outcome of the transfer.
+        Duration timeOfFlight;        // Time of flight, undefined if failed.
+        Real deltaV;                  // Delta-v [m/s], undefined if failed.
+        Mass propellantMass;          // Propellant mass, undefined if failed.
+        Vector5d finalElementsError;  // Final errors of the a, e, i, RAAN and AOP, NaN if failed.
+        Array<State> trajectory;      // Decimated trajectory, empty if not requested or failed.
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param anInitialState An initial state, with position, velocity and mass coordinates
+    /// @param aSatelliteSystem A satellite system, with a propulsion system
+    /// @param anEnvironmentDynamicsArray Dynamics other than the thruster, shared by the concurrent transfers
+    /// @param aNumericalSolver A numerical solver
+    /// @param aGravitationalParameter The gravitational parameter of the central body
+    /// @param aMaximumTimeOfFlight The maximum time of flight of a transfer
+    /// @param aGradientStrategy (optional) The QLaw gradient strategy. Defaults to Analytical.
+    QLawTradeStudy(
+        const State& anInitialState,
+        const SatelliteSystem& aSatelliteSystem,
+        const Array<Shared<Dynamics>>& anEnvironmentDynamicsArray,
+        const NumericalSolver& aNumericalSolver,
+        const Derived& aGravitationalParameter,
+        const Duration& aMaximumTimeOfFlight,
+        const QLaw::GradientStrategy& aGradientStrategy = QLaw::GradientStrategy::Analytical
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aTradeStudy A trade study
+    /// @return An output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const QLawTradeStudy& aTradeStudy);
+
+    /// @brief Get the initial state
+    ///
+    /// @return The initial state
+    State getInitialState() const;
+
+    /// @brief Get the satellite system
+    ///
+    /// @return The satellite system
+    SatelliteSystem getSatelliteSystem() const;
+
+    /// @brief Get the environment dynamics
+    ///
+    /// @return The environment dynamics
+    Array<Shared<Dynamics>> getEnvironmentDynamics() const;
+
+    /// @brief Get the numerical solver
+    ///
+    /// @return The numerical solver
+    NumericalSolver getNumericalSolver() const;
+
+    /// @brief Get the maximum time of flight
+    ///
+    /// @return The maximum time of flight
+    Duration getMaximumTimeOfFlight() const;
+
+    /// @brief Get the QLaw gradient strategy
+    ///
+    /// @return The QLaw gradient strategy
+    QLaw::GradientStrategy getGradientStrategy() const;
+
+    /// @brief Solve a transfer
+    ///
+    /// @param aCase A case
+    /// @param anIndex (optional) The index of the case. Defaults to 0.
+    /// @param aTrajectoryStride (optional) Keep one state every stride states, and the final state. Defaults to 0,
+    /// keeping no trajectory.
+    /// @return The result
+    Result solveCase(const Case& aCase, const Index& anIndex = 0, const Size& aTrajectoryStride = 0) const;
+
+    /// @brief Solve transfers in parallel
+    ///
+    /// Failed transfers are logged, and reported with the Failed status.
+    ///
+    /// @param aCaseArray An array of cases
+    /// @param aThreadCount (optional) A number of threads, zero meaning the hardware concurrency. Defaults to 0.
+    /// @param aTrajectoryStride (optional) Keep one state every stride states, and the final state. Defaults to 0,
+    /// keeping no trajectory.
+    /// @return The results, in the order of the cases
+    Array<Result> solve(
+        const Array<Case>& aCaseArray, const Size& aThreadCount = 0, const Size& aTrajectoryStride = 0
+    ) const;
+
+    /// @brief Print the trade study
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Construct cases sweeping QLaw parameters, towards a single target orbit
+    ///
+    /// @param aTargetCOE A target orbit
+    /// @param aParametersArray An array of QLaw parameters
+    /// @return The cases, one per parameters
+    static Array<Case> ParameterCases(const COE& aTargetCOE, const Array<QLaw::Parameters>& aParametersArray);
+
+    /// @brief Construct cases sweeping target orbits, with a single set of QLaw parameters
+    ///
+    /// @param aTargetCOEArray An array of target orbits
+    /// @param aParameters A set of QLaw parameters
+    /// @return The cases, one per target orbit
+    static Array<Case> TargetCases(const Array<COE>& aTargetCOEArray, const QLaw::Parameters& aParameters);
+
+    /// @brief Convert a status to string
+    ///
+    /// @param aStatus A status
+    /// @return A string
+    static String StringFromStatus(const Status& aStatus);
+
+   private:
+    State initialState_;
+    SatelliteSystem satelliteSystem_;
+    Array<Shared<Dynamics>> environmentDynamics_;
+    NumericalSolver numericalSolver_;
+    Derived gravitationalParameter_;
+    Duration maximumTimeOfFlight_;
+    QLaw::GradientStrategy gradientStrategy_;
+};
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -3,10 +3,17 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated__
 
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
@@ -28,7 +35,10 @@ namespace models
 using ostk::core::ctnr::Array;
 using ostk::core::types::Integer;
 using ostk::core::types::Real;
+using ostk::core::types::Size;
+using ostk::core::types::String;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astro::trajectory::state::NumericalSolver;
@@ -41,6 +51,13 @@ using ostk::astro::Dynamics;
 class Propagated : public ostk::astro::trajectory::orbit::Model
 {
    public:
+    /// @brief Interpolation between cached states
+    enum class InterpolationType
+    {
+        Blended,             ///< Blend forward and backward propagations from the surrounding cached states
+        ContinuityCorrected  ///< Propagate forward only, and spread the mismatch with the next cached state linearly
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -69,6 +86,17 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
         const Propagator& aPropagator, const Array<State>& aCachedStateArray, const Integer& aRevolutionNumber = 1
     );
 
+    /// @brief Copy constructor
+    ///
+    /// @param aPropagatedModel A propagated model
+    Propagated(const Propagated& aPropagatedModel);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param aPropagatedModel A propagated model
+    /// @return Reference to propagated model
+    Propagated& operator=(const Propagated& aPropagatedModel);
+
     /// @brief Clone propagated
     ///
     /// @return Pointer to cloned propagated
@@ -139,6 +167,13 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
 
     /// @brief Calculate the revolution number at an instant
     ///
+    /// A revolution starts at epoch, then at each ascending node crossing (GCRF equator, south to north) after epoch:
+    /// the revolution number increases by one as soon as the instant moves past epoch, then at each ascending node.
+    /// Backwards, it decreases by one as soon as the instant moves before epoch, then at each ascending node before
+    /// epoch. Ascending nodes are found by a single propagation from the epoch towards the instant, and are kept in a
+    /// table: later queries within the searched span are a binary search, and queries beyond it only propagate the
+    /// remainder.
+    ///
     /// @code{.cpp}
     ///              Integer integer = propagated.calculateRevolutionNumberAt(anInstant) ;
     /// @endcode
@@ -146,6 +181,14 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
     /// @return Integer
     virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;
 
+    /// @brief Get the ascending node instants found so far, sorted
+    ///
+    /// @code{.cpp}
+    ///              Array<Instant> instants = propagated.getAscendingNodeInstantArray() ;
+    /// @endcode
+    /// @return Array<Instant>
+    Array<Instant> getAscendingNodeInstantArray() const;
+
     /// @brief Fetch internal cached state array
     ///
     /// @code{.cpp}
@@ -172,12 +215,114 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
     /// @param aStateArray A state array
     void setCachedStateArray(const Array<State>& aStateArray);
 
+    /// @brief Check if checkpointing is enabled
+    ///
+    /// @code{.cpp}
+    ///              bool isEnabled = propagated.isCheckpointingEnabled() ;
+    /// @endcode
+    /// @return True if checkpointing is enabled
+    bool isCheckpointingEnabled() const;
+
+    /// @brief Get checkpoint interval
+    ///
+    /// @code{.cpp}
+    ///              Duration interval = propagated.getCheckpointInterval() ;
+    /// @endcode
+    /// @return The interval between checkpoints, undefined if checkpointing is disabled
+    Duration getCheckpointInterval() const;
+
+    /// @brief Get maximum checkpoint count
+    ///
+    /// @code{.cpp}
+    ///              Size count = propagated.getMaximumCheckpointCount() ;
+    /// @endcode
+    /// @return The maximum number of checkpoints, zero if checkpointing is disabled
+    Size getMaximumCheckpointCount() const;
+
+    /// @brief Get checkpoint state array, sorted by instant
+    ///
+    /// @code{.cpp}
+    ///              Array<State> stateArray = propagated.getCheckpointStateArray() ;
+    /// @endcode
+    /// @return Array<State>
+    Array<State> getCheckpointStateArray() const;
+
+    /// @brief Enable checkpointing
+    ///
+    /// Queries outside of the cached state array store checkpoint states, every checkpoint interval, as propagation
+    /// advances away from the cached states. Later queries propagate from the nearest checkpoint instead of the
+    /// nearest cached state. When the maximum checkpoint count is exceeded, every other checkpoint is dropped and the
+    /// checkpoint interval is doubled. Checkpoints are not part of the cached state array, and are thread-safe.
+    ///
+    /// @code{.cpp}
+    ///              propagated.enableCheckpointing() ;
+    /// @endcode
+    /// @param aCheckpointInterval (optional) The interval between checkpoints. Defaults to the orbital period at
+    /// epoch.
+    /// @param aMaximumCheckpointCount (optional) The maximum number of checkpoints. Defaults to 1000.
+    void enableCheckpointing(
+        const Duration& aCheckpointInterval = Duration::Undefined(), const Size& aMaximumCheckpointCount = 1000
+    );
+
+    /// @brief Get interpolation type between cached states
+    ///
+    /// @code{.cpp}
+    ///              Propagated::InterpolationType interpolationType = propagated.getInterpolationType() ;
+    /// @endcode
+    /// @return The interpolation type
+    InterpolationType getInterpolationType() const;
+
+    /// @brief Set interpolation type between cached states
+    ///
+    /// Blended interpolation propagates each instant twice, forward from the previous cached state and backward from
+    /// the next one, and weights both linearly. Continuity corrected interpolation propagates once, forward from the
+    /// previous cached state up to the next one, and removes the mismatch with the next cached state linearly in time.
+    /// Both match the cached states at their instants.
+    ///
+    /// @code{.cpp}
+    ///              propagated.setInterpolationType(Propagated::InterpolationType::ContinuityCorrected) ;
+    /// @endcode
+    /// @param anInterpolationType An interpolation type
+    void setInterpolationType(const InterpolationType& anInterpolationType);
+
+    /// @brief Get thread count used to propagate between cached states
+    ///
+    /// @code{.cpp}
+    ///              Size threadCount = propagated.getThreadCount() ;
+    /// @endcode
+    /// @return The thread count, zero meaning the hardware concurrency
+    Size getThreadCount() const;
+
+    /// @brief Set thread count used to propagate between cached states
+    ///
+    /// Propagations between cached states, i.e. each interval and each direction, are independent and run
+    /// concurrently on up to this many threads, sharing the propagator. Defaults to 1, i.e. sequential propagation.
+    ///
+    /// @code{.cpp}
+    ///              propagated.setThreadCount(0) ;
+    /// @endcode
+    /// @param aThreadCount A thread count, zero meaning the hardware concurrency
+    void setThreadCount(const Size& aThreadCount);
+
+    /// @brief Disable checkpointing, and clear checkpoints
+    ///
+    /// @code{.cpp}
+    ///              propagated.disableCheckpointing() ;
+    /// @endcode
+    void disableCheckpointing();
+
     /// @brief Print propagated
     ///
     /// @param anOutputStream An output stream
     /// @param (optional) displayDecorators If true, display decorators
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
+    /// @brief Convert interpolation type to string
+    ///
+    /// @param anInterpolationType An interpolation type
+    /// @return A string
+    static String StringFromInterpolationType(const InterpolationType& anInterpolationType);
+
    protected:
     /// @brief Equal to operator
     ///
@@ -196,7 +341,31 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
     mutable Array<State> cachedStateArray_;
     Integer initialRevolutionNumber_;
 
+    mutable std::shared_mutex checkpointMutex_;
+    mutable std::map<Instant, State> checkpointStateMap_;
+    mutable Duration checkpointInterval_;
+    Size maximumCheckpointCount_;
+
+    InterpolationType interpolationType_;
+    Size threadCount_;
+
+    mutable std::mutex ascendingNodeMutex_;
+    mutable Array<Instant> ascendingNodeInstants_;
+    mutable State firstSearchedState_;
+    mutable State lastSearchedState_;
+
     void sanitizeCachedArray() const;
+
+    Array<Instant> searchAscendingNodes(
+        const State& aSearchStartState, const Instant& anInstant, State& aSearchEndState
+    ) const;
+
+    Array<Array<State>> calculateIntervalStatesAt(
+        const Array<Size>& aCachedStateIndexArray, const Array<Array<Instant>>& anInstantArrays
+    ) const;
+
+    Array<State> calculateStatesFromCheckpointsAt(const State& aCachedState, const Array<Instant>& anInstantArray)
+        const;
 };
 
 }  // namespace models
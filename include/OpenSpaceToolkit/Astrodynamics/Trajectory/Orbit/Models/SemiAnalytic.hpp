@@ -0,0 +1,297 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic__
+
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace models
+{
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Index;
+using ostk::core::types::Integer;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::VectorXd;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::units::Length;
+
+using ostk::astro::Dynamics;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::orbit::models::kepler::COE;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+
+/// @brief Define an orbit model integrating averaged equations of motion for mean elements, with day-scale steps
+///
+/// The mean elements (angular momentum vector, eccentricity vector and mean longitude, non-singular for circular and
+/// equatorial orbits) are integrated with a fixed step fourth order Runge-Kutta scheme. Their rates are the Gauss
+/// variational equations averaged over one revolution of the mean orbit, by quadrature in eccentric anomaly, of the
+/// zonal harmonics (J2 and J4) of the central body and of any perturbing dynamics, e.g. atmospheric drag or third body
+/// gravity. Perturbing dynamics are evaluated at the instants the mean orbit passes the quadrature points.
+///
+/// Mean elements are computed once per step, kept, and interpolated with cubic Hermite polynomials in between: the cost
+/// of a multi-year run is a few evaluations of the perturbing dynamics per day. Short-period variations due to J2 are
+/// recovered with the Brouwer-Lyddane theory (defined for the Earth), or can be disabled, in which case mean and
+/// osculating elements coincide.
+///
+/// The orbit has decayed once the mean perigee falls below the surface of the central body: mean elements are not
+/// integrated further, and states beyond throw.
+///
+/// @code{.cpp}
+///     SemiAnalytic semiAnalytic = {
+///         state,
+///         earthSPtr,
+///         {std::make_shared<AtmosphericDrag>(earthSPtr), std::make_shared<ThirdBodyGravity>(sunSPtr)},
+///     };
+/// @endcode
+class SemiAnalytic : public ostk::astro::trajectory::orbit::Model
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param aState An osculating state, holding the coordinates read by the perturbing dynamics (e.g. mass,
+    /// surface area and drag coefficient for atmospheric drag)
+    /// @param aCelestialObjectSPtr A central body
+    /// @param aPerturbationArray (optional) Perturbing dynamics, writing to the cartesian velocity only. Central body
+    /// gravity is modeled by the semi-analytic model itself.
+    /// @param aStepDuration (optional) The integration step duration. Defaults to one day.
+    /// @param aQuadraturePointCount (optional) The number of quadrature points over one revolution. Defaults to 16.
+    /// @param isShortPeriodRecoveryEnabled (optional) If true, recover short-period variations due to J2. Only
+    /// defined for the Earth, and must be disabled for other central bodies. Defaults to true.
+    SemiAnalytic(
+        const State& aState,
+        const Shared<const Celestial>& aCelestialObjectSPtr,
+        const Array<Shared<Dynamics>>& aPerturbationArray = Array<Shared<Dynamics>>::Empty(),
+        const Duration& aStepDuration = Duration::Days(1.0),
+        const Size& aQuadraturePointCount = 16,
+        const bool& isShortPeriodRecoveryEnabled = true
+    );
+
+    /// @brief Copy constructor
+    ///
+    /// @param aSemiAnalyticModel A semi-analytic model
+    SemiAnalytic(const SemiAnalytic& aSemiAnalyticModel);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param aSemiAnalyticModel A semi-analytic model
+    /// @return Reference to semi-analytic model
+    SemiAnalytic& operator=(const SemiAnalytic& aSemiAnalyticModel);
+
+    /// @brief Clone semi-analytic model
+    ///
+    /// @return Pointer to cloned semi-analytic model
+    virtual SemiAnalytic* clone() const override;
+
+    /// @brief Equal to operator
+    ///
+    /// @param aSemiAnalyticModel A semi-analytic model
+    /// @return True if semi-analytic models are equal
+    bool operator==(const SemiAnalytic& aSemiAnalyticModel) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aSemiAnalyticModel A semi-analytic model
+    /// @return True if semi-analytic models are not equal
+    bool operator!=(const SemiAnalytic& aSemiAnalyticModel) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aSemiAnalyticModel A semi-analytic model
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const SemiAnalytic& aSemiAnalyticModel);
+
+    /// @brief Check if semi-analytic model is defined
+    ///
+    /// @return True if semi-analytic model is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Get epoch, the instant of the initial state
+    ///
+    /// @return The epoch
+    virtual Instant getEpoch() const override;
+
+    /// @brief Get revolution number at epoch (it is equal to 1)
+    ///
+    /// @return The revolution number at epoch
+    virtual Integer getRevolutionNumberAtEpoch() const override;
+
+    /// @brief Get initial state, in GCRF
+    ///
+    /// @return The initial state
+    State getState() const;
+
+    /// @brief Get central body
+    ///
+    /// @return The central body
+    Shared<const Celestial> getCelestial() const;
+
+    /// @brief Get perturbing dynamics
+    ///
+    /// @return The perturbing dynamics
+    Array<Shared<Dynamics>> getPerturbations() const;
+
+    /// @brief Get integration step duration
+    ///
+    /// @return The step duration
+    Duration getStepDuration() const;
+
+    /// @brief Get number of quadrature points over one revolution
+    ///
+    /// @return The number of quadrature points
+    Size getQuadraturePointCount() const;
+
+    /// @brief Check if short-period variations are recovered
+    ///
+    /// @return True if short-period variations are recovered
+    bool isShortPeriodRecoveryEnabled() const;
+
+    /// @brief Calculate the mean elements at an instant
+    ///
+    /// @code{.cpp}
+    ///     COE meanElements = semiAnalytic.calculateMeanElementsAt(anInstant) ;
+    ///     Length meanSemiMajorAxis = meanElements.getSemiMajorAxis() ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @return The mean elements
+    COE calculateMeanElementsAt(const Instant& anInstant) const;
+
+    /// @brief Calculate the osculating state at an instant, in GCRF
+    ///
+    /// Coordinates other than the position and velocity are the ones of the initial state.
+    ///
+    /// @param anInstant An instant
+    /// @return The state
+    virtual State calculateStateAt(const Instant& anInstant) const override;
+
+    /// @brief Calculate the revolution number at an instant
+    ///
+    /// The revolution number increases by one at each crossing of the mean ascending node after epoch, and decreases
+    /// by one at each crossing before epoch.
+    ///
+    /// @param anInstant An instant
+    /// @return The revolution number
+    virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;
+
+    /// @brief Calculate the instant at which the mean perigee altitude falls below a decay altitude, searching from
+    /// the epoch up to an instant
+    ///
+    /// The decay instant is interpolated linearly between steps, and is only resolved to a step when the orbit decays
+    /// within a single step.
+    ///
+    /// @param anEndInstant The last instant of the search, after the epoch
+    /// @param aDecayAltitude (optional) The decay altitude, above the equatorial radius. Defaults to 100 km.
+    /// @return The decay instant, undefined if the orbit has not decayed by the end instant
+    Instant calculateDecayInstant(
+        const Instant& anEndInstant, const Length& aDecayAltitude = Length::Kilometers(100.0)
+    ) const;
+
+    /// @brief Print semi-analytic model
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+   protected:
+    /// @brief Equal to operator
+    ///
+    /// @param aModel A model
+    /// @return True if models are equal
+    virtual bool operator==(const trajectory::Model& aModel) const override;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aModel A model
+    /// @return True if models are not equal
+    virtual bool operator!=(const trajectory::Model& aModel) const override;
+
+   private:
+    /// @brief Mean elements at a step, with their rates
+    struct Node
+    {
+        VectorXd elements;
+        VectorXd rates;
+        double raan;  ///< Mean right ascension of the ascending node, unwrapped from the epoch
+    };
+
+    State state_;
+    Shared<const Celestial> celestialObjectSPtr_;
+    Array<Shared<Dynamics>> perturbations_;
+    Duration stepDuration_;
+    Size quadraturePointCount_;
+    bool shortPeriodRecoveryEnabled_;
+
+    Real gravitationalParameter_SI_;
+    Real equatorialRadius_SI_;
+    Real j2_;
+    Real j4_;
+    Index positionIndex_;
+    Index velocityIndex_;
+    Array<Array<Shared<const CoordinatesSubset>>> perturbationReadSubsets_;
+
+    mutable std::mutex nodeMutex_;
+    mutable Array<Node> forwardNodes_;
+    mutable Array<Node> backwardNodes_;
+    mutable bool forwardNodesAreComplete_;
+    mutable bool backwardNodesAreComplete_;
+
+    VectorXd calculateMeanElementRates(const Instant& anInstant, const VectorXd& anElementVector) const;
+
+    Node calculateNode(const Instant& anInstant, const VectorXd& anElementVector, const Node* aPreviousNodePtr) const;
+
+    bool isValid(const VectorXd& anElementVector) const;
+
+    Instant getNodeInstant(const int& anIndex) const;
+
+    VectorXd integrateStep(const Instant& anInstant, const Node& aNode, const Real& aStepDuration_s) const;
+
+    bool tryAccessNode(const int& anIndex, Node& aNode) const;
+
+    VectorXd interpolateMeanElementsAt(const Instant& anInstant, double* aRaanPtr = nullptr) const;
+};
+
+}  // namespace models
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -3,7 +3,10 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Containers/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
@@ -42,10 +45,12 @@ namespace trajectory
 {
 
 using ostk::core::ctnr::Array;
+using ostk::core::ctnr::Tuple;
 using ostk::core::types::Integer;
 using ostk::core::types::Real;
 using ostk::core::types::Shared;
 using ostk::core::types::Size;
+using ostk::core::types::String;
 
 using ostk::physics::Environment;
 using ostk::physics::coord::Position;
@@ -61,9 +66,43 @@ using ostk::astro::Dynamics;
 using ostk::astro::flight::system::SatelliteSystem;
 
 /// @brief Define a propagator to be used for numerical propagation
+///
+/// Queries (calculateStateAt, calculateStatesAt and calculateStateToCondition) are reentrant: each one integrates with
+/// its own copy of the numerical solver, so that several threads can query the same propagator concurrently. The
+/// observed states and diagnostics of the numerical solver are those of the last completed query. The state logger of
+/// the numerical solver, if any, is then called from several threads. Modifying the propagator (e.g. its dynamics) is
+/// not thread-safe.
+///
+/// Fidelity schedule dynamics are integrated over arcs during which each schedule is pinned to one regime: an arc ends
+/// when the state leaves the regime (widened by the hysteresis), and the integration restarts from there with the new
+/// regime. This requires a numerical solver supporting event conditions, and the Cowell formulation.
 class Propagator
 {
    public:
+    /// @brief Formulation of the equations of motion
+    ///
+    /// The Encke formulation integrates the deviation of the position and velocity from an osculating Keplerian
+    /// reference orbit of the central body, which is propagated analytically. The reference orbit is rectified
+    /// (re-osculated to the current state) when the position deviation exceeds 1% of the reference radius, and the
+    /// deviation is then reset to zero. As the deviation is much smaller than the state, the integration tolerances
+    /// apply to the deviation: the same accuracy is reached with looser tolerances, and thus larger steps.
+    ///
+    /// The Kustaanheimo-Stiefel formulation regularizes the equations of motion: the position and velocity are
+    /// replaced by the four dimensional Kustaanheimo-Stiefel coordinates, and time is replaced by a fictitious time
+    /// through the Sundman transformation dt = (r / r0) ds, where r0 is the initial radius. The two-body motion then
+    /// reduces to a harmonic oscillator, and steps are uniform in eccentric anomaly rather than in time, which avoids
+    /// clustering steps around the perigee of highly eccentric orbits. The solver time step and the integration
+    /// tolerances apply to the regularized state. Output states are converted back to the requested instants.
+    ///
+    /// Both the Encke and Kustaanheimo-Stiefel formulations require a central body gravity and a position
+    /// derivative dynamics.
+    enum class Formulation
+    {
+        Cowell,              ///< Integrate the full state
+        Encke,               ///< Integrate the deviation from an osculating Keplerian reference orbit
+        KustaanheimoStiefel  ///< Integrate the Kustaanheimo-Stiefel coordinates, in Sundman fictitious time
+    };
+
     static const Shared<const Frame> IntegrationFrameSPtr;
 
     /// @brief Constructor
@@ -74,11 +113,24 @@ class Propagator
     ///
     /// @param aNumericalSolver A numerical solver
     /// @param aDynamicsArray A dynamics array
+    /// @param aFormulation (optional) A formulation of the equations of motion. Defaults to Cowell.
     Propagator(
         const NumericalSolver& aNumericalSolver,
-        const Array<Shared<Dynamics>>& aDynamicsArray = Array<Shared<Dynamics>>::Empty()
+        const Array<Shared<Dynamics>>& aDynamicsArray = Array<Shared<Dynamics>>::Empty(),
+        const Formulation& aFormulation = Formulation::Cowell
     );
 
+    /// @brief Copy constructor
+    ///
+    /// @param aPropagator A propagator
+    Propagator(const Propagator& aPropagator);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param aPropagator A propagator
+    /// @return Reference to propagator
+    Propagator& operator=(const Propagator& aPropagator);
+
     /// @brief Equal to operator
     ///
     /// @param aPropagator A propagator
@@ -110,9 +162,32 @@ class Propagator
 
     /// @brief Access the numerical solver
     ///
+    /// The observed states and diagnostics of the numerical solver are those of the last completed query. Access is
+    /// not synchronized: only use it while no query runs on another thread, otherwise use getNumericalSolver.
+    ///
     /// @return The numerical solver
     const NumericalSolver& accessNumericalSolver() const;
 
+    /// @brief Get a copy of the numerical solver, taken under its lock
+    ///
+    /// Safe to call while queries run on other threads.
+    ///
+    /// @return The numerical solver
+    NumericalSolver getNumericalSolver() const;
+
+    /// @brief Get the observed states and diagnostics of the numerical solver, taken under its lock
+    ///
+    /// Unlike getNumericalSolver, only the observed states and diagnostics of the last completed query are copied.
+    /// Safe to call while queries run on other threads.
+    ///
+    /// @return The observed states and the diagnostics
+    Tuple<Array<State>, NumericalSolver::Diagnostics> getObservedStatesAndDiagnostics() const;
+
+    /// @brief Get the formulation of the equations of motion
+    ///
+    /// @return The formulation
+    Formulation getFormulation() const;
+
     /// @brief Get the number of propagated coordinates
     ///
     /// @return The number of propagated coordinates
@@ -159,12 +234,20 @@ class Propagator
     ///              NumericalSolver::ConditionSolution state = propagator.calculateStateToCondition(aState, anInstant,
     ///              anEventCondition);
     /// @endcode
+    ///
+    /// The next time step of the solution is expressed in seconds, whatever the formulation, so that it can be used as
+    /// the initial time step of a following propagation, e.g. the next segment of a sequence.
+    ///
     /// @param aState An initial state
     /// @param anInstant An instant
     /// @param anEventCondition An event condition
+    /// @param anInitialTimeStep (optional) The first step size [s]. Defaults to the time step of the numerical solver.
     /// @return NumericalSolver::ConditionSolution
     NumericalSolver::ConditionSolution calculateStateToCondition(
-        const State& aState, const Instant& anInstant, const EventCondition& anEventCondition
+        const State& aState,
+        const Instant& anInstant,
+        const EventCondition& anEventCondition,
+        const Real& anInitialTimeStep = Real::Undefined()
     ) const;
 
     /// @brief Calculate the states at an array of instants, given an initial state
@@ -208,12 +291,78 @@ class Propagator
     /// @return A propagator from environment
     static Propagator FromEnvironment(const NumericalSolver& aNumericalSolver, const Environment& anEnvironment);
 
+    /// @brief Convert formulation to string
+    ///
+    /// @param aFormulation A formulation
+    ///
+    /// @return A string
+    static String StringFromFormulation(const Formulation& aFormulation);
+
    private:
     Shared<CoordinatesBroker> coordinatesBrokerSPtr_ = std::make_shared<CoordinatesBroker>();
     Array<Dynamics::Context> dynamicsContexts_ = Array<Dynamics::Context>::Empty();
     mutable NumericalSolver numericalSolver_;
+    Formulation formulation_;
+
+    mutable std::mutex numericalSolverMutex_;
 
     void registerDynamicsContext(const Shared<Dynamics>& aDynamicsSPtr);
+
+    NumericalSolver createNumericalSolverWorkspace() const;
+
+    void publishNumericalSolverWorkspace(NumericalSolver& aNumericalSolver) const;
+
+    Array<State> calculateScheduledStatesAt(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    NumericalSolver::ConditionSolution calculateScheduledStateToCondition(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Instant& anInstant,
+        const EventCondition& anEventCondition,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    State calculateEnckeStateAt(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Instant& anInstant,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    Array<State> calculateEnckeStatesAt(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    NumericalSolver::ConditionSolution calculateEnckeStateToCondition(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Instant& anInstant,
+        const EventCondition& anEventCondition,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    Array<State> calculateKustaanheimoStiefelStatesAt(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
+
+    NumericalSolver::ConditionSolution calculateKustaanheimoStiefelStateToCondition(
+        NumericalSolver& aNumericalSolver,
+        const State& aState,
+        const Instant& anInstant,
+        const EventCondition& anEventCondition,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const;
 };
 
 }  // namespace trajectory
@@ -5,7 +5,9 @@
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Containers/Map.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
@@ -17,6 +19,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
@@ -29,10 +32,13 @@ namespace trajectory
 
 using ostk::core::ctnr::Array;
 using ostk::core::ctnr::Map;
+using ostk::core::types::Real;
 using ostk::core::types::Shared;
+using ostk::core::types::Size;
 using ostk::core::types::String;
 
 using ostk::math::object::MatrixXd;
+using ostk::math::object::VectorXd;
 
 using ostk::physics::time::Instant;
 using ostk::physics::time::Duration;
@@ -41,10 +47,13 @@ using ostk::physics::units::Mass;
 using ostk::astro::trajectory::State;
 using ostk::astro::trajectory::state::NumericalSolver;
 using ostk::astro::trajectory::orbit::models::Propagated;
+using ostk::astro::trajectory::Propagator;
 using ostk::astro::Dynamics;
 using ostk::astro::dynamics::Thruster;
 using ostk::astro::EventCondition;
 
+class Sequence;
+
 /// @brief Represent a propagation segment for astrodynamics purposes
 class Segment
 {
@@ -105,8 +114,20 @@ class Segment
         /// @return Delta mass
         Mass computeDeltaMass() const;
 
+        /// @brief Get the time derivatives of the states, for dense output
+        ///
+        /// Computed from the segment dynamics at the first call, then cached on the solution along with the dynamics
+        /// contributions in the frame of the states. Empty unless the dense output is available and the states are
+        /// strictly increasing in time, sharing a frame and a coordinates broker.
+        ///
+        /// @return State derivatives, in the layout of the state coordinates
+        Array<VectorXd> getStateDerivatives() const;
+
         /// @brief Calculate intermediate states at specified Instants using the provided Numerical Solver
         ///
+        /// When the state derivatives are available, states are interpolated from them by Hermite polynomials,
+        /// without any integration, and the numerical solver is unused.
+        ///
         /// @param aNumericalSolver a numerical solver to use for the propagation between states
         /// @param anInstantArray an array of instants
         /// @return States at specified instants
@@ -115,6 +136,8 @@ class Segment
 
         /// @brief Get dynamics contribution
         ///
+        /// Served from the contributions cached by getAllDynamicsContributions when available.
+        ///
         /// @param aDynamicsSPtr Dynamics
         /// @param aFrameSPtr Frame
         /// @param aCoordinatesSubsetSPtrArray Array of coordinates subsets
@@ -137,9 +160,17 @@ class Segment
 
         /// @brief Get all segment dynamics contributions
         ///
+        /// All contributions are computed in a single pass over the states, converting each state to the frame once,
+        /// optionally in parallel across states. They are cached on the solution per frame, and recomputed if the
+        /// dynamics, the number of states or the start and end instants have changed since. States modified in place
+        /// are not detected.
+        ///
         /// @param aFrameSPtr Frame
+        /// @param aThreadCount (optional) A number of threads, zero meaning the hardware concurrency. Defaults to 1.
         /// @return All segment dynamics contributions
-        Map<Shared<Dynamics>, MatrixXd> getAllDynamicsContributions(const Shared<const Frame>& aFrameSPtr) const;
+        Map<Shared<Dynamics>, MatrixXd> getAllDynamicsContributions(
+            const Shared<const Frame>& aFrameSPtr, const Size& aThreadCount = 1
+        ) const;
 
         /// @brief Print the segment solution
         ///
@@ -154,11 +185,20 @@ class Segment
         /// @return An output stream
         friend std::ostream& operator<<(std::ostream& anOutputStream, const Solution& aSolution);
 
-        String name;                       // Name of the segment.
-        Array<Shared<Dynamics>> dynamics;  // List of dynamics used.
-        Array<State> states;               // Array of states for the segment.
-        bool conditionIsSatisfied;         // True if the event condition is satisfied.
-        Segment::Type segmentType;         // Type of segment.
+        String name;                               // Name of the segment.
+        Array<Shared<Dynamics>> dynamics;          // List of dynamics used.
+        Array<State> states;                       // Array of states for the segment.
+        bool conditionIsSatisfied;                 // True if the event condition is satisfied.
+        Segment::Type segmentType;                 // Type of segment.
+        NumericalSolver::Diagnostics diagnostics;  // Diagnostics of the propagation, if enabled on the solver.
+        bool denseOutputIsAvailable;               // True if all steps are recorded, without any held dynamics.
+
+       private:
+        struct DynamicsContributionCache;
+
+        Shared<DynamicsContributionCache> dynamicsContributionCacheSPtr_;
+
+        Shared<const Array<VectorXd>> accessStateDerivatives() const;
     };
 
     /// @brief Output stream operator
@@ -188,6 +228,10 @@ class Segment
     /// @return Type of segment
     Type getType() const;
 
+    /// @brief Get formulation of the equations of motion
+    /// @return Formulation
+    Propagator::Formulation getFormulation() const;
+
     /// @brief Access event condition
     /// @return Event condition
     const Shared<EventCondition>& accessEventCondition() const;
@@ -219,12 +263,14 @@ class Segment
     /// @param anEventConditionSPtr An event condition
     /// @param aDynamicsArray Array of dynamics
     /// @param aNumericalSolver Numerical solver
+    /// @param aFormulation (optional) Formulation of the equations of motion. Defaults to Cowell.
     /// @return A Segment for coasting
     static Segment Coast(
         const String& aName,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Array<Shared<Dynamics>>& aDynamicsArray,
-        const NumericalSolver& aNumericalSolver
+        const NumericalSolver& aNumericalSolver,
+        const Propagator::Formulation& aFormulation = Propagator::Formulation::Cowell
     );
 
     /// @brief Create a maneuvering segment
@@ -234,29 +280,51 @@ class Segment
     /// @param aThrusterDynamics Dynamics for the thruster
     /// @param aDynamicsArray Array of dynamics
     /// @param aNumericalSolver Numerical solver
+    /// @param aFormulation (optional) Formulation of the equations of motion. Defaults to Cowell.
     /// @return A Segment for maneuvering
     static Segment Maneuver(
         const String& aName,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Shared<Thruster>& aThrusterDynamics,
         const Array<Shared<Dynamics>>& aDynamicsArray,
-        const NumericalSolver& aNumericalSolver
+        const NumericalSolver& aNumericalSolver,
+        const Propagator::Formulation& aFormulation = Propagator::Formulation::Cowell
     );
 
    private:
+    friend class Sequence;
+
     String name_;
     Type type_;
     Shared<EventCondition> eventCondition_;
     Array<Shared<Dynamics>> dynamics_;
     NumericalSolver numericalSolver_;
+    Propagator::Formulation formulation_;
 
     Segment(
         const String& aName,
         const Type& aType,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Array<Shared<Dynamics>>& aDynamicsArray,
-        const NumericalSolver& aNumericalSolver
+        const NumericalSolver& aNumericalSolver,
+        const Propagator::Formulation& aFormulation
     );
+
+    /// @brief Solve the segment with a propagator built from its dynamics, numerical solver and formulation, which may
+    /// be shared with the neighbouring segments of a sequence
+    ///
+    /// @param aState Initial state for the segment
+    /// @param maximumPropagationDuration Maximum duration for propagation
+    /// @param aPropagator A propagator
+    /// @param aTimeStep The first step size [s], the step size of the numerical solver if undefined. Set to the step
+    /// size proposed to continue the propagation past the segment.
+    /// @return A Solution representing the result of the solve
+    Solution solve(
+        const State& aState,
+        const Duration& maximumPropagationDuration,
+        const Propagator& aPropagator,
+        Real& aTimeStep
+    ) const;
 };
 
 }  // namespace trajectory
@@ -111,6 +111,65 @@ class Sequence
         bool executionIsComplete;                   // True if the sequence was executed completely, false otherwise
     };
 
+    /// @brief Segment solutions of a previous solve, reused when a sequence is solved again after edits.
+    ///
+    /// Each segment solution is keyed on its initial state and on the definition of its segment (name, type, event
+    /// condition, dynamics, numerical solver and formulation) and on the propagation duration limit. A solve reuses
+    /// the cached solutions up to the first segment whose key changed, and re-integrates from that segment's cached
+    /// initial state onwards. The cached solutions are then replaced by the ones of the new solve.
+    ///
+    /// Event conditions and dynamics are compared by identity: edit a segment by replacing its event condition or
+    /// dynamics, rather than by mutating them in place. Numerical solvers are compared setting by setting, see
+    /// NumericalSolver::operator==. A cache is meant for a single solve loop and is not thread-safe.
+    ///
+    /// @code{.cpp}
+    ///     Sequence::SolutionCache solutionCache;
+    ///
+    ///     for (...)
+    ///     {
+    ///         const Sequence sequence = {{coastSegment, maneuverSegment(thrustDuration)}, ...};
+    ///         const Sequence::Solution solution = sequence.solve(state, solutionCache);  // Only solves the maneuver
+    ///     }
+    /// @endcode
+    class SolutionCache
+    {
+       public:
+        /// @brief Constructor
+        SolutionCache();
+
+        /// @brief Get the number of cached segment solutions
+        ///
+        /// @return Number of cached segment solutions
+        Size getSize() const;
+
+        /// @brief Get the number of segment solutions reused since construction (or the last clear)
+        ///
+        /// @return Number of reused segment solutions
+        Size getReuseCount() const;
+
+        /// @brief Clear the cache
+        void clear();
+
+       private:
+        friend class Sequence;
+
+        struct Entry
+        {
+            State initialState;
+            Segment segment;
+            Duration segmentPropagationDurationLimit;
+            Segment::Solution solution;
+            Real finalTimeStep;
+
+            bool matches(
+                const State& anInitialState, const Segment& aSegment, const Duration& aSegmentPropagationDurationLimit
+            ) const;
+        };
+
+        Array<Entry> entries_;
+        Size reuseCount_;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -195,6 +254,17 @@ class Sequence
     /// @return A Solution that contains solutions for each segment.
     Solution solve(const State& aState, const Size& aRepetitionCount = 1) const;
 
+    /// @brief Solve the sequence given an initial state, for a number of repetitions, reusing the segment solutions
+    /// of a previous solve up to the first changed segment.
+    ///
+    /// The solution is the same as the one of a solve without cache.
+    ///
+    /// @param aState Initial state for the sequence.
+    /// @param aSolutionCache A solution cache, updated with the segment solutions of this solve.
+    /// @param aRepetitionCount Number of repetitions. Defaults to 1, i.e. execute sequence once.
+    /// @return A Solution that contains solutions for each segment.
+    Solution solve(const State& aState, SolutionCache& aSolutionCache, const Size& aRepetitionCount = 1) const;
+
     /// @brief Solve the sequence given an initial state.
     ///
     /// @param aState Initial state for the sequence.
@@ -218,6 +288,8 @@ class Sequence
     NumericalSolver numericalSolver_;
     Array<Shared<Dynamics>> dynamics_;
     Duration segmentPropagationDurationLimit_;
+
+    Solution solve(const State& aState, const Size& aRepetitionCount, SolutionCache* aSolutionCachePtr) const;
 };
 
 }  // namespace trajectory
@@ -4,15 +4,23 @@
 #define __OpenSpaceToolkit_Astrodynamics_StateNumericalSolver__
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Containers/Map.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Solvers/NumericalSolver.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
 
 namespace ostk
 {
@@ -20,14 +28,25 @@ namespace astro
 {
 namespace trajectory
 {
+
+class Propagator;
+
 namespace state
 {
 
 using ostk::core::ctnr::Array;
-
+using ostk::core::ctnr::Map;
+using ostk::core::types::Index;
+using ostk::core::types::Integer;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::StateSink;
 using ostk::astro::RootSolver;
 using MathNumericalSolver = ostk::math::solvers::NumericalSolver;
 
@@ -36,13 +55,203 @@ using MathNumericalSolver = ostk::math::solvers::NumericalSolver;
 class NumericalSolver : public MathNumericalSolver
 {
    public:
+    /// @brief Multistep method, used in place of the stepper type when defined.
+    ///
+    /// Multistep methods reuse the derivative history, and need about 2 evaluations of the system of equations
+    /// per step (predict, evaluate, correct, evaluate), which pays off for long arcs with expensive dynamics.
+    /// They are restarted at each integration call, i.e. at each segment boundary, event or maneuver.
+    enum class MultistepType
+    {
+        Undefined,             ///< No multistep method, the stepper type is used
+        AdamsBashforthMoulton  ///< Variable step, variable order Adams-Bashforth-Moulton (PECE)
+    };
+
     /// @brief Structure to hold the condition solution.
     struct ConditionSolution
     {
-        State state;                  ///< Final state after integration.
-        bool conditionIsSatisfied;    ///< Whether the condition is met.
-        Size iterationCount;          ///< Number of iterations performed.
-        bool rootSolverHasConverged;  ///< Whether the root solver has converged.
+        State state;                            ///< Final state after integration.
+        bool conditionIsSatisfied;              ///< Whether the condition is met.
+        Size iterationCount;                    ///< Number of iterations performed.
+        bool rootSolverHasConverged;            ///< Whether the root solver has converged.
+        Real nextTimeStep = Real::Undefined();  ///< Step size proposed to continue the integration, if any.
+    };
+
+    /// @brief Structure to hold the diagnostics of the integrations, recorded when enabled.
+    ///
+    /// Step sizes are expressed in the independent variable of the integration, i.e. in seconds unless a
+    /// regularized formulation is used.
+    struct Diagnostics
+    {
+        Size systemOfEquationsEvaluationCount = 0;  ///< Number of evaluations of the system of equations.
+        Size acceptedStepCount = 0;                 ///< Number of accepted steps.
+        Size rejectedStepCount = 0;                 ///< Number of rejected steps.
+        Map<Integer, Size> stepSizeHistogram;       ///< Accepted steps per decade: key k counts [1e{k}, 1e{k+1}).
+        Size rootSolverIterationCount = 0;          ///< Number of root solver iterations, to locate events.
+        Map<String, Duration> dynamicsWallTimes;    ///< Cumulative wall time spent in each dynamics, by name.
+    };
+
+    /// @brief Observer of the accepted steps of an integration.
+    ///
+    /// Called with the state vector, the time and true at the start of each integration, then with false after each
+    /// accepted step. Returns true if the system of equations changed at that state (e.g. a dynamics updated a held
+    /// value), in which case the derivative already computed at that state is discarded, and multistep methods are
+    /// restarted.
+    typedef std::function<bool(const StateVector&, const double&, const bool&)> StepObserver;
+
+    /// @brief Converter from the states integrated by the numerical solver to the states it observes, e.g. from a
+    /// deviation from a reference orbit, or a regularized state, to the propagated state.
+    typedef std::function<State(const State&)> StateConverter;
+
+    /// @brief Policy for recording the states observed during an integration, i.e. the initial state, the state at
+    /// each accepted step, and the final or event state.
+    ///
+    /// The decimating policies always keep the initial state and the latest observed state, so that the recorded
+    /// states span the whole integration and end with the final or event state.
+    class ObservationPolicy
+    {
+       public:
+        enum class Type
+        {
+            All,           ///< Record every observed state
+            None,          ///< Record no state
+            EveryNthStep,  ///< Record every Nth step
+            FixedSpacing,  ///< Record the first step at least a given duration after the last recorded state
+            RingBuffer,    ///< Record the last N observed states
+            Boundaries     ///< Record the initial state, and the final or event state
+        };
+
+        /// @brief Constructor
+        ///
+        /// @param aType A type
+        /// @param aCount The step interval (EveryNthStep) or the capacity (RingBuffer)
+        /// @param aSpacing The spacing (FixedSpacing)
+        ObservationPolicy(const Type& aType, const Size& aCount, const Duration& aSpacing);
+
+        /// @brief Equal to operator
+        ///
+        /// @param anObservationPolicy An observation policy
+        /// @return True if observation policies are equal
+        bool operator==(const ObservationPolicy& anObservationPolicy) const;
+
+        /// @brief Get type
+        ///
+        /// @return Type
+        Type getType() const;
+
+        /// @brief Get count, i.e. the step interval (EveryNthStep) or the capacity (RingBuffer)
+        ///
+        /// @return Count
+        Size getCount() const;
+
+        /// @brief Get spacing (FixedSpacing)
+        ///
+        /// @return Spacing
+        Duration getSpacing() const;
+
+        /// @brief Record every observed state
+        ///
+        /// @return An observation policy
+        static ObservationPolicy All();
+
+        /// @brief Record no state
+        ///
+        /// @return An observation policy
+        static ObservationPolicy None();
+
+        /// @brief Record every Nth step
+        ///
+        /// @param aStepInterval A step interval, strictly positive
+        /// @return An observation policy
+        static ObservationPolicy EveryNthStep(const Size& aStepInterval);
+
+        /// @brief Record the first step at least a given duration after the last recorded state
+        ///
+        /// @param aSpacing A spacing, strictly positive
+        /// @return An observation policy
+        static ObservationPolicy FixedSpacing(const Duration& aSpacing);
+
+        /// @brief Record the last N observed states
+        ///
+        /// @param aCapacity A capacity, strictly positive
+        /// @return An observation policy
+        static ObservationPolicy RingBuffer(const Size& aCapacity);
+
+        /// @brief Record the initial state, and the final or event state
+        ///
+        /// @return An observation policy
+        static ObservationPolicy Boundaries();
+
+        /// @brief Get string from type
+        ///
+        /// @param aType A type
+        /// @return String
+        static String StringFromType(const Type& aType);
+
+       private:
+        Type type_;
+        Size count_;
+        Duration spacing_;
+    };
+
+    /// @brief Record states according to an observation policy, in bounded memory unless all states are recorded.
+    ///
+    /// Every state is also pushed to the state sink, if any, regardless of the observation policy.
+    class StateRecorder
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param anObservationPolicy An observation policy
+        /// @param aStateSinkSPtr (optional) A state sink. Defaults to none.
+        StateRecorder(const ObservationPolicy& anObservationPolicy, const Shared<StateSink>& aStateSinkSPtr = nullptr);
+
+        /// @brief Access observation policy
+        ///
+        /// @return Observation policy
+        const ObservationPolicy& accessObservationPolicy() const;
+
+        /// @brief Access state sink
+        ///
+        /// @return State sink, null if none
+        const Shared<StateSink>& accessStateSink() const;
+
+        /// @brief Check if no state is recorded
+        ///
+        /// @return True if no state is recorded
+        bool isEmpty() const;
+
+        /// @brief Access recorded states, in the order in which they were recorded
+        ///
+        /// A ring buffer is written in place while recording: its order is restored by restoreChronologicalOrder,
+        /// which the numerical solver calls at the end of each integration.
+        ///
+        /// @return Recorded states
+        const Array<State>& accessStates() const;
+
+        /// @brief Record a state
+        ///
+        /// @param aState A state
+        void record(const State& aState);
+
+        /// @brief Restore the chronological order of a wrapped ring buffer, once recording is done
+        void restoreChronologicalOrder();
+
+        /// @brief Clear recorded states
+        void reset();
+
+        /// @brief Clear recorded states, and record an initial state
+        ///
+        /// @param anInitialState An initial state
+        void reset(const State& anInitialState);
+
+       private:
+        ObservationPolicy observationPolicy_;
+        Shared<StateSink> stateSinkSPtr_;
+        Array<State> states_;
+        Index ringBufferStartIndex_;
+        Size stepCount_;
+        bool lastStateIsProvisional_;
+        Instant lastSampledInstant_;
     };
 
     /// @brief Constructor
@@ -70,7 +279,24 @@ class NumericalSolver : public MathNumericalSolver
         const RootSolver& aRootSolver = RootSolver::Default()
     );
 
-    /// @brief Access observed states
+    /// @brief Equal to operator
+    ///
+    /// Compares the integration settings (log type, stepper, time step and tolerances), the root solver, the multistep
+    /// method, the observation policy, the state sink, the diagnostics flag and the state logger. State loggers are
+    /// only equal if both are empty, or both wrap the same function pointer: loggers wrapping lambdas or functors
+    /// cannot be compared, and are considered different.
+    ///
+    /// @param aNumericalSolver A numerical solver
+    /// @return True if numerical solvers are equal
+    bool operator==(const NumericalSolver& aNumericalSolver) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aNumericalSolver A numerical solver
+    /// @return True if numerical solvers are not equal
+    bool operator!=(const NumericalSolver& aNumericalSolver) const;
+
+    /// @brief Access observed states, recorded according to the observation policy
     ///
     /// @code{.cpp}
     ///                  numericalSolver.accessObservedStates();
@@ -88,6 +314,33 @@ class NumericalSolver : public MathNumericalSolver
     /// @return RootSolver
     RootSolver getRootSolver() const;
 
+    /// @brief Check if a multistep method is used
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.isMultistep();
+    /// @endcode
+    ///
+    /// @return True if a multistep method is used
+    bool isMultistep() const;
+
+    /// @brief Get multistep type
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getMultistepType();
+    /// @endcode
+    ///
+    /// @return Multistep type
+    MultistepType getMultistepType() const;
+
+    /// @brief Get the maximum order of the multistep method
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getMaximumOrder();
+    /// @endcode
+    ///
+    /// @return Maximum order
+    Size getMaximumOrder() const;
+
     /// @brief Get observed states
     ///
     /// @code{.cpp}
@@ -97,6 +350,160 @@ class NumericalSolver : public MathNumericalSolver
     /// @return Observed states
     Array<State> getObservedStates() const;
 
+    /// @brief Get observation policy
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getObservationPolicy();
+    /// @endcode
+    ///
+    /// @return Observation policy
+    ObservationPolicy getObservationPolicy() const;
+
+    /// @brief Set observation policy
+    ///
+    /// The observed states of the last integration are cleared. The state logger is still called at every step.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::EveryNthStep(10));
+    /// @endcode
+    ///
+    /// @param anObservationPolicy An observation policy
+    void setObservationPolicy(const ObservationPolicy& anObservationPolicy);
+
+    /// @brief Get state sink
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getStateSink();
+    /// @endcode
+    ///
+    /// @return State sink, null if none
+    Shared<StateSink> getStateSink() const;
+
+    /// @brief Set state sink
+    ///
+    /// The observed states of the following integrations (the initial state, the state at each step, and the final or
+    /// event state) are streamed to the sink, regardless of the observation policy. Copies of the numerical solver,
+    /// e.g. the ones held by propagators, segments and sequences, share the sink.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setStateSink(StateSink::CSV(aFile));
+    /// @endcode
+    ///
+    /// @param aStateSinkSPtr A state sink, null to stop streaming
+    void setStateSink(const Shared<StateSink>& aStateSinkSPtr);
+
+    /// @brief Check if diagnostics are enabled
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.isDiagnosticsEnabled();
+    /// @endcode
+    ///
+    /// @return True if diagnostics are enabled
+    bool isDiagnosticsEnabled() const;
+
+    /// @brief Access diagnostics
+    ///
+    /// Diagnostics accumulate over integrations until reset. The propagator resets them at the start of each
+    /// propagation, and records the wall time spent in each dynamics.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.accessDiagnostics();
+    /// @endcode
+    ///
+    /// @return Diagnostics
+    const Diagnostics& accessDiagnostics() const;
+
+    /// @brief Get diagnostics
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getDiagnostics();
+    /// @endcode
+    ///
+    /// @return Diagnostics
+    Diagnostics getDiagnostics() const;
+
+    /// @brief Enable or disable diagnostics
+    ///
+    /// When enabled, integrations performed with a Runge-Kutta stepper run through instrumented Boost.Odeint
+    /// steppers, with the same step size control. When disabled, nothing is recorded.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setDiagnosticsEnabled(true);
+    /// @endcode
+    ///
+    /// @param isEnabled True to enable diagnostics
+    void setDiagnosticsEnabled(const bool& isEnabled);
+
+    /// @brief Reset diagnostics
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.resetDiagnostics();
+    /// @endcode
+    void resetDiagnostics();
+
+    /// @brief Set the step observer, called at the start of each integration and after each accepted step
+    ///
+    /// The step observer belongs to the integrations of a system of equations rather than to the configuration of the
+    /// numerical solver: it is not compared, and not carried over to the workspaces of propagations. Runge-Kutta
+    /// integrations with a step observer run through instrumented Boost.Odeint steppers, with the same step size
+    /// control.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setStepObserver(aStepObserver);
+    /// @endcode
+    ///
+    /// @param aStepObserver A step observer, null to remove it
+    void setStepObserver(const StepObserver& aStepObserver);
+
+    /// @brief Set the state converter, applied to the states of the integrations before they are recorded, logged and
+    /// streamed to the state sink
+    ///
+    /// Like the step observer, the state converter is not compared, and not carried over to the workspaces of
+    /// propagations.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setStateConverter(aStateConverter);
+    /// @endcode
+    ///
+    /// @param aStateConverter A state converter, null to remove it
+    void setStateConverter(const StateConverter& aStateConverter);
+
+    /// @brief Set the initial time step of the next integrations
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setTimeStep(10.0);
+    /// @endcode
+    ///
+    /// @param aTimeStep A time step
+    void setTimeStep(const Real& aTimeStep);
+
+    /// @brief Resume the last integration with the next one, starting from its final state
+    ///
+    /// The states observed by the next integration are appended to those of the last one, without its initial state,
+    /// and its event condition, if any, is also evaluated over its first step. This allows an integration to be split
+    /// into arcs, e.g. to change the system of equations or the integrated state between them.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.resume(conditionSolution.nextTimeStep);
+    /// @endcode
+    ///
+    /// @param aTimeStep The initial time step of the next integration, e.g. the next time step of the last one. The
+    ///                  time step is left unchanged if undefined.
+    void resume(const Real& aTimeStep = Real::Undefined());
+
+    /// @brief Get the step size proposed by the stepper after the last full step of the last integration to an
+    /// instant or to instants, if any
+    ///
+    /// Steps cut short to reach an output time are not full steps. The integrations with conditions report their next
+    /// time step in their solution instead.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.resume(numericalSolver.getNextTimeStep());
+    /// @endcode
+    ///
+    /// @return The next time step, undefined if not reported by the stepper
+    Real getNextTimeStep() const;
+
     /// @brief Perform numerical integration for a given array of time instants.
     ///
     /// @param aState Initial state for integration.
@@ -171,6 +578,26 @@ class NumericalSolver : public MathNumericalSolver
         const std::function<void(const State&)>& stateLogger
     );
 
+    /// @brief Create a variable step, variable order Adams-Bashforth-Moulton numerical solver.
+    ///
+    /// The solver starts at order 1, raises the order as the derivative history grows, and then selects the order
+    /// from the error estimates of the neighbouring orders. It supports integration with conditions.
+    ///
+    /// @param aTimeStep The initial time step to use.
+    /// @param aRelativeTolerance The relative tolerance to use.
+    /// @param anAbsoluteTolerance The absolute tolerance to use.
+    /// @param aMaximumOrder The maximum order, between 1 and 12. Defaults to 12.
+    /// @param stateLogger A function that takes a `State` object and logs. Defaults to `nullptr`.
+    ///
+    /// @return An Adams-Bashforth-Moulton numerical solver.
+    static NumericalSolver AdamsBashforthMoulton(
+        const Real& aTimeStep,
+        const Real& aRelativeTolerance,
+        const Real& anAbsoluteTolerance,
+        const Size& aMaximumOrder = 12,
+        const std::function<void(const State&)>& stateLogger = nullptr
+    );
+
     /// Delete undesired methods from parent
     Array<MathNumericalSolver::Solution> integrateTime(
         const MathNumericalSolver::StateVector& anInitialStateVector,
@@ -203,9 +630,21 @@ class NumericalSolver : public MathNumericalSolver
     const Array<MathNumericalSolver::Solution>& accessObservedStateVectors() const = delete;
 
    private:
+    // The propagator creates the call-local workspace of each propagation, and publishes its observed states and
+    // diagnostics back at the end
+    friend class ostk::astro::trajectory::Propagator;
+
     RootSolver rootSolver_;
-    Array<State> observedStates_;
+    StateRecorder observedStates_;
     std::function<void(const State&)> stateLogger_;
+    MultistepType multistepType_;
+    Size maximumOrder_;
+    bool diagnosticsEnabled_;
+    Diagnostics diagnostics_;
+    StepObserver stepObserver_;
+    StateConverter stateConverter_;
+    bool isResumed_;
+    Real nextTimeStep_;
 
     /// @brief Constructor
     ///
@@ -231,10 +670,65 @@ class NumericalSolver : public MathNumericalSolver
         const Real& aRelativeTolerance,
         const Real& anAbsoluteTolerance,
         const RootSolver& aRootSolver,
-        const std::function<void(const State&)>& stateLogger
+        const std::function<void(const State&)>& stateLogger,
+        const MultistepType& aMultistepType = MultistepType::Undefined,
+        const Size& aMaximumOrder = 0
     );
 
+    /// @brief Create a numerical solver with the same configuration (steppers, tolerances, root solver, state logger,
+    /// observation policy, state sink and diagnostics switch), but no observed states nor diagnostics, to be used as
+    /// the call-local workspace of a single propagation
+    NumericalSolver createWorkspace() const;
+
+    /// @brief Start observing an integration from its initial state, unless it resumes the last one
+    ///
+    /// @return True if the integration resumes the last one
+    bool startObservation(const State& anInitialState);
+
+    State convertState(const State& aState) const;
+
     void observeState(const State& aState);
+
+    bool observeStep(const StateVector& aStateVector, const double& aTime, const bool& isStart) const;
+
+    SystemOfEquationsWrapper instrumentSystemOfEquations(const SystemOfEquationsWrapper& aSystemOfEquations);
+
+    Array<MathNumericalSolver::Solution> integrateDurationWithSteppers(
+        const MathNumericalSolver::StateVector& anInitialStateVector,
+        const Array<Real>& aDurationArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const std::function<void(const MathNumericalSolver::StateVector&, const double&)>& aStepObserver = nullptr
+    );
+
+    /// @brief Perform numerical integration from a start state to the last of a set of sorted instants, until an
+    /// event condition is satisfied, and interpolate the states at the instants reached before the condition
+    ///
+    /// @param aState A start state
+    /// @param anInstantArray An array of instants, sorted in the direction of integration
+    /// @param aSystemOfEquations A system of equations
+    /// @param anEventCondition An event condition
+    /// @param anOutputStateArray The array to which the states at the instants reached are added
+    ///
+    /// @return The condition solution
+    ConditionSolution integrateTimesToCondition(
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const EventCondition& anEventCondition,
+        Array<State>& anOutputStateArray
+    );
+
+    template <typename DenseStepper>
+    ConditionSolution integrateTimeToCondition(
+        DenseStepper& aDenseStepper,
+        const State& aState,
+        const Instant& anInstant,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const EventCondition& anEventCondition,
+        const bool& isResumed,
+        const Array<Instant>& anOutputInstantArray = Array<Instant>::Empty(),
+        Array<State>* anOutputStateArrayPtr = nullptr
+    );
 };
 
 }  // namespace state
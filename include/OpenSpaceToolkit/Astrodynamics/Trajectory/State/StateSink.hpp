@@ -0,0 +1,169 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink__
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::filesystem::File;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::StateWriter;
+
+/// @brief Stream states to a state writer, from a background thread.
+///
+/// States are pushed to a bounded lock-free queue, which a background thread drains into the state writer, so that
+/// the pushing threads (e.g. numerical integrations) never wait on the writer's destination. When the queue is full,
+/// pushing threads spin until the writer thread catches up, rather than dropping states: stalls are counted.
+///
+/// A sink belongs to a single producer, e.g. a propagation: the decimation by step interval counts the pushed states
+/// regardless of their thread, and the states of concurrent producers would be interleaved. Pushing is nevertheless
+/// thread-safe, and a push racing with close is either written or throws.
+///
+/// Errors raised by the state writer are reported by the next call to flush or close. States pushed after an error are
+/// discarded.
+class StateSink
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///     StateSink stateSink = {std::make_shared<statewriters::CSV>(aFile)};
+    /// @endcode
+    ///
+    /// @param aStateWriterSPtr A state writer
+    /// @param aQueueCapacity (optional) The capacity of the queue, rounded up to a power of 2. Defaults to 1024.
+    /// @param aStepInterval (optional) Write one out of every N pushed states. Defaults to 1, i.e. every state.
+    StateSink(
+        const Shared<StateWriter>& aStateWriterSPtr, const Size& aQueueCapacity = 1024, const Size& aStepInterval = 1
+    );
+
+    /// @brief Destructor. Closes the sink, writing the queued states.
+    ~StateSink();
+
+    StateSink(const StateSink&) = delete;
+    StateSink& operator=(const StateSink&) = delete;
+
+    /// @brief Check if sink is open
+    ///
+    /// @return True if sink is open
+    bool isOpen() const;
+
+    /// @brief Get queue capacity
+    ///
+    /// @return The queue capacity
+    Size getQueueCapacity() const;
+
+    /// @brief Get step interval
+    ///
+    /// @return The step interval
+    Size getStepInterval() const;
+
+    /// @brief Get the number of states pushed to the sink, before decimation
+    ///
+    /// @return The number of pushed states
+    Size getPushedStateCount() const;
+
+    /// @brief Get the number of states written by the state writer
+    ///
+    /// @return The number of written states
+    Size getWrittenStateCount() const;
+
+    /// @brief Get the number of times a pushing thread found the queue full
+    ///
+    /// @return The number of stalls
+    Size getStallCount() const;
+
+    /// @brief Push a state. Thread-safe, a push admitted before close is written by close.
+    ///
+    /// @param aState A state
+    void push(const State& aState);
+
+    /// @brief Wait until the states pushed so far are written, and flush the state writer
+    void flush();
+
+    /// @brief Write the queued states, flush the state writer and stop the background thread. Further pushes throw.
+    void close();
+
+    /// @brief Constructs a sink streaming states to a CSV file
+    ///
+    /// @param aFile A file, created or truncated
+    /// @param aStepInterval (optional) Write one out of every N pushed states. Defaults to 1, i.e. every state.
+    /// @return Shared pointer to state sink
+    static Shared<StateSink> CSV(const File& aFile, const Size& aStepInterval = 1);
+
+    /// @brief Constructs a sink streaming states to a binary file
+    ///
+    /// @param aFile A file, created or truncated
+    /// @param aStepInterval (optional) Write one out of every N pushed states. Defaults to 1, i.e. every state.
+    /// @return Shared pointer to state sink
+    static Shared<StateSink> Binary(const File& aFile, const Size& aStepInterval = 1);
+
+   private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        State state = State::Undefined();
+    };
+
+    Shared<StateWriter> stateWriterSPtr_;
+    Size stepInterval_;
+
+    std::size_t queueMask_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(64) std::atomic<std::size_t> enqueuePosition_;
+    alignas(64) std::atomic<std::size_t> dequeuePosition_;
+
+    std::atomic<Size> pushedStateCount_;
+    std::atomic<Size> enqueuedStateCount_;
+    std::atomic<Size> writtenStateCount_;
+    std::atomic<Size> stallCount_;
+    std::atomic<Size> activeProducerCount_;
+
+    std::atomic<Size> flushRequestCount_;
+    std::atomic<Size> flushCount_;
+    std::atomic<bool> isClosing_;
+
+    std::mutex closeMutex_;
+    std::thread writerThread_;
+
+    mutable std::mutex writerErrorMutex_;
+    std::exception_ptr writerError_;
+
+    bool tryEnqueue(const State& aState);
+    bool tryDequeue(State& aState);
+
+    void run();
+    void setWriterError(const std::exception_ptr& anError);
+    void throwWriterError() const;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,42 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriter__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriter__
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::astro::trajectory::State;
+
+/// @brief Write states to a destination, e.g. a file.
+///
+/// State writers are driven by a state sink, from a single background thread: they do not need to be thread-safe.
+class StateWriter
+{
+   public:
+    /// @brief Destructor
+    virtual ~StateWriter();
+
+    /// @brief Write a state
+    ///
+    /// @param aState A state
+    virtual void write(const State& aState) = 0;
+
+    /// @brief Flush the written states to the destination
+    virtual void flush() = 0;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,73 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_Binary__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_Binary__
+
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+namespace statewriters
+{
+
+using ostk::core::filesystem::File;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::StateWriter;
+
+/// @brief Write states to a binary file.
+///
+/// The file starts with the 8-byte magic string "OSTKSTAT" and a 32-bit version number (1). Each state is then written
+/// as a record holding the instant (64-bit float, seconds since J2000), the number of coordinates (32-bit unsigned
+/// integer) and the coordinates (64-bit floats), in the native byte order. Frames and coordinates subsets are not
+/// written.
+class Binary : public StateWriter
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///     Binary binaryWriter = {File::Path(Path::Parse("/path/to/states.bin"))};
+    /// @endcode
+    ///
+    /// @param aFile A file, created or truncated
+    Binary(const File& aFile);
+
+    /// @brief Destructor
+    ~Binary();
+
+    /// @brief Get file
+    ///
+    /// @return The file
+    File getFile() const;
+
+    /// @brief Write a state
+    ///
+    /// @param aState A state
+    virtual void write(const State& aState) override;
+
+    /// @brief Flush the written states to the file
+    virtual void flush() override;
+
+   private:
+    File file_;
+    std::ofstream stream_;
+};
+
+}  // namespace statewriters
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,78 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_CSV__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_CSV__
+
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+namespace statewriters
+{
+
+using ostk::core::filesystem::File;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::StateWriter;
+
+/// @brief Write states to a CSV file.
+///
+/// Each row holds the instant (ISO 8601, UTC), the frame name and the coordinates of a state. Coordinates columns are
+/// named after the coordinates subsets, suffixed with the coordinate index for multi-dimensional subsets. A new header
+/// row is written whenever the coordinates subsets change from one state to the next.
+class CSV : public StateWriter
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///     CSV csvWriter = {File::Path(Path::Parse("/path/to/states.csv"))};
+    /// @endcode
+    ///
+    /// @param aFile A file, created or truncated
+    /// @param aPrecision (optional) The number of significant digits of the coordinates. Defaults to 17.
+    CSV(const File& aFile, const Size& aPrecision = 17);
+
+    /// @brief Destructor
+    ~CSV();
+
+    /// @brief Get file
+    ///
+    /// @return The file
+    File getFile() const;
+
+    /// @brief Write a state
+    ///
+    /// @param aState A state
+    virtual void write(const State& aState) override;
+
+    /// @brief Flush the written states to the file
+    virtual void flush() override;
+
+   private:
+    File file_;
+    std::ofstream stream_;
+    String header_;
+};
+
+}  // namespace statewriters
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
+
+#endif
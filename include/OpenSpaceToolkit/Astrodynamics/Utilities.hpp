@@ -0,0 +1,46 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Utilities__
+#define __OpenSpaceToolkit_Astrodynamics_Utilities__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace utilities
+{
+
+using ostk::core::types::Index;
+using ostk::core::types::Size;
+
+/// @brief Resolve a thread count
+///
+/// @param aThreadCount A number of threads, zero meaning the hardware concurrency
+/// @return The number of threads, at least one
+Size ResolveThreadCount(const Size& aThreadCount);
+
+/// @brief Call a function for every index of a range, on a pool of threads
+///
+/// Indices are handed out one at a time to the workers, in increasing order. With a single worker, the function is
+/// called serially on the calling thread. If a call throws, no further indices are handed out, and the first
+/// exception is rethrown once every worker has returned.
+///
+/// @code{.cpp}
+///     ParallelFor(sampleCount, threadCount, [&](const Index& anIndex) -> void { results[anIndex] = ...; });
+/// @endcode
+///
+/// @param aCount The number of indices, from zero
+/// @param aThreadCount A number of threads, zero meaning the hardware concurrency
+/// @param aFunction A function of the index, safe to call concurrently for distinct indices
+void ParallelFor(const Size& aCount, const Size& aThreadCount, const std::function<void(const Index&)>& aFunction);
+
+}  // namespace utilities
+}  // namespace astro
+}  // namespace ostk
+
+#endif
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <chrono>
+
 #include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -26,6 +28,8 @@ using ostk::astro::dynamics::ThirdBodyGravity;
 using ostk::astro::dynamics::AtmosphericDrag;
 using ostk::astro::dynamics::PositionDerivative;
 
+Dynamics::Hold::~Hold() {}
+
 Dynamics::Context::Context(
     const Shared<Dynamics>& aDynamicsSPtr,
     const Array<Pair<Index, Size>>& aReadIndexes,
@@ -34,7 +38,8 @@ Dynamics::Context::Context(
     : dynamics(aDynamicsSPtr),
       readIndexes(aReadIndexes),
       writeIndexes(aWriteIndexes),
-      readStateSize(0)
+      readStateSize(0),
+      hold(nullptr)
 {
     for (const Pair<Index, Size>& pair : readIndexes)
     {
@@ -70,41 +75,214 @@ void Dynamics::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+MatrixXd Dynamics::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    Size writeSize = 0;
+
+    for (const Shared<const CoordinatesSubset>& coordinatesSubsetSPtr : this->getWriteCoordinatesSubsets())
+    {
+        writeSize += coordinatesSubsetSPtr->getSize();
+    }
+
+    MatrixXd jacobian = MatrixXd::Zero(writeSize, x.size());
+
+    VectorXd perturbedX = x;
+
+    for (Index i = 0; i < Index(x.size()); ++i)
+    {
+        const double step = 1e-6 * std::max(1.0, std::abs(x(i)));
+
+        perturbedX(i) = x(i) + step;
+        const VectorXd forwardContribution = this->computeContribution(anInstant, perturbedX, aFrameSPtr);
+
+        perturbedX(i) = x(i) - step;
+        const VectorXd backwardContribution = this->computeContribution(anInstant, perturbedX, aFrameSPtr);
+
+        perturbedX(i) = x(i);
+
+        jacobian.col(i) = (forwardContribution - backwardContribution) / (2.0 * step);
+    }
+
+    return jacobian;
+}
+
+Shared<Dynamics::Hold> Dynamics::createHold() const
+{
+    return nullptr;
+}
+
+bool Dynamics::updateHold(
+    [[maybe_unused]] Dynamics::Hold& aHold,
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    [[maybe_unused]] const bool& isIntegrationStart
+) const
+{
+    return false;
+}
+
+VectorXd Dynamics::computeHeldContribution(
+    const Instant& anInstant,
+    const VectorXd& x,
+    const Shared<const Frame>& aFrameSPtr,
+    [[maybe_unused]] const Dynamics::Hold& aHold
+) const
+{
+    return this->computeContribution(anInstant, x, aFrameSPtr);
+}
+
 NumericalSolver::SystemOfEquationsWrapper Dynamics::GetSystemOfEquations(
-    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    Array<Duration>* aWallTimeArrayPtr,
+    NumericalSolver::StepObserver* aStepObserverPtr
 )
 {
+    if ((aWallTimeArrayPtr != nullptr) && (aWallTimeArrayPtr->getSize() != aContextArray.getSize()))
+    {
+        throw ostk::core::error::runtime::Wrong("Wall time array size");
+    }
+
+    // The holds belong to this system of equations, shared with its step observer
+
+    Array<Dynamics::Context> contexts = aContextArray;
+
+    bool hasHolds = false;
+
+    for (Dynamics::Context& context : contexts)
+    {
+        context.hold = (aStepObserverPtr != nullptr) ? context.dynamics->createHold() : nullptr;
+        hasHolds = hasHolds || (context.hold != nullptr);
+    }
+
+    if (aStepObserverPtr != nullptr)
+    {
+        *aStepObserverPtr = nullptr;
+    }
+
+    if (hasHolds)
+    {
+        *aStepObserverPtr = [contexts, anInstant, aFrameSPtr](
+                                const NumericalSolver::StateVector& x, const double& t, const bool& isStart
+                            ) -> bool
+        {
+            const Instant instant = anInstant + Duration::Seconds(t);
+
+            bool holdHasChanged = false;
+
+            for (const Dynamics::Context& context : contexts)
+            {
+                if (context.hold == nullptr)
+                {
+                    continue;
+                }
+
+                holdHasChanged = context.dynamics->updateHold(
+                                     *context.hold,
+                                     instant,
+                                     Dynamics::extractReadState(x, context.readIndexes, context.readStateSize),
+                                     aFrameSPtr,
+                                     isStart
+                                 ) ||
+                                 holdHasChanged;
+            }
+
+            return holdHasChanged;
+        };
+    }
+
     return std::bind(
         Dynamics::DynamicalEquations,
         std::placeholders::_1,
         std::placeholders::_2,
         std::placeholders::_3,
-        aContextArray,
+        contexts,
         anInstant,
-        aFrameSPtr
+        aFrameSPtr,
+        aWallTimeArrayPtr
     );
 }
 
+MatrixXd Dynamics::ComputeJacobian(
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const VectorXd& aStateVector,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    MatrixXd jacobian = MatrixXd::Zero(aStateVector.size(), aStateVector.size());
+
+    for (const Dynamics::Context& dynamicsContext : aContextArray)
+    {
+        Dynamics::applyContributionJacobian(
+            jacobian,
+            dynamicsContext.dynamics->computeContributionJacobian(
+                anInstant,
+                Dynamics::extractReadState(aStateVector, dynamicsContext.readIndexes, dynamicsContext.readStateSize),
+                aFrameSPtr
+            ),
+            dynamicsContext.readIndexes,
+            dynamicsContext.writeIndexes
+        );
+    }
+
+    return jacobian;
+}
+
 void Dynamics::DynamicalEquations(
     const NumericalSolver::StateVector& x,
     NumericalSolver::StateVector& dxdt,
     const double& t,
     const Array<Dynamics::Context>& aContextArray,
     const Instant& anInstant,
-    const Shared<const Frame>& aFrameSPtr
+    const Shared<const Frame>& aFrameSPtr,
+    Array<Duration>* aWallTimeArrayPtr
 )
 {
     dxdt.setZero();
 
     const Instant nextInstant = anInstant + Duration::Seconds(t);
 
+    const auto computeContribution = [&x, &nextInstant, &aFrameSPtr](const Dynamics::Context& aContext) -> VectorXd
+    {
+        const VectorXd readState = Dynamics::extractReadState(x, aContext.readIndexes, aContext.readStateSize);
+
+        if (aContext.hold != nullptr)
+        {
+            return aContext.dynamics->computeHeldContribution(nextInstant, readState, aFrameSPtr, *aContext.hold);
+        }
+
+        return aContext.dynamics->computeContribution(nextInstant, readState, aFrameSPtr);
+    };
+
+    if (aWallTimeArrayPtr != nullptr)
+    {
+        for (Index i = 0; i < aContextArray.getSize(); ++i)
+        {
+            const Dynamics::Context& dynamicsContext = aContextArray[i];
+
+            const auto startTime = std::chrono::steady_clock::now();
+
+            const VectorXd contribution = computeContribution(dynamicsContext);
+
+            (*aWallTimeArrayPtr)[i] += Duration::Nanoseconds(double(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime)
+                    .count()
+            ));
+
+            Dynamics::applyContribution(dxdt, contribution, dynamicsContext.writeIndexes);
+        }
+
+        return;
+    }
+
     for (const Dynamics::Context& dynamicsContext : aContextArray)
     {
-        const VectorXd contribution = dynamicsContext.dynamics->computeContribution(
-            nextInstant,
-            Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readStateSize),
-            aFrameSPtr
-        );
+        const VectorXd contribution = computeContribution(dynamicsContext);
 
         Dynamics::applyContribution(dxdt, contribution, dynamicsContext.writeIndexes);
     }
@@ -144,6 +322,28 @@ void Dynamics::applyContribution(
     }
 }
 
+void Dynamics::applyContributionJacobian(
+    MatrixXd& aJacobian,
+    const MatrixXd& aContributionJacobian,
+    const Array<Pair<Index, Size>>& readInfo,
+    const Array<Pair<Index, Size>>& writeInfo
+)
+{
+    Index rowOffset = 0;
+    for (const Pair<Index, Size>& writePair : writeInfo)
+    {
+        Index columnOffset = 0;
+        for (const Pair<Index, Size>& readPair : readInfo)
+        {
+            aJacobian.block(writePair.first, readPair.first, writePair.second, readPair.second) +=
+                aContributionJacobian.block(rowOffset, columnOffset, writePair.second, readPair.second);
+            columnOffset += readPair.second;
+        }
+
+        rowOffset += writePair.second;
+    }
+}
+
 Array<Shared<Dynamics>> Dynamics::FromEnvironment(const Environment& anEnvironment)
 {
     const auto getDynamics = [](const Shared<const Celestial>& aCelestial) -> Array<Shared<Dynamics>>
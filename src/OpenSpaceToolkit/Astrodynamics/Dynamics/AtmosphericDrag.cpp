@@ -4,6 +4,9 @@
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dual.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
@@ -24,6 +27,7 @@ using ostk::physics::units::Derived;
 using ostk::physics::units::Length;
 using ostk::physics::units::Time;
 using ostk::physics::coord::Position;
+using ostk::physics::coord::Transform;
 
 using ostk::astro::trajectory::state::CoordinatesSubset;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
@@ -39,7 +43,8 @@ AtmosphericDrag::AtmosphericDrag(const Shared<const Celestial>& aCelestialSPtr)
 
 AtmosphericDrag::AtmosphericDrag(const Shared<const Celestial>& aCelestialSPtr, const String& aName)
     : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialSPtr)
+      celestialObjectSPtr_(aCelestialSPtr),
+      densityCacheSPtr_(nullptr)
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->atmosphericModelIsDefined())
     {
@@ -47,6 +52,20 @@ AtmosphericDrag::AtmosphericDrag(const Shared<const Celestial>& aCelestialSPtr,
     }
 }
 
+AtmosphericDrag::AtmosphericDrag(const Shared<const DensityCache>& aDensityCacheSPtr)
+    : AtmosphericDrag(
+          (aDensityCacheSPtr != nullptr) ? aDensityCacheSPtr->getCelestial() : nullptr,
+          String::Format(
+              "Atmospheric Drag [{}]",
+              ((aDensityCacheSPtr != nullptr) && (aDensityCacheSPtr->getCelestial() != nullptr))
+                  ? aDensityCacheSPtr->getCelestial()->getName()
+                  : String("Undefined")
+          )
+      )
+{
+    densityCacheSPtr_ = aDensityCacheSPtr;
+}
+
 AtmosphericDrag::~AtmosphericDrag() {}
 
 std::ostream& operator<<(std::ostream& anOutputStream, const AtmosphericDrag& anAtmosphericDrag)
@@ -71,6 +90,21 @@ Shared<const Celestial> AtmosphericDrag::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+bool AtmosphericDrag::hasDensityCache() const
+{
+    return densityCacheSPtr_ != nullptr;
+}
+
+Shared<const DensityCache> AtmosphericDrag::getDensityCache() const
+{
+    if (densityCacheSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Density Cache");
+    }
+
+    return densityCacheSPtr_;
+}
+
 Array<Shared<const CoordinatesSubset>> AtmosphericDrag::getReadCoordinatesSubsets() const
 {
     return {
@@ -99,14 +133,14 @@ VectorXd AtmosphericDrag::computeContribution(
     const Real surfaceArea = x[7];  // m^2
     const Real dragCoefficient = x[8];
 
+    // Get the transform to ITRF once, it provides both the position used for the density and the angular velocity
+    const Transform transform = aFrameSPtr->getTransformTo(Frame::ITRF(), anInstant);
+
     // Get atmospheric density
     const Real atmosphericDensity =
-        celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, aFrameSPtr), anInstant)
-            .inUnit(Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter)))
-            .getValue();
+        this->computeAtmosphericDensity(anInstant, positionCoordinates, transform, aFrameSPtr);
 
-    const Vector3d earthAngularVelocity =
-        aFrameSPtr->getTransformTo(Frame::ITRF(), anInstant).getAngularVelocity();  // rad/s
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
 
     const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocity.cross(positionCoordinates);
 
@@ -121,17 +155,88 @@ VectorXd AtmosphericDrag::computeContribution(
     return contribution;
 }
 
+MatrixXd AtmosphericDrag::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    using std::sqrt;
+
+    const Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
+
+    const Transform transform = aFrameSPtr->getTransformTo(Frame::ITRF(), anInstant);
+
+    // The atmospheric models are not differentiable, the density gradient is computed with central differences
+
+    static const double densityStep = 10.0;  // m
+
+    VectorXd atmosphericDensityDerivatives = VectorXd::Zero(9);
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const Vector3d positionStep = densityStep * Vector3d::Unit(i);
+
+        atmosphericDensityDerivatives(i) =
+            (this->computeAtmosphericDensity(anInstant, positionCoordinates + positionStep, transform, aFrameSPtr) -
+             this->computeAtmosphericDensity(anInstant, positionCoordinates - positionStep, transform, aFrameSPtr)) /
+            (2.0 * densityStep);
+    }
+
+    // Drag acceleration, differentiated exactly with respect to the reduced state vector
+
+    const dual::VectorX variables = dual::Seed(x.head(9));
+
+    const dual::Vector3 position = variables.segment(0, 3);
+    const dual::Vector3 velocity = variables.segment(3, 3);
+    const dual::Scalar& mass = variables[6];
+    const dual::Scalar& surfaceArea = variables[7];
+    const dual::Scalar& dragCoefficient = variables[8];
+
+    const dual::Scalar atmosphericDensity = {
+        this->computeAtmosphericDensity(anInstant, positionCoordinates, transform, aFrameSPtr),
+        atmosphericDensityDerivatives,
+    };
+
+    const dual::Vector3 earthAngularVelocity = transform.getAngularVelocity().cast<dual::Scalar>();
+
+    const dual::Vector3 relativeVelocity = velocity - earthAngularVelocity.cross(position);
+    const dual::Scalar relativeSpeed = sqrt(relativeVelocity.squaredNorm());
+
+    const dual::Scalar dragScale = -(0.5 / mass) * surfaceArea * dragCoefficient * atmosphericDensity * relativeSpeed;
+    const dual::Vector3 dragAccelerationSI = dragScale * relativeVelocity;
+
+    return dual::Jacobian(dragAccelerationSI, 9);
+}
+
 void AtmosphericDrag::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Atmospheric Drag Dynamics") : void();
 
     Dynamics::print(anOutputStream, false);
 
+    ostk::core::utils::Print::Line(anOutputStream) << "Density Cache:" << (densityCacheSPtr_ != nullptr ? "Yes" : "No");
+
     // TBI: Print Celestial once we have a proper implementation of Celestial::print
 
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Real AtmosphericDrag::computeAtmosphericDensity(
+    const Instant& anInstant,
+    const Vector3d& aPositionCoordinates,
+    const Transform& aTransform,
+    const Shared<const Frame>& aFrameSPtr
+) const
+{
+    if (densityCacheSPtr_ != nullptr)
+    {
+        return densityCacheSPtr_->getDensityAt(aTransform.applyToPosition(aPositionCoordinates), anInstant);
+    }
+
+    return celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(aPositionCoordinates, aFrameSPtr), anInstant)
+        .inUnit(Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter)))
+        .getValue();
+}
+
 }  // namespace dynamics
 }  // namespace astro
 }  // namespace ostk
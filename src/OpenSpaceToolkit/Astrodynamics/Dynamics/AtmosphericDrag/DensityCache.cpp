@@ -0,0 +1,456 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag/DensityCache.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace dynamics
+{
+namespace atmosphericdrag
+{
+
+using ostk::physics::Unit;
+using ostk::physics::coord::Frame;
+using ostk::physics::coord::Position;
+using ostk::physics::coord::spherical::LLA;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Mass;
+
+static const Unit MassDensitySIUnit = Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+static double WrapDegrees(const double& anAngleDeg)
+{
+    // Wrap to [-180, 180)
+    return anAngleDeg - 360.0 * std::floor((anAngleDeg + 180.0) / 360.0);
+}
+
+DensityCache::DensityCache(
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Interval& anInterval,
+    const Length& anAltitudeStep,
+    const Angle& aLatitudeStep,
+    const Duration& aLocalSolarTimeStep,
+    const Duration& aTimeStep,
+    const Real& aRelativeTolerance
+)
+    : celestialObjectSPtr_(aCelestialSPtr),
+      sunSPtr_(std::make_shared<Sun>(Sun::Default())),
+      interval_(anInterval),
+      altitudeStepSI_(anAltitudeStep.inMeters()),
+      latitudeStepDeg_(aLatitudeStep.inDegrees()),
+      localSolarTimeStepHours_(aLocalSolarTimeStep.inHours()),
+      timeStepSI_(aTimeStep.inSeconds()),
+      relativeTolerance_(aRelativeTolerance),
+      localSolarTimeNodeCount_(0),
+      mutex_(),
+      logDensities_(),
+      cellValidities_(),
+      sunLongitudesDeg_(),
+      interpolatedQueryCount_(0),
+      directQueryCount_(0)
+{
+    if ((celestialObjectSPtr_ == nullptr) || !celestialObjectSPtr_->atmosphericModelIsDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric Model");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!anAltitudeStep.isDefined() || (altitudeStepSI_ <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Altitude step");
+    }
+
+    if (!aLatitudeStep.isDefined() || (latitudeStepDeg_ < (90.0 / 2000.0)) || (latitudeStepDeg_ > 90.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Latitude step");
+    }
+
+    // The local solar time index of a node is packed on 12 bits of its key
+
+    if (!aLocalSolarTimeStep.isDefined() || (localSolarTimeStepHours_ <= 0.0) ||
+        (std::abs(std::remainder(24.0, localSolarTimeStepHours_)) > 1e-9) ||
+        (std::round(24.0 / localSolarTimeStepHours_) > double(1 << 12)))
+    {
+        throw ostk::core::error::runtime::Wrong("Local solar time step");
+    }
+
+    if (!aTimeStep.isDefined() || (timeStepSI_ <= 0.0) ||
+        ((interval_.getDuration().inSeconds() / timeStepSI_) >= double(1 << 23)))
+    {
+        throw ostk::core::error::runtime::Wrong("Time step");
+    }
+
+    if (!aRelativeTolerance.isDefined() || (aRelativeTolerance <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Relative tolerance");
+    }
+
+    localSolarTimeNodeCount_ = std::int64_t(std::round(24.0 / localSolarTimeStepHours_));
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const DensityCache& aDensityCache)
+{
+    aDensityCache.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool DensityCache::isDefined() const
+{
+    return (celestialObjectSPtr_ != nullptr) && celestialObjectSPtr_->isDefined() && interval_.isDefined();
+}
+
+Shared<const Celestial> DensityCache::getCelestial() const
+{
+    return celestialObjectSPtr_;
+}
+
+Interval DensityCache::getInterval() const
+{
+    return interval_;
+}
+
+Real DensityCache::getRelativeTolerance() const
+{
+    return relativeTolerance_;
+}
+
+Size DensityCache::getNodeCount() const
+{
+    const std::shared_lock<std::shared_mutex> lock {mutex_};
+
+    return logDensities_.size();
+}
+
+Size DensityCache::getInterpolatedQueryCount() const
+{
+    return interpolatedQueryCount_.load();
+}
+
+Size DensityCache::getDirectQueryCount() const
+{
+    return directQueryCount_.load();
+}
+
+Real DensityCache::getDensityAt(const Vector3d& aPositionCoordinates, const Instant& anInstant) const
+{
+    const auto evaluateDirectly = [this, &aPositionCoordinates, &anInstant]() -> Real
+    {
+        ++directQueryCount_;
+
+        return celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(aPositionCoordinates, Frame::ITRF()), anInstant)
+            .inUnit(MassDensitySIUnit)
+            .getValue();
+    };
+
+    if (!interval_.contains(anInstant))
+    {
+        return evaluateDirectly();
+    }
+
+    const LLA lla = LLA::Cartesian(
+        aPositionCoordinates, celestialObjectSPtr_->getEquatorialRadius(), celestialObjectSPtr_->getFlattening()
+    );
+
+    const double altitudeSI = lla.getAltitude().inMeters();
+    const double latitudeDeg = lla.getLatitude().inDegrees();
+    const double longitudeDeg = lla.getLongitude().inDegrees();
+
+    // Time
+
+    const double timeCoordinate = (anInstant - interval_.accessStart()).inSeconds() / timeStepSI_;
+    const std::int64_t timeIndex = std::int64_t(std::floor(timeCoordinate));
+    const double timeFraction = timeCoordinate - timeIndex;
+
+    // Local solar time, from the Sun longitude interpolated between time nodes
+
+    const double previousSunLongitudeDeg = this->accessSunLongitudeAt(timeIndex);
+    const double nextSunLongitudeDeg = this->accessSunLongitudeAt(timeIndex + 1);
+
+    const double sunLongitudeDeg =
+        previousSunLongitudeDeg + timeFraction * WrapDegrees(nextSunLongitudeDeg - previousSunLongitudeDeg);
+
+    const double localSolarTimeHours = 12.0 + WrapDegrees(longitudeDeg - sunLongitudeDeg) / 15.0;
+
+    // Grid cell
+
+    const double altitudeCoordinate = altitudeSI / altitudeStepSI_;
+    const double latitudeCoordinate = latitudeDeg / latitudeStepDeg_;
+    const double localSolarTimeCoordinate = localSolarTimeHours / localSolarTimeStepHours_;
+
+    const std::int64_t altitudeIndex = std::int64_t(std::floor(altitudeCoordinate));
+    const std::int64_t latitudeIndex = std::int64_t(std::floor(latitudeCoordinate));
+    const std::int64_t localSolarTimeIndex = std::int64_t(std::floor(localSolarTimeCoordinate));
+
+    if ((altitudeSI < 0.0) || (std::abs(altitudeIndex) >= (1 << 15)) ||
+        !this->isCellInterpolable(altitudeIndex, latitudeIndex, localSolarTimeIndex, timeIndex))
+    {
+        return evaluateDirectly();
+    }
+
+    const double fractions[4] = {
+        altitudeCoordinate - altitudeIndex,
+        latitudeCoordinate - latitudeIndex,
+        localSolarTimeCoordinate - localSolarTimeIndex,
+        timeFraction,
+    };
+
+    ++interpolatedQueryCount_;
+
+    return std::exp(
+        this->interpolateLogDensity(altitudeIndex, latitudeIndex, localSolarTimeIndex, timeIndex, fractions)
+    );
+}
+
+void DensityCache::clear()
+{
+    const std::unique_lock<std::shared_mutex> lock {mutex_};
+
+    logDensities_.clear();
+    cellValidities_.clear();
+    sunLongitudesDeg_.clear();
+
+    interpolatedQueryCount_ = 0;
+    directQueryCount_ = 0;
+}
+
+void DensityCache::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Density Cache") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Celestial:" << ((celestialObjectSPtr_ != nullptr) ? celestialObjectSPtr_->getName() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Interval:" << interval_.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Altitude step [m]:" << altitudeStepSI_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Latitude step [deg]:" << latitudeStepDeg_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Local solar time step [h]:" << localSolarTimeStepHours_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Time step [s]:" << timeStepSI_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Relative tolerance:" << relativeTolerance_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Node count:" << this->getNodeCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Interpolated query count:" << this->getInterpolatedQueryCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Direct query count:" << this->getDirectQueryCount();
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+double DensityCache::evaluateDensityAt(
+    const double& anAltitudeSI, const double& aLatitudeDeg, const double& aLongitudeDeg, const Instant& anInstant
+) const
+{
+    const LLA lla = {
+        Angle::Degrees(std::max(-90.0, std::min(90.0, aLatitudeDeg))),
+        Angle::Degrees(WrapDegrees(aLongitudeDeg)),
+        Length::Meters(anAltitudeSI),
+    };
+
+    const Vector3d positionCoordinates =
+        lla.toCartesian(celestialObjectSPtr_->getEquatorialRadius(), celestialObjectSPtr_->getFlattening());
+
+    return celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, Frame::ITRF()), anInstant)
+        .inUnit(MassDensitySIUnit)
+        .getValue();
+}
+
+double DensityCache::accessSunLongitudeAt(const std::int64_t& aTimeIndex) const
+{
+    {
+        const std::shared_lock<std::shared_mutex> lock {mutex_};
+
+        const auto sunLongitudeIt = sunLongitudesDeg_.find(aTimeIndex);
+
+        if (sunLongitudeIt != sunLongitudesDeg_.end())
+        {
+            return sunLongitudeIt->second;
+        }
+    }
+
+    const Instant instant = interval_.accessStart() + Duration::Seconds(aTimeIndex * timeStepSI_);
+
+    const Vector3d sunPositionCoordinates =
+        sunSPtr_->getPositionIn(Frame::ITRF(), instant).inUnit(Position::Unit::Meter).accessCoordinates();
+
+    const double sunLongitudeDeg = std::atan2(sunPositionCoordinates.y(), sunPositionCoordinates.x()) * 180.0 / M_PI;
+
+    const std::unique_lock<std::shared_mutex> lock {mutex_};
+
+    return sunLongitudesDeg_.emplace(aTimeIndex, sunLongitudeDeg).first->second;
+}
+
+double DensityCache::accessLogDensityAt(
+    const std::int64_t& anAltitudeIndex,
+    const std::int64_t& aLatitudeIndex,
+    const std::int64_t& aLocalSolarTimeIndex,
+    const std::int64_t& aTimeIndex
+) const
+{
+    const std::int64_t localSolarTimeIndex =
+        ((aLocalSolarTimeIndex % localSolarTimeNodeCount_) + localSolarTimeNodeCount_) % localSolarTimeNodeCount_;
+
+    const std::uint64_t key = DensityCache::Key(anAltitudeIndex, aLatitudeIndex, localSolarTimeIndex, aTimeIndex);
+
+    {
+        const std::shared_lock<std::shared_mutex> lock {mutex_};
+
+        const auto logDensityIt = logDensities_.find(key);
+
+        if (logDensityIt != logDensities_.end())
+        {
+            return logDensityIt->second;
+        }
+    }
+
+    // Evaluate the node outside of the lock, as the atmospheric model is the expensive part
+
+    const double localSolarTimeHours = localSolarTimeIndex * localSolarTimeStepHours_;
+    const double longitudeDeg = this->accessSunLongitudeAt(aTimeIndex) + (localSolarTimeHours - 12.0) * 15.0;
+
+    const double density = this->evaluateDensityAt(
+        anAltitudeIndex * altitudeStepSI_,
+        aLatitudeIndex * latitudeStepDeg_,
+        longitudeDeg,
+        interval_.accessStart() + Duration::Seconds(aTimeIndex * timeStepSI_)
+    );
+
+    const double logDensity = (density > 0.0) ? std::log(density) : -std::numeric_limits<double>::infinity();
+
+    const std::unique_lock<std::shared_mutex> lock {mutex_};
+
+    return logDensities_.emplace(key, logDensity).first->second;
+}
+
+double DensityCache::interpolateLogDensity(
+    const std::int64_t& anAltitudeIndex,
+    const std::int64_t& aLatitudeIndex,
+    const std::int64_t& aLocalSolarTimeIndex,
+    const std::int64_t& aTimeIndex,
+    const double (&aFractionArray)[4]
+) const
+{
+    // Quadrilinear interpolation over the 16 corners of the cell
+
+    double logDensity = 0.0;
+
+    for (std::int64_t corner = 0; corner < 16; ++corner)
+    {
+        const std::int64_t offsets[4] = {
+            (corner >> 0) & 1,
+            (corner >> 1) & 1,
+            (corner >> 2) & 1,
+            (corner >> 3) & 1,
+        };
+
+        double weight = 1.0;
+
+        for (std::int64_t dimension = 0; dimension < 4; ++dimension)
+        {
+            weight *= (offsets[dimension] == 1) ? aFractionArray[dimension] : (1.0 - aFractionArray[dimension]);
+        }
+
+        if (weight == 0.0)
+        {
+            continue;
+        }
+
+        logDensity += weight * this->accessLogDensityAt(
+                                   anAltitudeIndex + offsets[0],
+                                   aLatitudeIndex + offsets[1],
+                                   aLocalSolarTimeIndex + offsets[2],
+                                   aTimeIndex + offsets[3]
+                               );
+    }
+
+    return logDensity;
+}
+
+bool DensityCache::isCellInterpolable(
+    const std::int64_t& anAltitudeIndex,
+    const std::int64_t& aLatitudeIndex,
+    const std::int64_t& aLocalSolarTimeIndex,
+    const std::int64_t& aTimeIndex
+) const
+{
+    const std::int64_t localSolarTimeIndex =
+        ((aLocalSolarTimeIndex % localSolarTimeNodeCount_) + localSolarTimeNodeCount_) % localSolarTimeNodeCount_;
+
+    const std::uint64_t key = DensityCache::Key(anAltitudeIndex, aLatitudeIndex, localSolarTimeIndex, aTimeIndex);
+
+    {
+        const std::shared_lock<std::shared_mutex> lock {mutex_};
+
+        const auto cellValidityIt = cellValidities_.find(key);
+
+        if (cellValidityIt != cellValidities_.end())
+        {
+            return cellValidityIt->second;
+        }
+    }
+
+    // Validate the cell once, against a direct evaluation at its center
+
+    const double centerFractions[4] = {0.5, 0.5, 0.5, 0.5};
+
+    const double interpolatedDensity = std::exp(this->interpolateLogDensity(
+        anAltitudeIndex, aLatitudeIndex, localSolarTimeIndex, aTimeIndex, centerFractions
+    ));
+
+    const double previousSunLongitudeDeg = this->accessSunLongitudeAt(aTimeIndex);
+    const double nextSunLongitudeDeg = this->accessSunLongitudeAt(aTimeIndex + 1);
+
+    const double centerSunLongitudeDeg =
+        previousSunLongitudeDeg + 0.5 * WrapDegrees(nextSunLongitudeDeg - previousSunLongitudeDeg);
+    const double centerLocalSolarTimeHours = (localSolarTimeIndex + 0.5) * localSolarTimeStepHours_;
+
+    const double centerDensity = this->evaluateDensityAt(
+        (anAltitudeIndex + 0.5) * altitudeStepSI_,
+        (aLatitudeIndex + 0.5) * latitudeStepDeg_,
+        centerSunLongitudeDeg + (centerLocalSolarTimeHours - 12.0) * 15.0,
+        interval_.accessStart() + Duration::Seconds((aTimeIndex + 0.5) * timeStepSI_)
+    );
+
+    const bool isInterpolable = std::isfinite(interpolatedDensity) && (centerDensity > 0.0) &&
+                                (std::abs(interpolatedDensity - centerDensity) <= relativeTolerance_ * centerDensity);
+
+    const std::unique_lock<std::shared_mutex> lock {mutex_};
+
+    return cellValidities_.emplace(key, isInterpolable).first->second;
+}
+
+std::uint64_t DensityCache::Key(
+    const std::int64_t& anAltitudeIndex,
+    const std::int64_t& aLatitudeIndex,
+    const std::int64_t& aLocalSolarTimeIndex,
+    const std::int64_t& aTimeIndex
+)
+{
+    // 16 bits altitude | 12 bits latitude | 12 bits local solar time | 24 bits time
+
+    return ((std::uint64_t(anAltitudeIndex + (1 << 15)) & 0xFFFF) << 48) |
+           ((std::uint64_t(aLatitudeIndex + (1 << 11)) & 0xFFF) << 36) |
+           ((std::uint64_t(aLocalSolarTimeIndex) & 0xFFF) << 24) | (std::uint64_t(aTimeIndex + 1) & 0xFFFFFF);
+}
+
+}  // namespace atmosphericdrag
+}  // namespace dynamics
+}  // namespace astro
+}  // namespace ostk
@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Dual.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
@@ -104,6 +105,60 @@ VectorXd CentralBodyGravity::computeContribution(
     return contribution;
 }
 
+MatrixXd CentralBodyGravity::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const double gravitationalParameterSI =
+        celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit);
+
+    const auto computePointMassAcceleration = [gravitationalParameterSI](const auto& aPositionCoordinates)
+    {
+        using Scalar = typename std::decay_t<decltype(aPositionCoordinates)>::Scalar;
+        using std::sqrt;
+
+        const Scalar radius = sqrt(aPositionCoordinates.squaredNorm());
+        const Scalar scale = -gravitationalParameterSI / (radius * radius * radius);
+
+        return Eigen::Matrix<Scalar, 3, 1>(scale * aPositionCoordinates);
+    };
+
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+
+    // Point mass term, differentiated exactly
+
+    const dual::Vector3 dualPositionCoordinates = dual::Seed(positionCoordinates);
+
+    MatrixXd jacobian = dual::Jacobian(computePointMassAcceleration(dualPositionCoordinates), 3);
+
+    // Residual of the gravitational model, differentiated with central differences
+
+    const auto computeResidualAcceleration = [&](const Vector3d& aPositionCoordinates) -> Vector3d
+    {
+        return this->computeContribution(anInstant, aPositionCoordinates, aFrameSPtr) -
+               computePointMassAcceleration(aPositionCoordinates);
+    };
+
+    if (computeResidualAcceleration(positionCoordinates).norm() <=
+        1e-12 * computePointMassAcceleration(positionCoordinates).norm())
+    {
+        return jacobian;  // The gravitational model reduces to a point mass
+    }
+
+    const double step = 1e-6 * positionCoordinates.norm();
+
+    for (Index i = 0; i < 3; ++i)
+    {
+        const Vector3d positionStep = step * Vector3d::Unit(i);
+
+        jacobian.col(i) += (computeResidualAcceleration(positionCoordinates + positionStep) -
+                            computeResidualAcceleration(positionCoordinates - positionStep)) /
+                           (2.0 * step);
+    }
+
+    return jacobian;
+}
+
 void CentralBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Central Body Gravitational Dynamics") : void();
@@ -0,0 +1,470 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Containers/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/FidelitySchedule.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace dynamics
+{
+
+using ostk::core::ctnr::Pair;
+
+using ostk::physics::coord::Position;
+
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+
+namespace
+{
+
+/// @brief Locate a coordinates subset in an array of coordinates subsets, as its offset and size
+Pair<Index, Size> LocateSubset(
+    const Array<Shared<const CoordinatesSubset>>& aSubsetArray, const Shared<const CoordinatesSubset>& aSubsetSPtr
+)
+{
+    Index offset = 0;
+
+    for (const Shared<const CoordinatesSubset>& subsetSPtr : aSubsetArray)
+    {
+        if (*subsetSPtr == *aSubsetSPtr)
+        {
+            return {offset, subsetSPtr->getSize()};
+        }
+
+        offset += subsetSPtr->getSize();
+    }
+
+    throw ostk::core::error::RuntimeError("Coordinates subset [{}] not found.", aSubsetSPtr->getName());
+}
+
+/// @brief Add the coordinates subsets missing from an array of coordinates subsets
+void AddSubsets(
+    Array<Shared<const CoordinatesSubset>>& aSubsetArray, const Array<Shared<const CoordinatesSubset>>& aNewSubsetArray
+)
+{
+    for (const Shared<const CoordinatesSubset>& newSubsetSPtr : aNewSubsetArray)
+    {
+        const bool isFound = std::any_of(
+            aSubsetArray.begin(),
+            aSubsetArray.end(),
+            [&newSubsetSPtr](const Shared<const CoordinatesSubset>& aSubsetSPtr) -> bool
+            {
+                return *aSubsetSPtr == *newSubsetSPtr;
+            }
+        );
+
+        if (!isFound)
+        {
+            aSubsetArray.add(newSubsetSPtr);
+        }
+    }
+}
+
+/// @brief Regime of a fidelity schedule: the sum of the contributions of its dynamics, read from and written to the
+/// coordinates subsets of the schedule
+class Regime : public Dynamics
+{
+   public:
+    Regime(
+        const String& aName,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
+        const Array<Shared<const CoordinatesSubset>>& aReadCoordinatesSubsets,
+        const Array<Shared<const CoordinatesSubset>>& aWriteCoordinatesSubsets
+    )
+        : Dynamics(aName),
+          readCoordinatesSubsets_(aReadCoordinatesSubsets),
+          writeCoordinatesSubsets_(aWriteCoordinatesSubsets),
+          writeSize_(0),
+          contexts_()
+    {
+        for (const Shared<const CoordinatesSubset>& subsetSPtr : writeCoordinatesSubsets_)
+        {
+            writeSize_ += subsetSPtr->getSize();
+        }
+
+        for (const Shared<Dynamics>& dynamicsSPtr : aDynamicsArray)
+        {
+            Array<Pair<Index, Size>> readIndexes = Array<Pair<Index, Size>>::Empty();
+            Array<Pair<Index, Size>> writeIndexes = Array<Pair<Index, Size>>::Empty();
+
+            for (const Shared<const CoordinatesSubset>& subsetSPtr : dynamicsSPtr->getReadCoordinatesSubsets())
+            {
+                readIndexes.add(LocateSubset(readCoordinatesSubsets_, subsetSPtr));
+            }
+
+            for (const Shared<const CoordinatesSubset>& subsetSPtr : dynamicsSPtr->getWriteCoordinatesSubsets())
+            {
+                writeIndexes.add(LocateSubset(writeCoordinatesSubsets_, subsetSPtr));
+            }
+
+            contexts_.add({dynamicsSPtr, readIndexes, writeIndexes});
+        }
+    }
+
+    virtual bool isDefined() const override
+    {
+        return true;
+    }
+
+    virtual Array<Shared<const CoordinatesSubset>> getReadCoordinatesSubsets() const override
+    {
+        return readCoordinatesSubsets_;
+    }
+
+    virtual Array<Shared<const CoordinatesSubset>> getWriteCoordinatesSubsets() const override
+    {
+        return writeCoordinatesSubsets_;
+    }
+
+    virtual VectorXd computeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override
+    {
+        VectorXd contribution = VectorXd::Zero(writeSize_);
+
+        for (const Dynamics::Context& context : contexts_)
+        {
+            Dynamics::applyContribution(
+                contribution,
+                context.dynamics->computeContribution(
+                    anInstant, Dynamics::extractReadState(x, context.readIndexes, context.readStateSize), aFrameSPtr
+                ),
+                context.writeIndexes
+            );
+        }
+
+        return contribution;
+    }
+
+    virtual MatrixXd computeContributionJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override
+    {
+        MatrixXd jacobian = MatrixXd::Zero(writeSize_, x.size());
+
+        for (const Dynamics::Context& context : contexts_)
+        {
+            Dynamics::applyContributionJacobian(
+                jacobian,
+                context.dynamics->computeContributionJacobian(
+                    anInstant, Dynamics::extractReadState(x, context.readIndexes, context.readStateSize), aFrameSPtr
+                ),
+                context.readIndexes,
+                context.writeIndexes
+            );
+        }
+
+        return jacobian;
+    }
+
+   private:
+    const Array<Shared<const CoordinatesSubset>> readCoordinatesSubsets_;
+    const Array<Shared<const CoordinatesSubset>> writeCoordinatesSubsets_;
+    Size writeSize_;
+    Array<Dynamics::Context> contexts_;
+};
+
+}  // namespace
+
+FidelitySchedule::FidelitySchedule(
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Criterion& aCriterion,
+    const Array<Length>& aThresholdArray,
+    const Array<Array<Shared<Dynamics>>>& aDynamicsArrays,
+    const Length& aHysteresis,
+    const String& aName
+)
+    : Dynamics(aName),
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      criterion_(aCriterion),
+      thresholds_(Array<Real>::Empty()),
+      dynamicsArrays_(aDynamicsArrays),
+      hysteresis_(Real::Undefined()),
+      readCoordinatesSubsets_({CartesianPosition::Default()}),
+      writeCoordinatesSubsets_(Array<Shared<const CoordinatesSubset>>::Empty()),
+      regimes_(Array<Shared<Dynamics>>::Empty())
+{
+    if ((celestialObjectSPtr_ == nullptr) || (!celestialObjectSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial");
+    }
+
+    if (!aHysteresis.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Hysteresis");
+    }
+
+    if (dynamicsArrays_.getSize() != (aThresholdArray.getSize() + 1))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Number of regimes [{}] must exceed the number of thresholds [{}] by one.",
+            dynamicsArrays_.getSize(),
+            aThresholdArray.getSize()
+        );
+    }
+
+    for (const Length& threshold : aThresholdArray)
+    {
+        if (!threshold.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Threshold");
+        }
+
+        thresholds_.add(threshold.inMeters());
+    }
+
+    hysteresis_ = aHysteresis.inMeters();
+
+    if (hysteresis_ < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Hysteresis");
+    }
+
+    // The ranges of two regimes, widened by the hysteresis, must not cover the range of the regime between them
+
+    for (Index i = 1; i < thresholds_.getSize(); ++i)
+    {
+        if (thresholds_[i] <= thresholds_[i - 1])
+        {
+            throw ostk::core::error::RuntimeError("Thresholds must be strictly increasing.");
+        }
+
+        if ((2.0 * hysteresis_) >= (thresholds_[i] - thresholds_[i - 1]))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Hysteresis [{}] must be smaller than half the gap between thresholds.", aHysteresis.toString()
+            );
+        }
+    }
+
+    for (const Array<Shared<Dynamics>>& dynamicsArray : dynamicsArrays_)
+    {
+        for (const Shared<Dynamics>& dynamicsSPtr : dynamicsArray)
+        {
+            if ((dynamicsSPtr == nullptr) || (!dynamicsSPtr->isDefined()))
+            {
+                throw ostk::core::error::runtime::Undefined("Dynamics");
+            }
+
+            AddSubsets(readCoordinatesSubsets_, dynamicsSPtr->getReadCoordinatesSubsets());
+            AddSubsets(writeCoordinatesSubsets_, dynamicsSPtr->getWriteCoordinatesSubsets());
+        }
+    }
+
+    // The regimes share the name of the schedule, under which the diagnostics of a propagation report them
+
+    for (const Array<Shared<Dynamics>>& dynamicsArray : dynamicsArrays_)
+    {
+        regimes_.add(
+            std::make_shared<Regime>(aName, dynamicsArray, readCoordinatesSubsets_, writeCoordinatesSubsets_)
+        );
+    }
+}
+
+FidelitySchedule::~FidelitySchedule() {}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const FidelitySchedule& aFidelitySchedule)
+{
+    aFidelitySchedule.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool FidelitySchedule::isDefined() const
+{
+    return (celestialObjectSPtr_ != nullptr) && celestialObjectSPtr_->isDefined() && hysteresis_.isDefined();
+}
+
+Shared<const Celestial> FidelitySchedule::getCelestial() const
+{
+    return celestialObjectSPtr_;
+}
+
+FidelitySchedule::Criterion FidelitySchedule::getCriterion() const
+{
+    return criterion_;
+}
+
+Array<Length> FidelitySchedule::getThresholds() const
+{
+    Array<Length> thresholds = Array<Length>::Empty();
+    thresholds.reserve(thresholds_.getSize());
+
+    for (const Real& threshold : thresholds_)
+    {
+        thresholds.add(Length::Meters(threshold));
+    }
+
+    return thresholds;
+}
+
+Length FidelitySchedule::getHysteresis() const
+{
+    return Length::Meters(hysteresis_);
+}
+
+Size FidelitySchedule::getRegimeCount() const
+{
+    return regimes_.getSize();
+}
+
+Array<Shared<Dynamics>> FidelitySchedule::getRegimeDynamics(const Index& anIndex) const
+{
+    if (anIndex >= dynamicsArrays_.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Regime index");
+    }
+
+    return dynamicsArrays_[anIndex];
+}
+
+const Shared<Dynamics>& FidelitySchedule::accessRegime(const Index& anIndex) const
+{
+    if (anIndex >= regimes_.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Regime index");
+    }
+
+    return regimes_[anIndex];
+}
+
+Real FidelitySchedule::calculateCriterionValue(
+    const Instant& anInstant, const Vector3d& aPositionCoordinates, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const Vector3d celestialObjectPositionCoordinates =
+        celestialObjectSPtr_->getPositionIn(aFrameSPtr, anInstant).inUnit(Position::Unit::Meter).accessCoordinates();
+
+    const Real distance = (aPositionCoordinates - celestialObjectPositionCoordinates).norm();
+
+    switch (criterion_)
+    {
+        case FidelitySchedule::Criterion::Altitude:
+            return distance - celestialObjectSPtr_->getEquatorialRadius().inMeters();
+
+        case FidelitySchedule::Criterion::Distance:
+            return distance;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Criterion");
+    }
+}
+
+Index FidelitySchedule::calculateRegimeIndex(const Real& aCriterionValue) const
+{
+    return std::upper_bound(thresholds_.begin(), thresholds_.end(), aCriterionValue) - thresholds_.begin();
+}
+
+bool FidelitySchedule::isInRegime(const Real& aCriterionValue, const Index& anIndex) const
+{
+    if (anIndex >= regimes_.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Regime index");
+    }
+
+    if ((anIndex > 0) && (aCriterionValue < (thresholds_[anIndex - 1] - hysteresis_)))
+    {
+        return false;
+    }
+
+    if ((anIndex < thresholds_.getSize()) && (aCriterionValue >= (thresholds_[anIndex] + hysteresis_)))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+Array<Shared<const CoordinatesSubset>> FidelitySchedule::getReadCoordinatesSubsets() const
+{
+    return readCoordinatesSubsets_;
+}
+
+Array<Shared<const CoordinatesSubset>> FidelitySchedule::getWriteCoordinatesSubsets() const
+{
+    return writeCoordinatesSubsets_;
+}
+
+VectorXd FidelitySchedule::computeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+
+    const Index regimeIndex =
+        this->calculateRegimeIndex(this->calculateCriterionValue(anInstant, positionCoordinates, aFrameSPtr));
+
+    return regimes_[regimeIndex]->computeContribution(anInstant, x, aFrameSPtr);
+}
+
+MatrixXd FidelitySchedule::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+
+    const Index regimeIndex =
+        this->calculateRegimeIndex(this->calculateCriterionValue(anInstant, positionCoordinates, aFrameSPtr));
+
+    return regimes_[regimeIndex]->computeContributionJacobian(anInstant, x, aFrameSPtr);
+}
+
+void FidelitySchedule::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Fidelity Schedule Dynamics") : void();
+
+    Dynamics::print(anOutputStream, false);
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Criterion:" << FidelitySchedule::StringFromCriterion(criterion_);
+
+    for (Index i = 0; i < dynamicsArrays_.getSize(); ++i)
+    {
+        const String lowerBound = (i > 0) ? Length::Meters(thresholds_[i - 1]).toString() : "-";
+        const String upperBound = (i < thresholds_.getSize()) ? Length::Meters(thresholds_[i]).toString() : "-";
+
+        String dynamicsNames = String::Empty();
+
+        for (const Shared<Dynamics>& dynamicsSPtr : dynamicsArrays_[i])
+        {
+            dynamicsNames += (dynamicsNames.isEmpty() ? "" : ", ") + dynamicsSPtr->getName();
+        }
+
+        ostk::core::utils::Print::Line(anOutputStream)
+            << String::Format("Regime [{}, {}[:", lowerBound, upperBound) << dynamicsNames;
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Hysteresis:" << Length::Meters(hysteresis_).toString();
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+String FidelitySchedule::StringFromCriterion(const Criterion& aCriterion)
+{
+    switch (aCriterion)
+    {
+        case FidelitySchedule::Criterion::Altitude:
+            return "Altitude";
+
+        case FidelitySchedule::Criterion::Distance:
+            return "Distance";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Criterion");
+    }
+
+    return String::Empty();
+}
+
+}  // namespace dynamics
+}  // namespace astro
+}  // namespace ostk
@@ -62,6 +62,15 @@ VectorXd PositionDerivative::computeContribution(
     return contribution;
 }
 
+MatrixXd PositionDerivative::computeContributionJacobian(
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+) const
+{
+    return MatrixXd::Identity(3, 3);
+}
+
 void PositionDerivative::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Position Derivative Dynamics") : void();
@@ -14,6 +14,8 @@ namespace astro
 namespace dynamics
 {
 
+using ostk::core::types::Index;
+using ostk::core::types::Real;
 using ostk::core::types::String;
 
 using ostk::math::object::Vector3d;
@@ -37,7 +39,11 @@ ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObje
 
 ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr, const String& aName)
     : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      ephemerisInterval_(Interval::Undefined()),
+      ephemerisSegmentDurationSI_(0.0),
+      ephemerisCoefficients_(Array<MatrixXd>::Empty()),
+      gravitationalParameterSI_(0.0)
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->gravitationalModelIsDefined())
     {
@@ -93,6 +99,27 @@ VectorXd ThirdBodyGravity::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
+    if (this->hasPrecomputedEphemeris() && ephemerisInterval_.contains(anInstant) &&
+        ((*aFrameSPtr) == (*Frame::GCRF())))
+    {
+        // Point mass acceleration of the spacecraft minus the one of the origin of the GCRF (indirect term)
+        const Vector3d thirdBodyPositionCoordinates = this->evaluatePrecomputedPositionAt(anInstant);
+        const Vector3d relativePositionCoordinates = thirdBodyPositionCoordinates - Vector3d(x[0], x[1], x[2]);
+
+        const double relativeDistance = relativePositionCoordinates.norm();
+        const double thirdBodyDistance = thirdBodyPositionCoordinates.norm();
+
+        const Vector3d gravitationalAccelerationSI =
+            gravitationalParameterSI_ *
+            (relativePositionCoordinates / (relativeDistance * relativeDistance * relativeDistance) -
+             thirdBodyPositionCoordinates / (thirdBodyDistance * thirdBodyDistance * thirdBodyDistance));
+
+        VectorXd contribution(3);
+        contribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
+
+        return contribution;
+    }
+
     // Obtain 3rd body effect on center of Central Body (origin in GCRF) aka 3rd body correction
     // TBI: This fails for the earth as we cannot calculate the acceleration at the origin of the GCRF
     Vector3d gravitationalAccelerationSI =
@@ -114,6 +141,97 @@ VectorXd ThirdBodyGravity::computeContribution(
     return contribution;
 }
 
+void ThirdBodyGravity::precomputeEphemeris(
+    const Interval& anInterval, const Duration& aSegmentDuration, const Size& aDegree
+)
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aSegmentDuration.isDefined() || !aSegmentDuration.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Segment duration");
+    }
+
+    if (aDegree < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Degree");
+    }
+
+    const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    const double pi = Real::Pi();
+
+    const Instant& startInstant = anInterval.accessStart();
+    const double intervalDurationSI = (anInterval.accessEnd() - startInstant).inSeconds();
+    const double segmentDurationSI = aSegmentDuration.inSeconds();
+
+    const Size segmentCount = std::max<Size>(1, Size(std::ceil(intervalDurationSI / segmentDurationSI)));
+    const Size nodeCount = aDegree + 1;
+
+    Array<MatrixXd> coefficientsArray = Array<MatrixXd>::Empty();
+    coefficientsArray.reserve(segmentCount);
+
+    for (Index segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex)
+    {
+        const double segmentMidTimeSI = (segmentIndex + 0.5) * segmentDurationSI;
+
+        // Sample the ephemeris at the Chebyshev nodes of the segment
+        MatrixXd samples = MatrixXd::Zero(3, nodeCount);
+
+        for (Index nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            const double nodeAbscissa = std::cos(pi * (nodeIndex + 0.5) / nodeCount);
+
+            const Instant nodeInstant =
+                startInstant + Duration::Seconds(segmentMidTimeSI + 0.5 * segmentDurationSI * nodeAbscissa);
+
+            samples.col(nodeIndex) = celestialObjectSPtr_->getPositionIn(gcrfSPtr, nodeInstant)
+                                         .inUnit(Position::Unit::Meter)
+                                         .accessCoordinates();
+        }
+
+        // Discrete Chebyshev transform
+        MatrixXd coefficients = MatrixXd::Zero(3, nodeCount);
+
+        for (Index order = 0; order < nodeCount; ++order)
+        {
+            for (Index nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+            {
+                coefficients.col(order) +=
+                    samples.col(nodeIndex) * std::cos(pi * order * (nodeIndex + 0.5) / nodeCount);
+            }
+
+            coefficients.col(order) *= 2.0 / nodeCount;
+        }
+
+        coefficientsArray.add(coefficients);
+    }
+
+    ephemerisInterval_ = anInterval;
+    ephemerisSegmentDurationSI_ = segmentDurationSI;
+    ephemerisCoefficients_ = coefficientsArray;
+    gravitationalParameterSI_ = celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit);
+}
+
+bool ThirdBodyGravity::hasPrecomputedEphemeris() const
+{
+    return !ephemerisCoefficients_.isEmpty();
+}
+
+Interval ThirdBodyGravity::getPrecomputedEphemerisInterval() const
+{
+    return ephemerisInterval_;
+}
+
+void ThirdBodyGravity::clearPrecomputedEphemeris()
+{
+    ephemerisInterval_ = Interval::Undefined();
+    ephemerisSegmentDurationSI_ = 0.0;
+    ephemerisCoefficients_.clear();
+}
+
 void ThirdBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Third Body Gravitational Dynamics") : void();
@@ -125,6 +243,34 @@ void ThirdBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Vector3d ThirdBodyGravity::evaluatePrecomputedPositionAt(const Instant& anInstant) const
+{
+    const double elapsedTimeSI = (anInstant - ephemerisInterval_.accessStart()).inSeconds();
+
+    const Index segmentIndex = std::min<Index>(
+        Index(std::max(0.0, std::floor(elapsedTimeSI / ephemerisSegmentDurationSI_))),
+        ephemerisCoefficients_.getSize() - 1
+    );
+
+    const MatrixXd& coefficients = ephemerisCoefficients_[segmentIndex];
+
+    // Map the instant onto [-1, 1] within the segment
+    const double abscissa = 2.0 * (elapsedTimeSI / ephemerisSegmentDurationSI_ - segmentIndex) - 1.0;
+
+    // Clenshaw recurrence
+    Vector3d b1 = Vector3d::Zero();
+    Vector3d b2 = Vector3d::Zero();
+
+    for (Index order = coefficients.cols() - 1; order > 0; --order)
+    {
+        const Vector3d b0 = 2.0 * abscissa * b1 - b2 + coefficients.col(order);
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return abscissa * b1 - b2 + 0.5 * coefficients.col(0);
+}
+
 }  // namespace dynamics
 }  // namespace astro
 }  // namespace ostk
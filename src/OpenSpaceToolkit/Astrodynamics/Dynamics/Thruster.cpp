@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <cmath>
+#include <cstdint>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
@@ -28,12 +31,99 @@ using ostk::astro::trajectory::state::CoordinatesSubset;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
 
+namespace
+{
+
+/// @brief Thrust direction and throttle held by a thruster over the accepted steps of an integration
+struct ThrustHold : public Dynamics::Hold
+{
+    bool isLatched = false;
+    std::int64_t windowIndex = 0;
+    Vector3d direction = Vector3d::Zero();
+    double thrustFraction = 0.0;
+};
+
+}  // namespace
+
+Thruster::GuidanceUpdatePolicy::GuidanceUpdatePolicy(
+    const Thruster::GuidanceUpdatePolicy::Type& aType, const Duration& anInterval
+)
+    : type_(aType),
+      interval_(anInterval)
+{
+    if ((type_ == Thruster::GuidanceUpdatePolicy::Type::FixedCadence) &&
+        ((!interval_.isDefined()) || (interval_ <= Duration::Zero())))
+    {
+        throw ostk::core::error::runtime::Wrong("Interval");
+    }
+}
+
+bool Thruster::GuidanceUpdatePolicy::operator==(const Thruster::GuidanceUpdatePolicy& aGuidanceUpdatePolicy) const
+{
+    if (type_ != aGuidanceUpdatePolicy.type_)
+    {
+        return false;
+    }
+
+    return (type_ != Thruster::GuidanceUpdatePolicy::Type::FixedCadence) ||
+           (interval_ == aGuidanceUpdatePolicy.interval_);
+}
+
+Thruster::GuidanceUpdatePolicy::Type Thruster::GuidanceUpdatePolicy::getType() const
+{
+    return type_;
+}
+
+Duration Thruster::GuidanceUpdatePolicy::getInterval() const
+{
+    return interval_;
+}
+
+Thruster::GuidanceUpdatePolicy Thruster::GuidanceUpdatePolicy::Continuous()
+{
+    return {Thruster::GuidanceUpdatePolicy::Type::Continuous, Duration::Undefined()};
+}
+
+Thruster::GuidanceUpdatePolicy Thruster::GuidanceUpdatePolicy::StepStart()
+{
+    return {Thruster::GuidanceUpdatePolicy::Type::StepStart, Duration::Undefined()};
+}
+
+Thruster::GuidanceUpdatePolicy Thruster::GuidanceUpdatePolicy::FixedCadence(const Duration& anInterval)
+{
+    return {Thruster::GuidanceUpdatePolicy::Type::FixedCadence, anInterval};
+}
+
+String Thruster::GuidanceUpdatePolicy::StringFromType(const Thruster::GuidanceUpdatePolicy::Type& aType)
+{
+    switch (aType)
+    {
+        case Thruster::GuidanceUpdatePolicy::Type::Continuous:
+            return "Continuous";
+
+        case Thruster::GuidanceUpdatePolicy::Type::StepStart:
+            return "StepStart";
+
+        case Thruster::GuidanceUpdatePolicy::Type::FixedCadence:
+            return "FixedCadence";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+
+    return String::Empty();
+}
+
 Thruster::Thruster(
-    const SatelliteSystem& aSatelliteSystem, const Shared<const GuidanceLaw>& aGuidanceLaw, const String& aName
+    const SatelliteSystem& aSatelliteSystem,
+    const Shared<const GuidanceLaw>& aGuidanceLaw,
+    const String& aName,
+    const GuidanceUpdatePolicy& aGuidanceUpdatePolicy
 )
     : Dynamics(aName),
       satelliteSystem_(aSatelliteSystem),
       guidanceLaw_(aGuidanceLaw),
+      guidanceUpdatePolicy_(aGuidanceUpdatePolicy),
       massFlowRateCache_(
           aSatelliteSystem.isDefined() ? aSatelliteSystem.accessPropulsionSystem().getMassFlowRate().getValue()
                                        : Real::Undefined()
@@ -58,6 +148,11 @@ Shared<const GuidanceLaw> Thruster::getGuidanceLaw() const
     return guidanceLaw_;
 }
 
+Thruster::GuidanceUpdatePolicy Thruster::getGuidanceUpdatePolicy() const
+{
+    return guidanceUpdatePolicy_;
+}
+
 Array<Shared<const CoordinatesSubset>> Thruster::getReadCoordinatesSubsets() const
 {
     return {
@@ -87,25 +182,134 @@ VectorXd Thruster::computeContribution(
     const Vector3d positionCoordinates = {x[0], x[1], x[2]};
     const Vector3d velocityCoordinates = {x[3], x[4], x[5]};
 
-    if (x[6] <= satelliteSystem_.getMass().inKilograms())  // We compare against the dry mass of the Satellite
+    const double maximumThrustAccelerationMagnitude = this->calculateMaximumThrustAccelerationMagnitude(x[6]);
+
+    const Vector3d acceleration = guidanceLaw_->calculateThrustAccelerationAt(
+        anInstant, positionCoordinates, velocityCoordinates, maximumThrustAccelerationMagnitude, aFrameSPtr
+    );
+
+    return this->assembleContribution(acceleration, acceleration.norm() / maximumThrustAccelerationMagnitude);
+}
+
+Shared<Dynamics::Hold> Thruster::createHold() const
+{
+    if (guidanceUpdatePolicy_.getType() == GuidanceUpdatePolicy::Type::Continuous)
     {
-        throw ostk::core::error::RuntimeError("Out of fuel.");
+        return nullptr;
     }
 
-    const Real maximumThrustAccelerationMagnitude =
-        satelliteSystem_.accessPropulsionSystem().getAcceleration(Mass::Kilograms(x[6])).getValue();
+    return std::make_shared<ThrustHold>();
+}
+
+bool Thruster::updateHold(
+    Dynamics::Hold& aHold,
+    const Instant& anInstant,
+    const VectorXd& x,
+    const Shared<const Frame>& aFrameSPtr,
+    const bool& isIntegrationStart
+) const
+{
+    ThrustHold& thrustHold = static_cast<ThrustHold&>(aHold);
+
+    std::int64_t windowIndex = 0;
+
+    if (guidanceUpdatePolicy_.getType() == GuidanceUpdatePolicy::Type::FixedCadence)
+    {
+        windowIndex = std::int64_t(std::floor(
+            (anInstant - Instant::J2000()).inSeconds() / guidanceUpdatePolicy_.getInterval().inSeconds()
+        ));
+
+        // Hold the thrust until the first accepted step of the next window
+
+        if ((!isIntegrationStart) && thrustHold.isLatched && (windowIndex == thrustHold.windowIndex))
+        {
+            return false;
+        }
+    }
+
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+    const Vector3d velocityCoordinates = {x[3], x[4], x[5]};
+
+    const double maximumThrustAccelerationMagnitude = this->calculateMaximumThrustAccelerationMagnitude(x[6]);
 
     const Vector3d acceleration = guidanceLaw_->calculateThrustAccelerationAt(
         anInstant, positionCoordinates, velocityCoordinates, maximumThrustAccelerationMagnitude, aFrameSPtr
     );
 
-    const Real effectiveThrustFraction = acceleration.norm() / maximumThrustAccelerationMagnitude;
+    const double accelerationMagnitude = acceleration.norm();
 
-    // Compute contribution
-    VectorXd contribution(4);
-    contribution << acceleration[0], acceleration[1], acceleration[2], -effectiveThrustFraction * massFlowRateCache_;
+    thrustHold.isLatched = true;
+    thrustHold.windowIndex = windowIndex;
+    thrustHold.direction = (accelerationMagnitude > 0.0) ? Vector3d(acceleration / accelerationMagnitude)
+                                                         : Vector3d(Vector3d::Zero());
+    thrustHold.thrustFraction = accelerationMagnitude / maximumThrustAccelerationMagnitude;
 
-    return contribution;
+    return true;
+}
+
+VectorXd Thruster::computeHeldContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, const Dynamics::Hold& aHold
+) const
+{
+    const ThrustHold& thrustHold = static_cast<const ThrustHold&>(aHold);
+
+    if (!thrustHold.isLatched)
+    {
+        return this->computeContribution(anInstant, x, aFrameSPtr);
+    }
+
+    // The held throttle scales the current maximum thrust acceleration, which grows as propellant is consumed
+
+    const double maximumThrustAccelerationMagnitude = this->calculateMaximumThrustAccelerationMagnitude(x[6]);
+
+    const Vector3d acceleration =
+        thrustHold.thrustFraction * maximumThrustAccelerationMagnitude * thrustHold.direction;
+
+    return this->assembleContribution(acceleration, thrustHold.thrustFraction);
+}
+
+MatrixXd Thruster::computeContributionJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+    const Vector3d velocityCoordinates = {x[3], x[4], x[5]};
+    const double mass = x[6];
+
+    const double maximumThrustAccelerationMagnitude = this->calculateMaximumThrustAccelerationMagnitude(mass);
+
+    // The maximum thrust acceleration is the thrust divided by the mass
+    const double maximumThrustAccelerationMagnitude_dMass = -maximumThrustAccelerationMagnitude / mass;
+
+    const Vector3d acceleration = guidanceLaw_->calculateThrustAccelerationAt(
+        anInstant, positionCoordinates, velocityCoordinates, maximumThrustAccelerationMagnitude, aFrameSPtr
+    );
+
+    const MatrixXd guidanceJacobian = guidanceLaw_->calculateThrustAccelerationJacobianAt(
+        anInstant, positionCoordinates, velocityCoordinates, maximumThrustAccelerationMagnitude, aFrameSPtr
+    );
+
+    MatrixXd jacobian = MatrixXd::Zero(4, 7);
+
+    // Acceleration
+
+    jacobian.block(0, 0, 3, 6) = guidanceJacobian.leftCols(6);
+    jacobian.block(0, 6, 3, 1) = guidanceJacobian.col(6) * maximumThrustAccelerationMagnitude_dMass;
+
+    // Mass flow rate, proportional to the effective thrust fraction
+
+    const double massFlowRate = massFlowRateCache_;
+    const double accelerationMagnitude = acceleration.norm();
+
+    if (accelerationMagnitude > 0.0)
+    {
+        jacobian.row(3) = -(massFlowRate / maximumThrustAccelerationMagnitude) *
+                          (acceleration.transpose() / accelerationMagnitude) * jacobian.topRows(3);
+        jacobian(3, 6) += massFlowRate * accelerationMagnitude * maximumThrustAccelerationMagnitude_dMass /
+                          (maximumThrustAccelerationMagnitude * maximumThrustAccelerationMagnitude);
+    }
+
+    return jacobian;
 }
 
 void Thruster::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -113,12 +317,39 @@ void Thruster::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Thruster") : void();
 
     ostk::core::utils::Print::Line(anOutputStream) << "Name:" << name_;
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Guidance update policy:" << GuidanceUpdatePolicy::StringFromType(guidanceUpdatePolicy_.getType());
+
+    if (guidanceUpdatePolicy_.getType() == GuidanceUpdatePolicy::Type::FixedCadence)
+    {
+        ostk::core::utils::Print::Line(anOutputStream)
+            << "Guidance update interval:" << guidanceUpdatePolicy_.getInterval().toString();
+    }
+
     satelliteSystem_.print(anOutputStream, false);
     guidanceLaw_->print(anOutputStream, false);
 
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+double Thruster::calculateMaximumThrustAccelerationMagnitude(const double& aMass) const
+{
+    if (aMass <= satelliteSystem_.getMass().inKilograms())  // We compare against the dry mass of the Satellite
+    {
+        throw ostk::core::error::RuntimeError("Out of fuel.");
+    }
+
+    return satelliteSystem_.accessPropulsionSystem().getAcceleration(Mass::Kilograms(aMass)).getValue();
+}
+
+VectorXd Thruster::assembleContribution(const Vector3d& anAcceleration, const double& aThrustFraction) const
+{
+    VectorXd contribution(4);
+    contribution << anAcceleration[0], anAcceleration[1], anAcceleration[2], -aThrustFraction * massFlowRateCache_;
+
+    return contribution;
+}
+
 }  // namespace dynamics
 }  // namespace astro
 }  // namespace ostk
@@ -1,4 +1,5 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw.hpp>
@@ -8,6 +9,8 @@ namespace ostk
 namespace astro
 {
 
+using ostk::core::types::Index;
+
 GuidanceLaw::GuidanceLaw(const String& aName)
     : name_(aName)
 {
@@ -35,5 +38,44 @@ void GuidanceLaw::print(std::ostream& anOutputStream, bool displayDecorator) con
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+MatrixXd GuidanceLaw::calculateThrustAccelerationJacobianAt(
+    const Instant& anInstant,
+    const Vector3d& aPositionCoordinates,
+    const Vector3d& aVelocityCoordinates,
+    const Real& aThrustAcceleration,
+    const Shared<const Frame>& outputFrameSPtr
+) const
+{
+    using ostk::math::object::VectorXd;
+
+    VectorXd x(7);
+    x << aPositionCoordinates, aVelocityCoordinates, aThrustAcceleration;
+
+    MatrixXd jacobian(3, 7);
+
+    VectorXd perturbedX = x;
+
+    for (Index i = 0; i < 7; ++i)
+    {
+        const double step = 1e-6 * std::max(1.0, std::abs(x(i)));
+
+        perturbedX(i) = x(i) + step;
+        const Vector3d forwardAcceleration = this->calculateThrustAccelerationAt(
+            anInstant, perturbedX.head<3>(), perturbedX.segment<3>(3), perturbedX(6), outputFrameSPtr
+        );
+
+        perturbedX(i) = x(i) - step;
+        const Vector3d backwardAcceleration = this->calculateThrustAccelerationAt(
+            anInstant, perturbedX.head<3>(), perturbedX.segment<3>(3), perturbedX(6), outputFrameSPtr
+        );
+
+        perturbedX(i) = x(i);
+
+        jacobian.col(i) = (forwardAcceleration - backwardAcceleration) / (2.0 * step);
+    }
+
+    return jacobian;
+}
+
 }  // namespace astro
 }  // namespace ostk
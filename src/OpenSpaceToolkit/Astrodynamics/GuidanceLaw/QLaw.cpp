@@ -1,8 +1,13 @@
 /// Apache License 2.0
 
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <OpenSpaceToolkit/Physics/Units/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dual.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
@@ -22,10 +27,190 @@ using ostk::math::object::VectorXd;
 using ostk::physics::coord::Position;
 using ostk::physics::coord::Velocity;
 using ostk::physics::coord::Frame;
+using ostk::physics::units::Time;
 
 using ostk::astro::trajectory::State;
 using ostk::astro::trajectory::state::CoordinatesSubset;
 
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+double ValueOf(const double& aValue)
+{
+    return aValue;
+}
+
+double ValueOf(const dual::Scalar& aValue)
+{
+    return aValue.value();
+}
+
+double Sign(const double& aValue)
+{
+    return static_cast<double>((aValue > 0.0) - (aValue < 0.0));
+}
+
+double Cbrt(const double& aValue)
+{
+    return std::cbrt(aValue);
+}
+
+dual::Scalar Cbrt(const dual::Scalar& aValue)
+{
+    const double value = std::cbrt(aValue.value());
+
+    return {value, aValue.derivatives() / (3.0 * value * value)};
+}
+
+/// @brief Angular distance acos(cos(x)), in [0, pi], its derivative being the sign of sin(x)
+double AngularDistance(const double& anAngle)
+{
+    return std::acos(std::cos(anAngle));
+}
+
+dual::Scalar AngularDistance(const dual::Scalar& anAngle)
+{
+    return {AngularDistance(anAngle.value()), Sign(std::sin(anAngle.value())) * anAngle.derivatives()};
+}
+
+template <typename Scalar>
+Eigen::Matrix<Scalar, 5, 3> ComputeOrbitalElementsDerivatives(
+    const Eigen::Matrix<Scalar, 6, 1>& aCOEVector, const double& aGravitationalParameter
+)
+{
+    using std::cos;
+    using std::sin;
+    using std::sqrt;
+
+    const Scalar& semiMajorAxis = aCOEVector[0];
+    const Scalar& eccentricity = aCOEVector[1];
+    const Scalar& inclination = aCOEVector[2];
+    const Scalar& argumentOfPeriapsis = aCOEVector[4];
+    const Scalar& trueAnomaly = aCOEVector[5];
+
+    const Scalar semiLatusRectum = semiMajorAxis * (1.0 - (eccentricity * eccentricity));
+    const Scalar angularMomentum = sqrt(aGravitationalParameter * semiLatusRectum);
+    const Scalar radialDistance = semiLatusRectum / (1.0 + eccentricity * cos(trueAnomaly));
+
+    // columns: Orbital elements
+    // rows: theta, radial, angular momentum directions
+    Eigen::Matrix<Scalar, 5, 3> derivativeMatrix = Eigen::Matrix<Scalar, 5, 3>::Zero();
+
+    // Common grouped operations
+    const Scalar trueAnomaly_sin = sin(trueAnomaly);
+    const Scalar trueAnomaly_cos = cos(trueAnomaly);
+    const Scalar trueAnomaly_ArgumentOfPeriapsis_sin = sin(trueAnomaly + argumentOfPeriapsis);
+    const Scalar trueAnomaly_ArgumentOfPeriapsis_cos = cos(trueAnomaly + argumentOfPeriapsis);
+
+    // Semi-major axis
+    const Scalar sma_alpha = (2.0 * semiMajorAxis * semiMajorAxis / angularMomentum);
+    derivativeMatrix(0, 0) = sma_alpha * semiLatusRectum / radialDistance;
+    derivativeMatrix(0, 1) = sma_alpha * eccentricity * trueAnomaly_sin;
+
+    // Eccentricity
+    derivativeMatrix(1, 0) =
+        (((semiLatusRectum + radialDistance) * trueAnomaly_cos) + (radialDistance * eccentricity)) / angularMomentum;
+    derivativeMatrix(1, 1) = (semiLatusRectum * trueAnomaly_sin / angularMomentum);
+
+    // Inclination
+    derivativeMatrix(2, 2) = (radialDistance * trueAnomaly_ArgumentOfPeriapsis_cos / angularMomentum);
+
+    // Right Ascension of the Ascending Node
+    derivativeMatrix(3, 2) =
+        (radialDistance * trueAnomaly_ArgumentOfPeriapsis_sin) / (angularMomentum * sin(inclination));
+
+    // Argument of Periapsis
+    const Scalar aop_alpha = 1.0 / (eccentricity * angularMomentum);
+    derivativeMatrix(4, 0) = (semiLatusRectum + radialDistance) * trueAnomaly_sin * aop_alpha;
+    derivativeMatrix(4, 1) = -semiLatusRectum * trueAnomaly_cos * aop_alpha;
+    derivativeMatrix(4, 2) = (-radialDistance * trueAnomaly_ArgumentOfPeriapsis_sin * cos(inclination)) /
+                             (angularMomentum * sin(inclination));
+
+    return derivativeMatrix;
+}
+
+template <typename Scalar>
+Eigen::Matrix<Scalar, 3, 3> ComputeThetaRHToGCRF(
+    const Eigen::Matrix<Scalar, 3, 1>& aPositionCoordinates, const Eigen::Matrix<Scalar, 3, 1>& aVelocityCoordinates
+)
+{
+    using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+
+    const Vector3 R = aPositionCoordinates.normalized();
+    const Vector3 H = (aPositionCoordinates.cross(aVelocityCoordinates)).normalized();
+    const Vector3 theta = H.cross(R);
+
+    Eigen::Matrix<Scalar, 3, 3> rotationMatrix;
+    rotationMatrix.col(0) = theta;
+    rotationMatrix.col(1) = R;
+    rotationMatrix.col(2) = H;
+
+    return rotationMatrix;
+}
+
+/// @brief Convert Cartesian coordinates to classical orbital elements (with the true anomaly), for a non-circular and
+/// inclined orbit, following COE::Cartesian
+Eigen::Matrix<dual::Scalar, 6, 1> ComputeCOEVector(
+    const dual::Vector3& aPositionCoordinates,
+    const dual::Vector3& aVelocityCoordinates,
+    const double& aGravitationalParameter
+)
+{
+    using std::acos;
+    using std::sqrt;
+
+    const double& mu = aGravitationalParameter;
+
+    const dual::Scalar position = sqrt(aPositionCoordinates.squaredNorm());
+    const dual::Scalar velocitySquared = aVelocityCoordinates.squaredNorm();
+    const dual::Scalar radialVelocity = aPositionCoordinates.dot(aVelocityCoordinates);
+
+    const dual::Vector3 angularMomentumVector = aPositionCoordinates.cross(aVelocityCoordinates);
+    const dual::Scalar angularMomentum = sqrt(angularMomentumVector.squaredNorm());
+
+    const dual::Vector3 nodeVector = {-angularMomentumVector(1), angularMomentumVector(0), dual::Scalar(0.0)};
+    const dual::Scalar node = sqrt(nodeVector.squaredNorm());
+
+    const dual::Vector3 eccentricityVector =
+        (((velocitySquared - (mu / position)) * aPositionCoordinates) - (radialVelocity * aVelocityCoordinates)) / mu;
+    const dual::Scalar eccentricity = sqrt(eccentricityVector.squaredNorm());
+
+    const dual::Scalar semiMajorAxis = -mu / (2.0 * ((0.5 * velocitySquared) - (mu / position)));
+
+    const dual::Scalar inclination = acos(angularMomentumVector(2) / angularMomentum);
+
+    dual::Scalar raan = acos(nodeVector(0) / node);
+
+    if (nodeVector(1) < 0.0)
+    {
+        raan = 2.0 * M_PI - raan;
+    }
+
+    dual::Scalar aop = acos(nodeVector.dot(eccentricityVector) / (node * eccentricity));
+
+    if (eccentricityVector(2) < 0.0)
+    {
+        aop = 2.0 * M_PI - aop;
+    }
+
+    dual::Scalar trueAnomaly = acos(eccentricityVector.dot(aPositionCoordinates) / (eccentricity * position));
+
+    if (radialVelocity < 0.0)
+    {
+        trueAnomaly = 2.0 * M_PI - trueAnomaly;
+    }
+
+    Eigen::Matrix<dual::Scalar, 6, 1> coeVector;
+    coeVector << semiMajorAxis, eccentricity, inclination, raan, aop, trueAnomaly;
+
+    return coeVector;
+}
+
+}  // namespace
+
 QLaw::Parameters::Parameters(
     const Map<COE::Element, Tuple<double, double>>& anElementWeightsMap,
     const Size& aMValue,
@@ -96,6 +281,11 @@ Vector5d QLaw::Parameters::getControlWeights() const
     return controlWeights_;
 }
 
+Vector5d QLaw::Parameters::getConvergenceThresholds() const
+{
+    return convergenceThresholds_;
+}
+
 Length QLaw::Parameters::getMinimumPeriapsisRadius() const
 {
     return Length::Meters(minimumPeriapsisRadius_);
@@ -176,6 +366,66 @@ Vector3d QLaw::calculateThrustAccelerationAt(
     return aThrustAcceleration * R_thetaRH_GCRF * thrustDirection;
 }
 
+MatrixXd QLaw::calculateThrustAccelerationJacobianAt(
+    const Instant& anInstant,
+    const Vector3d& aPositionCoordinates,
+    const Vector3d& aVelocityCoordinates,
+    const Real& aThrustAcceleration,
+    const Shared<const Frame>& outputFrameSPtr
+) const
+{
+    VectorXd cartesianCoordinates(6);
+    cartesianCoordinates << aPositionCoordinates, aVelocityCoordinates;
+
+    const dual::VectorX variables = dual::Seed(cartesianCoordinates);
+
+    const dual::Vector3 positionCoordinates = variables.segment(0, 3);
+    const dual::Vector3 velocityCoordinates = variables.segment(3, 3);
+
+    const Eigen::Matrix<dual::Scalar, 6, 1> coeVector =
+        ComputeCOEVector(positionCoordinates, velocityCoordinates, mu_);
+
+    if ((coeVector[1].value() < 1e-4) || (coeVector[2].value() < 1e-4) || (coeVector[2].value() > (M_PI - 1e-4)))
+    {
+        return GuidanceLaw::calculateThrustAccelerationJacobianAt(
+            anInstant, aPositionCoordinates, aVelocityCoordinates, aThrustAcceleration, outputFrameSPtr
+        );
+    }
+
+    MatrixXd jacobian = MatrixXd::Zero(3, 7);
+
+    // The thrust direction is evaluated first, as the convergence and effectivity thresholds switch the thrust off
+
+    const Vector3d thrustDirection = computeThrustDirection(dual::Value(coeVector), aThrustAcceleration);
+
+    if (thrustDirection.isZero())
+    {
+        return jacobian;
+    }
+
+    const Matrix3d R_thetaRH_GCRF = QLaw::ThetaRHToGCRF(aPositionCoordinates, aVelocityCoordinates);
+
+    // The maximal changes of the orbital elements are proportional to the thrust acceleration, so that the thrust
+    // direction does not depend on it
+    jacobian.col(6) = R_thetaRH_GCRF * thrustDirection;
+
+    const Eigen::Matrix<dual::Scalar, 5, 1> dQ_dOE = std::get<1>(
+        computeProximityQuotient<dual::Scalar>(coeVector.segment(0, 5), aThrustAcceleration, true)
+    );
+
+    const Eigen::Matrix<dual::Scalar, 5, 3> derivativeMatrix = ComputeOrbitalElementsDerivatives(coeVector, mu_);
+
+    const dual::Vector3 dualThrustDirection = -(derivativeMatrix.transpose() * dQ_dOE).normalized();
+
+    const dual::Vector3 acceleration =
+        double(aThrustAcceleration) * (ComputeThetaRHToGCRF(positionCoordinates, velocityCoordinates) *
+                                       dualThrustDirection);
+
+    jacobian.leftCols(6) = dual::Jacobian(acceleration, 6);
+
+    return jacobian;
+}
+
 Vector5d QLaw::compute_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
 {
     if (gradientStrategy_ == GradientStrategy::Analytical)
@@ -237,60 +487,117 @@ Vector3d QLaw::computeThrustDirection(const Vector6d& aCOEVector, const double&
 
 double QLaw::computeQ(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
 {
-    //                                                2
-    //                                    ⎛  ⎛      T⎞⎞
-    //                                    ⎜d ⎝oe, oe ⎠⎟
-    //                    ___             ⎜───────────⎟
-    // Q = ⎛1 + W  ⋅ P⎞ ⋅ ╲   W   ⋅ S   ⋅ ⎜     .     ⎟
-    //     ⎝     P    ⎠   ╱    oe    oe   ⎜   oe      ⎟
-    //                    ‾‾‾             ⎝     xx    ⎠
-    //                    oe
+    return std::get<0>(computeProximityQuotient(aCOEVector, aThrustAcceleration, false));
+}
+
+Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    return std::get<2>(computeProximityQuotient(aCOEVector, aThrustAcceleration, false));
+}
 
-    // (1 + W_p * P)
-    const double periapsisRadius = aCOEVector[0] * (1.0 - aCOEVector[1]);
-    const double P = std::exp(parameters_.k * (1.0 - (periapsisRadius / parameters_.minimumPeriapsisRadius_)));
+Vector5d QLaw::computeOrbitalElementsError(const Vector5d& aCOEVector) const
+{
+    return computeDeltaCOE(aCOEVector);
+}
 
-    const double periapsisScaling = (1.0 + (parameters_.periapsisWeight * P));
+Matrix3d QLaw::ThetaRHToGCRF(const Vector3d& aPositionCoordinates, const Vector3d& aVelocityCoordinates)
+{
+    return ComputeThetaRHToGCRF<double>(aPositionCoordinates, aVelocityCoordinates);
+}
 
-    //   ⎛      T⎞
-    // d ⎝oe, oe ⎠
-    const Vector5d deltaCOE = computeDeltaCOE(aCOEVector);
+Matrix53d QLaw::Compute_dOE_dF(const Vector6d& aCOEVector, const Derived& aGravitationalParameter)
+{
+    return ComputeOrbitalElementsDerivatives<double>(
+        aCOEVector, aGravitationalParameter.in(GravitationalParameterSIUnit)
+    );
+}
 
-    // S_oe
-    const Vector5d scalingCOE = {
-        std::pow(
-            (1.0 + std::pow(deltaCOE[0] / (parameters_.m * targetCOEVector_[0]), parameters_.n)), 1.0 / parameters_.r
-        ),
-        1.0,
-        1.0,
-        1.0,
-        1.0,
+Vector5d QLaw::computeAnalytical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    return std::get<1>(computeProximityQuotient(aCOEVector, aThrustAcceleration, true));
+}
+
+Vector5d QLaw::computeNumerical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    const auto getQ = [this,
+                       &aThrustAcceleration](const State& aState, [[maybe_unused]] const Instant& anInstant) -> VectorXd
+    {
+        const Vector5d& coeVector = aState.accessCoordinates();
+
+        VectorXd coordinates(1);
+        coordinates << this->computeQ(coeVector, aThrustAcceleration);
+
+        return coordinates;
     };
 
-    // oedot_xx
-    const Vector5d maximalCOE = computeOrbitalElementsMaximalChange(aCOEVector, aThrustAcceleration);
+    const Vector5d jacobian = Eigen::Map<Vector5d>(
+        finiteDifferenceSolver_
+            .computeJacobian(stateBuilder_.build(Instant::J2000(), aCOEVector), Instant::J2000(), getQ, 1)
+            .data(),
+        5
+    );
 
-    const Vector5d deltaCOE_divided_maximalCOE = (deltaCOE.cwiseQuotient(maximalCOE));
+    return jacobian;
+}
 
-    return periapsisScaling * (parameters_.controlWeights_.cwiseProduct(scalingCOE)
-                                   .cwiseProduct(deltaCOE_divided_maximalCOE.cwiseProduct(deltaCOE_divided_maximalCOE)))
-                                  .sum();
+template <typename Scalar>
+Eigen::Matrix<Scalar, 5, 1> QLaw::computeDeltaCOE(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector) const
+{
+    return {
+        (aCOEVector[0] - targetCOEVector_[0]),
+        (aCOEVector[1] - targetCOEVector_[1]),
+        (aCOEVector[2] - targetCOEVector_[2]),
+        AngularDistance(aCOEVector[3] - targetCOEVector_[3]),
+        AngularDistance(aCOEVector[4] - targetCOEVector_[4]),
+    };
 }
 
-Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+template <typename Scalar>
+Tuple<Scalar, Eigen::Matrix<Scalar, 5, 1>, Eigen::Matrix<Scalar, 5, 1>> QLaw::computeProximityQuotient(
+    const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration, const bool& computeGradient
+) const
 {
-    const double& semiMajorAxis = aCOEVector[0];
-    const double& eccentricity = aCOEVector[1];
-    const double& inclination = aCOEVector[2];
-    const double& argumentOfPeriapsis = aCOEVector[4];
+    using Vector5 = Eigen::Matrix<Scalar, 5, 1>;
+    using Matrix5 = Eigen::Matrix<Scalar, 5, 5>;
+
+    using std::abs;
+    using std::cos;
+    using std::exp;
+    using std::pow;
+    using std::sin;
+    using std::sqrt;
+
+    const Scalar& semiMajorAxis = aCOEVector[0];
+    const Scalar& eccentricity = aCOEVector[1];
+    const Scalar& inclination = aCOEVector[2];
+    const Scalar& argumentOfPeriapsis = aCOEVector[4];
+
+    const double& semiMajorAxisTarget = targetCOEVector_[0];
+
+    const double& m = parameters_.m;
+    const double& n = parameters_.n;
+    const double& r = parameters_.r;
+    const double& b = parameters_.b;
+    const double& k = parameters_.k;
+    const double& periapsisWeight = parameters_.periapsisWeight;
+    const double& minimumPeriapsisRadius = parameters_.minimumPeriapsisRadius_;
+
+    // Common subexpressions, shared by Q, its gradient and the maximal changes
+
+    const Scalar eccentricitySquared = eccentricity * eccentricity;
+    const Scalar oneMinusEccentricitySquared = 1.0 - eccentricitySquared;
+    const Scalar semiLatusRectum = semiMajorAxis * oneMinusEccentricitySquared;
+    const Scalar angularMomentum = sqrt(mu_ * semiLatusRectum);
+    const Scalar thrustScale = semiLatusRectum * aThrustAcceleration / angularMomentum;
 
-    const double semiLatusRectum = COE::ComputeSemiLatusRectum(semiMajorAxis, eccentricity);
-    const double angularMomentum = COE::ComputeAngularMomentum(semiLatusRectum, gravitationalParameter_);
+    const Scalar inclination_sin = sin(inclination);
+    const Scalar inclination_cos = cos(inclination);
+    const Scalar aop_sin = sin(argumentOfPeriapsis);
+    const Scalar aop_cos = cos(argumentOfPeriapsis);
+    const Scalar aop_sinSquared = aop_sin * aop_sin;
+    const Scalar aop_cosSquared = aop_cos * aop_cos;
 
-    // common grouped terms
-    const double eccentricitySquared = eccentricity * eccentricity;
-    const double aop_sin = std::sin(argumentOfPeriapsis);
-    const double aop_cos = std::cos(argumentOfPeriapsis);
+    // Maximal change of the orbital elements
 
     // Semi-Major Axis
     //
@@ -301,9 +608,9 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     //                       ╲╱           μ⋅(1 - eccentricity)
     //
 
-    const double semiMajorAxis_xx =
-        (2.0 * aThrustAcceleration *
-         std::sqrt(std::pow(semiMajorAxis, 3) * (1.0 + eccentricity) / (mu_ * (1.0 - eccentricity))));
+    const Scalar semiMajorAxisCubed = semiMajorAxis * semiMajorAxis * semiMajorAxis;
+    const Scalar semiMajorAxis_xx =
+        2.0 * aThrustAcceleration * sqrt(semiMajorAxisCubed * (1.0 + eccentricity) / (mu_ * (1.0 - eccentricity)));
 
     // Eccentricity
     //
@@ -311,7 +618,7 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     // ─────────────────────────────────────
     //           angularMomentum
 
-    const double eccentricity_xx = 2.0 * semiLatusRectum * aThrustAcceleration / angularMomentum;
+    const Scalar eccentricity_xx = 2.0 * thrustScale;
 
     // Inclination
     //                                         aThrustAcceleration⋅semiLatusRectum
@@ -320,9 +627,9 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     //                 ⎜                                             ╱               2      2                        ⎟
     // angularMomentum⋅⎝-eccentricity⋅│cos(argumentOfPeriapsis)│ + ╲╱ 1 - eccentricity ⋅ sin(argumentOfPeriapsis)    ⎠
 
-    const double inclination_xx = (semiLatusRectum * aThrustAcceleration) /
-                                  (angularMomentum * (std::sqrt(1.0 - (eccentricitySquared * aop_sin * aop_sin)) -
-                                                      eccentricity * std::abs(aop_cos)));
+    const Scalar inclinationRoot = sqrt(1.0 - eccentricitySquared * aop_sinSquared);
+    const Scalar inclinationDenominator = inclinationRoot - eccentricity * abs(aop_cos);
+    const Scalar inclination_xx = thrustScale / inclinationDenominator;
 
     // Right Ascension of the Ascending Node
     // clang-format off
@@ -333,347 +640,184 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     // angularMomentum⋅⎝-eccentricity⋅│sin(argumentOfPeriapsis)│ + ╲╱1 - eccentricity ⋅ cos(argumentOfPeriapsis)⎠⋅sin(inclination)
     // clang-format on
 
-    const double rightAscensionOfAscendingNode_xx =
-        (semiLatusRectum * aThrustAcceleration) /
-        (angularMomentum * std::sin(inclination) *
-         (std::sqrt(1.0 - (eccentricitySquared * aop_cos * aop_cos)) - eccentricity * std::abs(aop_sin)));
+    const Scalar raanRoot = sqrt(1.0 - eccentricitySquared * aop_cosSquared);
+    const Scalar raanDenominator = raanRoot - eccentricity * abs(aop_sin);
+    const Scalar rightAscensionOfAscendingNode_xx = thrustScale / (inclination_sin * raanDenominator);
 
     // Argument of Periapsis
     // Too complicated to print here. See the paper.
-    const double alpha = (1.0 - eccentricitySquared) / (2.0 * std::pow(eccentricity, 3));
-    const double beta = std::sqrt(alpha * alpha + 1.0 / 27.0);
-
-    const double cosTheta_xx =
-        std::pow((alpha + beta), 1.0 / 3.0) - std::pow((beta - alpha), 1.0 / 3.0) - 1.0 / eccentricity;
-    const double r_xx = semiLatusRectum / (1.0 + (eccentricity * cosTheta_xx));
-
-    const double cosTheta_xxSquared = cosTheta_xx * cosTheta_xx;
-
-    const double argumentOfPeriapsisI_xx = (aThrustAcceleration / (eccentricity * angularMomentum)) *
-                                           std::sqrt(
-                                               semiLatusRectum * semiLatusRectum * cosTheta_xxSquared +
-                                               std::pow((semiLatusRectum + r_xx), 2) * (1.0 - cosTheta_xxSquared)
-                                           );
-
-    const double argumentOfPeriapsisO_xx = rightAscensionOfAscendingNode_xx * std::abs(std::cos(inclination));
-    const double argumentOfPeriapsis_xx =
-        (argumentOfPeriapsisI_xx + parameters_.b * argumentOfPeriapsisO_xx) / (1.0 + parameters_.b);
-
-    return {
+    const Scalar alpha = oneMinusEccentricitySquared / (2.0 * eccentricitySquared * eccentricity);
+    const Scalar beta = sqrt(alpha * alpha + 1.0 / 27.0);
+    const Scalar cubeRootSum = Cbrt(alpha + beta);
+    const Scalar cubeRootDifference = Cbrt(beta - alpha);
+    const Scalar cosTheta_xx = cubeRootSum - cubeRootDifference - 1.0 / eccentricity;
+    const Scalar cosTheta_xxSquared = cosTheta_xx * cosTheta_xx;
+    const Scalar r_xxDenominator = 1.0 + eccentricity * cosTheta_xx;
+    const Scalar r_xx = semiLatusRectum / r_xxDenominator;
+    const Scalar semiLatusRectumPlusR_xx = semiLatusRectum + r_xx;
+    const Scalar aopRadicand = semiLatusRectum * semiLatusRectum * cosTheta_xxSquared +
+                               semiLatusRectumPlusR_xx * semiLatusRectumPlusR_xx * (1.0 - cosTheta_xxSquared);
+    const Scalar argumentOfPeriapsisI_xx =
+        (aThrustAcceleration / (eccentricity * angularMomentum)) * sqrt(aopRadicand);
+    const Scalar argumentOfPeriapsisO_xx = rightAscensionOfAscendingNode_xx * abs(inclination_cos);
+    const Scalar argumentOfPeriapsis_xx = (argumentOfPeriapsisI_xx + b * argumentOfPeriapsisO_xx) / (1.0 + b);
+
+    const Vector5 maximalCOE = {
         semiMajorAxis_xx,
         eccentricity_xx,
         inclination_xx,
         rightAscensionOfAscendingNode_xx,
         argumentOfPeriapsis_xx,
     };
-}
-
-Matrix3d QLaw::ThetaRHToGCRF(const Vector3d& aPositionCoordinates, const Vector3d& aVelocityCoordinates)
-{
-    const Vector3d R = aPositionCoordinates.normalized();
-    const Vector3d H = (aPositionCoordinates.cross(aVelocityCoordinates)).normalized();
-    const Vector3d theta = H.cross(R);
-
-    Matrix3d rotationMatrix;
-    rotationMatrix.col(0) = theta;
-    rotationMatrix.col(1) = R;
-    rotationMatrix.col(2) = H;
-
-    return rotationMatrix;
-}
-
-Matrix53d QLaw::Compute_dOE_dF(const Vector6d& aCOEVector, const Derived& aGravitationalParameter)
-{
-    const double& semiMajorAxis = aCOEVector[0];
-    const double& eccentricity = aCOEVector[1];
-    const double& inclination = aCOEVector[2];
-    const double& argumentOfPeriapsis = aCOEVector[4];
-    const double& trueAnomaly = aCOEVector[5];
-
-    const double semiLatusRectum = COE::ComputeSemiLatusRectum(semiMajorAxis, eccentricity);
-    const double angularMomentum = COE::ComputeAngularMomentum(semiLatusRectum, aGravitationalParameter);
-    const double radialDistance = COE::ComputeRadialDistance(semiMajorAxis, eccentricity, trueAnomaly);
 
-    // columns: Orbital elements
-    // rows: theta, radial, angular momentum directions
-    Matrix53d derivativeMatrix = Matrix53d::Zero();
-
-    // Common grouped operations
-    const double trueAnomaly_sin = std::sin(trueAnomaly);
-    const double trueAnomaly_cos = std::cos(trueAnomaly);
-    const double trueAnomaly_ArgumentOfPeriapsis_sin = std::sin(trueAnomaly + argumentOfPeriapsis);
-    const double trueAnomaly_ArgumentOfPeriapsis_cos = std::cos(trueAnomaly + argumentOfPeriapsis);
-
-    // Semi-major axis
-    const double sma_alpha = (2.0 * semiMajorAxis * semiMajorAxis / angularMomentum);
-    derivativeMatrix(0, 0) = sma_alpha * semiLatusRectum / radialDistance;
-    derivativeMatrix(0, 1) = sma_alpha * eccentricity * trueAnomaly_sin;
-
-    // Eccentricity
-    derivativeMatrix(1, 0) =
-        (((semiLatusRectum + radialDistance) * trueAnomaly_cos) + (radialDistance * eccentricity)) / angularMomentum;
-    derivativeMatrix(1, 1) = (semiLatusRectum * trueAnomaly_sin / angularMomentum);
-
-    // Inclination
-    derivativeMatrix(2, 2) = (radialDistance * trueAnomaly_ArgumentOfPeriapsis_cos / angularMomentum);
+    // Proximity quotient
+    //
+    //                                                2
+    //                                    ⎛  ⎛      T⎞⎞
+    //                                    ⎜d ⎝oe, oe ⎠⎟
+    //                    ___             ⎜───────────⎟
+    // Q = ⎛1 + W  ⋅ P⎞ ⋅ ╲   W   ⋅ S   ⋅ ⎜     .     ⎟
+    //     ⎝     P    ⎠   ╱    oe    oe   ⎜   oe      ⎟
+    //                    ‾‾‾             ⎝     xx    ⎠
+    //                    oe
 
-    // Right Ascension of the Ascending Node
-    derivativeMatrix(3, 2) =
-        (radialDistance * trueAnomaly_ArgumentOfPeriapsis_sin) / (angularMomentum * std::sin(inclination));
+    const Scalar periapsisRadius = semiMajorAxis * (1.0 - eccentricity);
+    const Scalar P = exp(k * (1.0 - (periapsisRadius / minimumPeriapsisRadius)));
+    const Scalar periapsisScaling = 1.0 + periapsisWeight * P;
 
-    // Argument of Periapsis
-    const double aop_alpha = 1.0 / (eccentricity * angularMomentum);
-    derivativeMatrix(4, 0) = (semiLatusRectum + radialDistance) * trueAnomaly_sin * aop_alpha;
-    derivativeMatrix(4, 1) = -semiLatusRectum * trueAnomaly_cos * aop_alpha;
-    derivativeMatrix(4, 2) = (-radialDistance * trueAnomaly_ArgumentOfPeriapsis_sin * std::cos(inclination)) /
-                             (angularMomentum * std::sin(inclination));
+    const Vector5 deltaCOE = computeDeltaCOE(aCOEVector);
 
-    return derivativeMatrix;
-}
+    const Scalar semiMajorAxisScalingBase = deltaCOE[0] / (m * semiMajorAxisTarget);
+    const Scalar semiMajorAxisScalingPower = pow(semiMajorAxisScalingBase, n);
+    const Scalar semiMajorAxisScaling = pow(1.0 + semiMajorAxisScalingPower, 1.0 / r);
 
-Vector5d QLaw::computeAnalytical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
-{
-    const double& semiMajorAxis = aCOEVector(0);
-    const double& eccentricity = aCOEVector(1);
-    const double& inclination = aCOEVector(2);
-    const double& rightAscensionOfAscendingNode = aCOEVector(3);
-    const double& argumentOfPeriapsis = aCOEVector(4);
+    const Vector5 scalingCOE = {semiMajorAxisScaling, 1.0, 1.0, 1.0, 1.0};
 
-    const double& semiMajorAxisTarget = targetCOEVector_(0);
-    const double& eccentricityTarget = targetCOEVector_(1);
-    const double& inclinationTarget = targetCOEVector_(2);
-    const double& rightAscensionOfAscendingNodeTarget = targetCOEVector_(3);
-    const double& argumentOfPeriapsisTarget = targetCOEVector_(4);
+    const Vector5 deltaCOE_divided_maximalCOE = deltaCOE.cwiseQuotient(maximalCOE);
 
-    const double& semiMajorAxisWeight = parameters_.controlWeights_(0);
-    const double& eccentricityWeight = parameters_.controlWeights_(1);
-    const double& inclinationWeight = parameters_.controlWeights_(2);
-    const double& rightAscensionOfAscendingNodeWeight = parameters_.controlWeights_(3);
-    const double& argumentOfPeriapsisWeight = parameters_.controlWeights_(4);
+    const Vector5 weightedScaling = parameters_.controlWeights_.cast<Scalar>().cwiseProduct(scalingCOE);
 
-    const double& periapsisWeight = parameters_.periapsisWeight;
-    const double& minimumPeriapsisRadius = parameters_.minimumPeriapsisRadius_;
+    const Scalar sum = weightedScaling.dot(deltaCOE_divided_maximalCOE.cwiseAbs2());
+    const Scalar Q = periapsisScaling * sum;
 
-    // common grouped expressions
-    const double x0 = 1.0 / minimumPeriapsisRadius;
-    const double x1 = eccentricity - 1.0;
-    const double x2 = x0 * x1;
-    const double x3 = eccentricity - eccentricityTarget;
-    const double x4 = eccentricityWeight * std::pow(x3, 2.0);
-    const double x5 = 1.0 / semiMajorAxis;
-    const double x6 = std::pow(eccentricity, 2.0);
-    const double x7 = x6 - 1.0;
-    const double x8 = 1.0 / x7;
-    const double x9 = x5 * x8;
-    const double x10 = semiMajorAxis - semiMajorAxisTarget;
-    const double x11 = std::pow(x10, 2.0);
-    const double x12 = std::pow(semiMajorAxis, -3.0);
-    const double x13 = eccentricity + 1.0;
-    const double x14 = 1.0 / x13;
-    const double x15 = std::pow(x10 / (parameters_.m * semiMajorAxisTarget), parameters_.n);
-    const double x16 = x15 + 1.0;
-    const double x17 = 1.0 / parameters_.r;
-    const double x18 = std::pow(x16, x17);
-    const double x19 = semiMajorAxisWeight * x12 * x14 * x18;
-    const double x20 = x11 * x19;
-    const double x21 = 4.0 * x9;
-    const double x22 = inclination - inclinationTarget;
-    const double x23 = std::pow(x22, 2.0);
-    const double x24 = std::cos(argumentOfPeriapsis);
-    const double x25 = std::fabs(x24);
-    const double x26 = std::sin(argumentOfPeriapsis);
-    const double x27 = std::pow(x26, 2.0);
-    const double x28 = std::sqrt(-x27 * x6 + 1.0);
-    const double x29 = eccentricity * x25 - x28;
-    const double x30 = inclinationWeight * std::pow(x29, 2.0);
-    const double x31 = x23 * x30;
-    const double x32 = std::fabs(x26);
-    const double x33 = std::pow(x24, 2.0);
-    const double x34 = std::sqrt(-x33 * x6 + 1.0);
-    const double x35 = eccentricity * x32 - x34;
-    const double x36 = std::pow(x35, 2.0);
-    const double x37 = rightAscensionOfAscendingNode - rightAscensionOfAscendingNodeTarget;
-    const double x38 = std::cos(x37);
-    const double x39 = std::acos(x38);
-    const double x40 = std::pow(x39, 2.0);
-    const double x41 = std::sin(inclination);
-    const double x42 = std::pow(x41, 2.0);
-    const double x43 = rightAscensionOfAscendingNodeWeight * x40 * x42;
-    const double x44 = x36 * x43;
-    const double x45 = semiMajorAxis * x7;
-    const double x46 = std::pow(parameters_.b + 1.0, 2.0);
-    const double x47 = 1.0 / x35;
-    const double x48 = std::cos(inclination);
-    const double x49 = std::fabs(x48);
-    const double x50 = parameters_.b * x49 / x41;
-    const double x51 = 1.0 / eccentricity;
-    const double x52 = -x7;
-    const double x53 = x52 / std::pow(eccentricity, 3.0);
-    const double x54 = std::sqrt(0.14814814814814814 + std::pow(x52, 2.0) / std::pow(eccentricity, 6.0));
-    const double x55 = x53 + x54;
-    const double x56 = std::max(0.0, -x53 + x54);
-    const double x57 =
-        x51 - 0.79370052598409979 * std::pow(x55, (1.0 / 3.0)) + 0.79370052598409979 * std::pow(x56, (1.0 / 3.0));
-    const double x58 = -x57;
-    const double x59 = std::pow(x58, 2.0);
-    const double x60 = x59 - 1.0;
-    const double x61 = std::fabs(semiMajorAxis);
-    const double x62 = std::fabs(x7);
-    const double x63 = x51 * x61 * x62;
-    const double x64 =
-        x45 * x47 * x50 +
-        x63 * std::sqrt(std::pow(x57, 2.0) - x60 * std::pow(1.0 + 1.0 / (-eccentricity * x57 + 1.0), 2.0));
-    const double x65 = std::pow(x64, -2.0);
-    const double x66 = argumentOfPeriapsis - argumentOfPeriapsisTarget;
-    const double x67 = std::cos(x66);
-    const double x68 = std::acos(x67);
-    const double x69 = std::pow(x68, 2.0);
-    const double x70 = 4.0 * x69;
-    const double x71 = periapsisWeight * std::exp(parameters_.k * (semiMajorAxis * x2 + 1.0));
-    const double x72 = parameters_.k * x71 *
-                       (argumentOfPeriapsisWeight * x45 * x46 * x65 * x70 + x1 * x20 + x21 * x31 + x21 * x44 + x4 * x9);
-    const double x73 = x71 + 1.0;
-    const double x74 = mu_ * x4;
-    const double x75 = std::pow(semiMajorAxis, 2.0);
-    const double x76 = 1.0 / x52;
-    const double x77 = x76 / x75;
-    const double x78 = -x1;
-    const double x79 = mu_ * x10 * x19 * x78;
-    const double x80 = inclinationWeight * x23;
-    const double x81 = 4.0 * mu_ * x77;
-    const double x82 = mu_ * semiMajorAxisWeight * x11 * x18;
-    const double x83 = -x35;
-    const double x84 = std::pow(x83, 2.0);
-    const double x85 = x50 / x83;
-    const double x86 = x52 * x85;
-    const double x87 = -x60;
-    const double x88 = eccentricity * x58 + 1.0;
-    const double x89 = 1.0 / x88;
-    const double x90 = x89 + 1.0;
-    const double x91 = std::pow(x90, 2.0);
-    const double x92 = std::sqrt(x59 + x87 * x91);
-    const double x93 = x51 * x52 / (x61 * x62 * x92);
-    const double x94 = 2.0 * semiMajorAxis;
-    const double x95 = mu_ * semiMajorAxis;
-    const double x96 = x52 * x95;
-    const double x97 = argumentOfPeriapsisWeight * x46 * x70;
-    const double x98 = std::pow(aThrustAcceleration, -2.0);
-    const double x99 = (1.0 / 4.0) * x98;
-    const double x100 = mu_ * x9;
-    const double x101 = 2.0 * eccentricity;
-    const double x102 = std::pow(x7, 2.0);
-    const double x103 = x5 / x102;
-    const double x104 = eccentricity * mu_;
-    const double x105 = 8.0 * x103 * x104;
-    const double x106 = eccentricity / x28;
-    const double x107 = 8.0 * x100;
-    const double x108 = eccentricity / x34;
-    const double x109 = x108 * x33 + x32;
-    const double x110 = x35 * x43;
-    const double x111 = std::pow(x64, -3.0);
-    const double x112 = 1.0 / x6;
-    const double x113 = 2.0 * x61 * x62 * x92;
-    const double x114 = x112 * x52;
-    const double x115 = (1.0 / 3.0) * x53 * (3.0 * x114 + 2.0) / x54;
-    const double x116 = x112 * (1.0 - 1.0 * x6) + (2.0 / 3.0);
-    const double x117 = std::pow(x55, -(2.0 / 3.0)) * (x115 + x116);
-    const double x118 = std::pow(std::max(x56, 1e-15), -(2.0 / 3.0)) * (-x115 + x116);
-    const double x119 = -1.5874010519681996 * x117 - 1.5874010519681996 * x118 + 2.0;
-    const double x120 = rightAscensionOfAscendingNodeWeight * x100 * x36;
-    const double x121 = argumentOfPeriapsisWeight * x102 * x111 * x46 * x69 * x75;
-    const double x122 = 2.0 * x73 * x98;
-    const double x123 = x24 * (x108 * x26 - (((x26) > 0) - ((x26) < 0)));
-
-    double dQ_dSemiMajorAxis =
-        -x99 * (mu_ * x2 * x72 + x73 * (-parameters_.n * x15 * x17 * x79 / x16 + std::pow(x29, 2.0) * x80 * x81 +
-                                        x43 * x81 * x84 + x74 * x77 - 2.0 * x79 -
-                                        x96 * x97 *
-                                            (x5 * x51 * x61 * x62 * x92 - x86 -
-                                             x93 * x94 * (x52 * x59 + x87 * x90 * (x52 * x89 - x6 + 1.0))) /
-                                            std::pow(semiMajorAxis * x86 + x63 * x92, 3.0) +
-                                        3.0 * x14 * x78 * x82 / std::pow(semiMajorAxis, 4.0)));
-
-    double dQ_dEccentricity =
-        -x99 *
-        (x0 * x72 * x95 +
-         x73 *
-             (2.0 * eccentricityWeight * x100 * x3 + mu_ * x20 - x1 * x12 * x82 / std::pow(x13, 2.0) -
-              x101 * x103 * x74 - x105 * x31 - x105 * x44 + x107 * x109 * x110 + x107 * x29 * x80 * (x106 * x27 + x25) +
-              x111 * x97 * std::pow(-x7 * x95, 3.0 / 2.0) *
-                  (-semiMajorAxis * x101 * x85 + x109 * x50 * x52 * x94 / x84 - x112 * x113 + x113 * x76 +
-                   x75 * x93 *
-                       (-4.0 * eccentricity * x59 + x112 * x119 * x52 * x58 - x114 * x119 * x58 * x91 +
-                        2.0 * x87 * x90 *
-                            (-x101 * x89 - x101 +
-                             x52 * (-x51 * (-0.79370052598409979 * x117 - 0.79370052598409979 * x118 + 1.0) + x57) /
-                                 std::pow(x88, 2.0)))) /
-                  std::sqrt(x96)));
-
-    double dQ_dInclination =
-        -x122 * (mu_ * parameters_.b * x121 * x47 * ((((x48) > 0) - ((x48) < 0)) + x48 * x49 / x42) + x100 * x22 * x30 +
-                 x120 * x40 * x41 * x48);
-
-    double x124 = std::sin(x37) / std::sqrt(1.0 - std::pow(x38, 2.0));
-    if (!std::isfinite(x124))
+    if (!computeGradient)
     {
-        x124 = 0.0;
+        return std::make_tuple(Q, Vector5::Constant(Scalar(std::numeric_limits<double>::quiet_NaN())), maximalCOE);
     }
 
-    double dQ_dRightAscensionOfAscendingNode = -x120 * x122 * x39 * x42 * x124;
-
-    double x125 = std::sin(x66) / std::sqrt(1.0 - std::pow(x67, 2.0));
-    if (!std::isfinite(x125))
-    {
-        x125 = 0.0;
-    }
+    // Derivatives of the maximal changes, rows: maximal changes, columns: orbital elements
+
+    Matrix5 d_maximalCOE_dOE = Matrix5::Zero();
+
+    const Scalar dLogThrustScale_dSemiMajorAxis = 0.5 / semiMajorAxis;
+    const Scalar dLogThrustScale_dEccentricity = -eccentricity / oneMinusEccentricitySquared;
+
+    d_maximalCOE_dOE(0, 0) = 1.5 * semiMajorAxis_xx / semiMajorAxis;
+    d_maximalCOE_dOE(0, 1) = semiMajorAxis_xx / oneMinusEccentricitySquared;
+
+    d_maximalCOE_dOE(1, 0) = eccentricity_xx * dLogThrustScale_dSemiMajorAxis;
+    d_maximalCOE_dOE(1, 1) = eccentricity_xx * dLogThrustScale_dEccentricity;
+
+    const Scalar inclinationDenominator_dEccentricity =
+        -eccentricity * aop_sinSquared / inclinationRoot - abs(aop_cos);
+    const Scalar inclinationDenominator_dAop =
+        -eccentricitySquared * aop_sin * aop_cos / inclinationRoot + eccentricity * Sign(ValueOf(aop_cos)) * aop_sin;
+
+    d_maximalCOE_dOE(2, 0) = inclination_xx * dLogThrustScale_dSemiMajorAxis;
+    d_maximalCOE_dOE(2, 1) =
+        inclination_xx *
+        (dLogThrustScale_dEccentricity - inclinationDenominator_dEccentricity / inclinationDenominator);
+    d_maximalCOE_dOE(2, 4) = -inclination_xx * inclinationDenominator_dAop / inclinationDenominator;
+
+    const Scalar raanDenominator_dEccentricity = -eccentricity * aop_cosSquared / raanRoot - abs(aop_sin);
+    const Scalar raanDenominator_dAop =
+        eccentricitySquared * aop_sin * aop_cos / raanRoot - eccentricity * Sign(ValueOf(aop_sin)) * aop_cos;
+
+    d_maximalCOE_dOE(3, 0) = rightAscensionOfAscendingNode_xx * dLogThrustScale_dSemiMajorAxis;
+    d_maximalCOE_dOE(3, 1) = rightAscensionOfAscendingNode_xx *
+                             (dLogThrustScale_dEccentricity - raanDenominator_dEccentricity / raanDenominator);
+    d_maximalCOE_dOE(3, 2) = -rightAscensionOfAscendingNode_xx * inclination_cos / inclination_sin;
+    d_maximalCOE_dOE(3, 4) = -rightAscensionOfAscendingNode_xx * raanDenominator_dAop / raanDenominator;
+
+    const Scalar alpha_dEccentricity = (eccentricitySquared - 3.0) / (2.0 * eccentricitySquared * eccentricitySquared);
+    const Scalar beta_dEccentricity = alpha * alpha_dEccentricity / beta;
+    const Scalar cosTheta_xx_dEccentricity =
+        (alpha_dEccentricity + beta_dEccentricity) / (3.0 * cubeRootSum * cubeRootSum) -
+        (beta_dEccentricity - alpha_dEccentricity) / (3.0 * cubeRootDifference * cubeRootDifference) +
+        1.0 / eccentricitySquared;
+
+    const Scalar semiLatusRectum_dSemiMajorAxis = oneMinusEccentricitySquared;
+    const Scalar semiLatusRectum_dEccentricity = -2.0 * semiMajorAxis * eccentricity;
+    const Scalar r_xx_dSemiMajorAxis = semiLatusRectum_dSemiMajorAxis / r_xxDenominator;
+    const Scalar r_xx_dEccentricity =
+        (semiLatusRectum_dEccentricity - r_xx * (cosTheta_xx + eccentricity * cosTheta_xx_dEccentricity)) /
+        r_xxDenominator;
+
+    const Scalar aopRadicand_dSemiMajorAxis =
+        2.0 * semiLatusRectum * cosTheta_xxSquared * semiLatusRectum_dSemiMajorAxis +
+        2.0 * semiLatusRectumPlusR_xx * (semiLatusRectum_dSemiMajorAxis + r_xx_dSemiMajorAxis) *
+            (1.0 - cosTheta_xxSquared);
+    const Scalar aopRadicand_dEccentricity =
+        2.0 * semiLatusRectum * cosTheta_xxSquared * semiLatusRectum_dEccentricity +
+        2.0 * (semiLatusRectum * semiLatusRectum - semiLatusRectumPlusR_xx * semiLatusRectumPlusR_xx) * cosTheta_xx *
+            cosTheta_xx_dEccentricity +
+        2.0 * semiLatusRectumPlusR_xx * (semiLatusRectum_dEccentricity + r_xx_dEccentricity) *
+            (1.0 - cosTheta_xxSquared);
+
+    const Scalar argumentOfPeriapsisI_xx_dSemiMajorAxis =
+        argumentOfPeriapsisI_xx * (0.5 * aopRadicand_dSemiMajorAxis / aopRadicand - dLogThrustScale_dSemiMajorAxis);
+    const Scalar argumentOfPeriapsisI_xx_dEccentricity =
+        argumentOfPeriapsisI_xx *
+        (0.5 * aopRadicand_dEccentricity / aopRadicand - 1.0 / eccentricity - dLogThrustScale_dEccentricity);
+
+    const Scalar absCosInclination = abs(inclination_cos);
+
+    d_maximalCOE_dOE(4, 0) =
+        (argumentOfPeriapsisI_xx_dSemiMajorAxis + b * absCosInclination * d_maximalCOE_dOE(3, 0)) / (1.0 + b);
+    d_maximalCOE_dOE(4, 1) =
+        (argumentOfPeriapsisI_xx_dEccentricity + b * absCosInclination * d_maximalCOE_dOE(3, 1)) / (1.0 + b);
+    d_maximalCOE_dOE(4, 2) = b *
+                             (absCosInclination * d_maximalCOE_dOE(3, 2) -
+                              rightAscensionOfAscendingNode_xx * Sign(ValueOf(inclination_cos)) * inclination_sin) /
+                             (1.0 + b);
+    d_maximalCOE_dOE(4, 4) = b * absCosInclination * d_maximalCOE_dOE(3, 4) / (1.0 + b);
+
+    // Derivatives of the element differences, the derivative of acos(cos(x)) being the sign of sin(x)
+    const Vector5d d_deltaCOE_dOE = {
+        1.0,
+        1.0,
+        1.0,
+        Sign(std::sin(ValueOf(aCOEVector[3]) - targetCOEVector_[3])),
+        Sign(std::sin(ValueOf(aCOEVector[4]) - targetCOEVector_[4])),
+    };
 
-    double dQ_dArgumentOfPeriapsis =
-        -x122 * (argumentOfPeriapsisWeight * mu_ * semiMajorAxis * x46 * x65 * x68 * x7 * x125 +
-                 eccentricity * inclinationWeight * mu_ * x23 * x26 * x29 * x5 * x8 *
-                     (x106 * x24 - (((x24) > 0) - ((x24) < 0))) -
-                 eccentricity * x100 * x110 * x123 - x104 * x121 * x123 * x50 / x36);
+    // Derivative of the weighted sum
 
-    return {
-        dQ_dSemiMajorAxis,
-        dQ_dEccentricity,
-        dQ_dInclination,
-        dQ_dRightAscensionOfAscendingNode,
-        dQ_dArgumentOfPeriapsis,
-    };
-}
+    Vector5 dSum_dOE = Vector5::Zero();
 
-Vector5d QLaw::computeNumerical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
-{
-    const auto getQ = [this,
-                       &aThrustAcceleration](const State& aState, [[maybe_unused]] const Instant& anInstant) -> VectorXd
+    for (Index i = 0; i < 5; ++i)
     {
-        const Vector5d& coeVector = aState.accessCoordinates();
+        const Scalar ratio = deltaCOE_divided_maximalCOE[i];
+        const Scalar factor = 2.0 * weightedScaling[i] * ratio / maximalCOE[i];
 
-        VectorXd coordinates(1);
-        coordinates << this->computeQ(coeVector, aThrustAcceleration);
+        dSum_dOE -= factor * ratio * d_maximalCOE_dOE.row(i).transpose();
+        dSum_dOE[i] += factor * d_deltaCOE_dOE[i];
+    }
 
-        return coordinates;
-    };
+    // S_a
+    dSum_dOE[0] += parameters_.controlWeights_[0] * deltaCOE_divided_maximalCOE[0] * deltaCOE_divided_maximalCOE[0] *
+                   semiMajorAxisScaling * n * pow(semiMajorAxisScalingBase, n - 1.0) /
+                   (r * m * semiMajorAxisTarget * (1.0 + semiMajorAxisScalingPower));
 
-    const Vector5d jacobian = Eigen::Map<Vector5d>(
-        finiteDifferenceSolver_
-            .computeJacobian(stateBuilder_.build(Instant::J2000(), aCOEVector), Instant::J2000(), getQ, 1)
-            .data(),
-        5
-    );
+    // Derivative of the periapsis penalty
 
-    return jacobian;
-}
+    const Scalar periapsisScaling_dRadius = -periapsisWeight * k * P / minimumPeriapsisRadius;
 
-Vector5d QLaw::computeDeltaCOE(const Vector5d& aCOEVector) const
-{
-    return {
-        (aCOEVector[0] - targetCOEVector_[0]),
-        (aCOEVector[1] - targetCOEVector_[1]),
-        (aCOEVector[2] - targetCOEVector_[2]),
-        (std::acos(std::cos((aCOEVector[3] - targetCOEVector_[3])))),
-        (std::acos(std::cos((aCOEVector[4] - targetCOEVector_[4])))),
-    };
+    Vector5 dQ_dOE = periapsisScaling * dSum_dOE;
+    dQ_dOE[0] += sum * periapsisScaling_dRadius * (1.0 - eccentricity);
+    dQ_dOE[1] -= sum * periapsisScaling_dRadius * semiMajorAxis;
+
+    return std::make_tuple(Q, dQ_dOE, maximalCOE);
 }
 
 Tuple<double, double> QLaw::computeEffectivity(
@@ -0,0 +1,527 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/AngularCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/DifferentialCorrector.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::astro::eventcondition::AngularCondition;
+using ostk::astro::utilities::ParallelFor;
+
+namespace
+{
+
+/// @brief Maximum number of step halvings before an iteration is considered stalled
+static const Size MaximumStepHalvingCount = 5;
+
+/// @brief Result of the solve of the sequence generated for a control vector
+struct Evaluation
+{
+    State initialState;
+    Sequence::Solution sequenceSolution;
+    VectorXd residuals;        // Residuals, unscaled.
+    VectorXd scaledResiduals;  // Residuals divided by their tolerances.
+};
+
+/// @brief Locate the controlled coordinate of a control variable in the coordinates of a state
+Index LocateCoordinate(const State& aState, const DifferentialCorrector::ControlVariable& aControlVariable)
+{
+    Index offset = 0;
+
+    for (const Shared<const CoordinatesSubset>& subsetSPtr : aState.accessCoordinatesBroker()->accessSubsets())
+    {
+        if (*subsetSPtr == *aControlVariable.coordinatesSubset)
+        {
+            return offset + aControlVariable.coordinateIndex;
+        }
+
+        offset += subsetSPtr->getSize();
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Coordinates subset [{}] is not in the initial state.", aControlVariable.coordinatesSubset->getName()
+    );
+}
+
+}  // namespace
+
+DifferentialCorrector::ControlVariable::ControlVariable(
+    const String& aName,
+    const Real& anInitialValue,
+    const Real& aPerturbation,
+    const Real& aLowerBound,
+    const Real& anUpperBound,
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr,
+    const Index& aCoordinateIndex
+)
+    : name(aName),
+      initialValue(anInitialValue),
+      perturbation(aPerturbation),
+      lowerBound(aLowerBound),
+      upperBound(anUpperBound),
+      coordinatesSubset(aCoordinatesSubsetSPtr),
+      coordinateIndex(aCoordinateIndex)
+{
+    if ((coordinatesSubset == nullptr) && (!initialValue.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Initial value");
+    }
+
+    if ((coordinatesSubset != nullptr) && (coordinateIndex >= coordinatesSubset->getSize()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Coordinate index [{}] is out of the bounds of subset [{}].", coordinateIndex, coordinatesSubset->getName()
+        );
+    }
+
+    if ((!perturbation.isDefined()) || (perturbation <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Perturbation");
+    }
+
+    if (lowerBound.isDefined() && upperBound.isDefined() && (lowerBound > upperBound))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Lower bound [{}] is greater than upper bound [{}].", lowerBound.toString(), upperBound.toString()
+        );
+    }
+}
+
+DifferentialCorrector::ControlVariable DifferentialCorrector::ControlVariable::Parameter(
+    const String& aName,
+    const Real& anInitialValue,
+    const Real& aPerturbation,
+    const Real& aLowerBound,
+    const Real& anUpperBound
+)
+{
+    return {aName, anInitialValue, aPerturbation, aLowerBound, anUpperBound};
+}
+
+DifferentialCorrector::ControlVariable DifferentialCorrector::ControlVariable::InitialStateCoordinate(
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr,
+    const Index& aCoordinateIndex,
+    const Real& aPerturbation,
+    const Real& aLowerBound,
+    const Real& anUpperBound
+)
+{
+    if (aCoordinatesSubsetSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Coordinates subset");
+    }
+
+    return {
+        String::Format("{} [{}]", aCoordinatesSubsetSPtr->getName(), aCoordinateIndex),
+        Real::Undefined(),
+        aPerturbation,
+        aLowerBound,
+        anUpperBound,
+        aCoordinatesSubsetSPtr,
+        aCoordinateIndex,
+    };
+}
+
+bool DifferentialCorrector::ControlVariable::isInitialStateCoordinate() const
+{
+    return coordinatesSubset != nullptr;
+}
+
+DifferentialCorrector::Constraint::Constraint(
+    const Shared<const EventCondition>& anEventConditionSPtr, const Real& aTolerance
+)
+    : eventCondition(anEventConditionSPtr),
+      tolerance(aTolerance)
+{
+    if (eventCondition == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Event condition");
+    }
+
+    if ((!tolerance.isDefined()) || (tolerance <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+}
+
+Real DifferentialCorrector::Constraint::evaluate(const State& anInitialState, const State& aFinalState) const
+{
+    // The target is read rather than updated, as the event condition may be shared with concurrent solves
+
+    const std::function<Real(const State&)> evaluator = eventCondition->getEvaluator();
+    const EventCondition::Target target = eventCondition->getTarget();
+
+    const Real targetValue = (target.type == EventCondition::Target::Type::Relative)
+                               ? target.value + evaluator(anInitialState)
+                               : target.value;
+
+    const Real residual = evaluator(aFinalState) - targetValue;
+
+    if (std::dynamic_pointer_cast<const AngularCondition>(eventCondition) != nullptr)
+    {
+        return std::fmod(std::fmod(residual + Real::Pi(), Real::TwoPi()) + Real::TwoPi(), Real::TwoPi()) - Real::Pi();
+    }
+
+    return residual;
+}
+
+void DifferentialCorrector::Solution::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Differential Corrector Solution");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Has converged:" << (this->hasConverged ? "True" : "False");
+    ostk::core::utils::Print::Line(anOutputStream) << "Iteration count:" << this->iterationCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Jacobian evaluation count:" << this->jacobianEvaluationCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Sequence solve count:" << this->sequenceSolveCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Control vector:" << this->controlVector.transpose();
+    ostk::core::utils::Print::Line(anOutputStream) << "Residuals:" << this->residuals.transpose();
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const DifferentialCorrector::Solution& aSolution)
+{
+    aSolution.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+DifferentialCorrector::DifferentialCorrector(
+    const Method& aMethod, const Size& aMaximumIterationCount, const Size& aThreadCount
+)
+    : method_(aMethod),
+      maximumIterationCount_(aMaximumIterationCount),
+      threadCount_(aThreadCount)
+{
+    if (maximumIterationCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum iteration count");
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const DifferentialCorrector& aDifferentialCorrector)
+{
+    aDifferentialCorrector.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+DifferentialCorrector::Method DifferentialCorrector::getMethod() const
+{
+    return method_;
+}
+
+Size DifferentialCorrector::getMaximumIterationCount() const
+{
+    return maximumIterationCount_;
+}
+
+Size DifferentialCorrector::getThreadCount() const
+{
+    return threadCount_;
+}
+
+DifferentialCorrector::Solution DifferentialCorrector::solve(
+    const State& anInitialState,
+    const SequenceGenerator& aSequenceGenerator,
+    const Array<ControlVariable>& aControlVariableArray,
+    const Array<Constraint>& aConstraintArray
+) const
+{
+    if (!anInitialState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Initial state");
+    }
+
+    if (!aSequenceGenerator)
+    {
+        throw ostk::core::error::runtime::Undefined("Sequence generator");
+    }
+
+    if (aControlVariableArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Control variables");
+    }
+
+    if (aConstraintArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Constraints");
+    }
+
+    const Size controlCount = aControlVariableArray.getSize();
+    const Size constraintCount = aConstraintArray.getSize();
+
+    // Initial control vector, and offsets of the controlled initial state coordinates
+
+    VectorXd initialControlVector(controlCount);
+    Array<Index> coordinateOffsets(controlCount, 0);
+
+    for (Index i = 0; i < controlCount; ++i)
+    {
+        const ControlVariable& controlVariable = aControlVariableArray[i];
+
+        if (controlVariable.isInitialStateCoordinate())
+        {
+            coordinateOffsets[i] = LocateCoordinate(anInitialState, controlVariable);
+            initialControlVector(i) = anInitialState.getCoordinates()(coordinateOffsets[i]);
+        }
+        else
+        {
+            initialControlVector(i) = controlVariable.initialValue;
+        }
+    }
+
+    const auto clamp = [&aControlVariableArray, controlCount](const VectorXd& aControlVector) -> VectorXd
+    {
+        VectorXd controlVector = aControlVector;
+
+        for (Index i = 0; i < controlCount; ++i)
+        {
+            const ControlVariable& controlVariable = aControlVariableArray[i];
+
+            if (controlVariable.lowerBound.isDefined())
+            {
+                controlVector(i) = std::max<double>(controlVector(i), controlVariable.lowerBound);
+            }
+
+            if (controlVariable.upperBound.isDefined())
+            {
+                controlVector(i) = std::min<double>(controlVector(i), controlVariable.upperBound);
+            }
+        }
+
+        return controlVector;
+    };
+
+    std::atomic<Size> sequenceSolveCount = {0};
+
+    const auto evaluate = [&](const VectorXd& aControlVector) -> Evaluation
+    {
+        VectorXd coordinates = anInitialState.getCoordinates();
+
+        for (Index i = 0; i < controlCount; ++i)
+        {
+            if (aControlVariableArray[i].isInitialStateCoordinate())
+            {
+                coordinates(coordinateOffsets[i]) = aControlVector(i);
+            }
+        }
+
+        const State initialState = {
+            anInitialState.accessInstant(),
+            coordinates,
+            anInitialState.accessFrame(),
+            anInitialState.accessCoordinatesBroker(),
+        };
+
+        const Sequence sequence = aSequenceGenerator(aControlVector);
+
+        ++sequenceSolveCount;
+
+        const Sequence::Solution sequenceSolution = sequence.solve(initialState);
+
+        if (!sequenceSolution.executionIsComplete)
+        {
+            throw ostk::core::error::RuntimeError("Sequence did not execute completely.");
+        }
+
+        const State finalState = sequenceSolution.segmentSolutions.accessLast().states.accessLast();
+
+        VectorXd residuals(constraintCount);
+        VectorXd scaledResiduals(constraintCount);
+
+        for (Index i = 0; i < constraintCount; ++i)
+        {
+            residuals(i) = aConstraintArray[i].evaluate(initialState, finalState);
+            scaledResiduals(i) = residuals(i) / aConstraintArray[i].tolerance;
+        }
+
+        return {initialState, sequenceSolution, residuals, scaledResiduals};
+    };
+
+    // Forward difference Jacobian of the scaled residuals, one perturbed sequence per control
+
+    const auto computeJacobian = [&](const VectorXd& aControlVector, const VectorXd& aScaledResiduals) -> MatrixXd
+    {
+        MatrixXd jacobian(constraintCount, controlCount);
+
+        const auto computeColumn = [&](const Index& aControlIndex) -> void
+        {
+            const ControlVariable& controlVariable = aControlVariableArray[aControlIndex];
+
+            // Perturb away from the upper bound
+
+            Real perturbation = controlVariable.perturbation;
+
+            if (controlVariable.upperBound.isDefined() &&
+                (aControlVector(aControlIndex) + perturbation > controlVariable.upperBound))
+            {
+                perturbation = -perturbation;
+            }
+
+            VectorXd perturbedControlVector = aControlVector;
+            perturbedControlVector(aControlIndex) += perturbation;
+
+            jacobian.col(aControlIndex) =
+                (evaluate(perturbedControlVector).scaledResiduals - aScaledResiduals) / perturbation;
+        };
+
+        ParallelFor(controlCount, threadCount_, computeColumn);
+
+        return jacobian;
+    };
+
+    const auto hasConverged = [](const Evaluation& anEvaluation) -> bool
+    {
+        return anEvaluation.scaledResiduals.lpNorm<Eigen::Infinity>() <= 1.0;
+    };
+
+    // Iterations
+
+    VectorXd controlVector = clamp(initialControlVector);
+    Evaluation evaluation = evaluate(controlVector);
+
+    MatrixXd jacobian;
+    bool jacobianIsCurrent = false;  // False if the Jacobian must be computed at the current control vector
+    bool jacobianIsFresh = false;    // True if the Jacobian was computed by finite differences at this iteration
+    Size jacobianEvaluationCount = 0;
+    Size iterationCount = 0;
+
+    while ((!hasConverged(evaluation)) && (iterationCount < maximumIterationCount_))
+    {
+        ++iterationCount;
+
+        if (!jacobianIsCurrent)
+        {
+            jacobian = computeJacobian(controlVector, evaluation.scaledResiduals);
+            jacobianIsCurrent = true;
+            jacobianIsFresh = true;
+            ++jacobianEvaluationCount;
+        }
+
+        // Minimum-norm least squares step. A step along a finite difference Jacobian is halved until the residuals
+        // decrease, while a step along an updated Jacobian is only tried once before recomputing it.
+
+        const VectorXd step = jacobian.completeOrthogonalDecomposition().solve(-evaluation.scaledResiduals);
+
+        const double residualNorm = evaluation.scaledResiduals.norm();
+        const Size halvingLimit = jacobianIsFresh ? MaximumStepHalvingCount : 0;
+
+        bool stepIsAccepted = false;
+        VectorXd nextControlVector = controlVector;
+
+        for (Size halvingCount = 0; (!stepIsAccepted) && (halvingCount <= halvingLimit); ++halvingCount)
+        {
+            nextControlVector = clamp(controlVector + std::ldexp(1.0, -int(halvingCount)) * step);
+
+            try
+            {
+                const Evaluation nextEvaluation = evaluate(nextControlVector);
+
+                if (nextEvaluation.scaledResiduals.norm() < residualNorm)
+                {
+                    if (method_ == Method::Broyden)
+                    {
+                        // Rank-one update along the step actually taken
+
+                        const VectorXd controlStep = nextControlVector - controlVector;
+                        const VectorXd residualStep = nextEvaluation.scaledResiduals - evaluation.scaledResiduals;
+
+                        jacobian += ((residualStep - jacobian * controlStep) * controlStep.transpose()) /
+                                    controlStep.squaredNorm();
+                    }
+
+                    evaluation = nextEvaluation;
+                    stepIsAccepted = true;
+                }
+            }
+            catch (const ostk::core::error::RuntimeError&)
+            {
+                // The step left the domain over which the sequence executes completely
+            }
+        }
+
+        if (stepIsAccepted)
+        {
+            controlVector = nextControlVector;
+            jacobianIsCurrent = (method_ == Method::Broyden);
+            jacobianIsFresh = false;
+        }
+        else if (jacobianIsFresh)
+        {
+            // No step along a finite difference Jacobian decreases the residuals: the iterations stalled
+
+            break;
+        }
+        else
+        {
+            jacobianIsCurrent = false;
+        }
+    }
+
+    return {
+        hasConverged(evaluation),
+        iterationCount,
+        jacobianEvaluationCount,
+        sequenceSolveCount.load(),
+        controlVector,
+        evaluation.residuals,
+        evaluation.initialState,
+        evaluation.sequenceSolution,
+    };
+}
+
+void DifferentialCorrector::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Differential Corrector");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Method:" << DifferentialCorrector::StringFromMethod(method_);
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum iteration count:" << maximumIterationCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Thread count:" << threadCount_;
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+String DifferentialCorrector::StringFromMethod(const Method& aMethod)
+{
+    switch (aMethod)
+    {
+        case Method::Newton:
+            return "Newton";
+
+        case Method::Broyden:
+            return "Broyden";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Method");
+    }
+}
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
@@ -1,9 +1,13 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <complex>
+
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Solvers/FiniteDifferenceSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
 
 namespace ostk
 {
@@ -18,13 +22,26 @@ using ostk::core::types::Index;
 using ostk::physics::time::Duration;
 
 using ostk::astro::trajectory::StateBuilder;
+using ostk::astro::utilities::ParallelFor;
+
+namespace
+{
+
+// Complex-step size relative to the coordinate magnitude: there is no subtraction, the step only has to avoid underflow
+static const Real ComplexStepRelativeSize = 1e-20;
+
+}  // namespace
 
 FiniteDifferenceSolver::FiniteDifferenceSolver(
-    const FiniteDifferenceSolver::Type& aType, const Real& aStepPercentage, const Duration& aStepDuration
+    const FiniteDifferenceSolver::Type& aType,
+    const Real& aStepPercentage,
+    const Duration& aStepDuration,
+    const Size& aThreadCount
 )
     : type_(aType),
       stepPercentage_(aStepPercentage),
-      stepDuration_(aStepDuration)
+      stepDuration_(aStepDuration),
+      threadCount_(aThreadCount)
 {
 }
 
@@ -50,6 +67,11 @@ Duration FiniteDifferenceSolver::getStepDuration() const
     return stepDuration_;
 }
 
+Size FiniteDifferenceSolver::getThreadCount() const
+{
+    return threadCount_;
+}
+
 MatrixXd FiniteDifferenceSolver::computeJacobian(
     const State& aState,
     const Array<Instant>& anInstantArray,
@@ -57,94 +79,91 @@ MatrixXd FiniteDifferenceSolver::computeJacobian(
     const Size& aCoordinatesDimension
 ) const
 {
+    if ((type_ != FiniteDifferenceSolver::Type::Forward) && (type_ != FiniteDifferenceSolver::Type::Backward) &&
+        (type_ != FiniteDifferenceSolver::Type::Central))
+    {
+        throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
+    }
+
     const StateBuilder stateBuilder = {aState};
 
+    const Instant& instant = aState.accessInstant();
+    const VectorXd& coordinates = aState.accessCoordinates();
+
     const Size stateVectorDimension = aState.getSize();
     const Size numberOfInstants = anInstantArray.getSize();
 
-    std::function<MatrixXd(const Real&, VectorXd, const Index&)> computeBlock;
+    // The unperturbed coordinates are shared by all the columns of the one-sided schemes
 
-    switch (type_)
+    const MatrixXd nominalCoordinates =
+        (type_ != FiniteDifferenceSolver::Type::Central)
+            ? generateStateCoordinates(stateBuilder.build(instant, coordinates), anInstantArray)
+            : MatrixXd();
+
+    MatrixXd A = MatrixXd::Zero(aCoordinatesDimension * numberOfInstants, stateVectorDimension);
+
+    const auto computeColumn = [&](const Index& anIndex) -> void
     {
-        case FiniteDifferenceSolver::Type::Forward:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
-            {
-                const MatrixXd coordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+        // Each column builds its perturbed states from its own copy of the builder
 
-                aCoordinateVector(anIndex) += aStepSize;
-                const MatrixXd forwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+        const StateBuilder columnStateBuilder = stateBuilder;
 
-                const MatrixXd differencedCoordinates = (forwardCoordinates - coordinates) / aStepSize;
+        const Real stepSize =
+            (coordinates(anIndex) * stepPercentage_ != 0.0) ? coordinates(anIndex) * stepPercentage_ : stepPercentage_;
 
-                return differencedCoordinates;
-            };
-            break;
+        VectorXd perturbedCoordinates = coordinates;
+        MatrixXd differencedCoordinates;
 
-        case FiniteDifferenceSolver::Type::Backward:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
+        switch (type_)
+        {
+            case FiniteDifferenceSolver::Type::Forward:
             {
-                const MatrixXd coordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+                perturbedCoordinates(anIndex) += stepSize;
+                const MatrixXd forwardCoordinates = generateStateCoordinates(
+                    columnStateBuilder.build(instant, perturbedCoordinates), anInstantArray
+                );
 
-                aCoordinateVector(anIndex) -= aStepSize;
-                const MatrixXd backwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+                differencedCoordinates = (forwardCoordinates - nominalCoordinates) / stepSize;
+                break;
+            }
 
-                const MatrixXd differencedCoordinates = (coordinates - backwardCoordinates) / aStepSize;
+            case FiniteDifferenceSolver::Type::Backward:
+            {
+                perturbedCoordinates(anIndex) -= stepSize;
+                const MatrixXd backwardCoordinates = generateStateCoordinates(
+                    columnStateBuilder.build(instant, perturbedCoordinates), anInstantArray
+                );
 
-                return differencedCoordinates;
-            };
-            break;
+                differencedCoordinates = (nominalCoordinates - backwardCoordinates) / stepSize;
+                break;
+            }
 
-        case FiniteDifferenceSolver::Type::Central:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
+            case FiniteDifferenceSolver::Type::Central:
             {
                 // Perturb state forward
-                aCoordinateVector(anIndex) += aStepSize;
-                const MatrixXd forwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+                perturbedCoordinates(anIndex) += stepSize;
+                const MatrixXd forwardCoordinates = generateStateCoordinates(
+                    columnStateBuilder.build(instant, perturbedCoordinates), anInstantArray
+                );
 
                 // Perturb state backward
-                aCoordinateVector(anIndex) -= 2.0 * aStepSize;
-                const MatrixXd backwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
-
-                const MatrixXd differencedCoordinates = (forwardCoordinates - backwardCoordinates) / (2.0 * aStepSize);
+                perturbedCoordinates(anIndex) -= 2.0 * stepSize;
+                const MatrixXd backwardCoordinates = generateStateCoordinates(
+                    columnStateBuilder.build(instant, perturbedCoordinates), anInstantArray
+                );
 
-                return differencedCoordinates;
-            };
-            break;
+                differencedCoordinates = (forwardCoordinates - backwardCoordinates) / (2.0 * stepSize);
+                break;
+            }
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
-    }
-
-    MatrixXd A = MatrixXd::Zero(aCoordinatesDimension * numberOfInstants, stateVectorDimension);
-
-    for (Index i = 0; i < stateVectorDimension; ++i)
-    {
-        const Real stepSize = (aState.accessCoordinates()(i) * stepPercentage_ != 0.0)
-                                ? aState.accessCoordinates()(i) * stepPercentage_
-                                : stepPercentage_;
-
-        MatrixXd differencedCoordinates = computeBlock(stepSize, aState.getCoordinates(), i);
+            default:
+                throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
+        }
 
-        const VectorXd columnStackedCoordinates =
-            Eigen::Map<VectorXd>(differencedCoordinates.data(), differencedCoordinates.size());
+        A.col(anIndex) = Eigen::Map<const VectorXd>(differencedCoordinates.data(), differencedCoordinates.size());
+    };
 
-        A.col(i) = columnStackedCoordinates;
-    }
+    ParallelFor(stateVectorDimension, threadCount_, computeColumn);
 
     return A;
 }
@@ -170,6 +189,38 @@ MatrixXd FiniteDifferenceSolver::computeJacobian(
     return computeJacobian(aState, {anInstant}, generateStatesCoordinates, aCoordinatesDimension);
 }
 
+MatrixXd FiniteDifferenceSolver::computeComplexStepJacobian(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const std::function<MatrixXcd(const VectorXcd&, const Array<Instant>&)>& generateStateCoordinates,
+    const Size& aCoordinatesDimension
+) const
+{
+    const VectorXd& coordinates = aState.accessCoordinates();
+
+    const Size stateVectorDimension = aState.getSize();
+    const Size numberOfInstants = anInstantArray.getSize();
+
+    MatrixXd A = MatrixXd::Zero(aCoordinatesDimension * numberOfInstants, stateVectorDimension);
+
+    const auto computeColumn = [&](const Index& anIndex) -> void
+    {
+        const Real stepSize = ComplexStepRelativeSize * std::max(1.0, std::abs(coordinates(anIndex)));
+
+        VectorXcd perturbedCoordinates = coordinates.cast<std::complex<double>>();
+        perturbedCoordinates(anIndex) += std::complex<double>(0.0, stepSize);
+
+        const MatrixXd differencedCoordinates =
+            generateStateCoordinates(perturbedCoordinates, anInstantArray).imag() / stepSize;
+
+        A.col(anIndex) = Eigen::Map<const VectorXd>(differencedCoordinates.data(), differencedCoordinates.size());
+    };
+
+    ParallelFor(stateVectorDimension, threadCount_, computeColumn);
+
+    return A;
+}
+
 VectorXd FiniteDifferenceSolver::computeGradient(
     const State& aState, const std::function<VectorXd(const State&, const Instant&)>& generateStateCoordinates
 ) const
@@ -224,6 +275,7 @@ void FiniteDifferenceSolver::print(std::ostream& anOutputStream, bool displayDec
     }
 
     ostk::core::utils::Print::Line(anOutputStream) << "Type: " << FiniteDifferenceSolver::StringFromType(type_);
+    ostk::core::utils::Print::Line(anOutputStream) << "Thread count: " << threadCount_;
 
     if (displayDecorator)
     {
@@ -0,0 +1,868 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+
+#include <boost/log/trivial.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/MonteCarloSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::physics::units::Mass;
+
+using ostk::astro::flight::system::PropulsionSystem;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+
+using ostk::astro::utilities::ParallelFor;
+
+namespace
+{
+
+/// @brief Random stream of a sample, seeded from the solver seed and the sample index
+///
+/// Draws are computed from the raw output of the engine, rather than with the standard distributions whose algorithms
+/// are implementation defined, so that samples are reproducible across platforms.
+class SampleRandomStream
+{
+   public:
+    SampleRandomStream(const Size& aSeed, const Index& anIndex)
+        : engine_()
+    {
+        const std::uint64_t seed = aSeed;
+        const std::uint64_t index = anIndex;
+
+        std::seed_seq seedSequence{
+            static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32),
+            static_cast<std::uint32_t>(index),
+            static_cast<std::uint32_t>(index >> 32),
+        };
+
+        engine_.seed(seedSequence);
+    }
+
+    /// @brief Draw from the uniform distribution over [0, 1)
+    double drawUniform()
+    {
+        return static_cast<double>(engine_() >> 11) * 0x1.0p-53;
+    }
+
+    /// @brief Draw from a distribution: standard normal (Box-Muller), or uniform over [-1, 1]
+    double draw(const MonteCarloSolver::Distribution& aDistribution)
+    {
+        switch (aDistribution)
+        {
+            case MonteCarloSolver::Distribution::Normal:
+            {
+                const double radius = std::sqrt(-2.0 * std::log(1.0 - this->drawUniform()));
+                const double angle = 2.0 * M_PI * this->drawUniform();
+
+                return radius * std::cos(angle);
+            }
+
+            case MonteCarloSolver::Distribution::Uniform:
+                return 2.0 * this->drawUniform() - 1.0;
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Distribution");
+        }
+    }
+
+   private:
+    std::mt19937_64 engine_;
+};
+
+/// @brief Streaming estimate of a percentile, with the P-square algorithm (Jain and Chlamtac, 1985)
+///
+/// Five markers track the minimum, the percentile, the maximum and two intermediate quantiles, and are adjusted with
+/// piecewise parabolic interpolation as observations come in. The estimate is exact up to five observations.
+class PercentileEstimator
+{
+   public:
+    PercentileEstimator(const double& aProbability)
+        : probability_(aProbability),
+          count_(0)
+    {
+        increments_ = {0.0, probability_ / 2.0, probability_, (1.0 + probability_) / 2.0, 1.0};
+        desiredPositions_ = {1.0, 1.0 + 2.0 * probability_, 1.0 + 4.0 * probability_, 3.0 + 2.0 * probability_, 5.0};
+        positions_ = {1.0, 2.0, 3.0, 4.0, 5.0};
+    }
+
+    void add(const double& aValue)
+    {
+        if (count_ < 5)
+        {
+            heights_[count_++] = aValue;
+
+            if (count_ == 5)
+            {
+                std::sort(heights_.begin(), heights_.end());
+            }
+
+            return;
+        }
+
+        ++count_;
+
+        Size k = 0;
+
+        if (aValue < heights_[0])
+        {
+            heights_[0] = aValue;
+        }
+        else if (aValue >= heights_[4])
+        {
+            heights_[4] = aValue;
+            k = 3;
+        }
+        else
+        {
+            while (aValue >= heights_[k + 1])
+            {
+                ++k;
+            }
+        }
+
+        for (Size i = k + 1; i < 5; ++i)
+        {
+            positions_[i] += 1.0;
+        }
+
+        for (Size i = 0; i < 5; ++i)
+        {
+            desiredPositions_[i] += increments_[i];
+        }
+
+        for (Size i = 1; i < 4; ++i)
+        {
+            const double offset = desiredPositions_[i] - positions_[i];
+
+            if (((offset >= 1.0) && ((positions_[i + 1] - positions_[i]) > 1.0)) ||
+                ((offset <= -1.0) && ((positions_[i - 1] - positions_[i]) < -1.0)))
+            {
+                const double sign = (offset >= 0.0) ? 1.0 : -1.0;
+
+                const double parabolicHeight =
+                    heights_[i] + sign / (positions_[i + 1] - positions_[i - 1]) *
+                                      ((positions_[i] - positions_[i - 1] + sign) * (heights_[i + 1] - heights_[i]) /
+                                           (positions_[i + 1] - positions_[i]) +
+                                       (positions_[i + 1] - positions_[i] - sign) * (heights_[i] - heights_[i - 1]) /
+                                           (positions_[i] - positions_[i - 1]));
+
+                if ((heights_[i - 1] < parabolicHeight) && (parabolicHeight < heights_[i + 1]))
+                {
+                    heights_[i] = parabolicHeight;
+                }
+                else
+                {
+                    const Size j = (sign > 0.0) ? (i + 1) : (i - 1);
+
+                    heights_[i] += sign * (heights_[j] - heights_[i]) / (positions_[j] - positions_[i]);
+                }
+
+                positions_[i] += sign;
+            }
+        }
+    }
+
+    double getEstimate() const
+    {
+        if (count_ == 0)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        if (count_ >= 5)
+        {
+            return heights_[2];
+        }
+
+        // Linear interpolation between the sorted observations
+
+        std::array<double, 5> sortedHeights = heights_;
+        std::sort(sortedHeights.begin(), sortedHeights.begin() + count_);
+
+        const double position = probability_ * static_cast<double>(count_ - 1);
+        const Size lowerIndex = static_cast<Size>(std::floor(position));
+        const Size upperIndex = std::min(lowerIndex + 1, count_ - 1);
+
+        return sortedHeights[lowerIndex] +
+               (position - static_cast<double>(lowerIndex)) * (sortedHeights[upperIndex] - sortedHeights[lowerIndex]);
+    }
+
+   private:
+    double probability_;
+    Size count_;
+    std::array<double, 5> heights_;
+    std::array<double, 5> positions_;
+    std::array<double, 5> desiredPositions_;
+    std::array<double, 5> increments_;
+};
+
+/// @brief Streaming mean, covariance (Welford) and percentiles of a vector quantity
+class StatisticsAccumulator
+{
+   public:
+    StatisticsAccumulator(const Array<Real>& aPercentileArray)
+        : percentiles_(aPercentileArray),
+          count_(0),
+          mean_(),
+          comoment_(),
+          percentileEstimators_()
+    {
+    }
+
+    void add(const VectorXd& aValue)
+    {
+        if (count_ == 0)
+        {
+            mean_ = VectorXd::Zero(aValue.size());
+            comoment_ = MatrixXd::Zero(aValue.size(), aValue.size());
+
+            for (Index i = 0; i < Size(aValue.size()); ++i)
+            {
+                for (const Real& percentile : percentiles_)
+                {
+                    percentileEstimators_.add(PercentileEstimator(percentile / 100.0));
+                }
+            }
+        }
+        else if (aValue.size() != mean_.size())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Value dimension [{}] differs from the one of the first sample [{}].", aValue.size(), mean_.size()
+            );
+        }
+
+        ++count_;
+
+        const VectorXd delta = aValue - mean_;
+
+        mean_ += delta / static_cast<double>(count_);
+        comoment_ += delta * (aValue - mean_).transpose();
+
+        for (Index i = 0; i < Size(aValue.size()); ++i)
+        {
+            for (Index j = 0; j < percentiles_.getSize(); ++j)
+            {
+                percentileEstimators_[i * percentiles_.getSize() + j].add(aValue(i));
+            }
+        }
+    }
+
+    MonteCarloSolver::Statistics getStatistics() const
+    {
+        const Size dimension = mean_.size();
+
+        MatrixXd covariance = MatrixXd::Zero(dimension, dimension);
+
+        if (count_ > 1)
+        {
+            covariance = comoment_ / static_cast<double>(count_ - 1);
+        }
+
+        MatrixXd percentiles = MatrixXd::Zero(percentiles_.getSize(), dimension);
+
+        for (Index i = 0; i < dimension; ++i)
+        {
+            for (Index j = 0; j < percentiles_.getSize(); ++j)
+            {
+                percentiles(j, i) = percentileEstimators_[i * percentiles_.getSize() + j].getEstimate();
+            }
+        }
+
+        return {mean_, covariance, percentiles};
+    }
+
+   private:
+    Array<Real> percentiles_;
+    Size count_;
+    VectorXd mean_;
+    MatrixXd comoment_;
+    Array<PercentileEstimator> percentileEstimators_;
+};
+
+/// @brief Result of a sample, aggregated in sample order
+struct SampleResult
+{
+    enum class Status
+    {
+        Complete,
+        Incomplete,
+        Failed
+    };
+
+    Status status;
+    VectorXd finalCoordinates;
+    Real deltaV;
+    Real propagationDuration;
+};
+
+/// @brief Locate a coordinates subset in a coordinates broker
+Index LocateSubset(
+    const Shared<const CoordinatesBroker>& aCoordinatesBrokerSPtr,
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr
+)
+{
+    Index offset = 0;
+
+    for (const Shared<const CoordinatesSubset>& subsetSPtr : aCoordinatesBrokerSPtr->accessSubsets())
+    {
+        if (*subsetSPtr == *aCoordinatesSubsetSPtr)
+        {
+            return offset;
+        }
+
+        offset += subsetSPtr->getSize();
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Coordinates subset [{}] is not in the nominal state.", aCoordinatesSubsetSPtr->getName()
+    );
+}
+
+}  // namespace
+
+MonteCarloSolver::StateDispersion::StateDispersion(
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr,
+    const Distribution& aDistribution,
+    const MatrixXd& aScaleMatrix
+)
+    : coordinatesSubset(aCoordinatesSubsetSPtr),
+      distribution(aDistribution),
+      scaleMatrix(aScaleMatrix)
+{
+    if (coordinatesSubset == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Coordinates subset");
+    }
+
+    if ((scaleMatrix.rows() != scaleMatrix.cols()) || (Size(scaleMatrix.rows()) != coordinatesSubset->getSize()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Scale matrix dimension [{}x{}] does not match coordinates subset [{}] size [{}].",
+            scaleMatrix.rows(),
+            scaleMatrix.cols(),
+            coordinatesSubset->getName(),
+            coordinatesSubset->getSize()
+        );
+    }
+
+    if (!scaleMatrix.allFinite())
+    {
+        throw ostk::core::error::RuntimeError("Scale matrix is not finite.");
+    }
+}
+
+MonteCarloSolver::StateDispersion MonteCarloSolver::StateDispersion::Normal(
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const VectorXd& aStandardDeviationVector
+)
+{
+    return {aCoordinatesSubsetSPtr, Distribution::Normal, MatrixXd(aStandardDeviationVector.asDiagonal())};
+}
+
+MonteCarloSolver::StateDispersion MonteCarloSolver::StateDispersion::Covariance(
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const MatrixXd& aCovarianceMatrix
+)
+{
+    const Eigen::LLT<MatrixXd> cholesky = aCovarianceMatrix.llt();
+
+    if (cholesky.info() != Eigen::Success)
+    {
+        throw ostk::core::error::RuntimeError("Covariance matrix is not symmetric positive definite.");
+    }
+
+    return {aCoordinatesSubsetSPtr, Distribution::Normal, MatrixXd(cholesky.matrixL())};
+}
+
+MonteCarloSolver::StateDispersion MonteCarloSolver::StateDispersion::Uniform(
+    const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr, const VectorXd& aHalfWidthVector
+)
+{
+    return {aCoordinatesSubsetSPtr, Distribution::Uniform, MatrixXd(aHalfWidthVector.asDiagonal())};
+}
+
+MonteCarloSolver::SatelliteSystemDispersion::SatelliteSystemDispersion(
+    const Parameter& aParameter, const Distribution& aDistribution, const Real& aScale
+)
+    : parameter(aParameter),
+      distribution(aDistribution),
+      scale(aScale)
+{
+    if (!scale.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Scale");
+    }
+
+    if (scale < 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Scale [{}] is negative.", scale);
+    }
+}
+
+MonteCarloSolver::SatelliteSystemDispersion MonteCarloSolver::SatelliteSystemDispersion::Normal(
+    const Parameter& aParameter, const Real& aStandardDeviation
+)
+{
+    return {aParameter, Distribution::Normal, aStandardDeviation};
+}
+
+MonteCarloSolver::SatelliteSystemDispersion MonteCarloSolver::SatelliteSystemDispersion::Uniform(
+    const Parameter& aParameter, const Real& aHalfWidth
+)
+{
+    return {aParameter, Distribution::Uniform, aHalfWidth};
+}
+
+String MonteCarloSolver::SatelliteSystemDispersion::StringFromParameter(const Parameter& aParameter)
+{
+    switch (aParameter)
+    {
+        case Parameter::DryMass:
+            return "Dry Mass";
+
+        case Parameter::CrossSectionalSurfaceArea:
+            return "Cross-Sectional Surface Area";
+
+        case Parameter::DragCoefficient:
+            return "Drag Coefficient";
+
+        case Parameter::Thrust:
+            return "Thrust";
+
+        case Parameter::SpecificImpulse:
+            return "Specific Impulse";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Parameter");
+    }
+}
+
+void MonteCarloSolver::Solution::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Monte Carlo Solution");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Sample count:" << this->sampleCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Complete sample count:" << this->completeSampleCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Incomplete sample count:" << this->incompleteSampleCount;
+    ostk::core::utils::Print::Line(anOutputStream) << "Failed sample count:" << this->failedSampleCount;
+
+    const auto printStatistics = [&anOutputStream, this](const String& aName, const Statistics& aStatistics) -> void
+    {
+        ostk::core::utils::Print::Separator(anOutputStream, aName);
+
+        if (aStatistics.mean.size() == 0)
+        {
+            ostk::core::utils::Print::Line(anOutputStream) << "Undefined";
+            return;
+        }
+
+        ostk::core::utils::Print::Line(anOutputStream) << "Mean:" << aStatistics.mean.transpose();
+        ostk::core::utils::Print::Line(anOutputStream)
+            << "Standard deviation:" << aStatistics.covariance.diagonal().cwiseSqrt().transpose();
+
+        for (Index i = 0; i < this->percentiles.getSize(); ++i)
+        {
+            ostk::core::utils::Print::Line(anOutputStream)
+                << String::Format("Percentile {}:", this->percentiles[i].toString())
+                << aStatistics.percentiles.row(i);
+        }
+    };
+
+    printStatistics(String::Format("Final Coordinates [{}]", this->frame->getName()), this->finalCoordinates);
+    printStatistics("Delta-V [m/s]", this->deltaV);
+    printStatistics("Propagation Duration [s]", this->propagationDuration);
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const MonteCarloSolver::Solution& aSolution)
+{
+    aSolution.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+MonteCarloSolver::MonteCarloSolver(
+    const State& aNominalState,
+    const SatelliteSystem& aNominalSatelliteSystem,
+    const SequenceGenerator& aSequenceGenerator,
+    const Array<StateDispersion>& aStateDispersionArray,
+    const Array<SatelliteSystemDispersion>& aSatelliteSystemDispersionArray,
+    const Size& aSeed
+)
+    : nominalState_(aNominalState),
+      nominalSatelliteSystem_(aNominalSatelliteSystem),
+      sequenceGenerator_(aSequenceGenerator),
+      stateDispersions_(aStateDispersionArray),
+      satelliteSystemDispersions_(aSatelliteSystemDispersionArray),
+      seed_(aSeed)
+{
+    if (!nominalState_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Nominal state");
+    }
+
+    if (!sequenceGenerator_)
+    {
+        throw ostk::core::error::runtime::Undefined("Sequence generator");
+    }
+
+    for (const StateDispersion& stateDispersion : stateDispersions_)
+    {
+        LocateSubset(nominalState_.accessCoordinatesBroker(), stateDispersion.coordinatesSubset);
+    }
+
+    if (!satelliteSystemDispersions_.isEmpty() && !nominalSatelliteSystem_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Nominal satellite system");
+    }
+
+    for (const SatelliteSystemDispersion& satelliteSystemDispersion : satelliteSystemDispersions_)
+    {
+        const bool isPropulsionParameter =
+            (satelliteSystemDispersion.parameter == SatelliteSystemDispersion::Parameter::Thrust) ||
+            (satelliteSystemDispersion.parameter == SatelliteSystemDispersion::Parameter::SpecificImpulse);
+
+        if (isPropulsionParameter && !nominalSatelliteSystem_.accessPropulsionSystem().isDefined())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Cannot disperse [{}] without a propulsion system.",
+                SatelliteSystemDispersion::StringFromParameter(satelliteSystemDispersion.parameter)
+            );
+        }
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const MonteCarloSolver& aMonteCarloSolver)
+{
+    aMonteCarloSolver.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+State MonteCarloSolver::getNominalState() const
+{
+    return nominalState_;
+}
+
+SatelliteSystem MonteCarloSolver::getNominalSatelliteSystem() const
+{
+    return nominalSatelliteSystem_;
+}
+
+Array<MonteCarloSolver::StateDispersion> MonteCarloSolver::getStateDispersions() const
+{
+    return stateDispersions_;
+}
+
+Array<MonteCarloSolver::SatelliteSystemDispersion> MonteCarloSolver::getSatelliteSystemDispersions() const
+{
+    return satelliteSystemDispersions_;
+}
+
+Size MonteCarloSolver::getSeed() const
+{
+    return seed_;
+}
+
+MonteCarloSolver::Sample MonteCarloSolver::generateSample(const Index& anIndex) const
+{
+    SampleRandomStream randomStream = {seed_, anIndex};
+
+    // State dispersions
+
+    VectorXd coordinates = nominalState_.getCoordinates();
+
+    for (const StateDispersion& stateDispersion : stateDispersions_)
+    {
+        const Size size = stateDispersion.coordinatesSubset->getSize();
+
+        VectorXd draws(size);
+
+        for (Index i = 0; i < size; ++i)
+        {
+            draws(i) = randomStream.draw(stateDispersion.distribution);
+        }
+
+        const Index offset = LocateSubset(nominalState_.accessCoordinatesBroker(), stateDispersion.coordinatesSubset);
+
+        coordinates.segment(offset, size) += stateDispersion.scaleMatrix * draws;
+    }
+
+    // Satellite system dispersions
+
+    Real dryMass = Real::Undefined();
+    Real crossSectionalSurfaceArea = Real::Undefined();
+    Real dragCoefficient = Real::Undefined();
+    Real thrust = Real::Undefined();
+    Real specificImpulse = Real::Undefined();
+
+    if (nominalSatelliteSystem_.isDefined())
+    {
+        dryMass = nominalSatelliteSystem_.getMass().inKilograms();
+        crossSectionalSurfaceArea = nominalSatelliteSystem_.getCrossSectionalSurfaceArea();
+        dragCoefficient = nominalSatelliteSystem_.getDragCoefficient();
+
+        if (nominalSatelliteSystem_.accessPropulsionSystem().isDefined())
+        {
+            thrust = nominalSatelliteSystem_.accessPropulsionSystem().getThrust().getValue();
+            specificImpulse = nominalSatelliteSystem_.accessPropulsionSystem().getSpecificImpulse().getValue();
+        }
+    }
+
+    for (const SatelliteSystemDispersion& satelliteSystemDispersion : satelliteSystemDispersions_)
+    {
+        const Real dispersion =
+            satelliteSystemDispersion.scale * randomStream.draw(satelliteSystemDispersion.distribution);
+
+        switch (satelliteSystemDispersion.parameter)
+        {
+            case SatelliteSystemDispersion::Parameter::DryMass:
+                dryMass += dispersion;
+                break;
+
+            case SatelliteSystemDispersion::Parameter::CrossSectionalSurfaceArea:
+                crossSectionalSurfaceArea += dispersion;
+                break;
+
+            case SatelliteSystemDispersion::Parameter::DragCoefficient:
+                dragCoefficient += dispersion;
+                break;
+
+            case SatelliteSystemDispersion::Parameter::Thrust:
+                thrust += dispersion;
+                break;
+
+            case SatelliteSystemDispersion::Parameter::SpecificImpulse:
+                specificImpulse += dispersion;
+                break;
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Parameter");
+        }
+    }
+
+    const SatelliteSystem satelliteSystem =
+        satelliteSystemDispersions_.isEmpty()
+            ? nominalSatelliteSystem_
+            : SatelliteSystem(
+                  Mass::Kilograms(dryMass),
+                  nominalSatelliteSystem_.getGeometry(),
+                  nominalSatelliteSystem_.getInertiaTensor(),
+                  crossSectionalSurfaceArea,
+                  dragCoefficient,
+                  nominalSatelliteSystem_.accessPropulsionSystem().isDefined()
+                      ? PropulsionSystem(thrust, specificImpulse)
+                      : PropulsionSystem::Undefined()
+              );
+
+    return {
+        anIndex,
+        {nominalState_.accessInstant(),
+         coordinates,
+         nominalState_.accessFrame(),
+         nominalState_.accessCoordinatesBroker()},
+        satelliteSystem,
+    };
+}
+
+MonteCarloSolver::Solution MonteCarloSolver::solve(
+    const Size& aSampleCount,
+    const Size& aThreadCount,
+    const Array<Real>& aPercentileArray,
+    const Shared<const Frame>& aFrameSPtr
+) const
+{
+    if (aSampleCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Sample count");
+    }
+
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    for (const Real& percentile : aPercentileArray)
+    {
+        if ((!percentile.isDefined()) || (percentile <= 0.0) || (percentile >= 100.0))
+        {
+            throw ostk::core::error::RuntimeError("Percentile [{}] is not in (0, 100).", percentile.toString());
+        }
+    }
+
+    const auto solveSample = [this, &aFrameSPtr](const Index& anIndex) -> SampleResult
+    {
+        try
+        {
+            const Sample sample = this->generateSample(anIndex);
+
+            const Sequence sequence = sequenceGenerator_(sample.satelliteSystem);
+
+            const Sequence::Solution solution = sequence.solve(sample.state);
+
+            if (!solution.executionIsComplete)
+            {
+                return {SampleResult::Status::Incomplete, VectorXd(), Real::Undefined(), Real::Undefined()};
+            }
+
+            const PropulsionSystem& propulsionSystem = sample.satelliteSystem.accessPropulsionSystem();
+
+            const Real deltaV = (sample.satelliteSystem.isDefined() && propulsionSystem.isDefined())
+                                  ? solution.computeDeltaV(propulsionSystem.getSpecificImpulse().getValue())
+                                  : Real(0.0);
+
+            return {
+                SampleResult::Status::Complete,
+                solution.segmentSolutions.accessLast().states.accessLast().inFrame(aFrameSPtr).getCoordinates(),
+                deltaV,
+                solution.getPropagationDuration().inSeconds(),
+            };
+        }
+        catch (const std::exception& anException)
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Sample [" << anIndex << "] failed: " << anException.what() << std::endl;
+
+            return {SampleResult::Status::Failed, VectorXd(), Real::Undefined(), Real::Undefined()};
+        }
+    };
+
+    // Aggregation, in sample order
+
+    StatisticsAccumulator finalCoordinatesAccumulator = {aPercentileArray};
+    StatisticsAccumulator deltaVAccumulator = {aPercentileArray};
+    StatisticsAccumulator propagationDurationAccumulator = {aPercentileArray};
+
+    Size completeSampleCount = 0;
+    Size incompleteSampleCount = 0;
+    Size failedSampleCount = 0;
+
+    std::mutex aggregationMutex;
+    std::map<Index, SampleResult> pendingSampleResults;
+    Index nextAggregatedSampleIndex = 0;
+
+    const auto aggregate = [&](const Index& anIndex, SampleResult&& aSampleResult) -> void
+    {
+        const std::lock_guard<std::mutex> lock(aggregationMutex);
+
+        pendingSampleResults.emplace(anIndex, std::move(aSampleResult));
+
+        // Samples completed ahead of their predecessors wait for them
+
+        for (auto iterator = pendingSampleResults.find(nextAggregatedSampleIndex);
+             iterator != pendingSampleResults.end();
+             iterator = pendingSampleResults.find(nextAggregatedSampleIndex))
+        {
+            const SampleResult& sampleResult = iterator->second;
+
+            switch (sampleResult.status)
+            {
+                case SampleResult::Status::Complete:
+                {
+                    finalCoordinatesAccumulator.add(sampleResult.finalCoordinates);
+                    deltaVAccumulator.add((VectorXd(1) << sampleResult.deltaV).finished());
+                    propagationDurationAccumulator.add((VectorXd(1) << sampleResult.propagationDuration).finished());
+
+                    ++completeSampleCount;
+                    break;
+                }
+
+                case SampleResult::Status::Incomplete:
+                    ++incompleteSampleCount;
+                    break;
+
+                case SampleResult::Status::Failed:
+                    ++failedSampleCount;
+                    break;
+            }
+
+            pendingSampleResults.erase(iterator);
+            ++nextAggregatedSampleIndex;
+        }
+    };
+
+    ParallelFor(
+        aSampleCount,
+        aThreadCount,
+        [&solveSample, &aggregate](const Index& aSampleIndex) -> void
+        {
+            aggregate(aSampleIndex, solveSample(aSampleIndex));
+        }
+    );
+
+    return {
+        aSampleCount,
+        completeSampleCount,
+        incompleteSampleCount,
+        failedSampleCount,
+        aPercentileArray,
+        aFrameSPtr,
+        finalCoordinatesAccumulator.getStatistics(),
+        deltaVAccumulator.getStatistics(),
+        propagationDurationAccumulator.getStatistics(),
+    };
+}
+
+void MonteCarloSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Monte Carlo Solver");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Seed:" << seed_;
+
+    ostk::core::utils::Print::Separator(anOutputStream, "State Dispersions");
+
+    for (const StateDispersion& stateDispersion : stateDispersions_)
+    {
+        ostk::core::utils::Print::Line(anOutputStream)
+            << stateDispersion.coordinatesSubset->getName()
+            << ((stateDispersion.distribution == Distribution::Normal) ? "Normal" : "Uniform");
+    }
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Satellite System Dispersions");
+
+    for (const SatelliteSystemDispersion& satelliteSystemDispersion : satelliteSystemDispersions_)
+    {
+        ostk::core::utils::Print::Line(anOutputStream)
+            << SatelliteSystemDispersion::StringFromParameter(satelliteSystemDispersion.parameter)
+            << ((satelliteSystemDispersion.distribution == Distribution::Normal) ? "Normal" : "Uniform")
+            << satelliteSystemDispersion.scale.toString();
+    }
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
@@ -0,0 +1,352 @@
+/// Apache License 2.0
+
+#include <limits>
+
+#include <boost/log/trivial.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/QLawTradeStudy.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace solvers
+{
+
+using ostk::physics::coord::Frame;
+
+using ostk::astro::dynamics::Thruster;
+using ostk::astro::eventcondition::RealCondition;
+using ostk::astro::flight::system::PropulsionSystem;
+using ostk::astro::trajectory::Segment;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::utilities::ParallelFor;
+
+namespace
+{
+
+QLawTradeStudy::Result FailedResult(const Index& anIndex)
+{
+    return {
+        anIndex,
+        QLawTradeStudy::Status::Failed,
+        Duration::Undefined(),
+        Real::Undefined(),
+        Mass::Undefined(),
+        Vector5d::Constant(std::numeric_limits<double>::quiet_NaN()),
+        Array<State>::Empty(),
+    };
+}
+
+}  // namespace
+
+void QLawTradeStudy::Result::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "QLaw Trade Study Result");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Index:" << this->index;
+    ostk::core::utils::Print::Line(anOutputStream) << "Status:" << QLawTradeStudy::StringFromStatus(this->status);
+    ostk::core::utils::Print::Line(anOutputStream) << "Time of flight:" << this->timeOfFlight.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Delta-V [m/s]:" << this->deltaV.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Propellant mass:" << this->propellantMass.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Final elements error:" << this->finalElementsError.transpose();
+    ostk::core::utils::Print::Line(anOutputStream) << "Trajectory state count:" << this->trajectory.getSize();
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const QLawTradeStudy::Result& aResult)
+{
+    aResult.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+QLawTradeStudy::QLawTradeStudy(
+    const State& anInitialState,
+    const SatelliteSystem& aSatelliteSystem,
+    const Array<Shared<Dynamics>>& anEnvironmentDynamicsArray,
+    const NumericalSolver& aNumericalSolver,
+    const Derived& aGravitationalParameter,
+    const Duration& aMaximumTimeOfFlight,
+    const QLaw::GradientStrategy& aGradientStrategy
+)
+    : initialState_(anInitialState),
+      satelliteSystem_(aSatelliteSystem),
+      environmentDynamics_(anEnvironmentDynamicsArray),
+      numericalSolver_(aNumericalSolver),
+      gravitationalParameter_(aGravitationalParameter),
+      maximumTimeOfFlight_(aMaximumTimeOfFlight),
+      gradientStrategy_(aGradientStrategy)
+{
+    if (!initialState_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Initial state");
+    }
+
+    if (!initialState_.hasSubset(CoordinatesSubset::Mass()))
+    {
+        throw ostk::core::error::RuntimeError("Initial state must have mass coordinates.");
+    }
+
+    if (!satelliteSystem_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite system");
+    }
+
+    if (!satelliteSystem_.accessPropulsionSystem().isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propulsion system");
+    }
+
+    if (!gravitationalParameter_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
+    if (!maximumTimeOfFlight_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum time of flight");
+    }
+
+    if (maximumTimeOfFlight_ <= Duration::Zero())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Maximum time of flight [{}] must be positive.", maximumTimeOfFlight_.toString()
+        );
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const QLawTradeStudy& aTradeStudy)
+{
+    aTradeStudy.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+State QLawTradeStudy::getInitialState() const
+{
+    return initialState_;
+}
+
+SatelliteSystem QLawTradeStudy::getSatelliteSystem() const
+{
+    return satelliteSystem_;
+}
+
+Array<Shared<Dynamics>> QLawTradeStudy::getEnvironmentDynamics() const
+{
+    return environmentDynamics_;
+}
+
+NumericalSolver QLawTradeStudy::getNumericalSolver() const
+{
+    return numericalSolver_;
+}
+
+Duration QLawTradeStudy::getMaximumTimeOfFlight() const
+{
+    return maximumTimeOfFlight_;
+}
+
+QLaw::GradientStrategy QLawTradeStudy::getGradientStrategy() const
+{
+    return gradientStrategy_;
+}
+
+QLawTradeStudy::Result QLawTradeStudy::solveCase(
+    const Case& aCase, const Index& anIndex, const Size& aTrajectoryStride
+) const
+{
+    const Shared<const QLaw> qlawSPtr =
+        std::make_shared<QLaw>(aCase.targetCOE, gravitationalParameter_, aCase.parameters, gradientStrategy_);
+
+    const Shared<Thruster> thrusterSPtr = std::make_shared<Thruster>(satelliteSystem_, qlawSPtr);
+
+    const auto computeElementsError = [qlawSPtr, gravitationalParameter = gravitationalParameter_](
+                                          const State& aState
+                                      ) -> Vector5d
+    {
+        const State stateInGCRF = aState.inFrame(Frame::GCRF());
+
+        const COE coe = COE::Cartesian({stateInGCRF.getPosition(), stateInGCRF.getVelocity()}, gravitationalParameter);
+
+        return qlawSPtr->computeOrbitalElementsError(coe.getSIVector(COE::AnomalyType::True).segment(0, 5));
+    };
+
+    // Relative distance of the farthest targeted element to its convergence band, negative once all the targeted
+    // elements have converged. Continuous, so that the convergence instant is located by the event detection.
+
+    const Vector5d controlWeights = aCase.parameters.getControlWeights();
+    const Vector5d convergenceThresholds = aCase.parameters.getConvergenceThresholds();
+
+    const Shared<RealCondition> convergenceConditionSPtr = std::make_shared<RealCondition>(
+        "QLaw Convergence",
+        RealCondition::Criterion::StrictlyNegative,
+        [computeElementsError, controlWeights, convergenceThresholds](const State& aState) -> Real
+        {
+            const Vector5d elementsError = computeElementsError(aState);
+
+            return ((controlWeights.array() * elementsError.array().abs() - convergenceThresholds.array()) /
+                    convergenceThresholds.array())
+                .maxCoeff();
+        }
+    );
+
+    const Segment segment = Segment::Maneuver(
+        "QLaw Transfer", convergenceConditionSPtr, thrusterSPtr, environmentDynamics_, numericalSolver_
+    );
+
+    const Segment::Solution solution = segment.solve(initialState_, maximumTimeOfFlight_);
+
+    Array<State> trajectory = Array<State>::Empty();
+
+    if (aTrajectoryStride > 0)
+    {
+        const Size stateCount = solution.states.getSize();
+
+        trajectory.reserve(stateCount / aTrajectoryStride + 2);
+
+        for (Index i = 0; i < stateCount; i += aTrajectoryStride)
+        {
+            trajectory.add(solution.states[i]);
+        }
+
+        if ((stateCount > 0) && (((stateCount - 1) % aTrajectoryStride) != 0))
+        {
+            trajectory.add(solution.states.accessLast());
+        }
+    }
+
+    return {
+        anIndex,
+        solution.conditionIsSatisfied ? Status::Converged : Status::NotConverged,
+        solution.getPropagationDuration(),
+        solution.computeDeltaV(satelliteSystem_.accessPropulsionSystem().getSpecificImpulse().getValue()),
+        solution.computeDeltaMass(),
+        computeElementsError(solution.states.accessLast()),
+        trajectory,
+    };
+}
+
+Array<QLawTradeStudy::Result> QLawTradeStudy::solve(
+    const Array<Case>& aCaseArray, const Size& aThreadCount, const Size& aTrajectoryStride
+) const
+{
+    const Size caseCount = aCaseArray.getSize();
+
+    // Each case writes its own slot
+
+    Array<Result> results = Array<Result>::Empty();
+    results.reserve(caseCount);
+
+    for (Index caseIndex = 0; caseIndex < caseCount; ++caseIndex)
+    {
+        results.add(FailedResult(caseIndex));
+    }
+
+    const auto solveCaseAt = [this, &aCaseArray, &results, aTrajectoryStride](const Index& anIndex) -> void
+    {
+        try
+        {
+            results[anIndex] = this->solveCase(aCaseArray[anIndex], anIndex, aTrajectoryStride);
+        }
+        catch (const std::exception& anException)
+        {
+            BOOST_LOG_TRIVIAL(warning) << "Case [" << anIndex << "] failed: " << anException.what() << std::endl;
+        }
+    };
+
+    ParallelFor(caseCount, aThreadCount, solveCaseAt);
+
+    return results;
+}
+
+void QLawTradeStudy::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "QLaw Trade Study");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Initial instant:" << initialState_.accessInstant().toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum time of flight:" << maximumTimeOfFlight_.toString();
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Gradient strategy:"
+        << ((gradientStrategy_ == QLaw::GradientStrategy::Analytical) ? "Analytical" : "Finite Difference");
+    ostk::core::utils::Print::Line(anOutputStream) << "Environment dynamics count:" << environmentDynamics_.getSize();
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+Array<QLawTradeStudy::Case> QLawTradeStudy::ParameterCases(
+    const COE& aTargetCOE, const Array<QLaw::Parameters>& aParametersArray
+)
+{
+    Array<Case> cases = Array<Case>::Empty();
+    cases.reserve(aParametersArray.getSize());
+
+    for (const QLaw::Parameters& parameters : aParametersArray)
+    {
+        cases.add({aTargetCOE, parameters});
+    }
+
+    return cases;
+}
+
+Array<QLawTradeStudy::Case> QLawTradeStudy::TargetCases(
+    const Array<COE>& aTargetCOEArray, const QLaw::Parameters& aParameters
+)
+{
+    Array<Case> cases = Array<Case>::Empty();
+    cases.reserve(aTargetCOEArray.getSize());
+
+    for (const COE& targetCOE : aTargetCOEArray)
+    {
+        cases.add({targetCOE, aParameters});
+    }
+
+    return cases;
+}
+
+String QLawTradeStudy::StringFromStatus(const Status& aStatus)
+{
+    switch (aStatus)
+    {
+        case Status::Converged:
+            return "Converged";
+
+        case Status::NotConverged:
+            return "Not Converged";
+
+        case Status::Failed:
+            return "Failed";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Status");
+    }
+}
+
+}  // namespace solvers
+}  // namespace astro
+}  // namespace ostk
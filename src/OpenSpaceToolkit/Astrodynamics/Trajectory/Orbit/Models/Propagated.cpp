@@ -1,9 +1,17 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
 
 namespace ostk
 {
@@ -21,18 +29,81 @@ using ostk::core::types::Size;
 using ostk::math::object::Vector3d;
 using ostk::math::object::VectorXd;
 
+using ostk::physics::coord::Frame;
 using ostk::physics::units::Derived;
 using ostk::physics::units::Length;
 using ostk::physics::units::Time;
 
+using ostk::astro::utilities::ParallelFor;
+
 static const Derived::Unit GravitationalParameterSIUnit =
     Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
 
+static double CalculateOrbitalPeriod_s(
+    const Vector3d& aPositionCoordinates, const Vector3d& aVelocityCoordinates, const Real& aGravitationalParameter_SI
+)
+{
+    const double semiMajorAxis = -aGravitationalParameter_SI * aPositionCoordinates.norm() /
+                                 (aPositionCoordinates.norm() * std::pow(aVelocityCoordinates.norm(), 2) -
+                                  2.0 * aGravitationalParameter_SI);
+
+    return Real::TwoPi() * std::sqrt(std::pow(semiMajorAxis, 3) / aGravitationalParameter_SI);
+}
+
+/// @brief Instant at which the GCRF z coordinate crosses zero between two states, from a cubic Hermite interpolation
+static Instant CalculateEquatorCrossingInstant(const State& aPreviousState, const State& aCurrentState)
+{
+    const Real duration_s = (aCurrentState.accessInstant() - aPreviousState.accessInstant()).inSeconds();
+
+    const double z0 = aPreviousState.getPosition().accessCoordinates()[2];
+    const double z1 = aCurrentState.getPosition().accessCoordinates()[2];
+    const double dz0 = aPreviousState.getVelocity().accessCoordinates()[2] * duration_s;
+    const double dz1 = aCurrentState.getVelocity().accessCoordinates()[2] * duration_s;
+
+    if (z1 == 0.0)
+    {
+        return aCurrentState.accessInstant();
+    }
+
+    const auto interpolate = [&z0, &z1, &dz0, &dz1](const double& s) -> double
+    {
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        return (2.0 * s3 - 3.0 * s2 + 1.0) * z0 + (s3 - 2.0 * s2 + s) * dz0 + (-2.0 * s3 + 3.0 * s2) * z1 +
+               (s3 - s2) * dz1;
+    };
+
+    // Bisection, as z0 < 0 <= z1
+
+    double lowerBound = 0.0;
+    double upperBound = 1.0;
+
+    for (Size i = 0; i < 52; ++i)
+    {
+        const double midpoint = 0.5 * (lowerBound + upperBound);
+
+        (interpolate(midpoint) < 0.0 ? lowerBound : upperBound) = midpoint;
+    }
+
+    return aPreviousState.accessInstant() + Duration::Seconds(0.5 * (lowerBound + upperBound) * duration_s);
+}
+
 Propagated::Propagated(const Propagator& aPropagator, const State& aState, const Integer& aRevolutionNumber)
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(1, aState),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      checkpointMutex_(),
+      checkpointStateMap_(),
+      checkpointInterval_(Duration::Undefined()),
+      maximumCheckpointCount_(0),
+      interpolationType_(Propagated::InterpolationType::Blended),
+      threadCount_(1),
+      ascendingNodeMutex_(),
+      ascendingNodeInstants_(Array<Instant>::Empty()),
+      firstSearchedState_(State::Undefined()),
+      lastSearchedState_(State::Undefined())
 
 {
 }
@@ -43,12 +114,109 @@ Propagated::Propagated(
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(aCachedStateArray),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      checkpointMutex_(),
+      checkpointStateMap_(),
+      checkpointInterval_(Duration::Undefined()),
+      maximumCheckpointCount_(0),
+      interpolationType_(Propagated::InterpolationType::Blended),
+      threadCount_(1),
+      ascendingNodeMutex_(),
+      ascendingNodeInstants_(Array<Instant>::Empty()),
+      firstSearchedState_(State::Undefined()),
+      lastSearchedState_(State::Undefined())
 
 {
     sanitizeCachedArray();
 }
 
+Propagated::Propagated(const Propagated& aPropagatedModel)
+    : Model(aPropagatedModel),
+      propagator_(aPropagatedModel.propagator_),
+      cachedStateArray_(aPropagatedModel.cachedStateArray_),
+      initialRevolutionNumber_(aPropagatedModel.initialRevolutionNumber_),
+      checkpointMutex_(),
+      checkpointStateMap_(),
+      checkpointInterval_(Duration::Undefined()),
+      maximumCheckpointCount_(0),
+      interpolationType_(aPropagatedModel.interpolationType_),
+      threadCount_(aPropagatedModel.threadCount_),
+      ascendingNodeMutex_(),
+      ascendingNodeInstants_(Array<Instant>::Empty()),
+      firstSearchedState_(State::Undefined()),
+      lastSearchedState_(State::Undefined())
+{
+    {
+        const std::shared_lock<std::shared_mutex> lock(aPropagatedModel.checkpointMutex_);
+
+        checkpointStateMap_ = aPropagatedModel.checkpointStateMap_;
+        checkpointInterval_ = aPropagatedModel.checkpointInterval_;
+        maximumCheckpointCount_ = aPropagatedModel.maximumCheckpointCount_;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(aPropagatedModel.ascendingNodeMutex_);
+
+        ascendingNodeInstants_ = aPropagatedModel.ascendingNodeInstants_;
+        firstSearchedState_ = aPropagatedModel.firstSearchedState_;
+        lastSearchedState_ = aPropagatedModel.lastSearchedState_;
+    }
+}
+
+Propagated& Propagated::operator=(const Propagated& aPropagatedModel)
+{
+    if (this != &aPropagatedModel)
+    {
+        Model::operator=(aPropagatedModel);
+
+        propagator_ = aPropagatedModel.propagator_;
+        cachedStateArray_ = aPropagatedModel.cachedStateArray_;
+        initialRevolutionNumber_ = aPropagatedModel.initialRevolutionNumber_;
+        interpolationType_ = aPropagatedModel.interpolationType_;
+        threadCount_ = aPropagatedModel.threadCount_;
+
+        std::map<Instant, State> checkpointStateMap;
+        Duration checkpointInterval = Duration::Undefined();
+        Size maximumCheckpointCount = 0;
+
+        {
+            const std::shared_lock<std::shared_mutex> lock(aPropagatedModel.checkpointMutex_);
+
+            checkpointStateMap = aPropagatedModel.checkpointStateMap_;
+            checkpointInterval = aPropagatedModel.checkpointInterval_;
+            maximumCheckpointCount = aPropagatedModel.maximumCheckpointCount_;
+        }
+
+        {
+            const std::unique_lock<std::shared_mutex> lock(checkpointMutex_);
+
+            checkpointStateMap_ = std::move(checkpointStateMap);
+            checkpointInterval_ = checkpointInterval;
+            maximumCheckpointCount_ = maximumCheckpointCount;
+        }
+
+        Array<Instant> ascendingNodeInstants = Array<Instant>::Empty();
+        State firstSearchedState = State::Undefined();
+        State lastSearchedState = State::Undefined();
+
+        {
+            const std::lock_guard<std::mutex> lock(aPropagatedModel.ascendingNodeMutex_);
+
+            ascendingNodeInstants = aPropagatedModel.ascendingNodeInstants_;
+            firstSearchedState = aPropagatedModel.firstSearchedState_;
+            lastSearchedState = aPropagatedModel.lastSearchedState_;
+        }
+
+        const std::lock_guard<std::mutex> lock(ascendingNodeMutex_);
+
+        ascendingNodeInstants_ = std::move(ascendingNodeInstants);
+        firstSearchedState_ = firstSearchedState;
+        lastSearchedState_ = lastSearchedState;
+    }
+
+    return *this;
+}
+
 Propagated* Propagated::clone() const
 {
     return new Propagated(*this);
@@ -61,7 +229,8 @@ bool Propagated::operator==(const Propagated& aPropagatedModel) const
         return false;
     }
 
-    return (cachedStateArray_ == aPropagatedModel.cachedStateArray_) && (propagator_ == aPropagatedModel.propagator_);
+    return (cachedStateArray_ == aPropagatedModel.cachedStateArray_) && (propagator_ == aPropagatedModel.propagator_) &&
+           (interpolationType_ == aPropagatedModel.interpolationType_);
 }
 
 bool Propagated::operator!=(const Propagated& aPropagatedModel) const
@@ -143,9 +312,6 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         }
     }
 
-    // Builder for output states based on cached array
-    StateBuilder outputStateBuilder = {this->cachedStateArray_.accessFirst()};
-
     Array<State> allStates = Array<State>::Empty();
 
     // Maintain counter separately so as to only iterate once through instant array
@@ -165,10 +331,13 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         instants.add(anInstantArray[j]);
     }
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessFirst(), instants));
+    allStates.add(this->calculateStatesFromCheckpointsAt(this->cachedStateArray_.accessFirst(), instants));
 
     // Propagate all instants between states
 
+    Array<Size> cachedStateIndices = Array<Size>::Empty();
+    Array<Array<Instant>> intervalInstants = Array<Array<Instant>>::Empty();
+
     for (Size i = 0; i < this->cachedStateArray_.getSize() - 1; ++i)
     {
         const Instant& thisStateInstant = this->cachedStateArray_[i].accessInstant();
@@ -196,33 +365,13 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
             continue;
         }
 
-        // Forward propagation
-        Array<State> forwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i], instants);
-
-        // Backward propagation
-        Array<State> backwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i + 1], instants);
-
-        Real durationBetweenStates = (nextStateInstant - thisStateInstant).inSeconds();
-
-        // Take weighted average
-        Array<State> averagedStates = Array<State>::Empty();
-        averagedStates.reserve(instants.getSize());
-
-        for (Size k = 0; k < instants.getSize(); ++k)
-        {
-            Real forwardWeight =
-                (this->cachedStateArray_[i + 1].accessInstant() - instants[k]).inSeconds() / durationBetweenStates;
-            Real backwardWeight =
-                (instants[k] - this->cachedStateArray_[i].accessInstant()).inSeconds() / durationBetweenStates;
-
-            VectorXd coordinates =
-                (forwardStates[k].accessCoordinates() * forwardWeight +
-                 backwardStates[k].accessCoordinates() * backwardWeight);
-
-            averagedStates.add(outputStateBuilder.build(instants[k], coordinates));
-        }
+        cachedStateIndices.add(i);
+        intervalInstants.add(instants);
+    }
 
-        allStates.add(averagedStates);
+    for (const Array<State>& intervalStates : this->calculateIntervalStatesAt(cachedStateIndices, intervalInstants))
+    {
+        allStates.add(intervalStates);
     }
 
     // Propagate any remaining instants forward in time
@@ -234,7 +383,7 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         instants.add(anInstantArray[j]);
     }
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessLast(), instants));
+    allStates.add(this->calculateStatesFromCheckpointsAt(this->cachedStateArray_.accessLast(), instants));
 
     return allStates;
 }
@@ -251,66 +400,90 @@ Integer Propagated::calculateRevolutionNumberAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Propagated");
     }
 
-    if (anInstant == cachedStateArray_[0].accessInstant())
+    const Instant& epoch = cachedStateArray_[0].accessInstant();
+
+    if (anInstant == epoch)
     {
         return this->getRevolutionNumberAtEpoch();
     }
 
-    // Calculate gravitational parameter (Spherical earth has the most modern value which is the correct one)
-    using ostk::physics::environment::gravitational::Earth;
+    // Revolutions start at epoch, then at each ascending node after epoch: the revolution number increases as soon as
+    // the instant moves past epoch, and at each ascending node in (epoch, instant]. Backwards, it decreases as soon as
+    // the instant moves before epoch, and at each ascending node in [instant, epoch).
 
-    const Derived gravitationalParameter = Earth::Spherical.gravitationalParameter_;
-    const Real gravitationalParameter_SI = gravitationalParameter.in(GravitationalParameterSIUnit);
-
-    Position currentPosition = cachedStateArray_[0].getPosition();
-    Velocity currentVelocity = cachedStateArray_[0].getVelocity();
+    const auto countRevolutions = [this, &epoch, &anInstant]() -> Integer
+    {
+        if (anInstant > epoch)
+        {
+            return 1 + static_cast<int>(
+                           std::upper_bound(ascendingNodeInstants_.begin(), ascendingNodeInstants_.end(), anInstant) -
+                           std::upper_bound(ascendingNodeInstants_.begin(), ascendingNodeInstants_.end(), epoch)
+                       );
+        }
 
-    Vector3d currentPositionCoordinates = currentPosition.inUnit(Position::Unit::Meter).accessCoordinates();
-    Vector3d currentVelocityCoordinates = currentVelocity.inUnit(Velocity::Unit::MeterPerSecond).accessCoordinates();
+        return -1 - static_cast<int>(
+                        std::lower_bound(ascendingNodeInstants_.begin(), ascendingNodeInstants_.end(), epoch) -
+                        std::lower_bound(ascendingNodeInstants_.begin(), ascendingNodeInstants_.end(), anInstant)
+                    );
+    };
 
-    // Determine whether to count revolution numbers in forwards or backwards time and return function if duration is 0
-    Instant currentInstant = cachedStateArray_[0].getInstant();
-    const double durationInSecs = (anInstant - currentInstant).inSeconds();
-    if (durationInSecs == 0.0)
-    {
-        return 1;
-    }
-    Integer durationSign = (durationInSecs > 0) - (durationInSecs < 0);
+    // Ascending nodes are searched without holding the lock, and published under it. Should another query have
+    // extended the searched span in the meantime, the search starts again from its new edge.
 
-    // Propagate towards desired instant a fraction of an orbit at a time in while loop, exit when arrived at desired
-    // instant
-    Integer revolutionNumber = this->getRevolutionNumberAtEpoch();
     while (true)
     {
-        // Calculate orbital period
-        const double semiMajorAxis =
-            -gravitationalParameter_SI * currentPositionCoordinates.norm() /
-            (currentPositionCoordinates.norm() * std::pow(currentVelocityCoordinates.norm(), 2) -
-             2.0 * gravitationalParameter_SI);
-        const Duration orbitalPeriod =
-            Duration::Seconds(Real::TwoPi() * std::sqrt(std::pow(semiMajorAxis, 3) / gravitationalParameter_SI));
+        State searchStartState = State::Undefined();
 
-        // If we have passed the desired instant during our progration, break from the loop
-        if (durationSign.isPositive() && currentInstant > anInstant)
-            break;
-        if (durationSign.isNegative() && currentInstant < anInstant)
-            break;
+        {
+            const std::lock_guard<std::mutex> lock(ascendingNodeMutex_);
+
+            if (!firstSearchedState_.isDefined())
+            {
+                firstSearchedState_ = cachedStateArray_[0];
+                lastSearchedState_ = cachedStateArray_[0];
+            }
+
+            if ((anInstant >= firstSearchedState_.accessInstant()) && (anInstant <= lastSearchedState_.accessInstant()))
+            {
+                return this->getRevolutionNumberAtEpoch() + countRevolutions();
+            }
 
-        // Increase or decrease revolution number by 1
-        revolutionNumber += durationSign;
+            searchStartState =
+                (anInstant > lastSearchedState_.accessInstant()) ? lastSearchedState_ : firstSearchedState_;
+        }
 
-        // Propagate for duration of this orbital period
-        const State currentState = propagator_.calculateStateAt(
-            cachedStateArray_[0], cachedStateArray_[0].accessInstant() + (durationSign * orbitalPeriod)
-        );
+        State searchEndState = State::Undefined();
 
-        // Update the current instant position and velocity coordinates
-        currentPositionCoordinates = currentState.getPosition().getCoordinates();
-        currentVelocityCoordinates = currentState.getVelocity().getCoordinates();
-        currentInstant += durationSign * orbitalPeriod;
+        const Array<Instant> ascendingNodeInstants =
+            this->searchAscendingNodes(searchStartState, anInstant, searchEndState);
+
+        const std::lock_guard<std::mutex> lock(ascendingNodeMutex_);
+
+        // Steps do not overlap the searched span, so node instants are appended or prepended
+
+        if (anInstant > searchStartState.accessInstant())
+        {
+            if (lastSearchedState_ == searchStartState)
+            {
+                ascendingNodeInstants_.add(ascendingNodeInstants);
+                lastSearchedState_ = searchEndState;
+            }
+        }
+        else if (firstSearchedState_ == searchStartState)
+        {
+            Array<Instant> prependedAscendingNodeInstants = ascendingNodeInstants;
+            prependedAscendingNodeInstants.add(ascendingNodeInstants_);
+            ascendingNodeInstants_ = std::move(prependedAscendingNodeInstants);
+            firstSearchedState_ = searchEndState;
+        }
     }
+}
 
-    return revolutionNumber;
+Array<Instant> Propagated::getAscendingNodeInstantArray() const
+{
+    const std::lock_guard<std::mutex> lock(ascendingNodeMutex_);
+
+    return ascendingNodeInstants_;
 }
 
 const Array<State>& Propagated::accessCachedStateArray() const
@@ -338,6 +511,131 @@ void Propagated::setCachedStateArray(const Array<State>& aStateArray)
     this->cachedStateArray_ = aStateArray;
 
     sanitizeCachedArray();
+
+    {
+        const std::unique_lock<std::shared_mutex> lock(checkpointMutex_);
+
+        checkpointStateMap_.clear();
+    }
+
+    const std::lock_guard<std::mutex> lock(ascendingNodeMutex_);
+
+    ascendingNodeInstants_.clear();
+    firstSearchedState_ = State::Undefined();
+    lastSearchedState_ = State::Undefined();
+}
+
+bool Propagated::isCheckpointingEnabled() const
+{
+    const std::shared_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    return maximumCheckpointCount_ > 0;
+}
+
+Duration Propagated::getCheckpointInterval() const
+{
+    const std::shared_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    return checkpointInterval_;
+}
+
+Size Propagated::getMaximumCheckpointCount() const
+{
+    const std::shared_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    return maximumCheckpointCount_;
+}
+
+Array<State> Propagated::getCheckpointStateArray() const
+{
+    const std::shared_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    Array<State> checkpointStateArray = Array<State>::Empty();
+    checkpointStateArray.reserve(checkpointStateMap_.size());
+
+    for (const auto& checkpoint : checkpointStateMap_)
+    {
+        checkpointStateArray.add(checkpoint.second);
+    }
+
+    return checkpointStateArray;
+}
+
+void Propagated::enableCheckpointing(const Duration& aCheckpointInterval, const Size& aMaximumCheckpointCount)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagated");
+    }
+
+    if (aMaximumCheckpointCount < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum checkpoint count");
+    }
+
+    Duration checkpointInterval = aCheckpointInterval;
+
+    if (!checkpointInterval.isDefined())
+    {
+        // Default to one orbital period at epoch (Spherical earth has the most modern gravitational parameter)
+        using ostk::physics::environment::gravitational::Earth;
+
+        const Real gravitationalParameter_SI =
+            Earth::Spherical.gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+        const double orbitalPeriod_s = CalculateOrbitalPeriod_s(
+            cachedStateArray_[0].getPosition().inUnit(Position::Unit::Meter).accessCoordinates(),
+            cachedStateArray_[0].getVelocity().inUnit(Velocity::Unit::MeterPerSecond).accessCoordinates(),
+            gravitationalParameter_SI
+        );
+
+        if (!std::isfinite(orbitalPeriod_s))
+        {
+            throw ostk::core::error::runtime::Wrong("Checkpoint interval");
+        }
+
+        checkpointInterval = Duration::Seconds(orbitalPeriod_s);
+    }
+
+    if ((!checkpointInterval.isDefined()) || (!checkpointInterval.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Checkpoint interval");
+    }
+
+    const std::unique_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    checkpointStateMap_.clear();
+    checkpointInterval_ = checkpointInterval;
+    maximumCheckpointCount_ = aMaximumCheckpointCount;
+}
+
+Propagated::InterpolationType Propagated::getInterpolationType() const
+{
+    return interpolationType_;
+}
+
+void Propagated::setInterpolationType(const Propagated::InterpolationType& anInterpolationType)
+{
+    interpolationType_ = anInterpolationType;
+}
+
+Size Propagated::getThreadCount() const
+{
+    return threadCount_;
+}
+
+void Propagated::setThreadCount(const Size& aThreadCount)
+{
+    threadCount_ = aThreadCount;
+}
+
+void Propagated::disableCheckpointing()
+{
+    const std::unique_lock<std::shared_mutex> lock(checkpointMutex_);
+
+    checkpointStateMap_.clear();
+    checkpointInterval_ = Duration::Undefined();
+    maximumCheckpointCount_ = 0;
 }
 
 void Propagated::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -359,6 +657,21 @@ void Propagated::print(std::ostream& anOutputStream, bool displayDecorator) cons
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+String Propagated::StringFromInterpolationType(const Propagated::InterpolationType& anInterpolationType)
+{
+    switch (anInterpolationType)
+    {
+        case Propagated::InterpolationType::Blended:
+            return "Blended";
+
+        case Propagated::InterpolationType::ContinuityCorrected:
+            return "ContinuityCorrected";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Interpolation type");
+    }
+}
+
 bool Propagated::operator==(const trajectory::Model& aModel) const
 {
     const Propagated* propagatedModelPtr = dynamic_cast<const Propagated*>(&aModel);
@@ -412,6 +725,330 @@ void Propagated::sanitizeCachedArray() const
     }
 }
 
+Array<Instant> Propagated::searchAscendingNodes(
+    const State& aSearchStartState, const Instant& anInstant, State& aSearchEndState
+) const
+{
+    // Propagate once from the edge of the searched span, recording every integration step
+
+    NumericalSolver numericalSolver = propagator_.getNumericalSolver();
+    numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::All());
+    numericalSolver.setStateSink(nullptr);
+
+    const Propagator propagator = {numericalSolver, propagator_.getDynamics(), propagator_.getFormulation()};
+
+    aSearchEndState = propagator.calculateStateAt(aSearchStartState, anInstant);
+
+    Array<State> stepStates = std::get<0>(propagator.getObservedStatesAndDiagnostics());
+    stepStates.add(aSearchStartState);
+    stepStates.add(aSearchEndState);
+
+    Array<State> gcrfStepStates = Array<State>::Empty();
+    gcrfStepStates.reserve(stepStates.getSize());
+
+    for (const State& stepState : stepStates)
+    {
+        gcrfStepStates.add(stepState.inFrame(Frame::GCRF()));
+    }
+
+    std::sort(
+        gcrfStepStates.begin(),
+        gcrfStepStates.end(),
+        [](const State& lhs, const State& rhs)
+        {
+            return lhs.accessInstant() < rhs.accessInstant();
+        }
+    );
+
+    // Ascending nodes are crossings of the GCRF equatorial plane from south to north. A state lying on the plane counts
+    // as crossed, so that a node at a step (e.g. at epoch) is found exactly once.
+
+    Array<Instant> ascendingNodeInstants = Array<Instant>::Empty();
+
+    for (Size i = 1; i < gcrfStepStates.getSize(); ++i)
+    {
+        if (gcrfStepStates[i].accessInstant() == gcrfStepStates[i - 1].accessInstant())
+        {
+            continue;
+        }
+
+        if ((gcrfStepStates[i - 1].getPosition().accessCoordinates()[2] < 0.0) &&
+            (gcrfStepStates[i].getPosition().accessCoordinates()[2] >= 0.0))
+        {
+            ascendingNodeInstants.add(CalculateEquatorCrossingInstant(gcrfStepStates[i - 1], gcrfStepStates[i]));
+        }
+    }
+
+    return ascendingNodeInstants;
+}
+
+Array<Array<State>> Propagated::calculateIntervalStatesAt(
+    const Array<Size>& aCachedStateIndexArray, const Array<Array<Instant>>& anInstantArrays
+) const
+{
+    const Size intervalCount = aCachedStateIndexArray.getSize();
+
+    if (intervalCount == 0)
+    {
+        return Array<Array<State>>::Empty();
+    }
+
+    const bool isBlended = interpolationType_ == Propagated::InterpolationType::Blended;
+
+    // Work items are independent propagations: forward from each interval's first cached state, and backward from its
+    // last cached state when blending
+
+    const Size workItemCount = isBlended ? (2 * intervalCount) : intervalCount;
+
+    Array<Array<State>> forwardStateArrays(intervalCount, Array<State>::Empty());
+    Array<Array<State>> backwardStateArrays(intervalCount, Array<State>::Empty());
+
+    const auto propagateWorkItem = [&](const Size& aWorkItemIndex) -> void
+    {
+        const Size k = aWorkItemIndex % intervalCount;
+        const bool isForward = aWorkItemIndex < intervalCount;
+
+        const Size i = aCachedStateIndexArray[k];
+
+        if (!isForward)
+        {
+            backwardStateArrays[k] = propagator_.calculateStatesAt(this->cachedStateArray_[i + 1], anInstantArrays[k]);
+            return;
+        }
+
+        if (isBlended)
+        {
+            forwardStateArrays[k] = propagator_.calculateStatesAt(this->cachedStateArray_[i], anInstantArrays[k]);
+            return;
+        }
+
+        // Propagate up to the next cached state as well, to measure the mismatch
+
+        Array<Instant> instants = anInstantArrays[k];
+        instants.add(this->cachedStateArray_[i + 1].accessInstant());
+
+        forwardStateArrays[k] = propagator_.calculateStatesAt(this->cachedStateArray_[i], instants);
+    };
+
+    // Workers share the propagator, whose queries are reentrant
+
+    ParallelFor(workItemCount, threadCount_, propagateWorkItem);
+
+    // Builder for output states based on cached array
+    const StateBuilder outputStateBuilder = {this->cachedStateArray_.accessFirst()};
+
+    Array<Array<State>> intervalStateArrays = Array<Array<State>>::Empty();
+    intervalStateArrays.reserve(intervalCount);
+
+    for (Size k = 0; k < intervalCount; ++k)
+    {
+        const Size i = aCachedStateIndexArray[k];
+        const Array<Instant>& instants = anInstantArrays[k];
+
+        const Instant& thisStateInstant = this->cachedStateArray_[i].accessInstant();
+        const Instant& nextStateInstant = this->cachedStateArray_[i + 1].accessInstant();
+
+        const Real durationBetweenStates = (nextStateInstant - thisStateInstant).inSeconds();
+
+        Array<State> intervalStates = Array<State>::Empty();
+        intervalStates.reserve(instants.getSize());
+
+        if (isBlended)
+        {
+            // Take weighted average
+
+            for (Size l = 0; l < instants.getSize(); ++l)
+            {
+                const Real forwardWeight = (nextStateInstant - instants[l]).inSeconds() / durationBetweenStates;
+                const Real backwardWeight = (instants[l] - thisStateInstant).inSeconds() / durationBetweenStates;
+
+                const VectorXd coordinates =
+                    (forwardStateArrays[k][l].accessCoordinates() * forwardWeight +
+                     backwardStateArrays[k][l].accessCoordinates() * backwardWeight);
+
+                intervalStates.add(outputStateBuilder.build(instants[l], coordinates));
+            }
+        }
+        else
+        {
+            // Remove the mismatch at the next cached state, linearly in time
+
+            const VectorXd mismatch = forwardStateArrays[k].accessLast().accessCoordinates() -
+                                      this->cachedStateArray_[i + 1].accessCoordinates();
+
+            for (Size l = 0; l < instants.getSize(); ++l)
+            {
+                const Real weight = (instants[l] - thisStateInstant).inSeconds() / durationBetweenStates;
+
+                const VectorXd coordinates = forwardStateArrays[k][l].accessCoordinates() - mismatch * weight;
+
+                intervalStates.add(outputStateBuilder.build(instants[l], coordinates));
+            }
+        }
+
+        intervalStateArrays.add(intervalStates);
+    }
+
+    return intervalStateArrays;
+}
+
+Array<State> Propagated::calculateStatesFromCheckpointsAt(
+    const State& aCachedState, const Array<Instant>& anInstantArray
+) const
+{
+    if (anInstantArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    // Instants are sorted, and all on the same side of the cached state
+
+    const Instant& cachedInstant = aCachedState.accessInstant();
+    const bool isForward = anInstantArray.accessLast() > cachedInstant;
+    const Instant& nearestInstant = isForward ? anInstantArray.accessFirst() : anInstantArray.accessLast();
+    const Instant& farthestInstant = isForward ? anInstantArray.accessLast() : anInstantArray.accessFirst();
+
+    State startState = aCachedState;
+    Array<Instant> checkpointInstants = Array<Instant>::Empty();
+
+    {
+        const std::shared_lock<std::shared_mutex> lock(checkpointMutex_);
+
+        if (maximumCheckpointCount_ == 0)
+        {
+            return propagator_.calculateStatesAt(aCachedState, anInstantArray);
+        }
+
+        // Start from the checkpoint closest to the nearest instant, between the cached state and that instant
+
+        Instant outermostInstant = cachedInstant;
+
+        if (isForward)
+        {
+            auto checkpointIt = checkpointStateMap_.upper_bound(nearestInstant);
+
+            if ((checkpointIt != checkpointStateMap_.begin()) && (std::prev(checkpointIt)->first > cachedInstant))
+            {
+                startState = std::prev(checkpointIt)->second;
+            }
+
+            if ((!checkpointStateMap_.empty()) && (checkpointStateMap_.rbegin()->first > cachedInstant))
+            {
+                outermostInstant = checkpointStateMap_.rbegin()->first;
+            }
+        }
+        else
+        {
+            auto checkpointIt = checkpointStateMap_.lower_bound(nearestInstant);
+
+            if ((checkpointIt != checkpointStateMap_.end()) && (checkpointIt->first < cachedInstant))
+            {
+                startState = checkpointIt->second;
+            }
+
+            if ((!checkpointStateMap_.empty()) && (checkpointStateMap_.begin()->first < cachedInstant))
+            {
+                outermostInstant = checkpointStateMap_.begin()->first;
+            }
+        }
+
+        // Extend the checkpoints, one interval at a time, up to the farthest instant
+
+        const Duration step =
+            isForward ? checkpointInterval_ : Duration::Seconds(-checkpointInterval_.inSeconds());
+
+        for (Instant checkpointInstant = outermostInstant + step;
+             isForward ? (checkpointInstant <= farthestInstant) : (checkpointInstant >= farthestInstant);
+             checkpointInstant += step)
+        {
+            checkpointInstants.add(checkpointInstant);
+        }
+
+        if (!isForward)
+        {
+            std::reverse(checkpointInstants.begin(), checkpointInstants.end());
+        }
+    }
+
+    if (checkpointInstants.isEmpty())
+    {
+        return propagator_.calculateStatesAt(startState, anInstantArray);
+    }
+
+    // Propagate checkpoints and instants in a single pass
+
+    Array<Instant> propagationInstants = Array<Instant>::Empty();
+    propagationInstants.reserve(anInstantArray.getSize() + checkpointInstants.getSize());
+
+    std::merge(
+        anInstantArray.begin(),
+        anInstantArray.end(),
+        checkpointInstants.begin(),
+        checkpointInstants.end(),
+        std::back_inserter(propagationInstants)
+    );
+
+    propagationInstants.erase(
+        std::unique(propagationInstants.begin(), propagationInstants.end()), propagationInstants.end()
+    );
+
+    const Array<State> propagatedStates = propagator_.calculateStatesAt(startState, propagationInstants);
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    std::map<Instant, State> checkpointStateMap;
+
+    Size instantIndex = 0;
+    Size checkpointIndex = 0;
+
+    for (const State& propagatedState : propagatedStates)
+    {
+        const Instant& propagatedInstant = propagatedState.accessInstant();
+
+        while ((instantIndex < anInstantArray.getSize()) && (anInstantArray[instantIndex] == propagatedInstant))
+        {
+            states.add(propagatedState);
+            ++instantIndex;
+        }
+
+        if ((checkpointIndex < checkpointInstants.getSize()) &&
+            (checkpointInstants[checkpointIndex] == propagatedInstant))
+        {
+            checkpointStateMap.emplace(propagatedInstant, propagatedState);
+            ++checkpointIndex;
+        }
+    }
+
+    {
+        const std::unique_lock<std::shared_mutex> lock(checkpointMutex_);
+
+        // Checkpointing may have been disabled, or reset, by another thread in the meantime
+
+        if (maximumCheckpointCount_ > 0)
+        {
+            checkpointStateMap_.insert(checkpointStateMap.begin(), checkpointStateMap.end());
+
+            // Bound the number of checkpoints by dropping every other checkpoint, and doubling the interval
+
+            while (checkpointStateMap_.size() > maximumCheckpointCount_)
+            {
+                bool isKept = true;
+
+                for (auto checkpointIt = checkpointStateMap_.begin(); checkpointIt != checkpointStateMap_.end();)
+                {
+                    checkpointIt = isKept ? std::next(checkpointIt) : checkpointStateMap_.erase(checkpointIt);
+                    isKept = !isKept;
+                }
+
+                checkpointInterval_ = checkpointInterval_ * 2.0;
+            }
+        }
+    }
+
+    return states;
+}
+
 }  // namespace models
 }  // namespace orbit
 }  // namespace trajectory
@@ -0,0 +1,970 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/BrouwerLyddaneMean/BrouwerLyddaneMeanShort.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/SemiAnalytic.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace models
+{
+
+using ostk::math::object::Vector3d;
+using ostk::math::object::Vector6d;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Time;
+
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::trajectory::orbit::models::blm::BrouwerLyddaneMeanShort;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+namespace
+{
+
+/// Mean elements vector: angular momentum vector [m^2/s], eccentricity vector, and unwrapped mean longitude [rad]
+static const Size ElementCount = 7;
+
+/// Eccentricity and inclination sine below which the perigee and node directions are undefined
+static const double DirectionTolerance = 1e-12;
+
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+double WrapAngle(const double& anAngle_rad)
+{
+    return anAngle_rad - 2.0 * M_PI * std::floor((anAngle_rad + M_PI) / (2.0 * M_PI));
+}
+
+Index LocateSubset(const State& aState, const Shared<const CoordinatesSubset>& aSubsetSPtr)
+{
+    Index index = 0;
+
+    for (const Shared<const CoordinatesSubset>& subsetSPtr : aState.accessCoordinatesBroker()->accessSubsets())
+    {
+        if (*subsetSPtr == *aSubsetSPtr)
+        {
+            return index;
+        }
+
+        index += subsetSPtr->getSize();
+    }
+
+    throw ostk::core::error::RuntimeError("State does not hold the [{}] coordinates subset.", aSubsetSPtr->getName());
+}
+
+/// @brief Orbital plane directions of a mean elements vector: the node direction defaults to the X axis for
+/// equatorial orbits, and the perigee direction to the node direction for circular orbits
+void CalculateDirections(
+    const VectorXd& anElementVector, Vector3d& aNormalDirection, Vector3d& aNodeDirection, Vector3d& aPerigeeDirection
+)
+{
+    const Vector3d angularMomentum = anElementVector.segment<3>(0);
+    const Vector3d eccentricityVector = anElementVector.segment<3>(3);
+
+    aNormalDirection = angularMomentum.normalized();
+
+    const Vector3d node = {-aNormalDirection.y(), aNormalDirection.x(), 0.0};
+
+    aNodeDirection = (node.norm() > DirectionTolerance) ? Vector3d(node.normalized()) : Vector3d::UnitX();
+
+    const double eccentricity = eccentricityVector.norm();
+
+    aPerigeeDirection =
+        (eccentricity > DirectionTolerance) ? Vector3d(eccentricityVector / eccentricity) : aNodeDirection;
+}
+
+/// @brief Classical mean elements [a, e, i, raan, aop, mean anomaly] of a mean elements vector
+Vector6d COEVectorFromElementVector(const VectorXd& anElementVector, const double& aGravitationalParameter_SI)
+{
+    Vector3d normalDirection;
+    Vector3d nodeDirection;
+    Vector3d perigeeDirection;
+
+    CalculateDirections(anElementVector, normalDirection, nodeDirection, perigeeDirection);
+
+    const double angularMomentum = anElementVector.segment<3>(0).norm();
+    const double eccentricity = anElementVector.segment<3>(3).norm();
+
+    const double semiMajorAxis =
+        angularMomentum * angularMomentum / (aGravitationalParameter_SI * (1.0 - eccentricity * eccentricity));
+    const double inclination = std::acos(std::max(-1.0, std::min(1.0, normalDirection.z())));
+    const double raan = std::atan2(nodeDirection.y(), nodeDirection.x());
+    const double aop = std::atan2(
+        perigeeDirection.dot(normalDirection.cross(nodeDirection)), perigeeDirection.dot(nodeDirection)
+    );
+    const double meanAnomaly = WrapAngle(anElementVector[6] - raan - aop);
+
+    Vector6d coeVector;
+    coeVector << semiMajorAxis, eccentricity, inclination, raan, aop, meanAnomaly;
+
+    return coeVector;
+}
+
+/// @brief Mean elements vector of classical mean elements [a, e, i, raan, aop, mean anomaly]
+VectorXd ElementVectorFromCOEVector(const Vector6d& aCOEVector, const double& aGravitationalParameter_SI)
+{
+    const double semiMajorAxis = aCOEVector[0];
+    const double eccentricity = aCOEVector[1];
+    const double inclination = aCOEVector[2];
+    const double raan = aCOEVector[3];
+    const double aop = aCOEVector[4];
+    const double meanAnomaly = aCOEVector[5];
+
+    const Vector3d normalDirection = {
+        std::sin(raan) * std::sin(inclination), -std::cos(raan) * std::sin(inclination), std::cos(inclination)
+    };
+    const Vector3d nodeDirection = {std::cos(raan), std::sin(raan), 0.0};
+    const Vector3d perigeeDirection =
+        std::cos(aop) * nodeDirection + std::sin(aop) * normalDirection.cross(nodeDirection);
+
+    const double angularMomentum =
+        std::sqrt(aGravitationalParameter_SI * semiMajorAxis * (1.0 - eccentricity * eccentricity));
+
+    VectorXd elementVector(ElementCount);
+    elementVector << angularMomentum * normalDirection, eccentricity * perigeeDirection, meanAnomaly + raan + aop;
+
+    return elementVector;
+}
+
+/// @brief Acceleration of the J2 and J4 zonal harmonics, about the Z axis
+Vector3d CalculateZonalAcceleration(
+    const Vector3d& aPositionCoordinates,
+    const double& aGravitationalParameter_SI,
+    const double& anEquatorialRadius_SI,
+    const double& aJ2,
+    const double& aJ4
+)
+{
+    const double r = aPositionCoordinates.norm();
+    const double zOverRSquared = (aPositionCoordinates.z() * aPositionCoordinates.z()) / (r * r);
+
+    const double radiusRatio = anEquatorialRadius_SI / r;
+
+    const double j2Factor = -1.5 * aJ2 * aGravitationalParameter_SI * std::pow(radiusRatio, 2) / std::pow(r, 3);
+    const double j4Factor = 0.625 * aJ4 * aGravitationalParameter_SI * std::pow(radiusRatio, 4) / std::pow(r, 3);
+
+    const double horizontalFactor = j2Factor * (1.0 - 5.0 * zOverRSquared) +
+                                    j4Factor * (3.0 - 42.0 * zOverRSquared + 63.0 * zOverRSquared * zOverRSquared);
+    const double verticalFactor = j2Factor * (3.0 - 5.0 * zOverRSquared) +
+                                  j4Factor * (15.0 - 70.0 * zOverRSquared + 63.0 * zOverRSquared * zOverRSquared);
+
+    return {
+        horizontalFactor * aPositionCoordinates.x(),
+        horizontalFactor * aPositionCoordinates.y(),
+        verticalFactor * aPositionCoordinates.z(),
+    };
+}
+
+}  // namespace
+
+SemiAnalytic::SemiAnalytic(
+    const State& aState,
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Array<Shared<Dynamics>>& aPerturbationArray,
+    const Duration& aStepDuration,
+    const Size& aQuadraturePointCount,
+    const bool& isShortPeriodRecoveryEnabled
+)
+    : Model(),
+      state_(State::Undefined()),
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      perturbations_(aPerturbationArray),
+      stepDuration_(aStepDuration),
+      quadraturePointCount_(aQuadraturePointCount),
+      shortPeriodRecoveryEnabled_(isShortPeriodRecoveryEnabled),
+      gravitationalParameter_SI_(Real::Undefined()),
+      equatorialRadius_SI_(Real::Undefined()),
+      j2_(0.0),
+      j4_(0.0),
+      positionIndex_(0),
+      velocityIndex_(0),
+      perturbationReadSubsets_(),
+      nodeMutex_(),
+      forwardNodes_(),
+      backwardNodes_(),
+      forwardNodesAreComplete_(false),
+      backwardNodesAreComplete_(false)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if ((celestialObjectSPtr_ == nullptr) || (!celestialObjectSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial");
+    }
+
+    // The Brouwer-Lyddane theory holds the zonal harmonics of the Earth
+
+    if (shortPeriodRecoveryEnabled_ && (celestialObjectSPtr_->getName() != "Earth"))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Short-period recovery is only defined for the Earth, not for [{}].", celestialObjectSPtr_->getName()
+        );
+    }
+
+    if (!stepDuration_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step duration");
+    }
+
+    if (!stepDuration_.isStrictlyPositive())
+    {
+        throw ostk::core::error::RuntimeError("Step duration [{}] must be positive.", stepDuration_.toString());
+    }
+
+    if (quadraturePointCount_ < 4)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Quadrature point count [{}] must be at least 4.", quadraturePointCount_
+        );
+    }
+
+    state_ = aState.inFrame(Frame::GCRF());
+
+    positionIndex_ = LocateSubset(state_, CartesianPosition::Default());
+    velocityIndex_ = LocateSubset(state_, CartesianVelocity::Default());
+
+    gravitationalParameter_SI_ = celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit);
+    equatorialRadius_SI_ = celestialObjectSPtr_->getEquatorialRadius().inMeters();
+
+    if (celestialObjectSPtr_->getJ2().isDefined())
+    {
+        j2_ = celestialObjectSPtr_->getJ2();
+    }
+
+    if (celestialObjectSPtr_->getJ4().isDefined())
+    {
+        j4_ = celestialObjectSPtr_->getJ4();
+    }
+
+    for (const Shared<Dynamics>& perturbationSPtr : perturbations_)
+    {
+        if ((perturbationSPtr == nullptr) || (!perturbationSPtr->isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Perturbation");
+        }
+
+        if (std::dynamic_pointer_cast<const CentralBodyGravity>(perturbationSPtr) != nullptr)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Perturbation [{}] cannot be a central body gravity: the central body is modeled by the semi-analytic "
+                "model.",
+                perturbationSPtr->getName()
+            );
+        }
+
+        const Array<Shared<const CoordinatesSubset>> writeSubsets = perturbationSPtr->getWriteCoordinatesSubsets();
+
+        if ((writeSubsets.getSize() != 1) || (*writeSubsets.accessFirst() != *CartesianVelocity::Default()))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Perturbation [{}] must only write to the cartesian velocity.", perturbationSPtr->getName()
+            );
+        }
+
+        const Array<Shared<const CoordinatesSubset>> readSubsets = perturbationSPtr->getReadCoordinatesSubsets();
+
+        for (const Shared<const CoordinatesSubset>& subsetSPtr : readSubsets)
+        {
+            LocateSubset(state_, subsetSPtr);
+        }
+
+        perturbationReadSubsets_.add(readSubsets);
+    }
+
+    // Mean elements at epoch
+
+    const COE::CartesianState cartesianState = {state_.getPosition(), state_.getVelocity()};
+    const Derived gravitationalParameter = celestialObjectSPtr_->getGravitationalParameter();
+
+    Vector6d coeVector;
+
+    if (!shortPeriodRecoveryEnabled_)
+    {
+        coeVector = COE::Cartesian(cartesianState, gravitationalParameter).getSIVector(COE::AnomalyType::Mean);
+    }
+    else
+    {
+        // Brouwer-Lyddane mean elements hold the mean anomaly in place of the true anomaly
+
+        const BrouwerLyddaneMeanShort meanElements =
+            BrouwerLyddaneMeanShort::Cartesian(cartesianState, gravitationalParameter);
+
+        coeVector << meanElements.getSemiMajorAxis().inMeters(), meanElements.getEccentricity(),
+            meanElements.getInclination().inRadians(), meanElements.getRaan().inRadians(),
+            meanElements.getAop().inRadians(), meanElements.getMeanAnomaly().inRadians();
+    }
+
+    const VectorXd elementVector = ElementVectorFromCOEVector(coeVector, gravitationalParameter_SI_);
+
+    if (!this->isValid(elementVector))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Mean perigee at [{}] is below the surface.", state_.accessInstant().toString()
+        );
+    }
+
+    forwardNodes_.add(this->calculateNode(state_.accessInstant(), elementVector, nullptr));
+}
+
+SemiAnalytic::SemiAnalytic(const SemiAnalytic& aSemiAnalyticModel)
+    : Model(aSemiAnalyticModel),
+      state_(aSemiAnalyticModel.state_),
+      celestialObjectSPtr_(aSemiAnalyticModel.celestialObjectSPtr_),
+      perturbations_(aSemiAnalyticModel.perturbations_),
+      stepDuration_(aSemiAnalyticModel.stepDuration_),
+      quadraturePointCount_(aSemiAnalyticModel.quadraturePointCount_),
+      shortPeriodRecoveryEnabled_(aSemiAnalyticModel.shortPeriodRecoveryEnabled_),
+      gravitationalParameter_SI_(aSemiAnalyticModel.gravitationalParameter_SI_),
+      equatorialRadius_SI_(aSemiAnalyticModel.equatorialRadius_SI_),
+      j2_(aSemiAnalyticModel.j2_),
+      j4_(aSemiAnalyticModel.j4_),
+      positionIndex_(aSemiAnalyticModel.positionIndex_),
+      velocityIndex_(aSemiAnalyticModel.velocityIndex_),
+      perturbationReadSubsets_(aSemiAnalyticModel.perturbationReadSubsets_),
+      nodeMutex_(),
+      forwardNodes_(),
+      backwardNodes_(),
+      forwardNodesAreComplete_(false),
+      backwardNodesAreComplete_(false)
+{
+    const std::lock_guard<std::mutex> lock(aSemiAnalyticModel.nodeMutex_);
+
+    forwardNodes_ = aSemiAnalyticModel.forwardNodes_;
+    backwardNodes_ = aSemiAnalyticModel.backwardNodes_;
+    forwardNodesAreComplete_ = aSemiAnalyticModel.forwardNodesAreComplete_;
+    backwardNodesAreComplete_ = aSemiAnalyticModel.backwardNodesAreComplete_;
+}
+
+SemiAnalytic& SemiAnalytic::operator=(const SemiAnalytic& aSemiAnalyticModel)
+{
+    if (this != &aSemiAnalyticModel)
+    {
+        Model::operator=(aSemiAnalyticModel);
+
+        state_ = aSemiAnalyticModel.state_;
+        celestialObjectSPtr_ = aSemiAnalyticModel.celestialObjectSPtr_;
+        perturbations_ = aSemiAnalyticModel.perturbations_;
+        stepDuration_ = aSemiAnalyticModel.stepDuration_;
+        quadraturePointCount_ = aSemiAnalyticModel.quadraturePointCount_;
+        shortPeriodRecoveryEnabled_ = aSemiAnalyticModel.shortPeriodRecoveryEnabled_;
+        gravitationalParameter_SI_ = aSemiAnalyticModel.gravitationalParameter_SI_;
+        equatorialRadius_SI_ = aSemiAnalyticModel.equatorialRadius_SI_;
+        j2_ = aSemiAnalyticModel.j2_;
+        j4_ = aSemiAnalyticModel.j4_;
+        positionIndex_ = aSemiAnalyticModel.positionIndex_;
+        velocityIndex_ = aSemiAnalyticModel.velocityIndex_;
+        perturbationReadSubsets_ = aSemiAnalyticModel.perturbationReadSubsets_;
+
+        const std::scoped_lock lock(nodeMutex_, aSemiAnalyticModel.nodeMutex_);
+
+        forwardNodes_ = aSemiAnalyticModel.forwardNodes_;
+        backwardNodes_ = aSemiAnalyticModel.backwardNodes_;
+        forwardNodesAreComplete_ = aSemiAnalyticModel.forwardNodesAreComplete_;
+        backwardNodesAreComplete_ = aSemiAnalyticModel.backwardNodesAreComplete_;
+    }
+
+    return *this;
+}
+
+SemiAnalytic* SemiAnalytic::clone() const
+{
+    return new SemiAnalytic(*this);
+}
+
+bool SemiAnalytic::operator==(const SemiAnalytic& aSemiAnalyticModel) const
+{
+    if ((!this->isDefined()) || (!aSemiAnalyticModel.isDefined()))
+    {
+        return false;
+    }
+
+    return (state_ == aSemiAnalyticModel.state_) &&
+           (celestialObjectSPtr_ == aSemiAnalyticModel.celestialObjectSPtr_) &&
+           (perturbations_ == aSemiAnalyticModel.perturbations_) &&
+           (stepDuration_ == aSemiAnalyticModel.stepDuration_) &&
+           (quadraturePointCount_ == aSemiAnalyticModel.quadraturePointCount_) &&
+           (shortPeriodRecoveryEnabled_ == aSemiAnalyticModel.shortPeriodRecoveryEnabled_);
+}
+
+bool SemiAnalytic::operator!=(const SemiAnalytic& aSemiAnalyticModel) const
+{
+    return !((*this) == aSemiAnalyticModel);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const SemiAnalytic& aSemiAnalyticModel)
+{
+    aSemiAnalyticModel.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool SemiAnalytic::isDefined() const
+{
+    return state_.isDefined() && (celestialObjectSPtr_ != nullptr);
+}
+
+Instant SemiAnalytic::getEpoch() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return state_.getInstant();
+}
+
+Integer SemiAnalytic::getRevolutionNumberAtEpoch() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return 1;
+}
+
+State SemiAnalytic::getState() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return state_;
+}
+
+Shared<const Celestial> SemiAnalytic::getCelestial() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return celestialObjectSPtr_;
+}
+
+Array<Shared<Dynamics>> SemiAnalytic::getPerturbations() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return perturbations_;
+}
+
+Duration SemiAnalytic::getStepDuration() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return stepDuration_;
+}
+
+Size SemiAnalytic::getQuadraturePointCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return quadraturePointCount_;
+}
+
+bool SemiAnalytic::isShortPeriodRecoveryEnabled() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return shortPeriodRecoveryEnabled_;
+}
+
+COE SemiAnalytic::calculateMeanElementsAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    return COE::FromSIVector(
+        COEVectorFromElementVector(this->interpolateMeanElementsAt(anInstant), gravitationalParameter_SI_),
+        COE::AnomalyType::Mean
+    );
+}
+
+State SemiAnalytic::calculateStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    const Vector6d coeVector =
+        COEVectorFromElementVector(this->interpolateMeanElementsAt(anInstant), gravitationalParameter_SI_);
+    const Derived gravitationalParameter = celestialObjectSPtr_->getGravitationalParameter();
+
+    const COE::CartesianState cartesianState =
+        shortPeriodRecoveryEnabled_
+            ? BrouwerLyddaneMeanShort(
+                  Length::Meters(coeVector[0]),
+                  coeVector[1],
+                  Angle::Radians(coeVector[2]),
+                  Angle::Radians(coeVector[3]),
+                  Angle::Radians(coeVector[4]),
+                  Angle::Radians(coeVector[5])
+              )
+                  .getCartesianState(gravitationalParameter, gcrfSPtr)
+            : COE::FromSIVector(coeVector, COE::AnomalyType::Mean).getCartesianState(gravitationalParameter, gcrfSPtr);
+
+    VectorXd coordinates = state_.accessCoordinates();
+    coordinates.segment<3>(positionIndex_) = cartesianState.first.accessCoordinates();
+    coordinates.segment<3>(velocityIndex_) = cartesianState.second.accessCoordinates();
+
+    return {anInstant, coordinates, gcrfSPtr, state_.accessCoordinatesBroker()};
+}
+
+Integer SemiAnalytic::calculateRevolutionNumberAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    // Unwrapped mean argument of latitude, the mean longitude minus the unwrapped right ascension of the ascending node
+
+    double epochRaan = 0.0;
+    double raan = 0.0;
+
+    const VectorXd epochElementVector = this->interpolateMeanElementsAt(state_.accessInstant(), &epochRaan);
+    const VectorXd elementVector = this->interpolateMeanElementsAt(anInstant, &raan);
+
+    const double epochArgumentOfLatitude = epochElementVector[6] - epochRaan;
+    const double argumentOfLatitude = elementVector[6] - raan;
+
+    return this->getRevolutionNumberAtEpoch() +
+           static_cast<int>(
+               std::floor(argumentOfLatitude / (2.0 * M_PI)) - std::floor(epochArgumentOfLatitude / (2.0 * M_PI))
+           );
+}
+
+Instant SemiAnalytic::calculateDecayInstant(const Instant& anEndInstant, const Length& aDecayAltitude) const
+{
+    if (!anEndInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("End instant");
+    }
+
+    if (!aDecayAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Decay altitude");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytic");
+    }
+
+    if (anEndInstant < state_.accessInstant())
+    {
+        throw ostk::core::error::RuntimeError(
+            "End instant [{}] is before the epoch [{}].", anEndInstant.toString(), state_.accessInstant().toString()
+        );
+    }
+
+    const double decayRadius_SI = equatorialRadius_SI_ + aDecayAltitude.inMeters();
+
+    const auto calculatePerigeeRadius = [this](const Node& aNode) -> double
+    {
+        const Vector6d coeVector = COEVectorFromElementVector(aNode.elements, gravitationalParameter_SI_);
+
+        return coeVector[0] * (1.0 - coeVector[1]);
+    };
+
+    Node previousNode;
+    Node node;
+
+    this->tryAccessNode(0, node);
+
+    if (calculatePerigeeRadius(node) < decayRadius_SI)
+    {
+        return state_.getInstant();
+    }
+
+    for (int index = 1; this->getNodeInstant(index - 1) < anEndInstant; ++index)
+    {
+        previousNode = node;
+
+        const Instant instant = this->getNodeInstant(index);
+
+        if (!this->tryAccessNode(index, node))
+        {
+            return (instant <= anEndInstant) ? instant : Instant::Undefined();
+        }
+
+        const double perigeeRadius = calculatePerigeeRadius(node);
+
+        if (perigeeRadius < decayRadius_SI)
+        {
+            const double previousPerigeeRadius = calculatePerigeeRadius(previousNode);
+            const double ratio = (previousPerigeeRadius - decayRadius_SI) / (previousPerigeeRadius - perigeeRadius);
+
+            const Instant decayInstant =
+                this->getNodeInstant(index - 1) + Duration::Seconds(ratio * stepDuration_.inSeconds());
+
+            return (decayInstant <= anEndInstant) ? decayInstant : Instant::Undefined();
+        }
+    }
+
+    return Instant::Undefined();
+}
+
+void SemiAnalytic::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Semi-Analytic") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Epoch:" << (state_.isDefined() ? state_.accessInstant().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Celestial:" << ((celestialObjectSPtr_ != nullptr) ? celestialObjectSPtr_->getName() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Step duration:" << (stepDuration_.isDefined() ? stepDuration_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Quadrature point count:" << quadraturePointCount_;
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Short-period recovery:" << (shortPeriodRecoveryEnabled_ ? "Enabled" : "Disabled");
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Perturbations");
+
+    for (const Shared<Dynamics>& perturbationSPtr : perturbations_)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << perturbationSPtr->getName();
+    }
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+bool SemiAnalytic::operator==(const trajectory::Model& aModel) const
+{
+    const SemiAnalytic* semiAnalyticModelPtr = dynamic_cast<const SemiAnalytic*>(&aModel);
+
+    return (semiAnalyticModelPtr != nullptr) && this->operator==(*semiAnalyticModelPtr);
+}
+
+bool SemiAnalytic::operator!=(const trajectory::Model& aModel) const
+{
+    return !((*this) == aModel);
+}
+
+VectorXd SemiAnalytic::calculateMeanElementRates(const Instant& anInstant, const VectorXd& anElementVector) const
+{
+    if (!this->isValid(anElementVector))
+    {
+        return VectorXd::Constant(ElementCount, std::numeric_limits<double>::quiet_NaN());
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    const double mu = gravitationalParameter_SI_;
+
+    const Vector3d angularMomentumVector = anElementVector.segment<3>(0);
+
+    const double angularMomentum = angularMomentumVector.norm();
+    const double eccentricity = anElementVector.segment<3>(3).norm();
+    const double eta = std::sqrt(1.0 - eccentricity * eccentricity);
+    const double semiMajorAxis = angularMomentum * angularMomentum / (mu * eta * eta);
+    const double semiLatusRectum = angularMomentum * angularMomentum / mu;
+    const double meanMotion = std::sqrt(mu / (semiMajorAxis * semiMajorAxis * semiMajorAxis));
+
+    Vector3d normalDirection;
+    Vector3d nodeDirection;
+    Vector3d perigeeDirection;
+
+    CalculateDirections(anElementVector, normalDirection, nodeDirection, perigeeDirection);
+
+    const Vector3d eccentricityVector = eccentricity * perigeeDirection;
+    const Vector3d semiMinorDirection = normalDirection.cross(perigeeDirection);
+
+    const double meanAnomaly = COEVectorFromElementVector(anElementVector, mu)[5];
+
+    VectorXd fullCoordinates = state_.accessCoordinates();
+
+    Vector3d angularMomentumRate = Vector3d::Zero();
+    Vector3d eccentricityVectorRate = Vector3d::Zero();
+    double meanLongitudeRate = meanMotion;
+
+    // Average the Gauss variational equations over the mean orbit, with a trapezoidal rule in eccentric anomaly
+    // weighted by dM / dE, spectrally accurate for periodic integrands
+
+    for (Size pointIndex = 0; pointIndex < quadraturePointCount_; ++pointIndex)
+    {
+        const double eccentricAnomaly = 2.0 * M_PI * double(pointIndex) / double(quadraturePointCount_);
+        const double cosE = std::cos(eccentricAnomaly);
+        const double sinE = std::sin(eccentricAnomaly);
+
+        const double radius = semiMajorAxis * (1.0 - eccentricity * cosE);
+        const double weight = (1.0 - eccentricity * cosE) / double(quadraturePointCount_);
+
+        const Vector3d positionCoordinates = semiMajorAxis * (cosE - eccentricity) * perigeeDirection +
+                                             semiMajorAxis * eta * sinE * semiMinorDirection;
+        const Vector3d velocityCoordinates =
+            (std::sqrt(mu * semiMajorAxis) / radius) * (-sinE * perigeeDirection + eta * cosE * semiMinorDirection);
+
+        Vector3d acceleration =
+            CalculateZonalAcceleration(positionCoordinates, mu, equatorialRadius_SI_, j2_, j4_);
+
+        if (!perturbations_.isEmpty())
+        {
+            const double pointMeanAnomaly = eccentricAnomaly - eccentricity * sinE;
+            const Instant pointInstant =
+                anInstant + Duration::Seconds(WrapAngle(pointMeanAnomaly - meanAnomaly) / meanMotion);
+
+            fullCoordinates.segment<3>(positionIndex_) = positionCoordinates;
+            fullCoordinates.segment<3>(velocityIndex_) = velocityCoordinates;
+
+            for (Size perturbationIndex = 0; perturbationIndex < perturbations_.getSize(); ++perturbationIndex)
+            {
+                const VectorXd x = state_.accessCoordinatesBroker()->extractCoordinates(
+                    fullCoordinates, perturbationReadSubsets_[perturbationIndex]
+                );
+
+                acceleration +=
+                    perturbations_[perturbationIndex]->computeContribution(pointInstant, x, gcrfSPtr).head<3>();
+            }
+        }
+
+        const Vector3d radialDirection = positionCoordinates / radius;
+        const Vector3d transverseDirection = normalDirection.cross(radialDirection);
+
+        const double radialAcceleration = acceleration.dot(radialDirection);
+        const double transverseAcceleration = acceleration.dot(transverseDirection);
+        const double normalAcceleration = acceleration.dot(normalDirection);
+
+        const Vector3d torque = positionCoordinates.cross(acceleration);
+
+        angularMomentumRate += weight * torque;
+        eccentricityVectorRate +=
+            weight * (acceleration.cross(angularMomentumVector) + velocityCoordinates.cross(torque)) / mu;
+
+        // Mean longitude rate, with the 1 / e terms of the mean anomaly and longitude of perigee rates combined
+
+        const double eCosNu = eccentricityVector.dot(radialDirection);
+        const double eSinNu = eccentricityVector.dot(transverseDirection);
+
+        const double radialTerm = -2.0 * eta * radius * radialAcceleration / angularMomentum;
+        const double eccentricityTerm = -(semiLatusRectum * eCosNu * radialAcceleration -
+                                          (semiLatusRectum + radius) * eSinNu * transverseAcceleration) /
+                                        (angularMomentum * (1.0 + eta));
+        const double normalTerm =
+            positionCoordinates.z() * normalAcceleration / (angularMomentum * (1.0 + normalDirection.z()));
+
+        meanLongitudeRate += weight * (radialTerm + eccentricityTerm + normalTerm);
+    }
+
+    VectorXd rates(ElementCount);
+    rates << angularMomentumRate, eccentricityVectorRate, meanLongitudeRate;
+
+    return rates;
+}
+
+SemiAnalytic::Node SemiAnalytic::calculateNode(
+    const Instant& anInstant, const VectorXd& anElementVector, const Node* aPreviousNodePtr
+) const
+{
+    const double raan = COEVectorFromElementVector(anElementVector, gravitationalParameter_SI_)[3];
+
+    return {
+        anElementVector,
+        this->calculateMeanElementRates(anInstant, anElementVector),
+        (aPreviousNodePtr != nullptr) ? (aPreviousNodePtr->raan + WrapAngle(raan - aPreviousNodePtr->raan)) : raan,
+    };
+}
+
+bool SemiAnalytic::isValid(const VectorXd& anElementVector) const
+{
+    if (!anElementVector.allFinite())
+    {
+        return false;
+    }
+
+    const double angularMomentum = anElementVector.segment<3>(0).norm();
+    const double eccentricity = anElementVector.segment<3>(3).norm();
+
+    if ((angularMomentum <= 0.0) || (eccentricity >= 1.0))
+    {
+        return false;
+    }
+
+    const double semiLatusRectum = angularMomentum * angularMomentum / gravitationalParameter_SI_;
+
+    return (semiLatusRectum / (1.0 + eccentricity)) > equatorialRadius_SI_;
+}
+
+Instant SemiAnalytic::getNodeInstant(const int& anIndex) const
+{
+    return state_.accessInstant() + Duration::Seconds(double(anIndex) * stepDuration_.inSeconds());
+}
+
+VectorXd SemiAnalytic::integrateStep(const Instant& anInstant, const Node& aNode, const Real& aStepDuration_s) const
+{
+    const double step = aStepDuration_s;
+
+    const Instant midInstant = anInstant + Duration::Seconds(0.5 * step);
+    const Instant endInstant = anInstant + Duration::Seconds(step);
+
+    const VectorXd& k1 = aNode.rates;
+    const VectorXd k2 = this->calculateMeanElementRates(midInstant, aNode.elements + 0.5 * step * k1);
+    const VectorXd k3 = this->calculateMeanElementRates(midInstant, aNode.elements + 0.5 * step * k2);
+    const VectorXd k4 = this->calculateMeanElementRates(endInstant, aNode.elements + step * k3);
+
+    return aNode.elements + (step / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+}
+
+bool SemiAnalytic::tryAccessNode(const int& anIndex, Node& aNode) const
+{
+    const std::lock_guard<std::mutex> lock(nodeMutex_);
+
+    const bool isForward = anIndex >= 0;
+
+    Array<Node>& nodes = isForward ? forwardNodes_ : backwardNodes_;
+    bool& nodesAreComplete = isForward ? forwardNodesAreComplete_ : backwardNodesAreComplete_;
+
+    // Forward nodes are indexed from the epoch, backward nodes from the step before the epoch
+
+    const Size position = isForward ? Size(anIndex) : Size(-anIndex - 1);
+
+    while (nodes.getSize() <= position)
+    {
+        if (nodesAreComplete)
+        {
+            return false;
+        }
+
+        const int nodeCount = static_cast<int>(nodes.getSize());
+        const int previousIndex = isForward ? (nodeCount - 1) : -nodeCount;
+        const Node& previousNode =
+            (isForward || (!nodes.isEmpty())) ? nodes.accessLast() : forwardNodes_.accessFirst();
+
+        const double step = isForward ? stepDuration_.inSeconds() : -stepDuration_.inSeconds();
+
+        const VectorXd elementVector = this->integrateStep(this->getNodeInstant(previousIndex), previousNode, step);
+
+        if (!this->isValid(elementVector))
+        {
+            nodesAreComplete = true;
+            return false;
+        }
+
+        const Node node = this->calculateNode(
+            this->getNodeInstant(isForward ? (previousIndex + 1) : (previousIndex - 1)), elementVector, &previousNode
+        );
+
+        if (!node.rates.allFinite())
+        {
+            nodesAreComplete = true;
+            return false;
+        }
+
+        nodes.add(node);
+    }
+
+    aNode = nodes[position];
+
+    return true;
+}
+
+VectorXd SemiAnalytic::interpolateMeanElementsAt(const Instant& anInstant, double* aRaanPtr) const
+{
+    const double stepDuration_s = stepDuration_.inSeconds();
+    const double offset = Duration::Between(state_.accessInstant(), anInstant).inSeconds() / stepDuration_s;
+
+    const int index = static_cast<int>(std::floor(offset));
+    const double s = offset - std::floor(offset);
+
+    Node node;
+
+    if (!this->tryAccessNode(index, node))
+    {
+        throw ostk::core::error::RuntimeError("Orbit has decayed before [{}].", anInstant.toString());
+    }
+
+    VectorXd elementVector = node.elements;
+
+    if (s > 0.0)
+    {
+        Node nextNode;
+
+        if (!this->tryAccessNode(index + 1, nextNode))
+        {
+            throw ostk::core::error::RuntimeError("Orbit has decayed before [{}].", anInstant.toString());
+        }
+
+        // Cubic Hermite interpolation, from the mean elements and rates at both ends of the step
+
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        elementVector = (2.0 * s3 - 3.0 * s2 + 1.0) * node.elements +
+                        ((s3 - 2.0 * s2 + s) * stepDuration_s) * node.rates +
+                        (-2.0 * s3 + 3.0 * s2) * nextNode.elements + ((s3 - s2) * stepDuration_s) * nextNode.rates;
+    }
+
+    if (aRaanPtr != nullptr)
+    {
+        const double raan = COEVectorFromElementVector(elementVector, gravitationalParameter_SI_)[3];
+
+        *aRaanPtr = node.raan + WrapAngle(raan - node.raan);
+    }
+
+    return elementVector;
+}
+
+}  // namespace models
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
@@ -1,10 +1,18 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Time.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/FidelitySchedule.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
@@ -20,283 +28,1519 @@ using ostk::core::ctnr::Array;
 using ostk::core::types::Index;
 using ostk::core::ctnr::Pair;
 
+using ostk::math::object::Vector3d;
 using ostk::math::object::VectorXd;
 
 using ostk::physics::environment::object::Celestial;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Length;
 
 using ostk::astro::dynamics::PositionDerivative;
 using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::FidelitySchedule;
 using ostk::astro::dynamics::ThirdBodyGravity;
 using ostk::astro::dynamics::AtmosphericDrag;
+using ostk::astro::trajectory::state::CoordinatesBroker;
 using ostk::astro::trajectory::state::CoordinatesSubset;
 
-const Shared<const Frame> Propagator::IntegrationFrameSPtr = Frame::GCRF();
+using Vector4d = Eigen::Matrix<double, 4, 1>;
+using Matrix4d = Eigen::Matrix<double, 4, 4>;
 
-Propagator::Propagator(const NumericalSolver& aNumericalSolver, const Array<Shared<Dynamics>>& aDynamicsArray)
-    : dynamicsContexts_(),
-      numericalSolver_(aNumericalSolver)
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second);
+
+namespace
 {
-    for (const Shared<Dynamics>& aDynamicsSPtr : aDynamicsArray)
-    {
-        this->registerDynamicsContext(aDynamicsSPtr);
-    }
-}
 
-bool Propagator::operator==(const Propagator& aPropagator) const
+/// @brief Rectify the Encke reference orbit when the position deviation exceeds this fraction of its radius
+const double EnckeRectificationThreshold = 1.0e-2;
+
+/// @brief Tolerance (in seconds) on the time of the Kustaanheimo-Stiefel output states
+const double KustaanheimoStiefelTimeTolerance = 1.0e-8;
+
+/// @brief Tolerance (in seconds) under which a Kustaanheimo-Stiefel event is attributed to the end instant
+const double KustaanheimoStiefelEndTolerance = 1.0e-6;
+
+/// @brief Compute the Stumpff functions c2 and c3 of the universal variable formulation
+void StumpffFunctions(const double& z, double& c2, double& c3)
 {
-    if ((!this->isDefined()) || (!aPropagator.isDefined()))
+    if (z > 1.0e-6)
     {
-        return false;
+        const double sqrtZ = std::sqrt(z);
+
+        c2 = (1.0 - std::cos(sqrtZ)) / z;
+        c3 = (sqrtZ - std::sin(sqrtZ)) / (z * sqrtZ);
     }
+    else if (z < -1.0e-6)
+    {
+        const double sqrtMinusZ = std::sqrt(-z);
 
-    return (
-        numericalSolver_ == aPropagator.numericalSolver_ &&
-        *this->coordinatesBrokerSPtr_ == *(aPropagator.coordinatesBrokerSPtr_)
-    );
+        c2 = (std::cosh(sqrtMinusZ) - 1.0) / (-z);
+        c3 = (std::sinh(sqrtMinusZ) - sqrtMinusZ) / (-z * sqrtMinusZ);
+    }
+    else
+    {
+        c2 = 1.0 / 2.0 - z / 24.0 + z * z / 720.0;
+        c3 = 1.0 / 6.0 - z / 120.0 + z * z / 5040.0;
+    }
 }
 
-bool Propagator::operator!=(const Propagator& aPropagator) const
+/// @brief Get the equations of motion of a set of dynamics, and set the step observer updating the values held by the
+/// dynamics on the numerical solver integrating them
+NumericalSolver::SystemOfEquationsWrapper GetObservedSystemOfEquations(
+    NumericalSolver& aNumericalSolver,
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    Array<Duration>* aWallTimeArrayPtr
+)
 {
-    return !((*this) == aPropagator);
-}
+    NumericalSolver::StepObserver stepObserver = nullptr;
 
-std::ostream& operator<<(std::ostream& anOutputStream, const Propagator& aPropagator)
-{
-    aPropagator.print(anOutputStream);
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetSystemOfEquations(
+        aContextArray, anInstant, Propagator::IntegrationFrameSPtr, aWallTimeArrayPtr, &stepObserver
+    );
 
-    return anOutputStream;
-}
+    aNumericalSolver.setStepObserver(stepObserver);
 
-bool Propagator::isDefined() const
-{
-    return this->numericalSolver_.isDefined() && this->coordinatesBrokerSPtr_ != nullptr &&
-           !this->dynamicsContexts_.isEmpty();
+    return systemOfEquations;
 }
 
-const Shared<CoordinatesBroker>& Propagator::accessCoordinatesBroker() const
+/// @brief Central body of a set of dynamics: its gravitational parameter, and the indexes of the cartesian position
+/// and velocity coordinates
+struct CentralBody
 {
-    if (!this->isDefined())
+    double gravitationalParameter;
+    Index positionIndex;
+    Index velocityIndex;
+
+    static CentralBody FromDynamicsContexts(
+        const Array<Dynamics::Context>& aContextArray, const Propagator::Formulation& aFormulation
+    )
     {
-        throw ostk::core::error::runtime::Undefined("Propagator");
-    }
+        Shared<const CentralBodyGravity> centralBodyGravitySPtr = nullptr;
+        Index positionIndex = 0;
+        Index velocityIndex = 0;
+        bool hasPositionDerivative = false;
 
-    return this->coordinatesBrokerSPtr_;
-}
+        for (const Dynamics::Context& dynamicsContext : aContextArray)
+        {
+            if (const Shared<const CentralBodyGravity> dynamicsSPtr =
+                    std::dynamic_pointer_cast<const CentralBodyGravity>(dynamicsContext.dynamics))
+            {
+                centralBodyGravitySPtr = dynamicsSPtr;
+                positionIndex = dynamicsContext.readIndexes[0].first;
+                velocityIndex = dynamicsContext.writeIndexes[0].first;
+            }
+
+            if (std::dynamic_pointer_cast<const PositionDerivative>(dynamicsContext.dynamics) != nullptr)
+            {
+                hasPositionDerivative = true;
+            }
+        }
 
-const NumericalSolver& Propagator::accessNumericalSolver() const
+        if ((centralBodyGravitySPtr == nullptr) || (!hasPositionDerivative))
+        {
+            throw ostk::core::error::RuntimeError(String::Format(
+                "{} formulation requires a central body gravity and a position derivative dynamics.",
+                Propagator::StringFromFormulation(aFormulation)
+            ));
+        }
+
+        return {
+            centralBodyGravitySPtr->getCelestial()->getGravitationalParameter().in(GravitationalParameterSIUnit),
+            positionIndex,
+            velocityIndex,
+        };
+    }
+};
+
+/// @brief Keplerian reference orbit
+///
+/// The reference orbit osculates a state at its epoch, and is propagated with the universal variable formulation,
+/// which holds for elliptic, parabolic and hyperbolic orbits. Deviation states (Encke formulation) hold the position
+/// and velocity deviations from the reference orbit, and the other coordinates unchanged.
+class KeplerianReference
 {
-    if (!this->isDefined())
+   public:
+    KeplerianReference(
+        const State& aState,
+        const double& aGravitationalParameter,
+        const Index& aPositionIndex,
+        const Index& aVelocityIndex
+    )
+        : epoch_(aState.accessInstant()),
+          position_(aState.accessCoordinates().segment(aPositionIndex, 3)),
+          velocity_(aState.accessCoordinates().segment(aVelocityIndex, 3)),
+          gravitationalParameter_(aGravitationalParameter),
+          positionIndex_(aPositionIndex),
+          velocityIndex_(aVelocityIndex),
+          alpha_((2.0 / position_.norm()) - (velocity_.squaredNorm() / aGravitationalParameter))
     {
-        throw ostk::core::error::runtime::Undefined("Propagator");
     }
 
-    return this->numericalSolver_;
-}
+    KeplerianReference(const State& aState, const CentralBody& aCentralBody)
+        : KeplerianReference(
+              aState, aCentralBody.gravitationalParameter, aCentralBody.positionIndex, aCentralBody.velocityIndex
+          )
+    {
+    }
 
-Size Propagator::getNumberOfCoordinates() const
-{
-    return this->accessCoordinatesBroker()->getNumberOfCoordinates();
-}
+    /// @brief Duration between two rectification checks: a quarter of the period, or the radius to speed ratio for
+    /// open orbits
+    Duration getArcDuration() const
+    {
+        if (alpha_ > 0.0)
+        {
+            return Duration::Seconds(0.5 * M_PI / std::sqrt(gravitationalParameter_ * alpha_ * alpha_ * alpha_));
+        }
 
-Array<Shared<Dynamics>> Propagator::getDynamics() const
-{
-    Array<Shared<Dynamics>> dynamicsArray = Array<Shared<Dynamics>>::Empty();
+        return Duration::Seconds(position_.norm() / velocity_.norm());
+    }
 
-    for (const Dynamics::Context& dynamicsContext : this->dynamicsContexts_)
+    /// @brief Solve the universal Kepler equation for a duration (in seconds) from the epoch
+    ///
+    /// @return The universal anomaly, in sqrt(m)
+    double calculateUniversalAnomalyAt(const double& aDuration) const
     {
-        dynamicsArray.add(dynamicsContext.dynamics);
+        if (aDuration == 0.0)
+        {
+            return 0.0;
+        }
+
+        const double sqrtMu = std::sqrt(gravitationalParameter_);
+        const double radius = position_.norm();
+        const double radialProduct = position_.dot(velocity_) / sqrtMu;
+
+        // Initial guess of the universal anomaly
+
+        double chi = sqrtMu * aDuration / radius;
+
+        if (alpha_ > 1.0e-12)
+        {
+            chi = sqrtMu * aDuration * alpha_;
+        }
+        else if (alpha_ < -1.0e-12)
+        {
+            const double semiMajorAxis = 1.0 / alpha_;
+            const double sign = (aDuration > 0.0) ? 1.0 : -1.0;
+
+            const double hyperbolicGuess =
+                sign * std::sqrt(-semiMajorAxis) *
+                std::log(
+                    (-2.0 * gravitationalParameter_ * alpha_ * aDuration) /
+                    (position_.dot(velocity_) +
+                     sign * std::sqrt(-gravitationalParameter_ * semiMajorAxis) * (1.0 - radius * alpha_))
+                );
+
+            if (std::isfinite(hyperbolicGuess) && ((hyperbolicGuess * aDuration) > 0.0))
+            {
+                chi = hyperbolicGuess;
+            }
+        }
+
+        // Solve the universal Kepler equation with Newton iterations
+
+        double z = 0.0;
+        double c2 = 0.0;
+        double c3 = 0.0;
+
+        for (Size iteration = 0; iteration < 50; ++iteration)
+        {
+            z = alpha_ * chi * chi;
+            StumpffFunctions(z, c2, c3);
+
+            const double currentRadius =
+                chi * chi * c2 + radialProduct * chi * (1.0 - z * c3) + radius * (1.0 - z * c2);
+
+            const double residual = chi * chi * chi * c3 + radialProduct * chi * chi * c2 +
+                                    radius * chi * (1.0 - z * c3) - sqrtMu * aDuration;
+
+            const double correction = residual / currentRadius;
+
+            chi -= correction;
+
+            if (std::abs(correction) <= 1.0e-12 * std::max(1.0, std::abs(chi)))
+            {
+                break;
+            }
+        }
+
+        return chi;
     }
 
-    return dynamicsArray;
-}
+    /// @brief Propagate the reference orbit by a duration (in seconds) from its epoch
+    void calculateAt(const double& aDuration, Vector3d& aPosition, Vector3d& aVelocity) const
+    {
+        if (aDuration == 0.0)
+        {
+            aPosition = position_;
+            aVelocity = velocity_;
 
-void Propagator::setDynamics(const Array<Shared<Dynamics>>& aDynamicsArray)
-{
-    this->clearDynamics();
+            return;
+        }
 
-    for (const Shared<Dynamics>& aDynamicsSPtr : aDynamicsArray)
+        const double sqrtMu = std::sqrt(gravitationalParameter_);
+        const double radius = position_.norm();
+
+        const double chi = this->calculateUniversalAnomalyAt(aDuration);
+
+        double c2 = 0.0;
+        double c3 = 0.0;
+        const double z = alpha_ * chi * chi;
+        StumpffFunctions(z, c2, c3);
+
+        // Lagrange coefficients
+
+        const double f = 1.0 - chi * chi * c2 / radius;
+        const double g = aDuration - chi * chi * chi * c3 / sqrtMu;
+
+        aPosition = f * position_ + g * velocity_;
+
+        const double currentRadius = aPosition.norm();
+
+        const double fDot = sqrtMu * chi * (z * c3 - 1.0) / (currentRadius * radius);
+        const double gDot = 1.0 - chi * chi * c2 / currentRadius;
+
+        aVelocity = fDot * position_ + gDot * velocity_;
+    }
+
+    /// @brief Convert a full state to a deviation state
+    State toDeviationState(const State& aState) const
     {
-        this->registerDynamicsContext(aDynamicsSPtr);
+        return this->applyReference(aState, -1.0);
     }
-}
 
-void Propagator::addDynamics(const Shared<Dynamics>& aDynamicsSPtr)
-{
-    if (aDynamicsSPtr == nullptr || !aDynamicsSPtr->isDefined())
+    /// @brief Convert a deviation state to a full state
+    State toFullState(const State& aDeviationState) const
     {
-        throw ostk::core::error::runtime::Undefined("Dynamics");
+        return this->applyReference(aDeviationState, 1.0);
     }
 
-    this->registerDynamicsContext(aDynamicsSPtr);
-}
+    /// @brief Check if the position deviation has grown enough for the reference orbit to be rectified
+    bool requiresRectification(const State& aDeviationState) const
+    {
+        Vector3d position;
+        Vector3d velocity;
+        this->calculateAt((aDeviationState.accessInstant() - epoch_).inSeconds(), position, velocity);
 
-void Propagator::clearDynamics()
-{
-    this->dynamicsContexts_.clear();
-    this->coordinatesBrokerSPtr_ = std::make_shared<CoordinatesBroker>();
-}
+        return aDeviationState.accessCoordinates().segment(positionIndex_, 3).norm() >
+               (EnckeRectificationThreshold * position.norm());
+    }
 
-State Propagator::calculateStateAt(const State& aState, const Instant& anInstant) const
-{
-    if (!this->isDefined())
+    /// @brief Build the reference orbit osculating the full state corresponding to a deviation state
+    KeplerianReference rectify(const State& aDeviationState) const
     {
-        throw ostk::core::error::runtime::Undefined("Propagator");
+        return {this->toFullState(aDeviationState), gravitationalParameter_, positionIndex_, velocityIndex_};
     }
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+    /// @brief Get the equations of motion of the deviation state, for a given start instant, and set the step
+    /// observer of the full state on the numerical solver integrating them
+    NumericalSolver::SystemOfEquationsWrapper getSystemOfEquations(
+        NumericalSolver& aNumericalSolver,
+        const Array<Dynamics::Context>& aContextArray,
+        const Instant& aStartInstant,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const
+    {
+        NumericalSolver::StepObserver stepObserver = nullptr;
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetSystemOfEquations(
+            aContextArray, aStartInstant, Propagator::IntegrationFrameSPtr, aWallTimeArrayPtr, &stepObserver
+        );
 
-    const State solverOutputState = numericalSolver_.integrateTime(
-        solverInputState,
-        anInstant,
-        Dynamics::GetSystemOfEquations(
-            this->dynamicsContexts_, solverInputState.accessInstant(), Propagator::IntegrationFrameSPtr
-        )
-    );
+        const KeplerianReference reference = *this;
+        const double startDuration = (aStartInstant - epoch_).inSeconds();
 
-    const StateBuilder outputStateBuilder = {aState};
+        aNumericalSolver.setStepObserver(nullptr);
 
-    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
-}
+        if (stepObserver != nullptr)
+        {
+            aNumericalSolver.setStepObserver(
+                [reference, stepObserver, startDuration](
+                    const NumericalSolver::StateVector& x, const double& t, const bool& isStart
+                ) -> bool
+                {
+                    Vector3d position;
+                    Vector3d velocity;
+                    reference.calculateAt(startDuration + t, position, velocity);
+
+                    NumericalSolver::StateVector fullStateVector = x;
+                    fullStateVector.segment(reference.positionIndex_, 3) += position;
+                    fullStateVector.segment(reference.velocityIndex_, 3) += velocity;
+
+                    return stepObserver(fullStateVector, t, isStart);
+                }
+            );
+        }
 
-NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
-    const State& aState, const Instant& anInstant, const EventCondition& anEventCondition
-) const
-{
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Propagator");
-    }
+        return [reference, systemOfEquations, startDuration](
+                   const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+               ) -> void
+        {
+            Vector3d position;
+            Vector3d velocity;
+            reference.calculateAt(startDuration + t, position, velocity);
 
-    const Instant& startInstant = aState.accessInstant();
+            NumericalSolver::StateVector fullStateVector = x;
+            fullStateVector.segment(reference.positionIndex_, 3) += position;
+            fullStateVector.segment(reference.velocityIndex_, 3) += velocity;
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+            systemOfEquations(fullStateVector, dxdt, t);
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+            // Remove the Keplerian motion of the reference orbit
 
-    NumericalSolver::ConditionSolution conditionSolution = numericalSolver_.integrateTime(
-        solverInputState,
-        anInstant,
-        Dynamics::GetSystemOfEquations(this->dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr),
-        anEventCondition
-    );
+            const double radius = position.norm();
 
-    const StateBuilder outputStateBuilder = {aState};
+            dxdt.segment(reference.positionIndex_, 3) -= velocity;
+            dxdt.segment(reference.velocityIndex_, 3) +=
+                (reference.gravitationalParameter_ / (radius * radius * radius)) * position;
+        };
+    }
 
-    conditionSolution.state = outputStateBuilder.expand(conditionSolution.state.inFrame(aState.accessFrame()), aState);
+   private:
+    Instant epoch_;
+    Vector3d position_;
+    Vector3d velocity_;
+    double gravitationalParameter_;
+    Index positionIndex_;
+    Index velocityIndex_;
+    double alpha_;
 
-    return conditionSolution;
-}
+    State applyReference(const State& aState, const double& aSign) const
+    {
+        Vector3d position;
+        Vector3d velocity;
+        this->calculateAt((aState.accessInstant() - epoch_).inSeconds(), position, velocity);
+
+        VectorXd coordinates = aState.accessCoordinates();
+        coordinates.segment(positionIndex_, 3) += aSign * position;
+        coordinates.segment(velocityIndex_, 3) += aSign * velocity;
+
+        return {
+            aState.accessInstant(),
+            coordinates,
+            aState.accessFrame(),
+            aState.accessCoordinatesBroker(),
+        };
+    }
+};
 
-Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Instant>& anInstantArray) const
+/// @brief Evaluate an event condition on the full states corresponding to deviation states
+class EnckeEventCondition : public EventCondition
 {
-    if (!this->isDefined())
+   public:
+    EnckeEventCondition(const EventCondition& anEventCondition, const KeplerianReference& aReference)
+        : EventCondition(anEventCondition.getName(), anEventCondition.getEvaluator(), anEventCondition.getTarget()),
+          eventCondition_(anEventCondition),
+          reference_(aReference)
     {
-        throw ostk::core::error::runtime::Undefined("Propagator");
     }
 
-    if (!aState.isDefined())
+    virtual bool isSatisfied(const State& currentState, const State& previousState) const override
     {
-        throw ostk::core::error::runtime::Undefined("State");
+        return eventCondition_.isSatisfied(
+            reference_.toFullState(currentState), reference_.toFullState(previousState)
+        );
     }
 
-    if (anInstantArray.isEmpty())
+   private:
+    const EventCondition& eventCondition_;
+    const KeplerianReference& reference_;
+};
+
+/// @brief Publish the observed states and diagnostics of the call-local numerical solver of a propagation to the
+/// propagator at its end, once the diagnostics scope is closed
+class WorkspacePublisher
+{
+   public:
+    WorkspacePublisher(const std::function<void()>& aPublisher)
+        : publisher_(aPublisher)
     {
-        return Array<State>::Empty();
     }
 
-    for (Size k = 0; k < anInstantArray.getSize() - 1; ++k)
+    ~WorkspacePublisher()
     {
-        if (anInstantArray[k] > anInstantArray[k + 1])
+        publisher_();
+    }
+
+   private:
+    const std::function<void()> publisher_;
+};
+
+/// @brief Reset the diagnostics of a numerical solver at the start of a propagation, and add the wall time spent in
+/// each dynamics to them at its end
+class DiagnosticsScope
+{
+   public:
+    DiagnosticsScope(
+        const bool& isEnabled,
+        NumericalSolver::Diagnostics& aDiagnostics,
+        const Array<Dynamics::Context>& aContextArray
+    )
+        : isEnabled_(isEnabled),
+          diagnostics_(aDiagnostics),
+          contextArray_(aContextArray),
+          wallTimes_(aContextArray.getSize(), Duration::Zero())
+    {
+        if (isEnabled_)
         {
-            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array");
+            diagnostics_ = NumericalSolver::Diagnostics();
         }
     }
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+    ~DiagnosticsScope()
+    {
+        if (!isEnabled_)
+        {
+            return;
+        }
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+        for (Index i = 0; i < contextArray_.getSize(); ++i)
+        {
+            const String name = contextArray_[i].dynamics->getName();
+
+            const auto wallTimeIt = diagnostics_.dynamicsWallTimes.find(name);
+
+            if (wallTimeIt == diagnostics_.dynamicsWallTimes.end())
+            {
+                diagnostics_.dynamicsWallTimes.insert({name, wallTimes_[i]});
+            }
+            else
+            {
+                wallTimeIt->second += wallTimes_[i];
+            }
+        }
+    }
 
-    const Instant& startInstant = solverInputState.accessInstant();
+    /// @brief Access the wall times to be filled by the systems of equations, if diagnostics are enabled
+    Array<Duration>* accessWallTimes()
+    {
+        return isEnabled_ ? &wallTimes_ : nullptr;
+    }
 
-    Array<Instant> forwardInstants;
-    forwardInstants.reserve(anInstantArray.getSize());
-    Array<Instant> backwardInstants;
-    backwardInstants.reserve(anInstantArray.getSize());
+   private:
+    const bool isEnabled_;
+    NumericalSolver::Diagnostics& diagnostics_;
+    const Array<Dynamics::Context>& contextArray_;
+    Array<Duration> wallTimes_;
+};
+
+/// @brief Kustaanheimo-Stiefel regularization of a propagation from an epoch state
+///
+/// Regularized states hold the Kustaanheimo-Stiefel position u and velocity du/dtau (with dt = r dtau), the Keplerian
+/// energy, and the time elapsed since the epoch (in seconds), followed by the coordinates other than the cartesian
+/// position and velocity. The instant of a regularized state is the epoch plus the fictitious time s, defined by the
+/// Sundman transformation dt = (r / r0) ds where r0 is the radius at the epoch, so that s is close to the time near
+/// the epoch.
+class KustaanheimoStiefelTransformation
+{
+   public:
+    KustaanheimoStiefelTransformation(const State& anEpochState, const CentralBody& aCentralBody)
+        : epochState_(anEpochState),
+          centralBody_(aCentralBody),
+          epochRadius_(anEpochState.accessCoordinates().segment(aCentralBody.positionIndex, 3).norm()),
+          regularizedCoordinatesBrokerSPtr_(nullptr),
+          otherCoordinatesSegments_(Array<Pair<Index, Size>>::Empty())
+    {
+        const Shared<CoordinatesBroker> regularizedCoordinatesBrokerSPtr =
+            std::make_shared<CoordinatesBroker>(Array<Shared<const CoordinatesSubset>> {
+                std::make_shared<CoordinatesSubset>("KUSTAANHEIMO_STIEFEL_POSITION", 4),
+                std::make_shared<CoordinatesSubset>("KUSTAANHEIMO_STIEFEL_VELOCITY", 4),
+                std::make_shared<CoordinatesSubset>("KUSTAANHEIMO_STIEFEL_ENERGY", 1),
+                std::make_shared<CoordinatesSubset>("KUSTAANHEIMO_STIEFEL_TIME", 1),
+            });
 
-    const StateBuilder outputStateBuilder(aState);
+        Index index = 0;
 
-    for (const Instant& anInstant : anInstantArray)
+        for (const Shared<const CoordinatesSubset>& subset : anEpochState.accessCoordinatesBroker()->accessSubsets())
+        {
+            if ((index != centralBody_.positionIndex) && (index != centralBody_.velocityIndex))
+            {
+                regularizedCoordinatesBrokerSPtr->addSubset(subset);
+                otherCoordinatesSegments_.add({index, subset->getSize()});
+            }
+
+            index += subset->getSize();
+        }
+
+        regularizedCoordinatesBrokerSPtr_ = regularizedCoordinatesBrokerSPtr;
+    }
+
+    /// @brief Get the regularized state of the epoch state, at fictitious time zero
+    State getRegularizedEpochState() const
     {
-        if (anInstant <= startInstant)
+        const VectorXd& coordinates = epochState_.accessCoordinates();
+
+        const Vector3d position = coordinates.segment(centralBody_.positionIndex, 3);
+        const Vector3d velocity = coordinates.segment(centralBody_.velocityIndex, 3);
+        const double radius = position.norm();
+
+        Vector4d u;
+
+        if (position.x() >= 0.0)
         {
-            backwardInstants.add(anInstant);
+            u[0] = std::sqrt(0.5 * (radius + position.x()));
+            u[1] = position.y() / (2.0 * u[0]);
+            u[2] = position.z() / (2.0 * u[0]);
+            u[3] = 0.0;
         }
         else
         {
-            forwardInstants.add(anInstant);
+            u[1] = std::sqrt(0.5 * (radius - position.x()));
+            u[0] = position.y() / (2.0 * u[1]);
+            u[2] = 0.0;
+            u[3] = position.z() / (2.0 * u[1]);
+        }
+
+        const Vector4d uPrime = 0.5 * KustaanheimoStiefelTransformation::L(u).transpose() *
+                                (Vector4d() << velocity, 0.0).finished();
+
+        VectorXd regularizedCoordinates(regularizedCoordinatesBrokerSPtr_->getNumberOfCoordinates());
+
+        regularizedCoordinates.segment(0, 4) = u;
+        regularizedCoordinates.segment(4, 4) = uPrime;
+        regularizedCoordinates[8] = (centralBody_.gravitationalParameter / radius) - 0.5 * velocity.squaredNorm();
+        regularizedCoordinates[9] = 0.0;
+
+        Index regularizedIndex = 10;
+
+        for (const Pair<Index, Size>& segment : otherCoordinatesSegments_)
+        {
+            regularizedCoordinates.segment(regularizedIndex, segment.second) =
+                coordinates.segment(segment.first, segment.second);
+            regularizedIndex += segment.second;
         }
+
+        return {
+            epochState_.accessInstant(),
+            regularizedCoordinates,
+            epochState_.accessFrame(),
+            regularizedCoordinatesBrokerSPtr_,
+        };
     }
 
-    // forward propagation only
-    Array<State> forwardPropagatedStates;
-    if (!forwardInstants.isEmpty())
+    /// @brief Get the time elapsed since the epoch (in seconds) of a regularized state
+    double getElapsedSeconds(const State& aRegularizedState) const
     {
-        forwardPropagatedStates = numericalSolver_.integrateTime(
-            solverInputState,
-            forwardInstants,
-            Dynamics::GetSystemOfEquations(this->dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
-        );
+        return aRegularizedState.accessCoordinates()[9];
     }
 
-    // backward propagation only
-    Array<State> backwardPropagatedStates;
-    if (!backwardInstants.isEmpty())
+    /// @brief Convert a regularized state to a full state
+    State toFullState(const State& aRegularizedState) const
     {
-        std::reverse(backwardInstants.begin(), backwardInstants.end());
-
-        backwardPropagatedStates = numericalSolver_.integrateTime(
-            solverInputState,
-            backwardInstants,
-            Dynamics::GetSystemOfEquations(this->dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
+        return this->toFullState(
+            aRegularizedState,
+            epochState_.accessInstant() + Duration::Seconds(this->getElapsedSeconds(aRegularizedState))
         );
-
-        std::reverse(backwardPropagatedStates.begin(), backwardPropagatedStates.end());
     }
 
-    Array<State> outputStates;
-    outputStates.reserve(backwardPropagatedStates.getSize() + forwardPropagatedStates.getSize());
+    /// @brief Convert a regularized state to a full state, at a given instant
+    State toFullState(const State& aRegularizedState, const Instant& anInstant) const
+    {
+        return {
+            anInstant,
+            this->toFullCoordinates(aRegularizedState.accessCoordinates()),
+            epochState_.accessFrame(),
+            epochState_.accessCoordinatesBroker(),
+        };
+    }
 
-    for (const State& solverOutputState : backwardPropagatedStates + forwardPropagatedStates)
+    /// @brief Estimate the fictitious duration corresponding to a duration from a full state, on its osculating
+    /// Keplerian orbit
+    Duration calculateFictitiousDuration(const State& aState, const Duration& aDuration) const
     {
-        outputStates.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+        const double universalAnomaly =
+            KeplerianReference(aState, centralBody_).calculateUniversalAnomalyAt(aDuration.inSeconds());
+
+        return Duration::Seconds(epochRadius_ * universalAnomaly / std::sqrt(centralBody_.gravitationalParameter));
     }
 
-    return outputStates;
-}
+    /// @brief Integrate a regularized state until its elapsed time matches an instant
+    ///
+    /// The fictitious duration to the instant is estimated on the osculating Keplerian orbit, and refined until the
+    /// time offset due to the perturbations vanishes.
+    State integrateToInstant(
+        NumericalSolver& aNumericalSolver,
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const State& aRegularizedState,
+        const Instant& anInstant
+    ) const
+    {
+        const double elapsedSeconds = (anInstant - epochState_.accessInstant()).inSeconds();
 
-void Propagator::print(std::ostream& anOutputStream, bool displayDecorator) const
-{
-    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Propagator") : void();
+        State regularizedState = aRegularizedState;
 
-    ostk::core::utils::Print::Separator(anOutputStream, "Numerical Solver");
-    numericalSolver_.print(anOutputStream, false);
+        for (Size iteration = 0; iteration < 10; ++iteration)
+        {
+            const double timeOffset = elapsedSeconds - this->getElapsedSeconds(regularizedState);
 
-    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
-}
+            if (std::abs(timeOffset) <= KustaanheimoStiefelTimeTolerance)
+            {
+                break;
+            }
 
-Propagator Propagator::Undefined()
-{
-    return {
-        NumericalSolver::Undefined(),
-        Array<Shared<Dynamics>>::Empty(),
-    };
-}
+            const Duration fictitiousDuration =
+                this->calculateFictitiousDuration(this->toFullState(regularizedState), Duration::Seconds(timeOffset));
 
-Propagator Propagator::Default()
-{
-    return {
+            if (fictitiousDuration.isZero())
+            {
+                break;
+            }
+
+            const Array<Instant> instants = {regularizedState.accessInstant() + fictitiousDuration};
+
+            regularizedState =
+                aNumericalSolver.integrateTime(regularizedState, instants, aSystemOfEquations).accessFirst();
+        }
+
+        return regularizedState;
+    }
+
+    /// @brief Get the equations of motion of the regularized state, with respect to the fictitious time, and set the
+    /// step observer of the full state on the numerical solver integrating them
+    NumericalSolver::SystemOfEquationsWrapper getSystemOfEquations(
+        NumericalSolver& aNumericalSolver,
+        const Array<Dynamics::Context>& aContextArray,
+        Array<Duration>* aWallTimeArrayPtr
+    ) const
+    {
+        NumericalSolver::StepObserver stepObserver = nullptr;
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetSystemOfEquations(
+            aContextArray,
+            epochState_.accessInstant(),
+            Propagator::IntegrationFrameSPtr,
+            aWallTimeArrayPtr,
+            &stepObserver
+        );
+
+        const KustaanheimoStiefelTransformation transformation = *this;
+
+        // The physical time, relative to the epoch, is the last regularized coordinate
+
+        aNumericalSolver.setStepObserver(nullptr);
+
+        if (stepObserver != nullptr)
+        {
+            aNumericalSolver.setStepObserver(
+                [transformation, stepObserver](
+                    const NumericalSolver::StateVector& y, const double& s, const bool& isStart
+                ) -> bool
+                {
+                    (void)s;
+
+                    return stepObserver(transformation.toFullCoordinates(y), y[9], isStart);
+                }
+            );
+        }
+
+        return [transformation, systemOfEquations](
+                   const NumericalSolver::StateVector& y, NumericalSolver::StateVector& dyds, const double s
+               ) -> void
+        {
+            (void)s;
+
+            const Vector4d u = y.segment(0, 4);
+            const Vector4d uPrime = y.segment(4, 4);
+            const double energy = y[8];
+
+            const Matrix4d l = KustaanheimoStiefelTransformation::L(u);
+            const double radius = u.squaredNorm();
+
+            const NumericalSolver::StateVector x = transformation.toFullCoordinates(y);
+            NumericalSolver::StateVector dxdt = NumericalSolver::StateVector::Zero(x.size());
+
+            systemOfEquations(x, dxdt, y[9]);
+
+            // Perturbing acceleration: the total acceleration minus the Keplerian acceleration of the central body
+
+            const CentralBody& centralBody = transformation.centralBody_;
+
+            Vector4d perturbation = Vector4d::Zero();
+            perturbation.head(3) = dxdt.segment(centralBody.velocityIndex, 3) +
+                                   (centralBody.gravitationalParameter / (radius * radius * radius)) *
+                                       x.segment(centralBody.positionIndex, 3);
+
+            const Vector4d transformedPerturbation = l.transpose() * perturbation;
+
+            // Derivatives with respect to tau, scaled by dtau/ds = 1 / r0
+
+            const double scale = 1.0 / transformation.epochRadius_;
+
+            dyds.segment(0, 4) = scale * uPrime;
+            dyds.segment(4, 4) = scale * ((-0.5 * energy) * u + (0.5 * radius) * transformedPerturbation);
+            dyds[8] = scale * (-2.0 * uPrime.dot(transformedPerturbation));
+            dyds[9] = scale * radius;
+
+            Index regularizedIndex = 10;
+
+            for (const Pair<Index, Size>& segment : transformation.otherCoordinatesSegments_)
+            {
+                dyds.segment(regularizedIndex, segment.second) =
+                    (scale * radius) * dxdt.segment(segment.first, segment.second);
+                regularizedIndex += segment.second;
+            }
+        };
+    }
+
+   private:
+    State epochState_;
+    CentralBody centralBody_;
+    double epochRadius_;
+    Shared<const CoordinatesBroker> regularizedCoordinatesBrokerSPtr_;
+    Array<Pair<Index, Size>> otherCoordinatesSegments_;
+
+    VectorXd toFullCoordinates(const VectorXd& aRegularizedCoordinates) const
+    {
+        const Vector4d u = aRegularizedCoordinates.segment(0, 4);
+        const Vector4d uPrime = aRegularizedCoordinates.segment(4, 4);
+
+        const Matrix4d l = KustaanheimoStiefelTransformation::L(u);
+
+        VectorXd coordinates(epochState_.accessCoordinates().size());
+
+        coordinates.segment(centralBody_.positionIndex, 3) = (l * u).head(3);
+        coordinates.segment(centralBody_.velocityIndex, 3) = ((2.0 / u.squaredNorm()) * (l * uPrime)).head(3);
+
+        Index regularizedIndex = 10;
+
+        for (const Pair<Index, Size>& segment : otherCoordinatesSegments_)
+        {
+            coordinates.segment(segment.first, segment.second) =
+                aRegularizedCoordinates.segment(regularizedIndex, segment.second);
+            regularizedIndex += segment.second;
+        }
+
+        return coordinates;
+    }
+
+    static Matrix4d L(const Vector4d& u)
+    {
+        Matrix4d l;
+
+        l << u[0], -u[1], -u[2], u[3],  //
+            u[1], u[0], -u[3], -u[2],   //
+            u[2], u[3], u[0], u[1],     //
+            u[3], -u[2], u[1], -u[0];
+
+        return l;
+    }
+};
+
+/// @brief Evaluate an event condition on the full states corresponding to regularized states, and detect the crossing
+/// of an end instant
+class KustaanheimoStiefelEventCondition : public EventCondition
+{
+   public:
+    KustaanheimoStiefelEventCondition(
+        const EventCondition& anEventCondition,
+        const KustaanheimoStiefelTransformation& aTransformation,
+        const Instant& aStartInstant,
+        const Instant& anEndInstant
+    )
+        : EventCondition(anEventCondition.getName(), anEventCondition.getEvaluator(), anEventCondition.getTarget()),
+          eventCondition_(anEventCondition),
+          transformation_(aTransformation),
+          endElapsedSeconds_((anEndInstant - aStartInstant).inSeconds()),
+          direction_((anEndInstant >= aStartInstant) ? 1.0 : -1.0)
+    {
+    }
+
+    virtual bool isSatisfied(const State& currentState, const State& previousState) const override
+    {
+        if (this->isEndReached(currentState) && (!this->isEndReached(previousState)))
+        {
+            return true;
+        }
+
+        return eventCondition_.isSatisfied(
+            transformation_.toFullState(currentState), transformation_.toFullState(previousState)
+        );
+    }
+
+    /// @brief Check if a regularized state is at (within a tolerance, in seconds) or past the end instant
+    bool isEndReached(const State& aRegularizedState, const double& aTolerance = 0.0) const
+    {
+        return (direction_ * (transformation_.getElapsedSeconds(aRegularizedState) - endElapsedSeconds_)) >=
+               -aTolerance;
+    }
+
+   private:
+    const EventCondition& eventCondition_;
+    const KustaanheimoStiefelTransformation& transformation_;
+    double endElapsedSeconds_;
+    double direction_;
+};
+
+/// @brief Check if a set of dynamics contains fidelity schedules, which are only supported with the Cowell formulation
+bool HasFidelitySchedule(const Array<Dynamics::Context>& aContextArray, const Propagator::Formulation& aFormulation)
+{
+    const bool hasFidelitySchedule = std::any_of(
+        aContextArray.begin(),
+        aContextArray.end(),
+        [](const Dynamics::Context& aContext) -> bool
+        {
+            return std::dynamic_pointer_cast<const FidelitySchedule>(aContext.dynamics) != nullptr;
+        }
+    );
+
+    if (hasFidelitySchedule && (aFormulation != Propagator::Formulation::Cowell))
+    {
+        throw ostk::core::error::runtime::ToBeImplemented(String::Format(
+            "Fidelity schedules with the {} formulation", Propagator::StringFromFormulation(aFormulation)
+        ));
+    }
+
+    return hasFidelitySchedule;
+}
+
+/// @brief Regimes of the fidelity schedules of a set of dynamics, along a propagation
+///
+/// The contexts of the schedules are replaced by contexts of their current regimes, which read from and write to the
+/// same coordinates. The initial regimes hold the criteria of the initial state, without hysteresis.
+class FidelityScheduleRegimes
+{
+   public:
+    FidelityScheduleRegimes(const Array<Dynamics::Context>& aContextArray, const State& aState)
+        : contexts_(aContextArray),
+          contextIndexes_(Array<Index>::Empty()),
+          schedules_(Array<Shared<const FidelitySchedule>>::Empty()),
+          regimeIndexes_(Array<Index>::Empty())
+    {
+        for (Index i = 0; i < contexts_.getSize(); ++i)
+        {
+            if (const Shared<const FidelitySchedule> scheduleSPtr =
+                    std::dynamic_pointer_cast<const FidelitySchedule>(contexts_[i].dynamics))
+            {
+                contextIndexes_.add(i);
+                schedules_.add(scheduleSPtr);
+                regimeIndexes_.add(
+                    scheduleSPtr->calculateRegimeIndex(FidelityScheduleRegimes::CalculateCriterionValue(
+                        *scheduleSPtr, aState
+                    ))
+                );
+            }
+        }
+
+        this->pinRegimes();
+    }
+
+    const Array<Dynamics::Context>& accessContexts() const
+    {
+        return contexts_;
+    }
+
+    /// @brief Calculate the direction in which a state leaves the regime of each schedule: 1 upwards, -1 downwards,
+    /// and 0 if the state is in the regime
+    Array<Integer> calculateExitDirections(const State& aState) const
+    {
+        Array<Integer> exitDirections = Array<Integer>(schedules_.getSize(), 0);
+
+        for (Index k = 0; k < schedules_.getSize(); ++k)
+        {
+            const Real criterionValue = FidelityScheduleRegimes::CalculateCriterionValue(*schedules_[k], aState);
+
+            if (!schedules_[k]->isInRegime(criterionValue, regimeIndexes_[k]))
+            {
+                exitDirections[k] = (schedules_[k]->calculateRegimeIndex(criterionValue) > regimeIndexes_[k]) ? 1 : -1;
+            }
+        }
+
+        return exitDirections;
+    }
+
+    /// @brief Move each schedule to the neighbouring regime in its exit direction
+    void switchRegimes(const Array<Integer>& anExitDirectionArray)
+    {
+        for (Index k = 0; k < schedules_.getSize(); ++k)
+        {
+            if (anExitDirectionArray[k] > 0)
+            {
+                ++regimeIndexes_[k];
+            }
+            else if (anExitDirectionArray[k] < 0)
+            {
+                --regimeIndexes_[k];
+            }
+        }
+
+        this->pinRegimes();
+    }
+
+   private:
+    Array<Dynamics::Context> contexts_;
+    Array<Index> contextIndexes_;
+    Array<Shared<const FidelitySchedule>> schedules_;
+    Array<Index> regimeIndexes_;
+
+    void pinRegimes()
+    {
+        for (Index k = 0; k < schedules_.getSize(); ++k)
+        {
+            contexts_[contextIndexes_[k]].dynamics = schedules_[k]->accessRegime(regimeIndexes_[k]);
+        }
+    }
+
+    static Real CalculateCriterionValue(const FidelitySchedule& aFidelitySchedule, const State& aState)
+    {
+        return aFidelitySchedule.calculateCriterionValue(
+            aState.accessInstant(), aState.getPosition().accessCoordinates(), aState.accessFrame()
+        );
+    }
+};
+
+/// @brief Detect the exit of a state from the regimes of fidelity schedules, or the satisfaction of an event condition
+/// if any. The cause of the first satisfaction, which is the one found by the numerical solver, is latched.
+class FidelityScheduleEventCondition : public EventCondition
+{
+   public:
+    FidelityScheduleEventCondition(
+        const FidelityScheduleRegimes& aRegimes, const EventCondition* anEventConditionPtr = nullptr
+    )
+        : EventCondition(
+              "Fidelity Schedule Regime Exit",
+              [](const State&) -> Real
+              {
+                  return 0.0;
+              },
+              0.0
+          ),
+          regimes_(aRegimes),
+          eventConditionPtr_(anEventConditionPtr),
+          isLatched_(false),
+          eventConditionIsSatisfied_(false),
+          exitDirections_(Array<Integer>::Empty())
+    {
+    }
+
+    virtual bool isSatisfied(const State& currentState, const State& previousState) const override
+    {
+        const bool eventConditionIsSatisfied =
+            (eventConditionPtr_ != nullptr) && eventConditionPtr_->isSatisfied(currentState, previousState);
+
+        const Array<Integer> exitDirections = regimes_.calculateExitDirections(currentState);
+
+        const bool isExited = std::any_of(
+            exitDirections.begin(),
+            exitDirections.end(),
+            [](const Integer& anExitDirection) -> bool
+            {
+                return anExitDirection != 0;
+            }
+        );
+
+        if ((eventConditionIsSatisfied || isExited) && (!isLatched_))
+        {
+            isLatched_ = true;
+            eventConditionIsSatisfied_ = eventConditionIsSatisfied;
+            exitDirections_ = exitDirections;
+        }
+
+        return eventConditionIsSatisfied || isExited;
+    }
+
+    /// @brief Check if the event condition caused the first satisfaction
+    bool eventConditionIsSatisfied() const
+    {
+        return eventConditionIsSatisfied_;
+    }
+
+    /// @brief Access the exit directions at the first satisfaction
+    const Array<Integer>& accessExitDirections() const
+    {
+        return exitDirections_;
+    }
+
+   private:
+    const FidelityScheduleRegimes& regimes_;
+    const EventCondition* eventConditionPtr_;
+    mutable bool isLatched_;
+    mutable bool eventConditionIsSatisfied_;
+    mutable Array<Integer> exitDirections_;
+};
+
+}  // namespace
+
+const Shared<const Frame> Propagator::IntegrationFrameSPtr = Frame::GCRF();
+
+Propagator::Propagator(
+    const NumericalSolver& aNumericalSolver,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const Propagator::Formulation& aFormulation
+)
+    : dynamicsContexts_(),
+      numericalSolver_(aNumericalSolver),
+      formulation_(aFormulation)
+{
+    for (const Shared<Dynamics>& aDynamicsSPtr : aDynamicsArray)
+    {
+        this->registerDynamicsContext(aDynamicsSPtr);
+    }
+}
+
+Propagator::Propagator(const Propagator& aPropagator)
+    : coordinatesBrokerSPtr_(aPropagator.coordinatesBrokerSPtr_),
+      dynamicsContexts_(aPropagator.dynamicsContexts_),
+      numericalSolver_(NumericalSolver::Undefined()),
+      formulation_(aPropagator.formulation_),
+      numericalSolverMutex_()
+{
+    const std::lock_guard<std::mutex> lock(aPropagator.numericalSolverMutex_);
+
+    numericalSolver_ = aPropagator.numericalSolver_;
+}
+
+Propagator& Propagator::operator=(const Propagator& aPropagator)
+{
+    if (this == &aPropagator)
+    {
+        return *this;
+    }
+
+    coordinatesBrokerSPtr_ = aPropagator.coordinatesBrokerSPtr_;
+    dynamicsContexts_ = aPropagator.dynamicsContexts_;
+    formulation_ = aPropagator.formulation_;
+
+    const std::scoped_lock lock(numericalSolverMutex_, aPropagator.numericalSolverMutex_);
+
+    numericalSolver_ = aPropagator.numericalSolver_;
+
+    return *this;
+}
+
+bool Propagator::operator==(const Propagator& aPropagator) const
+{
+    if ((!this->isDefined()) || (!aPropagator.isDefined()))
+    {
+        return false;
+    }
+
+    return (
+        numericalSolver_ == aPropagator.numericalSolver_ &&
+        *this->coordinatesBrokerSPtr_ == *(aPropagator.coordinatesBrokerSPtr_) &&
+        formulation_ == aPropagator.formulation_
+    );
+}
+
+bool Propagator::operator!=(const Propagator& aPropagator) const
+{
+    return !((*this) == aPropagator);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Propagator& aPropagator)
+{
+    aPropagator.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Propagator::isDefined() const
+{
+    return this->numericalSolver_.isDefined() && this->coordinatesBrokerSPtr_ != nullptr &&
+           !this->dynamicsContexts_.isEmpty();
+}
+
+const Shared<CoordinatesBroker>& Propagator::accessCoordinatesBroker() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    return this->coordinatesBrokerSPtr_;
+}
+
+const NumericalSolver& Propagator::accessNumericalSolver() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    return this->numericalSolver_;
+}
+
+NumericalSolver Propagator::getNumericalSolver() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    const std::lock_guard<std::mutex> lock(numericalSolverMutex_);
+
+    return this->numericalSolver_;
+}
+
+Tuple<Array<State>, NumericalSolver::Diagnostics> Propagator::getObservedStatesAndDiagnostics() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    const std::lock_guard<std::mutex> lock(numericalSolverMutex_);
+
+    return {this->numericalSolver_.accessObservedStates(), this->numericalSolver_.accessDiagnostics()};
+}
+
+Propagator::Formulation Propagator::getFormulation() const
+{
+    return formulation_;
+}
+
+Size Propagator::getNumberOfCoordinates() const
+{
+    return this->accessCoordinatesBroker()->getNumberOfCoordinates();
+}
+
+Array<Shared<Dynamics>> Propagator::getDynamics() const
+{
+    Array<Shared<Dynamics>> dynamicsArray = Array<Shared<Dynamics>>::Empty();
+
+    for (const Dynamics::Context& dynamicsContext : this->dynamicsContexts_)
+    {
+        dynamicsArray.add(dynamicsContext.dynamics);
+    }
+
+    return dynamicsArray;
+}
+
+void Propagator::setDynamics(const Array<Shared<Dynamics>>& aDynamicsArray)
+{
+    this->clearDynamics();
+
+    for (const Shared<Dynamics>& aDynamicsSPtr : aDynamicsArray)
+    {
+        this->registerDynamicsContext(aDynamicsSPtr);
+    }
+}
+
+void Propagator::addDynamics(const Shared<Dynamics>& aDynamicsSPtr)
+{
+    if (aDynamicsSPtr == nullptr || !aDynamicsSPtr->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Dynamics");
+    }
+
+    this->registerDynamicsContext(aDynamicsSPtr);
+}
+
+void Propagator::clearDynamics()
+{
+    this->dynamicsContexts_.clear();
+    this->coordinatesBrokerSPtr_ = std::make_shared<CoordinatesBroker>();
+}
+
+State Propagator::calculateStateAt(const State& aState, const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+
+    NumericalSolver numericalSolver = this->createNumericalSolverWorkspace();
+
+    const WorkspacePublisher workspacePublisher = {
+        [this, &numericalSolver]() -> void
+        {
+            this->publishNumericalSolverWorkspace(numericalSolver);
+        },
+    };
+
+    DiagnosticsScope diagnosticsScope = {
+        numericalSolver.diagnosticsEnabled_, numericalSolver.diagnostics_, this->dynamicsContexts_
+    };
+
+    Array<Duration>* wallTimeArrayPtr = diagnosticsScope.accessWallTimes();
+
+    const bool isScheduled = HasFidelitySchedule(this->dynamicsContexts_, formulation_);
+
+    State solverOutputState = State::Undefined();
+
+    switch (formulation_)
+    {
+        case Propagator::Formulation::Encke:
+            solverOutputState =
+                this->calculateEnckeStateAt(numericalSolver, solverInputState, anInstant, wallTimeArrayPtr);
+            break;
+
+        case Propagator::Formulation::KustaanheimoStiefel:
+            solverOutputState = this->calculateKustaanheimoStiefelStatesAt(
+                                        numericalSolver, solverInputState, {anInstant}, wallTimeArrayPtr
+                                    )
+                                    .accessFirst();
+            break;
+
+        default:
+            if (isScheduled)
+            {
+                solverOutputState =
+                    this->calculateScheduledStatesAt(numericalSolver, solverInputState, {anInstant}, wallTimeArrayPtr)
+                        .accessFirst();
+                break;
+            }
+
+            solverOutputState = numericalSolver.integrateTime(
+                solverInputState,
+                anInstant,
+                GetObservedSystemOfEquations(
+                    numericalSolver, this->dynamicsContexts_, solverInputState.accessInstant(), wallTimeArrayPtr
+                )
+            );
+            break;
+    }
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
+}
+
+NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
+    const State& aState,
+    const Instant& anInstant,
+    const EventCondition& anEventCondition,
+    const Real& anInitialTimeStep
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (anInitialTimeStep.isDefined() && (!anInitialTimeStep.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Initial time step");
+    }
+
+    const Instant& startInstant = aState.accessInstant();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+
+    NumericalSolver numericalSolver = this->createNumericalSolverWorkspace();
+
+    // The fictitious time step of a regularized integration equals the time step at the start of the propagation
+
+    if (anInitialTimeStep.isDefined())
+    {
+        numericalSolver.setTimeStep(anInitialTimeStep);
+    }
+
+    const WorkspacePublisher workspacePublisher = {
+        [this, &numericalSolver]() -> void
+        {
+            this->publishNumericalSolverWorkspace(numericalSolver);
+        },
+    };
+
+    DiagnosticsScope diagnosticsScope = {
+        numericalSolver.diagnosticsEnabled_, numericalSolver.diagnostics_, this->dynamicsContexts_
+    };
+
+    const bool isScheduled = HasFidelitySchedule(this->dynamicsContexts_, formulation_);
+
+    NumericalSolver::ConditionSolution conditionSolution = {State::Undefined(), false, 0, false};
+
+    switch (formulation_)
+    {
+        case Propagator::Formulation::Encke:
+            conditionSolution = this->calculateEnckeStateToCondition(
+                numericalSolver, solverInputState, anInstant, anEventCondition, diagnosticsScope.accessWallTimes()
+            );
+            break;
+
+        case Propagator::Formulation::KustaanheimoStiefel:
+            conditionSolution = this->calculateKustaanheimoStiefelStateToCondition(
+                numericalSolver, solverInputState, anInstant, anEventCondition, diagnosticsScope.accessWallTimes()
+            );
+            break;
+
+        default:
+            if (isScheduled)
+            {
+                conditionSolution = this->calculateScheduledStateToCondition(
+                    numericalSolver, solverInputState, anInstant, anEventCondition, diagnosticsScope.accessWallTimes()
+                );
+                break;
+            }
+
+            conditionSolution = numericalSolver.integrateTime(
+                solverInputState,
+                anInstant,
+                GetObservedSystemOfEquations(
+                    numericalSolver, this->dynamicsContexts_, startInstant, diagnosticsScope.accessWallTimes()
+                ),
+                anEventCondition
+            );
+            break;
+    }
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    conditionSolution.state = outputStateBuilder.expand(conditionSolution.state.inFrame(aState.accessFrame()), aState);
+
+    return conditionSolution;
+}
+
+Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    for (Size k = 0; k < anInstantArray.getSize() - 1; ++k)
+    {
+        if (anInstantArray[k] > anInstantArray[k + 1])
+        {
+            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array");
+        }
+    }
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+
+    const Instant& startInstant = solverInputState.accessInstant();
+
+    Array<Instant> forwardInstants;
+    forwardInstants.reserve(anInstantArray.getSize());
+    Array<Instant> backwardInstants;
+    backwardInstants.reserve(anInstantArray.getSize());
+
+    const StateBuilder outputStateBuilder(aState);
+
+    NumericalSolver numericalSolver = this->createNumericalSolverWorkspace();
+
+    const WorkspacePublisher workspacePublisher = {
+        [this, &numericalSolver]() -> void
+        {
+            this->publishNumericalSolverWorkspace(numericalSolver);
+        },
+    };
+
+    DiagnosticsScope diagnosticsScope = {
+        numericalSolver.diagnosticsEnabled_, numericalSolver.diagnostics_, this->dynamicsContexts_
+    };
+
+    Array<Duration>* wallTimeArrayPtr = diagnosticsScope.accessWallTimes();
+
+    const bool isScheduled = HasFidelitySchedule(this->dynamicsContexts_, formulation_);
+
+    const auto integrateStates =
+        [this, &numericalSolver, &solverInputState, &startInstant, &wallTimeArrayPtr, &isScheduled](
+            const Array<Instant>& aSortedInstantArray
+        ) -> Array<State>
+    {
+        if (isScheduled)
+        {
+            return this->calculateScheduledStatesAt(
+                numericalSolver, solverInputState, aSortedInstantArray, wallTimeArrayPtr
+            );
+        }
+
+        if (formulation_ == Propagator::Formulation::Encke)
+        {
+            return this->calculateEnckeStatesAt(
+                numericalSolver, solverInputState, aSortedInstantArray, wallTimeArrayPtr
+            );
+        }
+
+        if (formulation_ == Propagator::Formulation::KustaanheimoStiefel)
+        {
+            return this->calculateKustaanheimoStiefelStatesAt(
+                numericalSolver, solverInputState, aSortedInstantArray, wallTimeArrayPtr
+            );
+        }
+
+        return numericalSolver.integrateTime(
+            solverInputState,
+            aSortedInstantArray,
+            GetObservedSystemOfEquations(numericalSolver, this->dynamicsContexts_, startInstant, wallTimeArrayPtr)
+        );
+    };
+
+    for (const Instant& anInstant : anInstantArray)
+    {
+        if (anInstant <= startInstant)
+        {
+            backwardInstants.add(anInstant);
+        }
+        else
+        {
+            forwardInstants.add(anInstant);
+        }
+    }
+
+    // forward propagation only
+    Array<State> forwardPropagatedStates;
+    if (!forwardInstants.isEmpty())
+    {
+        forwardPropagatedStates = integrateStates(forwardInstants);
+    }
+
+    // backward propagation only
+    Array<State> backwardPropagatedStates;
+    if (!backwardInstants.isEmpty())
+    {
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+
+        backwardPropagatedStates = integrateStates(backwardInstants);
+
+        std::reverse(backwardPropagatedStates.begin(), backwardPropagatedStates.end());
+    }
+
+    Array<State> outputStates;
+    outputStates.reserve(backwardPropagatedStates.getSize() + forwardPropagatedStates.getSize());
+
+    for (const State& solverOutputState : backwardPropagatedStates + forwardPropagatedStates)
+    {
+        outputStates.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+    }
+
+    return outputStates;
+}
+
+void Propagator::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Propagator") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Formulation:" << Propagator::StringFromFormulation(formulation_);
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Numerical Solver");
+    numericalSolver_.print(anOutputStream, false);
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Propagator Propagator::Undefined()
+{
+    return {
+        NumericalSolver::Undefined(),
+        Array<Shared<Dynamics>>::Empty(),
+    };
+}
+
+Propagator Propagator::Default()
+{
+    return {
         NumericalSolver::Default(),
         {std::make_shared<PositionDerivative>()},
     };
@@ -315,6 +1559,24 @@ Propagator Propagator::FromEnvironment(const NumericalSolver& aNumericalSolver,
     };
 }
 
+String Propagator::StringFromFormulation(const Propagator::Formulation& aFormulation)
+{
+    switch (aFormulation)
+    {
+        case Propagator::Formulation::Cowell:
+            return "Cowell";
+
+        case Propagator::Formulation::Encke:
+            return "Encke";
+
+        case Propagator::Formulation::KustaanheimoStiefel:
+            return "KustaanheimoStiefel";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Formulation");
+    }
+}
+
 void Propagator::registerDynamicsContext(const Shared<Dynamics>& aDynamicsSPtr)
 {
     // Store read coordinate subsets information
@@ -338,6 +1600,516 @@ void Propagator::registerDynamicsContext(const Shared<Dynamics>& aDynamicsSPtr)
     this->dynamicsContexts_.add({aDynamicsSPtr, readInfo, writeInfo});
 }
 
+NumericalSolver Propagator::createNumericalSolverWorkspace() const
+{
+    const std::lock_guard<std::mutex> lock(numericalSolverMutex_);
+
+    return numericalSolver_.createWorkspace();
+}
+
+void Propagator::publishNumericalSolverWorkspace(NumericalSolver& aNumericalSolver) const
+{
+    const std::lock_guard<std::mutex> lock(numericalSolverMutex_);
+
+    std::swap(numericalSolver_.observedStates_, aNumericalSolver.observedStates_);
+
+    if (aNumericalSolver.diagnosticsEnabled_)
+    {
+        numericalSolver_.diagnostics_ = aNumericalSolver.diagnostics_;
+    }
+}
+
+Array<State> Propagator::calculateScheduledStatesAt(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    FidelityScheduleRegimes regimes = {this->dynamicsContexts_, aState};
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    State arcStartState = aState;
+
+    // Integrate over arcs, at the end of which the state leaves the regime of a schedule, and restart with the next
+    // regime
+
+    while (states.getSize() < anInstantArray.getSize())
+    {
+        const Array<Instant> arcInstants(anInstantArray.begin() + states.getSize(), anInstantArray.end());
+
+        const FidelityScheduleEventCondition regimeExitCondition = {regimes};
+
+        const NumericalSolver::ConditionSolution arcSolution = aNumericalSolver.integrateTimesToCondition(
+            arcStartState,
+            arcInstants,
+            GetObservedSystemOfEquations(
+                aNumericalSolver, regimes.accessContexts(), arcStartState.accessInstant(), aWallTimeArrayPtr
+            ),
+            regimeExitCondition,
+            states
+        );
+
+        if ((!arcSolution.conditionIsSatisfied) || (states.getSize() == anInstantArray.getSize()))
+        {
+            break;
+        }
+
+        regimes.switchRegimes(regimeExitCondition.accessExitDirections());
+        arcStartState = arcSolution.state;
+
+        aNumericalSolver.resume(arcSolution.nextTimeStep);
+    }
+
+    return states;
+}
+
+NumericalSolver::ConditionSolution Propagator::calculateScheduledStateToCondition(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Instant& anInstant,
+    const EventCondition& anEventCondition,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    FidelityScheduleRegimes regimes = {this->dynamicsContexts_, aState};
+
+    State arcStartState = aState;
+
+    // Integrate over arcs, at the end of which the state leaves the regime of a schedule, and resume with the next
+    // regime
+
+    while (true)
+    {
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = GetObservedSystemOfEquations(
+            aNumericalSolver, regimes.accessContexts(), arcStartState.accessInstant(), aWallTimeArrayPtr
+        );
+
+        const FidelityScheduleEventCondition arcEventCondition = {regimes, &anEventCondition};
+
+        const NumericalSolver::ConditionSolution arcSolution =
+            aNumericalSolver.integrateTime(arcStartState, anInstant, systemOfEquations, arcEventCondition);
+
+        if ((!arcSolution.conditionIsSatisfied) || arcEventCondition.eventConditionIsSatisfied())
+        {
+            return arcSolution;
+        }
+
+        regimes.switchRegimes(arcEventCondition.accessExitDirections());
+        arcStartState = arcSolution.state;
+
+        aNumericalSolver.resume(arcSolution.nextTimeStep);
+    }
+}
+
+State Propagator::calculateEnckeStateAt(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Instant& anInstant,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    KeplerianReference reference = {
+        aState, CentralBody::FromDynamicsContexts(this->dynamicsContexts_, Propagator::Formulation::Encke)
+    };
+
+    // The numerical solver integrates the deviation from the reference orbit, and observes the full state
+
+    aNumericalSolver.setStateConverter(
+        [&reference](const State& aDeviationState) -> State
+        {
+            return reference.toFullState(aDeviationState);
+        }
+    );
+
+    const bool isForward = anInstant >= aState.accessInstant();
+
+    State deviationState = reference.toDeviationState(aState);
+
+    // Integrate over arcs, at the end of which the reference orbit is rectified if needed
+
+    while (true)
+    {
+        const Instant arcStartInstant = deviationState.accessInstant();
+        const Duration arcDuration = reference.getArcDuration();
+
+        Instant arcEndInstant = isForward ? (arcStartInstant + arcDuration) : (arcStartInstant - arcDuration);
+
+        const bool isLastArc = isForward ? (arcEndInstant >= anInstant) : (arcEndInstant <= anInstant);
+
+        if (isLastArc)
+        {
+            arcEndInstant = anInstant;
+        }
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = reference.getSystemOfEquations(
+            aNumericalSolver, this->dynamicsContexts_, arcStartInstant, aWallTimeArrayPtr
+        );
+
+        const State arcEndDeviationState =
+            aNumericalSolver.integrateTime(deviationState, arcEndInstant, systemOfEquations);
+
+        const State arcEndState = reference.toFullState(arcEndDeviationState);
+
+        if (isLastArc)
+        {
+            return arcEndState;
+        }
+
+        if (reference.requiresRectification(arcEndDeviationState))
+        {
+            reference = reference.rectify(arcEndDeviationState);
+        }
+
+        deviationState = reference.toDeviationState(arcEndState);
+
+        // The arcs are fractions of the reference period: carry the step size over rather than restart from the
+        // initial time step
+
+        aNumericalSolver.resume(aNumericalSolver.getNextTimeStep());
+    }
+}
+
+Array<State> Propagator::calculateEnckeStatesAt(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    KeplerianReference reference = {
+        aState, CentralBody::FromDynamicsContexts(this->dynamicsContexts_, Propagator::Formulation::Encke)
+    };
+
+    const bool isForward = anInstantArray.accessLast() >= aState.accessInstant();
+
+    const auto isBeforeOrAt = [&isForward](const Instant& anInstant, const Instant& aReferenceInstant) -> bool
+    {
+        return isForward ? (anInstant <= aReferenceInstant) : (anInstant >= aReferenceInstant);
+    };
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    Index instantIndex = 0;
+
+    while ((instantIndex < anInstantArray.getSize()) && (anInstantArray[instantIndex] == aState.accessInstant()))
+    {
+        states.add(aState);
+        ++instantIndex;
+    }
+
+    State deviationState = reference.toDeviationState(aState);
+
+    // Integrate over arcs, at the end of which the reference orbit is rectified if needed
+
+    while (instantIndex < anInstantArray.getSize())
+    {
+        const Instant arcStartInstant = deviationState.accessInstant();
+        const Duration arcDuration = reference.getArcDuration();
+
+        Instant arcEndInstant = isForward ? (arcStartInstant + arcDuration) : (arcStartInstant - arcDuration);
+
+        if (isBeforeOrAt(anInstantArray.accessLast(), arcEndInstant))
+        {
+            arcEndInstant = anInstantArray.accessLast();
+        }
+
+        Array<Instant> arcInstants = Array<Instant>::Empty();
+
+        while ((instantIndex < anInstantArray.getSize()) && isBeforeOrAt(anInstantArray[instantIndex], arcEndInstant))
+        {
+            arcInstants.add(anInstantArray[instantIndex]);
+            ++instantIndex;
+        }
+
+        const Size outputStateCount = arcInstants.getSize();
+
+        if (arcInstants.isEmpty() || (arcInstants.accessLast() != arcEndInstant))
+        {
+            arcInstants.add(arcEndInstant);
+        }
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = reference.getSystemOfEquations(
+            aNumericalSolver, this->dynamicsContexts_, arcStartInstant, aWallTimeArrayPtr
+        );
+
+        const Array<State> deviationStates =
+            aNumericalSolver.integrateTime(deviationState, arcInstants, systemOfEquations);
+
+        for (Index i = 0; i < outputStateCount; ++i)
+        {
+            states.add(reference.toFullState(deviationStates[i]));
+        }
+
+        deviationState = deviationStates.accessLast();
+
+        if (reference.requiresRectification(deviationState))
+        {
+            const State arcEndState = reference.toFullState(deviationState);
+
+            reference = reference.rectify(deviationState);
+            deviationState = reference.toDeviationState(arcEndState);
+        }
+
+        // The arcs are fractions of the reference period: carry the step size over rather than restart from the
+        // initial time step
+
+        const Real nextTimeStep = aNumericalSolver.getNextTimeStep();
+
+        if (nextTimeStep.isDefined())
+        {
+            aNumericalSolver.setTimeStep(nextTimeStep);
+        }
+    }
+
+    return states;
+}
+
+NumericalSolver::ConditionSolution Propagator::calculateEnckeStateToCondition(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Instant& anInstant,
+    const EventCondition& anEventCondition,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    KeplerianReference reference = {
+        aState, CentralBody::FromDynamicsContexts(this->dynamicsContexts_, Propagator::Formulation::Encke)
+    };
+
+    // The numerical solver integrates the deviation from the reference orbit, and observes the full state
+
+    aNumericalSolver.setStateConverter(
+        [&reference](const State& aDeviationState) -> State
+        {
+            return reference.toFullState(aDeviationState);
+        }
+    );
+
+    const bool isForward = anInstant >= aState.accessInstant();
+
+    State deviationState = reference.toDeviationState(aState);
+
+    // Integrate over arcs, at the end of which the reference orbit is rectified if needed
+
+    while (true)
+    {
+        const Instant arcStartInstant = deviationState.accessInstant();
+        const Duration arcDuration = reference.getArcDuration();
+
+        Instant arcEndInstant = isForward ? (arcStartInstant + arcDuration) : (arcStartInstant - arcDuration);
+
+        const bool isLastArc = isForward ? (arcEndInstant >= anInstant) : (arcEndInstant <= anInstant);
+
+        if (isLastArc)
+        {
+            arcEndInstant = anInstant;
+        }
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = reference.getSystemOfEquations(
+            aNumericalSolver, this->dynamicsContexts_, arcStartInstant, aWallTimeArrayPtr
+        );
+
+        const EnckeEventCondition arcEventCondition = {anEventCondition, reference};
+
+        const NumericalSolver::ConditionSolution arcSolution =
+            aNumericalSolver.integrateTime(deviationState, arcEndInstant, systemOfEquations, arcEventCondition);
+
+        const State arcEndState = reference.toFullState(arcSolution.state);
+
+        if (arcSolution.conditionIsSatisfied || isLastArc)
+        {
+            return {
+                arcEndState,
+                arcSolution.conditionIsSatisfied,
+                arcSolution.iterationCount,
+                arcSolution.rootSolverHasConverged,
+                arcSolution.nextTimeStep,
+            };
+        }
+
+        if (reference.requiresRectification(arcSolution.state))
+        {
+            reference = reference.rectify(arcSolution.state);
+        }
+
+        deviationState = reference.toDeviationState(arcEndState);
+
+        aNumericalSolver.resume(arcSolution.nextTimeStep);
+    }
+}
+
+Array<State> Propagator::calculateKustaanheimoStiefelStatesAt(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    const KustaanheimoStiefelTransformation transformation = {
+        aState,
+        CentralBody::FromDynamicsContexts(this->dynamicsContexts_, Propagator::Formulation::KustaanheimoStiefel),
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        transformation.getSystemOfEquations(aNumericalSolver, this->dynamicsContexts_, aWallTimeArrayPtr);
+
+    const State regularizedEpochState = transformation.getRegularizedEpochState();
+
+    // Integrate up to the fictitious instants of the requested instants on the osculating Keplerian orbit, then
+    // remove the time offsets due to the perturbations
+
+    const Array<Instant> fictitiousInstants = anInstantArray.map<Instant>(
+        [&aState, &transformation, &regularizedEpochState](const Instant& anInstant) -> Instant
+        {
+            return regularizedEpochState.accessInstant() +
+                   transformation.calculateFictitiousDuration(aState, anInstant - aState.accessInstant());
+        }
+    );
+
+    const Array<State> regularizedStates =
+        aNumericalSolver.integrateTime(regularizedEpochState, fictitiousInstants, systemOfEquations);
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        const State regularizedState = transformation.integrateToInstant(
+            aNumericalSolver, systemOfEquations, regularizedStates[i], anInstantArray[i]
+        );
+
+        states.add(transformation.toFullState(regularizedState, anInstantArray[i]));
+    }
+
+    return states;
+}
+
+NumericalSolver::ConditionSolution Propagator::calculateKustaanheimoStiefelStateToCondition(
+    NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const Instant& anInstant,
+    const EventCondition& anEventCondition,
+    Array<Duration>* aWallTimeArrayPtr
+) const
+{
+    const KustaanheimoStiefelTransformation transformation = {
+        aState,
+        CentralBody::FromDynamicsContexts(this->dynamicsContexts_, Propagator::Formulation::KustaanheimoStiefel),
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        transformation.getSystemOfEquations(aNumericalSolver, this->dynamicsContexts_, aWallTimeArrayPtr);
+
+    const State regularizedEpochState = transformation.getRegularizedEpochState();
+
+    // The end instant is detected as an event, so that the integration can run up to a generous estimate of its
+    // fictitious instant
+
+    const KustaanheimoStiefelEventCondition eventCondition = {
+        anEventCondition, transformation, aState.accessInstant(), anInstant
+    };
+
+    // The numerical solver integrates the regularized state, and observes the full state: the state at which the end
+    // instant is detected is observed at the end instant
+
+    aNumericalSolver.setStateConverter(
+        [&transformation, &eventCondition, &anInstant](const State& aRegularizedState) -> State
+        {
+            if (eventCondition.isEndReached(aRegularizedState, KustaanheimoStiefelEndTolerance))
+            {
+                return transformation.toFullState(aRegularizedState, anInstant);
+            }
+
+            return transformation.toFullState(aRegularizedState);
+        }
+    );
+
+    if (anInstant == aState.accessInstant())
+    {
+        aNumericalSolver.integrateTime(
+            regularizedEpochState, regularizedEpochState.accessInstant(), systemOfEquations, eventCondition
+        );
+
+        return {
+            aState,
+            false,
+            0,
+            false,
+        };
+    }
+
+    Duration fictitiousDuration =
+        transformation.calculateFictitiousDuration(aState, anInstant - aState.accessInstant()) * 2.0;
+
+    NumericalSolver::ConditionSolution solution = aNumericalSolver.integrateTime(
+        regularizedEpochState,
+        regularizedEpochState.accessInstant() + fictitiousDuration,
+        systemOfEquations,
+        eventCondition
+    );
+
+    // Resume the integration up to doubled estimates, until the end instant is reached
+
+    while ((!solution.conditionIsSatisfied) && (!eventCondition.isEndReached(solution.state)))
+    {
+        fictitiousDuration = fictitiousDuration * 2.0;
+
+        aNumericalSolver.resume(solution.nextTimeStep);
+
+        solution = aNumericalSolver.integrateTime(
+            solution.state,
+            regularizedEpochState.accessInstant() + fictitiousDuration,
+            systemOfEquations,
+            eventCondition
+        );
+    }
+
+    // Convert the next fictitious time step to a time step at the final state, following the Sundman transformation
+
+    const auto calculateNextTimeStep = [&aState, &solution](const State& aFinalState) -> Real
+    {
+        if (!solution.nextTimeStep.isDefined())
+        {
+            return Real::Undefined();
+        }
+
+        return solution.nextTimeStep * aFinalState.getPosition().getCoordinates().norm() /
+               aState.getPosition().getCoordinates().norm();
+    };
+
+    if (solution.conditionIsSatisfied &&
+        (!eventCondition.isEndReached(solution.state, KustaanheimoStiefelEndTolerance)))
+    {
+        const State finalState = transformation.toFullState(solution.state);
+
+        return {
+            finalState,
+            true,
+            solution.iterationCount,
+            solution.rootSolverHasConverged,
+            calculateNextTimeStep(finalState),
+        };
+    }
+
+    // The end instant is reached first
+
+    const State endState = transformation.toFullState(
+        transformation.integrateToInstant(aNumericalSolver, systemOfEquations, solution.state, anInstant), anInstant
+    );
+
+    return {
+        endState,
+        false,
+        0,
+        false,
+        calculateNextTimeStep(endState),
+    };
+}
+
 }  // namespace trajectory
 }  // namespace astro
 }  // namespace ostk
@@ -1,13 +1,19 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <mutex>
 #include <numeric>
+#include <tuple>
 
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
 
 namespace ostk
 {
@@ -20,8 +26,240 @@ using ostk::physics::time::Duration;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 using ostk::astro::trajectory::Propagator;
+using ostk::astro::trajectory::state::CoordinatesBroker;
 using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+using ostk::astro::utilities::ParallelFor;
+
+struct Segment::Solution::DynamicsContributionCache
+{
+    struct Entry
+    {
+        Shared<const Frame> frameSPtr;
+        Array<Shared<Dynamics>> dynamics;
+        Size stateCount;
+        Instant startInstant;
+        Instant endInstant;
+        Map<Shared<Dynamics>, MatrixXd> contributions;
+        Shared<const Array<VectorXd>> stateDerivatives;  // Assembled on demand, in the frame of the states
+
+        bool isValidFor(const Segment::Solution& aSolution) const
+        {
+            if ((this->dynamics != aSolution.dynamics) || (this->stateCount != aSolution.states.getSize()))
+            {
+                return false;
+            }
+
+            return aSolution.states.isEmpty() || ((this->startInstant == aSolution.accessStartInstant()) &&
+                                                  (this->endInstant == aSolution.accessEndInstant()));
+        }
+    };
+
+    /// @brief Access the entry of a frame, computing the contributions if missing or stale. The mutex must be held.
+    Entry& accessEntry(
+        const Segment::Solution& aSolution, const Shared<const Frame>& aFrameSPtr, const Size& aThreadCount
+    );
+
+    std::mutex mutex;
+    Array<Entry> entries;
+};
+
+namespace
+{
+
+// Number of states computed by a worker at a time
+const Size dynamicsContributionChunkSize = 256;
+
+Size ComputeDynamicsWriteSize(const Shared<Dynamics>& aDynamicsSPtr)
+{
+    Size writeSize = 0;
+
+    for (const Shared<const CoordinatesSubset>& subset : aDynamicsSPtr->getWriteCoordinatesSubsets())
+    {
+        writeSize += subset->getSize();
+    }
+
+    return writeSize;
+}
+
+/// @brief Compute the contributions of dynamics at all states, in a single pass over the states
+Array<MatrixXd> ComputeDynamicsContributions(
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const Array<State>& aStateArray,
+    const Shared<const Frame>& aFrameSPtr,
+    const Size& aThreadCount
+)
+{
+    const Size stateCount = aStateArray.getSize();
+
+    Array<StateBuilder> builders = Array<StateBuilder>::Empty();
+    Array<MatrixXd> contributions = Array<MatrixXd>::Empty();
+
+    builders.reserve(aDynamicsArray.getSize());
+    contributions.reserve(aDynamicsArray.getSize());
+
+    for (const Shared<Dynamics>& dynamicsSPtr : aDynamicsArray)
+    {
+        builders.add(StateBuilder(aFrameSPtr, dynamicsSPtr->getReadCoordinatesSubsets()));
+        contributions.add(MatrixXd::Zero(stateCount, ComputeDynamicsWriteSize(dynamicsSPtr)));
+    }
+
+    // Each state is converted to the frame once, and workers write to distinct rows
+
+    const auto computeChunk = [&](const Index& aChunkIndex) -> void
+    {
+        const Index endIndex = std::min(stateCount, (aChunkIndex + 1) * dynamicsContributionChunkSize);
+
+        for (Index stateIndex = aChunkIndex * dynamicsContributionChunkSize; stateIndex < endIndex; ++stateIndex)
+        {
+            const State state = aStateArray[stateIndex].inFrame(aFrameSPtr);
+
+            for (Index dynamicsIndex = 0; dynamicsIndex < aDynamicsArray.getSize(); ++dynamicsIndex)
+            {
+                contributions[dynamicsIndex].row(stateIndex) = aDynamicsArray[dynamicsIndex]->computeContribution(
+                    state.accessInstant(), builders[dynamicsIndex].reduce(state).getCoordinates(), aFrameSPtr
+                );
+            }
+        }
+    };
+
+    const Size chunkCount = (stateCount + dynamicsContributionChunkSize - 1) / dynamicsContributionChunkSize;
+    ParallelFor(chunkCount, aThreadCount, computeChunk);
+
+    return contributions;
+}
+
+/// @brief True if states are at least two, strictly increasing in time, and share a frame and a coordinates broker
+bool HasDenseOutputLayout(const Array<State>& aStateArray)
+{
+    if (aStateArray.getSize() < 2)
+    {
+        return false;
+    }
+
+    const Shared<const Frame>& frameSPtr = aStateArray.accessFirst().accessFrame();
+    const Shared<const CoordinatesBroker>& coordinatesBrokerSPtr = aStateArray.accessFirst().accessCoordinatesBroker();
+
+    for (Index stateIndex = 1; stateIndex < aStateArray.getSize(); ++stateIndex)
+    {
+        const State& state = aStateArray[stateIndex];
+
+        if ((state.accessInstant() <= aStateArray[stateIndex - 1].accessInstant()) ||
+            (state.accessFrame() != frameSPtr) || (*state.accessCoordinatesBroker() != *coordinatesBrokerSPtr))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Assemble the time derivatives of states, in the layout of their coordinates, from the dynamics
+/// contributions in the frame of the states
+///
+/// Coordinates that no dynamics writes to are constant.
+Array<VectorXd> AssembleStateDerivatives(
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const Array<State>& aStateArray,
+    const Map<Shared<Dynamics>, MatrixXd>& aContributionMap
+)
+{
+    const Shared<const CoordinatesBroker>& coordinatesBrokerSPtr = aStateArray.accessFirst().accessCoordinatesBroker();
+
+    Array<VectorXd> derivatives = Array<VectorXd>::Empty();
+    derivatives.reserve(aStateArray.getSize());
+
+    for (Index stateIndex = 0; stateIndex < aStateArray.getSize(); ++stateIndex)
+    {
+        derivatives.add(VectorXd::Zero(coordinatesBrokerSPtr->getNumberOfCoordinates()));
+    }
+
+    for (const Shared<Dynamics>& dynamicsSPtr : aDynamicsArray)
+    {
+        const MatrixXd& contribution = aContributionMap.at(dynamicsSPtr);
+
+        Index columnIndex = 0;
+
+        for (const Shared<const CoordinatesSubset>& subset : dynamicsSPtr->getWriteCoordinatesSubsets())
+        {
+            const Index writeIndex = coordinatesBrokerSPtr->getSubsetIndex(subset->getId());
+            const Size subsetSize = subset->getSize();
+
+            for (Index stateIndex = 0; stateIndex < aStateArray.getSize(); ++stateIndex)
+            {
+                derivatives[stateIndex].segment(writeIndex, subsetSize) +=
+                    contribution.row(stateIndex).segment(columnIndex, subsetSize).transpose();
+            }
+
+            columnIndex += subsetSize;
+        }
+    }
+
+    return derivatives;
+}
+
+/// @brief Interpolate between two consecutive states and their derivatives
+///
+/// Coordinates are interpolated by cubic Hermite polynomials. Position and velocity, when present, are interpolated by
+/// the quintic Hermite polynomial of the position matching position, velocity and acceleration at both states, and its
+/// derivative.
+State InterpolateState(
+    const State& aPreviousState,
+    const VectorXd& aPreviousDerivative,
+    const State& aNextState,
+    const VectorXd& aNextDerivative,
+    const Instant& anInstant
+)
+{
+    const double h = (aNextState.accessInstant() - aPreviousState.accessInstant()).inSeconds();
+    const double s = (anInstant - aPreviousState.accessInstant()).inSeconds() / h;
+
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double s4 = s3 * s;
+    const double s5 = s4 * s;
+
+    const VectorXd& y0 = aPreviousState.accessCoordinates();
+    const VectorXd& y1 = aNextState.accessCoordinates();
+
+    VectorXd coordinates = (2.0 * s3 - 3.0 * s2 + 1.0) * y0 + (s3 - 2.0 * s2 + s) * h * aPreviousDerivative +
+                           (-2.0 * s3 + 3.0 * s2) * y1 + (s3 - s2) * h * aNextDerivative;
+
+    const Shared<const CoordinatesBroker>& coordinatesBrokerSPtr = aPreviousState.accessCoordinatesBroker();
+
+    if (coordinatesBrokerSPtr->hasSubset(CartesianPosition::Default()) &&
+        coordinatesBrokerSPtr->hasSubset(CartesianVelocity::Default()))
+    {
+        const Index positionIndex = coordinatesBrokerSPtr->getSubsetIndex(CartesianPosition::Default()->getId());
+        const Index velocityIndex = coordinatesBrokerSPtr->getSubsetIndex(CartesianVelocity::Default()->getId());
+
+        const VectorXd p0 = y0.segment(positionIndex, 3);
+        const VectorXd v0 = y0.segment(velocityIndex, 3);
+        const VectorXd a0 = aPreviousDerivative.segment(velocityIndex, 3);
+        const VectorXd p1 = y1.segment(positionIndex, 3);
+        const VectorXd v1 = y1.segment(velocityIndex, 3);
+        const VectorXd a1 = aNextDerivative.segment(velocityIndex, 3);
+
+        coordinates.segment(positionIndex, 3) = (1.0 - 10.0 * s3 + 15.0 * s4 - 6.0 * s5) * p0 +
+                                                (s - 6.0 * s3 + 8.0 * s4 - 3.0 * s5) * h * v0 +
+                                                (0.5 * s2 - 1.5 * s3 + 1.5 * s4 - 0.5 * s5) * h * h * a0 +
+                                                (0.5 * s3 - s4 + 0.5 * s5) * h * h * a1 +
+                                                (-4.0 * s3 + 7.0 * s4 - 3.0 * s5) * h * v1 +
+                                                (10.0 * s3 - 15.0 * s4 + 6.0 * s5) * p1;
+
+        coordinates.segment(velocityIndex, 3) = (-30.0 * s2 + 60.0 * s3 - 30.0 * s4) / h * p0 +
+                                                (1.0 - 18.0 * s2 + 32.0 * s3 - 15.0 * s4) * v0 +
+                                                (s - 4.5 * s2 + 6.0 * s3 - 2.5 * s4) * h * a0 +
+                                                (1.5 * s2 - 4.0 * s3 + 2.5 * s4) * h * a1 +
+                                                (-12.0 * s2 + 28.0 * s3 - 15.0 * s4) * v1 +
+                                                (30.0 * s2 - 60.0 * s3 + 30.0 * s4) / h * p1;
+    }
+
+    return State(anInstant, coordinates, aPreviousState.accessFrame(), coordinatesBrokerSPtr);
+}
+
+}  // namespace
 
 Segment::Solution::Solution(
     const String& aName,
@@ -34,10 +272,64 @@ Segment::Solution::Solution(
       dynamics(aDynamicsArray),
       states(aStates),
       conditionIsSatisfied(aConditionIsSatisfied),
-      segmentType(aSegmentType)
+      segmentType(aSegmentType),
+      diagnostics(),
+      denseOutputIsAvailable(false),
+      dynamicsContributionCacheSPtr_(std::make_shared<DynamicsContributionCache>())
 {
 }
 
+Segment::Solution::DynamicsContributionCache::Entry& Segment::Solution::DynamicsContributionCache::accessEntry(
+    const Segment::Solution& aSolution, const Shared<const Frame>& aFrameSPtr, const Size& aThreadCount
+)
+{
+    for (Index entryIndex = 0; entryIndex < this->entries.getSize(); ++entryIndex)
+    {
+        Entry& entry = this->entries[entryIndex];
+
+        if (*entry.frameSPtr != *aFrameSPtr)
+        {
+            continue;
+        }
+
+        if (entry.isValidFor(aSolution))
+        {
+            return entry;
+        }
+
+        // Stale entry, the solution has changed since
+
+        this->entries.erase(this->entries.begin() + entryIndex);
+        break;
+    }
+
+    const Array<MatrixXd> contributions =
+        ComputeDynamicsContributions(aSolution.dynamics, aSolution.states, aFrameSPtr, aThreadCount);
+
+    // Each MatrixXd contains the contribution of a single dynamics for all the segment states
+    Map<Shared<Dynamics>, MatrixXd> dynamicsContributionsMap = Map<Shared<Dynamics>, MatrixXd>();
+
+    for (Index dynamicsIndex = 0; dynamicsIndex < aSolution.dynamics.getSize(); ++dynamicsIndex)
+    {
+        dynamicsContributionsMap.emplace(aSolution.dynamics[dynamicsIndex], contributions[dynamicsIndex]);
+    }
+
+    const Instant startInstant = aSolution.states.isEmpty() ? Instant::Undefined() : aSolution.accessStartInstant();
+    const Instant endInstant = aSolution.states.isEmpty() ? Instant::Undefined() : aSolution.accessEndInstant();
+
+    this->entries.add(Entry {
+        aFrameSPtr,
+        aSolution.dynamics,
+        aSolution.states.getSize(),
+        startInstant,
+        endInstant,
+        dynamicsContributionsMap,
+        nullptr,
+    });
+
+    return this->entries.accessLast();
+}
+
 const Instant& Segment::Solution::accessStartInstant() const
 {
     if (this->states.isEmpty())
@@ -105,6 +397,13 @@ Mass Segment::Solution::computeDeltaMass() const
     return Mass::Kilograms(getInitialMass().inKilograms() - getFinalMass().inKilograms());
 }
 
+Array<VectorXd> Segment::Solution::getStateDerivatives() const
+{
+    const Shared<const Array<VectorXd>> stateDerivativesSPtr = this->accessStateDerivatives();
+
+    return (stateDerivativesSPtr != nullptr) ? *stateDerivativesSPtr : Array<VectorXd>::Empty();
+}
+
 Array<State> Segment::Solution::calculateStatesAt(
     const Array<Instant>& anInstantArray, const NumericalSolver& aNumericalSolver
 ) const
@@ -135,6 +434,53 @@ Array<State> Segment::Solution::calculateStatesAt(
         }
     }
 
+    // Interpolate the dense output when available, without any integration
+
+    const Shared<const Array<VectorXd>> stateDerivativesSPtr = this->accessStateDerivatives();
+
+    if (stateDerivativesSPtr != nullptr)
+    {
+        const Array<VectorXd>& stateDerivatives = *stateDerivativesSPtr;
+
+        Array<State> interpolatedStates = Array<State>::Empty();
+        interpolatedStates.reserve(anInstantArray.getSize());
+
+        Index stateIndex = 0;
+
+        for (const Instant& instant : anInstantArray)
+        {
+            while ((stateIndex + 2 < this->states.getSize()) &&
+                   (this->states[stateIndex + 1].accessInstant() < instant))
+            {
+                ++stateIndex;
+            }
+
+            const State& previousState = this->states[stateIndex];
+            const State& nextState = this->states[stateIndex + 1];
+
+            if (instant == previousState.accessInstant())
+            {
+                interpolatedStates.add(previousState);
+            }
+            else if (instant == nextState.accessInstant())
+            {
+                interpolatedStates.add(nextState);
+            }
+            else
+            {
+                interpolatedStates.add(InterpolateState(
+                    previousState,
+                    stateDerivatives[stateIndex],
+                    nextState,
+                    stateDerivatives[stateIndex + 1],
+                    instant
+                ));
+            }
+        }
+
+        return interpolatedStates;
+    }
+
     const Propagated propagated = {
         {
             aNumericalSolver,
@@ -174,28 +520,38 @@ MatrixXd Segment::Solution::getDynamicsContribution(
         }
     }
 
-    // Initialize the definitive coordinate subset array
-    Array<Shared<const CoordinatesSubset>> definitiveCoordinateSubsetArray = aCoordinatesSubsetSPtrArray;
+    // Read the full contribution from the cache, or compute it for this dynamics only
+
+    MatrixXd fullContributionMatrix;
 
-    // Check value for aCoordinatesSubsetSPtrArray
-    if (aCoordinatesSubsetSPtrArray.isEmpty())
     {
-        definitiveCoordinateSubsetArray = aDynamicsSPtr->getWriteCoordinatesSubsets();
+        std::lock_guard<std::mutex> lock(this->dynamicsContributionCacheSPtr_->mutex);
+
+        for (const DynamicsContributionCache::Entry& entry : this->dynamicsContributionCacheSPtr_->entries)
+        {
+            if ((*entry.frameSPtr == *aFrameSPtr) && entry.isValidFor(*this))
+            {
+                fullContributionMatrix = entry.contributions.at(aDynamicsSPtr);
+                break;
+            }
+        }
     }
 
-    // Extract states size
-    const Size numberOfstates = this->states.getSize();
+    if (fullContributionMatrix.size() == 0)
+    {
+        fullContributionMatrix = ComputeDynamicsContributions({aDynamicsSPtr}, this->states, aFrameSPtr, 1)[0];
+    }
 
-    // Extract dynamics context and behavior relative to state
-    Array<Shared<const CoordinatesSubset>> dynamicsReadCoordinatesSubsets = aDynamicsSPtr->getReadCoordinatesSubsets();
+    if (aCoordinatesSubsetSPtrArray.isEmpty())
+    {
+        return fullContributionMatrix;
+    }
 
-    // Construct state builder
-    const StateBuilder builder = StateBuilder(aFrameSPtr, dynamicsReadCoordinatesSubsets);
+    // Select the columns of the provided coordinates subsets, in the provided order
 
-    // Compute the size of dynamicsContributionMatrix
     Size dynamicsWriteSize = std::accumulate(
-        definitiveCoordinateSubsetArray.begin(),
-        definitiveCoordinateSubsetArray.end(),
+        aCoordinatesSubsetSPtrArray.begin(),
+        aCoordinatesSubsetSPtrArray.end(),
         0,
         [](int sum, const Shared<const CoordinatesSubset>& subset)
         {
@@ -203,19 +559,27 @@ MatrixXd Segment::Solution::getDynamicsContribution(
         }
     );
 
-    // Initialize the dynamicsContributionMatrix
-    MatrixXd dynamicsContributionMatrix = MatrixXd::Zero(numberOfstates, dynamicsWriteSize);
+    MatrixXd dynamicsContributionMatrix = MatrixXd::Zero(this->states.getSize(), dynamicsWriteSize);
+
+    Index nextColumnIndex = 0;
 
-    // Construct the dynamicsContributionMatrix, state by state (a.k.a row by row)
-    for (Index stateIndex = 0; stateIndex < numberOfstates; ++stateIndex)
+    for (const Shared<const CoordinatesSubset>& aCoordinatesSubsetSPtr : aCoordinatesSubsetSPtrArray)
     {
-        const State& state = this->states[stateIndex];
+        Index offset = 0;
 
-        VectorXd dynamicsContributionAtState = aDynamicsSPtr->computeContribution(
-            state.getInstant(), builder.reduce(state.inFrame(aFrameSPtr)).getCoordinates(), aFrameSPtr
-        );
+        for (const Shared<const CoordinatesSubset>& dynamicsWriteCoordinatesSubset : dynamicsWriteCoordinatesSubsets)
+        {
+            if (dynamicsWriteCoordinatesSubset == aCoordinatesSubsetSPtr)
+            {
+                break;
+            }
+
+            offset += dynamicsWriteCoordinatesSubset->getSize();
+        }
 
-        dynamicsContributionMatrix.row(stateIndex) = dynamicsContributionAtState;
+        dynamicsContributionMatrix.middleCols(nextColumnIndex, aCoordinatesSubsetSPtr->getSize()) =
+            fullContributionMatrix.middleCols(offset, aCoordinatesSubsetSPtr->getSize());
+        nextColumnIndex += aCoordinatesSubsetSPtr->getSize();
     }
 
     return dynamicsContributionMatrix;
@@ -228,21 +592,20 @@ MatrixXd Segment::Solution::getDynamicsAccelerationContribution(
     return this->getDynamicsContribution(aDynamicsSPtr, aFrameSPtr, {CartesianVelocity::Default()});
 }
 
-Map<Shared<Dynamics>, MatrixXd> Segment::Solution::getAllDynamicsContributions(const Shared<const Frame>& aFrameSPtr
+Map<Shared<Dynamics>, MatrixXd> Segment::Solution::getAllDynamicsContributions(
+    const Shared<const Frame>& aFrameSPtr, const Size& aThreadCount
 ) const
 {
-    // TBI: Use smart caching for multiple calls in the future
-
-    // Each MatrixXd contains the contribution of a single dynamics for all the segment states
-    Map<Shared<Dynamics>, MatrixXd> dynamicsContributionsMap = Map<Shared<Dynamics>, MatrixXd>();
-
-    for (const Shared<Dynamics>& aDynamicsSPtr : this->dynamics)
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
     {
-        MatrixXd dynamicsContribution = this->getDynamicsContribution(aDynamicsSPtr, aFrameSPtr);
-        dynamicsContributionsMap.emplace(aDynamicsSPtr, dynamicsContribution);
+        throw ostk::core::error::runtime::Undefined("Frame");
     }
 
-    return dynamicsContributionsMap;
+    // The lock is held while computing, so that concurrent calls compute the contributions once
+
+    std::lock_guard<std::mutex> lock(this->dynamicsContributionCacheSPtr_->mutex);
+
+    return this->dynamicsContributionCacheSPtr_->accessEntry(*this, aFrameSPtr, aThreadCount).contributions;
 }
 
 void Segment::Solution::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -283,18 +646,44 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Segment::Solution&
     return anOutputStream;
 }
 
+Shared<const Array<VectorXd>> Segment::Solution::accessStateDerivatives() const
+{
+    if ((!this->denseOutputIsAvailable) || (!HasDenseOutputLayout(this->states)))
+    {
+        return nullptr;
+    }
+
+    // Derived from the contributions in the frame of the states, computed once and shared by the later calls
+
+    std::lock_guard<std::mutex> lock(this->dynamicsContributionCacheSPtr_->mutex);
+
+    DynamicsContributionCache::Entry& entry =
+        this->dynamicsContributionCacheSPtr_->accessEntry(*this, this->states.accessFirst().accessFrame(), 1);
+
+    if (entry.stateDerivatives == nullptr)
+    {
+        entry.stateDerivatives = std::make_shared<const Array<VectorXd>>(
+            AssembleStateDerivatives(this->dynamics, this->states, entry.contributions)
+        );
+    }
+
+    return entry.stateDerivatives;
+}
+
 Segment::Segment(
     const String& aName,
     const Segment::Type& aType,
     const Shared<EventCondition>& anEventConditionSPtr,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const Propagator::Formulation& aFormulation
 )
     : name_(aName),
       type_(aType),
       eventCondition_(anEventConditionSPtr),
       dynamics_(aDynamicsArray),
-      numericalSolver_(aNumericalSolver)
+      numericalSolver_(aNumericalSolver),
+      formulation_(aFormulation)
 {
     if (eventCondition_ == nullptr)
     {
@@ -344,6 +733,11 @@ Segment::Type Segment::getType() const
     return type_;
 }
 
+Propagator::Formulation Segment::getFormulation() const
+{
+    return formulation_;
+}
+
 const Shared<EventCondition>& Segment::accessEventCondition() const
 {
     return eventCondition_;
@@ -364,19 +758,12 @@ Segment::Solution Segment::solve(const State& aState, const Duration& maximumPro
     const Propagator propagator = {
         numericalSolver_,
         dynamics_,
+        formulation_,
     };
 
-    const NumericalSolver::ConditionSolution conditionSolution = propagator.calculateStateToCondition(
-        aState, aState.accessInstant() + maximumPropagationDuration, *eventCondition_
-    );
+    Real timeStep = Real::Undefined();
 
-    return {
-        name_,
-        dynamics_,
-        propagator.accessNumericalSolver().accessObservedStates(),
-        conditionSolution.conditionIsSatisfied,
-        type_,
-    };
+    return this->solve(aState, maximumPropagationDuration, propagator, timeStep);
 }
 
 void Segment::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -388,6 +775,8 @@ void Segment::print(std::ostream& anOutputStream, bool displayDecorator) const
 
     ostk::core::utils::Print::Line(anOutputStream) << "Name:" << name_;
     ostk::core::utils::Print::Line(anOutputStream) << "Type:" << (type_ == Segment::Type::Coast ? "Coast" : "Maneuver");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Formulation:" << Propagator::StringFromFormulation(formulation_);
     ostk::core::utils::Print::Separator(anOutputStream, "Event Condition");
     eventCondition_->print(anOutputStream, false);
     ostk::core::utils::Print::Line(anOutputStream);
@@ -412,7 +801,8 @@ Segment Segment::Coast(
     const String& aName,
     const Shared<EventCondition>& anEventConditionSPtr,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const Propagator::Formulation& aFormulation
 )
 {
     return {
@@ -421,6 +811,7 @@ Segment Segment::Coast(
         anEventConditionSPtr,
         aDynamicsArray,
         aNumericalSolver,
+        aFormulation,
     };
 }
 
@@ -429,7 +820,8 @@ Segment Segment::Maneuver(
     const Shared<EventCondition>& anEventConditionSPtr,
     const Shared<Thruster>& aThrusterDynamics,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const Propagator::Formulation& aFormulation
 )
 {
     return {
@@ -438,9 +830,64 @@ Segment Segment::Maneuver(
         anEventConditionSPtr,
         aDynamicsArray + Array<Shared<Dynamics>> {aThrusterDynamics},
         aNumericalSolver,
+        aFormulation,
     };
 }
 
+Segment::Solution Segment::solve(
+    const State& aState,
+    const Duration& maximumPropagationDuration,
+    const Propagator& aPropagator,
+    Real& aTimeStep
+) const
+{
+    const NumericalSolver::ConditionSolution conditionSolution = aPropagator.calculateStateToCondition(
+        aState, aState.accessInstant() + maximumPropagationDuration, *eventCondition_, aTimeStep
+    );
+
+    aTimeStep = conditionSolution.nextTimeStep;
+
+    // The observed states are copied once, out of the propagator
+
+    Array<State> states = Array<State>::Empty();
+    NumericalSolver::Diagnostics diagnostics;
+
+    std::tie(states, diagnostics) = aPropagator.getObservedStatesAndDiagnostics();
+
+    // Without any recorded state, keep the boundaries of the segment
+
+    if (states.isEmpty())
+    {
+        states = {aState, conditionSolution.state};
+    }
+
+    Segment::Solution solution = {
+        name_,
+        dynamics_,
+        states,
+        conditionSolution.conditionIsSatisfied,
+        type_,
+    };
+
+    solution.diagnostics = diagnostics;
+
+    // Interpolate between the recorded states when every step is recorded. The derivatives of dynamics holding values
+    // over the steps differ from the integrated ones, so these are re-propagated.
+
+    solution.denseOutputIsAvailable =
+        (numericalSolver_.getObservationPolicy().getType() == NumericalSolver::ObservationPolicy::Type::All) &&
+        std::none_of(
+            dynamics_.begin(),
+            dynamics_.end(),
+            [](const Shared<Dynamics>& aDynamicsSPtr) -> bool
+            {
+                return aDynamicsSPtr->createHold() != nullptr;
+            }
+        );
+
+    return solution;
+}
+
 }  // namespace trajectory
 }  // namespace astro
 }  // namespace ostk
@@ -17,6 +17,74 @@ namespace trajectory
 
 using ostk::physics::time::Duration;
 
+namespace
+{
+
+/// @brief Carry the integration across the boundaries of consecutive segments
+///
+/// Consecutive segments with the same dynamics, numerical solver and formulation share a propagator, and thus its
+/// coordinates broker. Consecutive segments with the same numerical solver and formulation start with the step size
+/// proposed at the end of the previous segment, rather than growing it again from the step size of the numerical
+/// solver. The derivative at the end of the previous segment is not carried over: segments end at an event located
+/// within a step, where it is not available, and the dynamics may change at the boundary.
+class SegmentContinuation
+{
+   public:
+    SegmentContinuation()
+        : previousSegmentPtr_(nullptr),
+          propagatorSPtr_(nullptr),
+          timeStep_(Real::Undefined())
+    {
+    }
+
+    /// @brief Access the propagator of a segment, reusing the one of the previous segment if possible
+    const Propagator& accessPropagator(const Segment& aSegment)
+    {
+        const bool sharesNumericalSolver =
+            (previousSegmentPtr_ != nullptr) &&
+            (aSegment.getFormulation() == previousSegmentPtr_->getFormulation()) &&
+            (aSegment.accessNumericalSolver() == previousSegmentPtr_->accessNumericalSolver());
+
+        if (!sharesNumericalSolver)
+        {
+            timeStep_ = Real::Undefined();
+        }
+
+        if ((!sharesNumericalSolver) || (propagatorSPtr_ == nullptr) ||
+            (aSegment.accessDynamics() != previousSegmentPtr_->accessDynamics()))
+        {
+            propagatorSPtr_ = std::make_shared<Propagator>(
+                aSegment.accessNumericalSolver(), aSegment.accessDynamics(), aSegment.getFormulation()
+            );
+        }
+
+        previousSegmentPtr_ = &aSegment;
+
+        return *propagatorSPtr_;
+    }
+
+    /// @brief Access the step size carried to the next segment
+    Real& accessTimeStep()
+    {
+        return timeStep_;
+    }
+
+    /// @brief Skip a segment whose solution is already known, carrying its final step size to the next segment
+    void skip(const Segment& aSegment, const Real& aFinalTimeStep)
+    {
+        previousSegmentPtr_ = &aSegment;
+        propagatorSPtr_ = nullptr;
+        timeStep_ = aFinalTimeStep;
+    }
+
+   private:
+    const Segment* previousSegmentPtr_;
+    Shared<Propagator> propagatorSPtr_;
+    Real timeStep_;
+};
+
+}  // namespace
+
 Sequence::Solution::Solution(const Array<Segment::Solution>& aSegmentSolutionArray, const bool& anExecutionIsComplete)
     : segmentSolutions(aSegmentSolutionArray),
       executionIsComplete(anExecutionIsComplete)
@@ -171,6 +239,40 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Sequence::Solution&
     return anOutputStream;
 }
 
+Sequence::SolutionCache::SolutionCache()
+    : entries_(Array<Entry>::Empty()),
+      reuseCount_(0)
+{
+}
+
+Size Sequence::SolutionCache::getSize() const
+{
+    return entries_.getSize();
+}
+
+Size Sequence::SolutionCache::getReuseCount() const
+{
+    return reuseCount_;
+}
+
+void Sequence::SolutionCache::clear()
+{
+    entries_.clear();
+    reuseCount_ = 0;
+}
+
+bool Sequence::SolutionCache::Entry::matches(
+    const State& anInitialState, const Segment& aSegment, const Duration& aSegmentPropagationDurationLimit
+) const
+{
+    return (initialState == anInitialState) && (segmentPropagationDurationLimit == aSegmentPropagationDurationLimit) &&
+           (segment.getName() == aSegment.getName()) && (segment.getType() == aSegment.getType()) &&
+           (segment.accessEventCondition() == aSegment.accessEventCondition()) &&
+           (segment.accessDynamics() == aSegment.accessDynamics()) &&
+           (segment.getFormulation() == aSegment.getFormulation()) &&
+           (segment.accessNumericalSolver() == aSegment.accessNumericalSolver());
+}
+
 Sequence::Sequence(
     const Array<Segment>& aSegmentArray,
     const NumericalSolver& aNumericalSolver,
@@ -261,6 +363,20 @@ void Sequence::addManeuverSegment(const Shared<EventCondition>& anEventCondition
 }
 
 Sequence::Solution Sequence::solve(const State& aState, const Size& aRepetitionCount) const
+{
+    return this->solve(aState, aRepetitionCount, nullptr);
+}
+
+Sequence::Solution Sequence::solve(
+    const State& aState, SolutionCache& aSolutionCache, const Size& aRepetitionCount
+) const
+{
+    return this->solve(aState, aRepetitionCount, &aSolutionCache);
+}
+
+Sequence::Solution Sequence::solve(
+    const State& aState, const Size& aRepetitionCount, SolutionCache* aSolutionCachePtr
+) const
 {
     if (aRepetitionCount <= 0)
     {
@@ -272,15 +388,65 @@ Sequence::Solution Sequence::solve(const State& aState, const Size& aRepetitionC
     State initialState = aState;
     State finalState = State::Undefined();
 
+    SegmentContinuation continuation;
+
+    // Index of the segment solution in the cache, which holds the segment solutions of the previous solve in order
+    Index cacheIndex = 0;
+
     for (Size i = 0; i < aRepetitionCount; ++i)
     {
         for (const Segment& segment : segments_)
         {
             segment.accessEventCondition()->updateTarget(initialState);
 
-            BOOST_LOG_TRIVIAL(debug) << "Solving Segment:\n" << segment << std::endl;
+            const SolutionCache::Entry* cachedEntryPtr = nullptr;
+
+            if ((aSolutionCachePtr != nullptr) && (cacheIndex < aSolutionCachePtr->entries_.getSize()))
+            {
+                const SolutionCache::Entry& entry = aSolutionCachePtr->entries_[cacheIndex];
+
+                if (entry.matches(initialState, segment, segmentPropagationDurationLimit_))
+                {
+                    cachedEntryPtr = &entry;
+                }
+            }
+
+            BOOST_LOG_TRIVIAL(debug) << ((cachedEntryPtr != nullptr) ? "Reusing cached solution of Segment:\n"
+                                                                     : "Solving Segment:\n")
+                                     << segment << std::endl;
 
-            Segment::Solution segmentSolution = segment.solve(initialState, segmentPropagationDurationLimit_);
+            Segment::Solution segmentSolution =
+                (cachedEntryPtr != nullptr) ? cachedEntryPtr->solution
+                                            : segment.solve(
+                                                  initialState,
+                                                  segmentPropagationDurationLimit_,
+                                                  continuation.accessPropagator(segment),
+                                                  continuation.accessTimeStep()
+                                              );
+
+            if (cachedEntryPtr != nullptr)
+            {
+                continuation.skip(segment, cachedEntryPtr->finalTimeStep);
+
+                aSolutionCachePtr->reuseCount_++;
+            }
+            else if (aSolutionCachePtr != nullptr)
+            {
+                // Cached solutions from the first changed segment onwards are stale
+                Array<SolutionCache::Entry>& entries = aSolutionCachePtr->entries_;
+
+                entries.erase(entries.begin() + std::min(cacheIndex, entries.getSize()), entries.end());
+
+                entries.add({
+                    initialState,
+                    segment,
+                    segmentPropagationDurationLimit_,
+                    segmentSolution,
+                    continuation.accessTimeStep(),
+                });
+            }
+
+            ++cacheIndex;
 
             segmentSolution.name =
                 String::Format("{} - {} - {}", segmentSolution.name, segment.getEventCondition()->getName(), i);
@@ -317,6 +483,8 @@ Sequence::Solution Sequence::solveToCondition(
 
     Duration propagationDuration = Duration::Zero();
 
+    SegmentContinuation continuation;
+
     while (!eventConditionIsSatisfied && propagationDuration <= aMaximumPropagationDuration)
     {
         for (const Segment& segment : segments_)
@@ -328,7 +496,12 @@ Sequence::Solution Sequence::solveToCondition(
             const Duration segmentPropagationDurationLimit =
                 std::min(segmentPropagationDurationLimit_, aMaximumPropagationDuration - propagationDuration);
 
-            Segment::Solution segmentSolution = segment.solve(initialState, segmentPropagationDurationLimit);
+            Segment::Solution segmentSolution = segment.solve(
+                initialState,
+                segmentPropagationDurationLimit,
+                continuation.accessPropagator(segment),
+                continuation.accessTimeStep()
+            );
 
             segmentSolution.name =
                 String::Format("{} - {}", segmentSolution.name, segment.getEventCondition()->getName());
@@ -1,5 +1,10 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
 #include <boost/numeric/odeint.hpp>
 #include <boost/numeric/odeint/external/eigen/eigen.hpp>
 
@@ -28,6 +33,913 @@ using ostk::astro::trajectory::StateBuilder;
 
 typedef runge_kutta_dopri5<NumericalSolver::StateVector> dense_stepper_type_5;
 
+namespace
+{
+
+/// @brief Variable step, variable order Adams-Bashforth-Moulton stepper in PECE mode, with dense output.
+///
+/// The integration weights are computed from the actual (possibly unevenly spaced) history nodes, so that the step
+/// size can change at any step without restarting. The stepper is self-starting: it begins at order 1 and raises the
+/// order as the derivative history grows.
+///
+/// The interface mirrors the Boost.Odeint dense output steppers, so that it can be used for conditional integration.
+class AdamsBashforthMoultonStepper
+{
+   public:
+    AdamsBashforthMoultonStepper(
+        const double& anAbsoluteTolerance, const double& aRelativeTolerance, const Size& aMaximumOrder
+    )
+        : absoluteTolerance_(anAbsoluteTolerance),
+          relativeTolerance_(aRelativeTolerance),
+          maximumOrder_(aMaximumOrder),
+          order_(1),
+          stepCountSinceOrderChange_(0),
+          isStarting_(true),
+          timeStep_(0.0),
+          rejectedStepCount_(0),
+          currentTime_(0.0),
+          previousTime_(0.0),
+          currentState_(),
+          previousState_(),
+          times_(),
+          derivatives_(),
+          interpolationNodes_(),
+          interpolationDerivatives_()
+    {
+    }
+
+    void initialize(const NumericalSolver::StateVector& aStateVector, const double& aTime, const double& aTimeStep)
+    {
+        currentState_ = aStateVector;
+        previousState_ = aStateVector;
+        currentTime_ = aTime;
+        previousTime_ = aTime;
+        timeStep_ = aTimeStep;
+
+        order_ = 1;
+        stepCountSinceOrderChange_ = 0;
+        isStarting_ = true;
+        rejectedStepCount_ = 0;
+
+        times_.clear();
+        derivatives_.clear();
+        interpolationNodes_.clear();
+        interpolationDerivatives_.clear();
+    }
+
+    std::pair<double, double> do_step(const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations)
+    {
+        if (derivatives_.empty())
+        {
+            times_.push_front(currentTime_);
+            derivatives_.push_front(this->evaluate(aSystemOfEquations, currentState_, currentTime_));
+        }
+
+        Size rejectionCount = 0;
+
+        while (true)
+        {
+            const double timeStep = timeStep_;
+            const Size historySize = derivatives_.size();
+
+            // History nodes, normalized by the time step: 0, -1, -2, ... for a constant time step
+
+            std::vector<double> nodes(historySize);
+            for (Index i = 0; i < historySize; ++i)
+            {
+                nodes[i] = (times_[i] - currentTime_) / timeStep;
+            }
+
+            // Predict (P) with order_ history nodes, and evaluate (E)
+
+            const NumericalSolver::StateVector predictedState =
+                currentState_ + timeStep * this->combine(nodes, order_, nullptr);
+            const NumericalSolver::StateVector predictedDerivative =
+                this->evaluate(aSystemOfEquations, predictedState, currentTime_ + timeStep);
+
+            // Correct (C) with one more node than the predictor: the corrected state is one order higher, and its
+            // difference with the predicted state estimates the error of the predictor
+
+            const auto computeError =
+                [this, &nodes, &predictedDerivative, &timeStep](
+                    const Size& anOrder, NumericalSolver::StateVector* aCorrectedStatePtr
+                ) -> double
+            {
+                const NumericalSolver::StateVector predicted =
+                    currentState_ + timeStep * this->combine(nodes, anOrder, nullptr);
+                const NumericalSolver::StateVector corrected =
+                    currentState_ + timeStep * this->combine(nodes, anOrder, &predictedDerivative);
+
+                if (aCorrectedStatePtr != nullptr)
+                {
+                    *aCorrectedStatePtr = corrected;
+                }
+
+                return this->computeErrorNorm(corrected - predicted, corrected);
+            };
+
+            NumericalSolver::StateVector correctedState;
+            const double error = computeError(order_, &correctedState);
+
+            if (!std::isfinite(error) || (error > 1.0))
+            {
+                // Reject the step, and fall back to order 1 after repeated rejections
+
+                ++rejectionCount;
+                ++rejectedStepCount_;
+
+                if (historySize > 1)
+                {
+                    isStarting_ = false;
+                }
+
+                if ((rejectionCount >= 3) && (order_ > 1))
+                {
+                    order_ = 1;
+                    stepCountSinceOrderChange_ = 0;
+                }
+
+                const double factor = std::isfinite(error) ? 0.9 * std::pow(error, -1.0 / double(order_ + 1)) : 0.0;
+                timeStep_ = timeStep * std::max(0.1, std::min(0.9, factor));
+
+                if ((currentTime_ + timeStep_) == currentTime_)
+                {
+                    throw ostk::core::error::RuntimeError("Adams-Bashforth-Moulton time step underflow.");
+                }
+
+                continue;
+            }
+
+            // Select the order of the next step, from the error estimates of the neighbouring orders
+
+            Size order = order_;
+
+            if (isStarting_)
+            {
+                order = std::min(order_ + 1, maximumOrder_);
+            }
+            else if (stepCountSinceOrderChange_ >= order_)
+            {
+                if ((order_ > 1) && (computeError(order_ - 1, nullptr) <= error))
+                {
+                    order = order_ - 1;
+                }
+                else if ((order_ < maximumOrder_) && (historySize > order_) &&
+                         (computeError(order_ + 1, nullptr) < error))
+                {
+                    order = order_ + 1;
+                }
+            }
+
+            // Accept the step, and evaluate (E) at the corrected state
+
+            interpolationNodes_ = {1.0};
+            interpolationNodes_.insert(interpolationNodes_.end(), nodes.begin(), nodes.begin() + order_);
+            interpolationDerivatives_ = {predictedDerivative};
+            interpolationDerivatives_.insert(
+                interpolationDerivatives_.end(), derivatives_.begin(), derivatives_.begin() + order_
+            );
+
+            previousState_ = currentState_;
+            previousTime_ = currentTime_;
+            currentState_ = correctedState;
+            currentTime_ = previousTime_ + timeStep;
+
+            times_.push_front(currentTime_);
+            derivatives_.push_front(this->evaluate(aSystemOfEquations, currentState_, currentTime_));
+
+            if (derivatives_.size() > (maximumOrder_ + 1))
+            {
+                times_.pop_back();
+                derivatives_.pop_back();
+            }
+
+            ++stepCountSinceOrderChange_;
+
+            if (order != order_)
+            {
+                order_ = order;
+                stepCountSinceOrderChange_ = 0;
+            }
+
+            // Select the time step of the next step: while starting, grow it up to twice per step, then only grow it
+            // when worthwhile, to keep the history regularly spaced
+
+            const double factor = 0.9 * std::pow(std::max(error, 1.0e-10), -1.0 / double(order_ + 1));
+
+            if (isStarting_)
+            {
+                timeStep_ = timeStep * std::min(2.0, std::max(1.0, factor));
+
+                if (factor < 2.0)
+                {
+                    isStarting_ = false;
+                }
+            }
+            else if (factor >= 1.5)
+            {
+                timeStep_ = timeStep * std::min(2.0, factor);
+            }
+
+            return {previousTime_, currentTime_};
+        }
+    }
+
+    void calc_state(const double& aTime, NumericalSolver::StateVector& aStateVector) const
+    {
+        if (interpolationNodes_.empty())
+        {
+            aStateVector = currentState_;
+            return;
+        }
+
+        // Integrate the corrector polynomial of the last step from its start
+
+        const double timeStep = currentTime_ - previousTime_;
+
+        const std::vector<double> weights = AdamsBashforthMoultonStepper::IntegrationWeights(
+            interpolationNodes_, interpolationNodes_.size(), (aTime - previousTime_) / timeStep
+        );
+
+        aStateVector = previousState_;
+
+        for (Index i = 0; i < weights.size(); ++i)
+        {
+            aStateVector += (timeStep * weights[i]) * interpolationDerivatives_[i];
+        }
+    }
+
+    const NumericalSolver::StateVector& current_state() const
+    {
+        return currentState_;
+    }
+
+    double current_time() const
+    {
+        return currentTime_;
+    }
+
+    const NumericalSolver::StateVector& previous_state() const
+    {
+        return previousState_;
+    }
+
+    double previous_time() const
+    {
+        return previousTime_;
+    }
+
+    double current_time_step() const
+    {
+        return timeStep_;
+    }
+
+    /// @brief Discard the derivative history, restarting at order 1 from the current state, e.g. after the system of
+    /// equations changed at the current state. The last step can still be interpolated.
+    void restart()
+    {
+        order_ = 1;
+        stepCountSinceOrderChange_ = 0;
+        isStarting_ = true;
+
+        times_.clear();
+        derivatives_.clear();
+    }
+
+    Size getRejectedStepCount() const
+    {
+        return rejectedStepCount_;
+    }
+
+   private:
+    double absoluteTolerance_;
+    double relativeTolerance_;
+    Size maximumOrder_;
+
+    Size order_;
+    Size stepCountSinceOrderChange_;
+    bool isStarting_;
+    double timeStep_;
+    Size rejectedStepCount_;
+
+    double currentTime_;
+    double previousTime_;
+    NumericalSolver::StateVector currentState_;
+    NumericalSolver::StateVector previousState_;
+
+    std::deque<double> times_;
+    std::deque<NumericalSolver::StateVector> derivatives_;
+
+    std::vector<double> interpolationNodes_;
+    std::vector<NumericalSolver::StateVector> interpolationDerivatives_;
+
+    NumericalSolver::StateVector evaluate(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const NumericalSolver::StateVector& aStateVector,
+        const double& aTime
+    ) const
+    {
+        NumericalSolver::StateVector derivative = NumericalSolver::StateVector::Zero(aStateVector.size());
+
+        aSystemOfEquations(aStateVector, derivative, aTime);
+
+        return derivative;
+    }
+
+    // Sum of the derivatives, weighted by the integrals from 0 to 1 of the Lagrange basis polynomials over the first
+    // aNodeCount history nodes, and over the new node at 1 if a new derivative is provided
+    NumericalSolver::StateVector combine(
+        const std::vector<double>& aNodeArray,
+        const Size& aNodeCount,
+        const NumericalSolver::StateVector* aNewDerivativePtr
+    ) const
+    {
+        const Size newNodeCount = (aNewDerivativePtr != nullptr) ? 1 : 0;
+
+        std::vector<double> nodes;
+        nodes.reserve(aNodeCount + newNodeCount);
+
+        if (newNodeCount == 1)
+        {
+            nodes.push_back(1.0);
+        }
+
+        nodes.insert(nodes.end(), aNodeArray.begin(), aNodeArray.begin() + aNodeCount);
+
+        const std::vector<double> weights =
+            AdamsBashforthMoultonStepper::IntegrationWeights(nodes, nodes.size(), 1.0);
+
+        NumericalSolver::StateVector sum = NumericalSolver::StateVector::Zero(currentState_.size());
+
+        for (Index i = 0; i < weights.size(); ++i)
+        {
+            sum += weights[i] * (((newNodeCount == 1) && (i == 0)) ? *aNewDerivativePtr
+                                                                     : derivatives_[i - newNodeCount]);
+        }
+
+        return sum;
+    }
+
+    // Weighted RMS norm of the error
+    double computeErrorNorm(
+        const NumericalSolver::StateVector& anErrorVector, const NumericalSolver::StateVector& aStateVector
+    ) const
+    {
+        double sum = 0.0;
+
+        for (Index i = 0; i < Index(anErrorVector.size()); ++i)
+        {
+            const double scale = absoluteTolerance_ +
+                                 relativeTolerance_ * std::max(std::abs(aStateVector[i]), std::abs(currentState_[i]));
+
+            sum += (anErrorVector[i] / scale) * (anErrorVector[i] / scale);
+        }
+
+        return std::sqrt(sum / double(anErrorVector.size()));
+    }
+
+    // Integrals from 0 to anUpperBound of the Lagrange basis polynomials over the first aNodeCount nodes, with an 8
+    // point Gauss-Legendre quadrature (exact up to degree 15, i.e. up to order 15)
+    static std::vector<double> IntegrationWeights(
+        const std::vector<double>& aNodeArray, const Size& aNodeCount, const double& anUpperBound
+    )
+    {
+        static const double abscissas[8] = {
+            -0.9602898564975363,
+            -0.7966664774136267,
+            -0.5255324099163290,
+            -0.1834346424956498,
+            0.1834346424956498,
+            0.5255324099163290,
+            0.7966664774136267,
+            0.9602898564975363,
+        };
+
+        static const double quadratureWeights[8] = {
+            0.1012285362903763,
+            0.2223810344533745,
+            0.3137066458778873,
+            0.3626837833783620,
+            0.3626837833783620,
+            0.3137066458778873,
+            0.2223810344533745,
+            0.1012285362903763,
+        };
+
+        std::vector<double> weights(aNodeCount, 0.0);
+
+        for (Index k = 0; k < 8; ++k)
+        {
+            const double node = 0.5 * anUpperBound * (abscissas[k] + 1.0);
+
+            for (Index j = 0; j < aNodeCount; ++j)
+            {
+                double basis = 1.0;
+
+                for (Index i = 0; i < aNodeCount; ++i)
+                {
+                    if (i != j)
+                    {
+                        basis *= (node - aNodeArray[i]) / (aNodeArray[j] - aNodeArray[i]);
+                    }
+                }
+
+                weights[j] += 0.5 * anUpperBound * quadratureWeights[k] * basis;
+            }
+        }
+
+        return weights;
+    }
+};
+
+void RecordAcceptedStep(NumericalSolver::Diagnostics& aDiagnostics, const double& aTimeStep)
+{
+    ++aDiagnostics.acceptedStepCount;
+
+    if (aTimeStep != 0.0)
+    {
+        ++aDiagnostics.stepSizeHistogram[Integer(int(std::floor(std::log10(std::abs(aTimeStep)))))];
+    }
+}
+
+/// @brief Discard the derivative cached by a first-same-as-last controlled stepper, so that the next step evaluates
+/// the system of equations at the current state
+template <typename Stepper>
+auto ResetDerivative(Stepper& aStepper, int) -> decltype(aStepper.reset(), void())
+{
+    aStepper.reset();
+}
+
+/// @brief Steppers without a cached derivative evaluate the system of equations at the start of each step
+template <typename Stepper>
+void ResetDerivative(Stepper&, long)
+{
+}
+
+/// @brief Wrap a Boost.Odeint stepper (controlled or not) to record its accepted and rejected steps, if diagnostics are
+/// provided, to notify a step observer of its accepted steps, if provided, and to report the step size proposed after
+/// its last full accepted step, if requested.
+template <typename Stepper>
+class InstrumentedStepper
+{
+   public:
+    typedef typename Stepper::state_type state_type;
+    typedef typename Stepper::deriv_type deriv_type;
+    typedef typename Stepper::value_type value_type;
+    typedef typename Stepper::time_type time_type;
+    typedef typename Stepper::stepper_category stepper_category;
+
+    InstrumentedStepper(
+        const Stepper& aStepper,
+        NumericalSolver::Diagnostics* aDiagnosticsPtr,
+        const NumericalSolver::StepObserver* aStepObserverPtr = nullptr,
+        Real* aNextTimeStepPtr = nullptr
+    )
+        : stepper_(aStepper),
+          diagnosticsPtr_(aDiagnosticsPtr),
+          stepObserverPtr_(aStepObserverPtr),
+          nextTimeStepPtr_(aNextTimeStepPtr),
+          proposedTimeStep_(0.0)
+    {
+    }
+
+    template <class System, class StateInOut>
+    controlled_step_result try_step(System aSystem, StateInOut& aState, time_type& aTime, time_type& aTimeStep)
+    {
+        const time_type time = aTime;
+
+        // A step shorter than the last proposed one was cut to reach an output time, the step size proposed after it
+        // would shrink the next integration
+
+        const bool isFullStep = (proposedTimeStep_ == 0.0) || (std::abs(aTimeStep) >= std::abs(proposedTimeStep_));
+
+        const controlled_step_result result = stepper_.try_step(aSystem, aState, aTime, aTimeStep);
+
+        proposedTimeStep_ = aTimeStep;
+
+        if (result != success)
+        {
+            if (diagnosticsPtr_ != nullptr)
+            {
+                ++diagnosticsPtr_->rejectedStepCount;
+            }
+
+            return result;
+        }
+
+        if (diagnosticsPtr_ != nullptr)
+        {
+            RecordAcceptedStep(*diagnosticsPtr_, aTime - time);
+        }
+
+        if (isFullStep && (nextTimeStepPtr_ != nullptr))
+        {
+            *nextTimeStepPtr_ = std::abs(aTimeStep);
+        }
+
+        this->observeStep(aState, aTime);
+
+        return result;
+    }
+
+    template <class System, class StateInOut>
+    void do_step(System aSystem, StateInOut& aState, const time_type aTime, const time_type aTimeStep)
+    {
+        stepper_.do_step(aSystem, aState, aTime, aTimeStep);
+
+        if (diagnosticsPtr_ != nullptr)
+        {
+            RecordAcceptedStep(*diagnosticsPtr_, aTimeStep);
+        }
+
+        this->observeStep(aState, aTime + aTimeStep);
+    }
+
+   private:
+    Stepper stepper_;
+    NumericalSolver::Diagnostics* diagnosticsPtr_;
+    const NumericalSolver::StepObserver* stepObserverPtr_;
+    Real* nextTimeStepPtr_;
+    time_type proposedTimeStep_;
+
+    void observeStep(const NumericalSolver::StateVector& aStateVector, const time_type& aTime)
+    {
+        if ((stepObserverPtr_ != nullptr) && (*stepObserverPtr_)(aStateVector, aTime, false))
+        {
+            ResetDerivative(stepper_, 0);
+        }
+    }
+};
+
+/// @brief Restart a multistep method from its current state, e.g. after the system of equations changed
+void RestartAtCurrentState(AdamsBashforthMoultonStepper& aStepper)
+{
+    aStepper.restart();
+}
+
+/// @brief Restart a dense output stepper from its current state, discarding the derivative computed there. The last
+/// step can still be interpolated.
+template <typename DenseStepper>
+void RestartAtCurrentState(DenseStepper& aDenseStepper)
+{
+    const NumericalSolver::StateVector stateVector = aDenseStepper.current_state();
+
+    aDenseStepper.initialize(stateVector, aDenseStepper.current_time(), aDenseStepper.current_time_step());
+}
+
+/// @brief Wrap the controlled stepper of a first-same-as-last dense output stepper to record its rejected steps, if
+/// diagnostics are provided. The accepted steps are recorded by the caller of the dense output stepper.
+template <typename ControlledStepper>
+class RejectionRecordingControlledStepper
+{
+   public:
+    typedef typename ControlledStepper::stepper_type stepper_type;
+    typedef typename ControlledStepper::state_type state_type;
+    typedef typename ControlledStepper::deriv_type deriv_type;
+    typedef typename ControlledStepper::value_type value_type;
+    typedef typename ControlledStepper::time_type time_type;
+    typedef explicit_controlled_stepper_fsal_tag stepper_category;
+
+    RejectionRecordingControlledStepper(
+        const ControlledStepper& aControlledStepper = ControlledStepper(),
+        NumericalSolver::Diagnostics* aDiagnosticsPtr = nullptr
+    )
+        : controlledStepper_(aControlledStepper),
+          diagnosticsPtr_(aDiagnosticsPtr)
+    {
+    }
+
+    template <class System, class StateIn, class DerivIn, class StateOut, class DerivOut>
+    controlled_step_result try_step(
+        System aSystem,
+        const StateIn& anInputState,
+        const DerivIn& anInputDerivative,
+        time_type& aTime,
+        StateOut& anOutputState,
+        DerivOut& anOutputDerivative,
+        time_type& aTimeStep
+    )
+    {
+        const controlled_step_result result = controlledStepper_.try_step(
+            aSystem, anInputState, anInputDerivative, aTime, anOutputState, anOutputDerivative, aTimeStep
+        );
+
+        if ((result != success) && (diagnosticsPtr_ != nullptr))
+        {
+            ++diagnosticsPtr_->rejectedStepCount;
+        }
+
+        return result;
+    }
+
+    stepper_type& stepper()
+    {
+        return controlledStepper_.stepper();
+    }
+
+    const stepper_type& stepper() const
+    {
+        return controlledStepper_.stepper();
+    }
+
+   private:
+    ControlledStepper controlledStepper_;
+    NumericalSolver::Diagnostics* diagnosticsPtr_;
+};
+
+typedef controlled_runge_kutta<dense_stepper_type_5> controlled_dense_stepper_type_5;
+typedef dense_output_runge_kutta<
+    RejectionRecordingControlledStepper<controlled_dense_stepper_type_5>,
+    explicit_controlled_stepper_fsal_tag>
+    recording_dense_stepper_type_5;
+
+recording_dense_stepper_type_5 MakeDenseStepper(
+    const double& anAbsoluteTolerance,
+    const double& aRelativeTolerance,
+    NumericalSolver::Diagnostics* aDiagnosticsPtr
+)
+{
+    typedef controlled_dense_stepper_type_5::error_checker_type error_checker_type;
+    typedef controlled_dense_stepper_type_5::step_adjuster_type step_adjuster_type;
+
+    const RejectionRecordingControlledStepper<controlled_dense_stepper_type_5> controlledStepper = {
+        controlled_dense_stepper_type_5(
+            error_checker_type(anAbsoluteTolerance, aRelativeTolerance), step_adjuster_type(), dense_stepper_type_5()
+        ),
+        aDiagnosticsPtr,
+    };
+
+    return recording_dense_stepper_type_5(controlledStepper);
+}
+
+/// @brief The multistep stepper records its rejected steps, to be added to the diagnostics once integrated
+Size CountRejectedSteps(const AdamsBashforthMoultonStepper& aStepper)
+{
+    return aStepper.getRejectedStepCount();
+}
+
+/// @brief The dense output stepper records its rejected steps in the diagnostics as they occur
+Size CountRejectedSteps(const recording_dense_stepper_type_5&)
+{
+    return 0;
+}
+
+/// @brief Restore the chronological order of the recorded states at the end of an integration, whichever way it exits
+class ChronologicalOrderRestorer
+{
+   public:
+    ChronologicalOrderRestorer(NumericalSolver::StateRecorder& aStateRecorder)
+        : stateRecorder_(aStateRecorder)
+    {
+    }
+
+    ~ChronologicalOrderRestorer()
+    {
+        stateRecorder_.restoreChronologicalOrder();
+    }
+
+   private:
+    NumericalSolver::StateRecorder& stateRecorder_;
+};
+
+}  // namespace
+
+NumericalSolver::ObservationPolicy::ObservationPolicy(
+    const NumericalSolver::ObservationPolicy::Type& aType, const Size& aCount, const Duration& aSpacing
+)
+    : type_(aType),
+      count_(aCount),
+      spacing_(aSpacing)
+{
+    if (((type_ == NumericalSolver::ObservationPolicy::Type::EveryNthStep) ||
+         (type_ == NumericalSolver::ObservationPolicy::Type::RingBuffer)) &&
+        (count_ == 0))
+    {
+        throw ostk::core::error::runtime::Wrong("Count");
+    }
+
+    if ((type_ == NumericalSolver::ObservationPolicy::Type::FixedSpacing) &&
+        ((!spacing_.isDefined()) || (spacing_ <= Duration::Zero())))
+    {
+        throw ostk::core::error::runtime::Wrong("Spacing");
+    }
+}
+
+bool NumericalSolver::ObservationPolicy::operator==(const NumericalSolver::ObservationPolicy& anObservationPolicy
+) const
+{
+    return (type_ == anObservationPolicy.type_) && (count_ == anObservationPolicy.count_) &&
+           (spacing_.isDefined() == anObservationPolicy.spacing_.isDefined()) &&
+           ((!spacing_.isDefined()) || (spacing_ == anObservationPolicy.spacing_));
+}
+
+NumericalSolver::ObservationPolicy::Type NumericalSolver::ObservationPolicy::getType() const
+{
+    return type_;
+}
+
+Size NumericalSolver::ObservationPolicy::getCount() const
+{
+    return count_;
+}
+
+Duration NumericalSolver::ObservationPolicy::getSpacing() const
+{
+    return spacing_;
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::All()
+{
+    return {NumericalSolver::ObservationPolicy::Type::All, 0, Duration::Undefined()};
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::None()
+{
+    return {NumericalSolver::ObservationPolicy::Type::None, 0, Duration::Undefined()};
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::EveryNthStep(const Size& aStepInterval)
+{
+    return {NumericalSolver::ObservationPolicy::Type::EveryNthStep, aStepInterval, Duration::Undefined()};
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::FixedSpacing(const Duration& aSpacing)
+{
+    return {NumericalSolver::ObservationPolicy::Type::FixedSpacing, 0, aSpacing};
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::RingBuffer(const Size& aCapacity)
+{
+    return {NumericalSolver::ObservationPolicy::Type::RingBuffer, aCapacity, Duration::Undefined()};
+}
+
+NumericalSolver::ObservationPolicy NumericalSolver::ObservationPolicy::Boundaries()
+{
+    return {NumericalSolver::ObservationPolicy::Type::Boundaries, 0, Duration::Undefined()};
+}
+
+String NumericalSolver::ObservationPolicy::StringFromType(const NumericalSolver::ObservationPolicy::Type& aType)
+{
+    switch (aType)
+    {
+        case NumericalSolver::ObservationPolicy::Type::All:
+            return "All";
+
+        case NumericalSolver::ObservationPolicy::Type::None:
+            return "None";
+
+        case NumericalSolver::ObservationPolicy::Type::EveryNthStep:
+            return "EveryNthStep";
+
+        case NumericalSolver::ObservationPolicy::Type::FixedSpacing:
+            return "FixedSpacing";
+
+        case NumericalSolver::ObservationPolicy::Type::RingBuffer:
+            return "RingBuffer";
+
+        case NumericalSolver::ObservationPolicy::Type::Boundaries:
+            return "Boundaries";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+
+    return String::Empty();
+}
+
+NumericalSolver::StateRecorder::StateRecorder(
+    const NumericalSolver::ObservationPolicy& anObservationPolicy, const Shared<StateSink>& aStateSinkSPtr
+)
+    : observationPolicy_(anObservationPolicy),
+      stateSinkSPtr_(aStateSinkSPtr),
+      states_(),
+      ringBufferStartIndex_(0),
+      stepCount_(0),
+      lastStateIsProvisional_(false),
+      lastSampledInstant_(Instant::Undefined())
+{
+}
+
+const NumericalSolver::ObservationPolicy& NumericalSolver::StateRecorder::accessObservationPolicy() const
+{
+    return observationPolicy_;
+}
+
+const Shared<StateSink>& NumericalSolver::StateRecorder::accessStateSink() const
+{
+    return stateSinkSPtr_;
+}
+
+bool NumericalSolver::StateRecorder::isEmpty() const
+{
+    return states_.isEmpty();
+}
+
+const Array<State>& NumericalSolver::StateRecorder::accessStates() const
+{
+    return states_;
+}
+
+void NumericalSolver::StateRecorder::record(const State& aState)
+{
+    if (stateSinkSPtr_ != nullptr)
+    {
+        stateSinkSPtr_->push(aState);
+    }
+
+    switch (observationPolicy_.getType())
+    {
+        case NumericalSolver::ObservationPolicy::Type::All:
+            states_.add(aState);
+            return;
+
+        case NumericalSolver::ObservationPolicy::Type::None:
+            return;
+
+        case NumericalSolver::ObservationPolicy::Type::RingBuffer:
+        {
+            if (states_.getSize() < observationPolicy_.getCount())
+            {
+                states_.add(aState);
+            }
+            else
+            {
+                states_[ringBufferStartIndex_] = aState;
+                ringBufferStartIndex_ = (ringBufferStartIndex_ + 1) % states_.getSize();
+            }
+
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    // Decimating policies: the latest state is kept provisionally, until it is replaced by the next one
+
+    if (lastStateIsProvisional_)
+    {
+        states_.pop_back();
+    }
+
+    bool isSampled = states_.isEmpty();
+
+    if (!isSampled)
+    {
+        ++stepCount_;
+
+        switch (observationPolicy_.getType())
+        {
+            case NumericalSolver::ObservationPolicy::Type::EveryNthStep:
+                isSampled = (stepCount_ % observationPolicy_.getCount()) == 0;
+                break;
+
+            case NumericalSolver::ObservationPolicy::Type::FixedSpacing:
+            {
+                isSampled = (aState.accessInstant() - lastSampledInstant_).getAbsolute() >=
+                            observationPolicy_.getSpacing();
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    states_.add(aState);
+
+    lastStateIsProvisional_ = !isSampled;
+
+    if (isSampled)
+    {
+        lastSampledInstant_ = aState.accessInstant();
+    }
+}
+
+void NumericalSolver::StateRecorder::restoreChronologicalOrder()
+{
+    if (ringBufferStartIndex_ != 0)
+    {
+        std::rotate(states_.begin(), states_.begin() + ringBufferStartIndex_, states_.end());
+        ringBufferStartIndex_ = 0;
+    }
+}
+
+void NumericalSolver::StateRecorder::reset()
+{
+    states_.clear();
+    ringBufferStartIndex_ = 0;
+    stepCount_ = 0;
+    lastStateIsProvisional_ = false;
+    lastSampledInstant_ = Instant::Undefined();
+}
+
+void NumericalSolver::StateRecorder::reset(const State& anInitialState)
+{
+    this->reset();
+    this->record(anInitialState);
+}
+
 NumericalSolver::NumericalSolver(
     const NumericalSolver::LogType& aLogType,
     const NumericalSolver::StepperType& aStepperType,
@@ -38,9 +950,61 @@ NumericalSolver::NumericalSolver(
 )
     : MathNumericalSolver(aLogType, aStepperType, aTimeStep, aRelativeTolerance, anAbsoluteTolerance),
       rootSolver_(aRootSolver),
-      observedStates_(),
-      stateLogger_(nullptr)
+      observedStates_(NumericalSolver::ObservationPolicy::All()),
+      stateLogger_(nullptr),
+      multistepType_(NumericalSolver::MultistepType::Undefined),
+      maximumOrder_(0),
+      diagnosticsEnabled_(false),
+      diagnostics_(),
+      stepObserver_(nullptr),
+      stateConverter_(nullptr),
+      isResumed_(false),
+      nextTimeStep_(Real::Undefined())
+{
+}
+
+bool NumericalSolver::operator==(const NumericalSolver& aNumericalSolver) const
+{
+    if (!MathNumericalSolver::operator==(aNumericalSolver))
+    {
+        return false;
+    }
+
+    if ((rootSolver_.getMaximumIterationCount() != aNumericalSolver.rootSolver_.getMaximumIterationCount()) ||
+        (rootSolver_.getTolerance() != aNumericalSolver.rootSolver_.getTolerance()))
+    {
+        return false;
+    }
+
+    if ((multistepType_ != aNumericalSolver.multistepType_) || (maximumOrder_ != aNumericalSolver.maximumOrder_) ||
+        (diagnosticsEnabled_ != aNumericalSolver.diagnosticsEnabled_))
+    {
+        return false;
+    }
+
+    if ((!(observedStates_.accessObservationPolicy() == aNumericalSolver.observedStates_.accessObservationPolicy())) ||
+        (observedStates_.accessStateSink() != aNumericalSolver.observedStates_.accessStateSink()))
+    {
+        return false;
+    }
+
+    if ((stateLogger_ == nullptr) || (aNumericalSolver.stateLogger_ == nullptr))
+    {
+        return (stateLogger_ == nullptr) && (aNumericalSolver.stateLogger_ == nullptr);
+    }
+
+    typedef void (*StateLoggerFunction)(const State&);
+
+    const StateLoggerFunction* stateLoggerFunction = stateLogger_.target<StateLoggerFunction>();
+    const StateLoggerFunction* otherStateLoggerFunction = aNumericalSolver.stateLogger_.target<StateLoggerFunction>();
+
+    return (stateLoggerFunction != nullptr) && (otherStateLoggerFunction != nullptr) &&
+           (*stateLoggerFunction == *otherStateLoggerFunction);
+}
+
+bool NumericalSolver::operator!=(const NumericalSolver& aNumericalSolver) const
 {
+    return !((*this) == aNumericalSolver);
 }
 
 const Array<State>& NumericalSolver::accessObservedStates() const
@@ -50,7 +1014,7 @@ const Array<State>& NumericalSolver::accessObservedStates() const
         throw ostk::core::error::runtime::Undefined("NumericalSolver");
     }
 
-    return observedStates_;
+    return observedStates_.accessStates();
 }
 
 RootSolver NumericalSolver::getRootSolver() const
@@ -63,17 +1027,120 @@ RootSolver NumericalSolver::getRootSolver() const
     return rootSolver_;
 }
 
+bool NumericalSolver::isMultistep() const
+{
+    return multistepType_ != NumericalSolver::MultistepType::Undefined;
+}
+
+NumericalSolver::MultistepType NumericalSolver::getMultistepType() const
+{
+    return multistepType_;
+}
+
+Size NumericalSolver::getMaximumOrder() const
+{
+    if (!this->isMultistep())
+    {
+        throw ostk::core::error::runtime::Undefined("Multistep type");
+    }
+
+    return maximumOrder_;
+}
+
 Array<State> NumericalSolver::getObservedStates() const
 {
     return accessObservedStates();
 }
 
+NumericalSolver::ObservationPolicy NumericalSolver::getObservationPolicy() const
+{
+    return observedStates_.accessObservationPolicy();
+}
+
+void NumericalSolver::setObservationPolicy(const NumericalSolver::ObservationPolicy& anObservationPolicy)
+{
+    observedStates_ = {anObservationPolicy, observedStates_.accessStateSink()};
+}
+
+Shared<StateSink> NumericalSolver::getStateSink() const
+{
+    return observedStates_.accessStateSink();
+}
+
+void NumericalSolver::setStateSink(const Shared<StateSink>& aStateSinkSPtr)
+{
+    observedStates_ = {observedStates_.accessObservationPolicy(), aStateSinkSPtr};
+}
+
+bool NumericalSolver::isDiagnosticsEnabled() const
+{
+    return diagnosticsEnabled_;
+}
+
+const NumericalSolver::Diagnostics& NumericalSolver::accessDiagnostics() const
+{
+    return diagnostics_;
+}
+
+NumericalSolver::Diagnostics NumericalSolver::getDiagnostics() const
+{
+    return accessDiagnostics();
+}
+
+void NumericalSolver::setDiagnosticsEnabled(const bool& isEnabled)
+{
+    diagnosticsEnabled_ = isEnabled;
+}
+
+void NumericalSolver::resetDiagnostics()
+{
+    diagnostics_ = NumericalSolver::Diagnostics();
+}
+
+void NumericalSolver::setStepObserver(const NumericalSolver::StepObserver& aStepObserver)
+{
+    stepObserver_ = aStepObserver;
+}
+
+void NumericalSolver::setStateConverter(const NumericalSolver::StateConverter& aStateConverter)
+{
+    stateConverter_ = aStateConverter;
+}
+
+void NumericalSolver::setTimeStep(const Real& aTimeStep)
+{
+    if (!aTimeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time step");
+    }
+
+    timeStep_ = aTimeStep;
+}
+
+void NumericalSolver::resume(const Real& aTimeStep)
+{
+    if (aTimeStep.isDefined())
+    {
+        timeStep_ = aTimeStep;
+    }
+
+    isResumed_ = true;
+}
+
+Real NumericalSolver::getNextTimeStep() const
+{
+    return nextTimeStep_;
+}
+
 Array<State> NumericalSolver::integrateTime(
     const State& aState,
     const Array<Instant>& anInstantArray,
     const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
 )
 {
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->instrumentSystemOfEquations(aSystemOfEquations);
+
     const Array<Real> durationArray = anInstantArray.map<Real>(
         [&aState](const Instant& anInstant) -> Real
         {
@@ -81,8 +1148,77 @@ Array<State> NumericalSolver::integrateTime(
         }
     );
 
+    nextTimeStep_ = Real::Undefined();
+
+    if (this->isMultistep())
+    {
+        if (durationArray.isEmpty())
+        {
+            return {};
+        }
+
+        const StateBuilder stateBuilder = {aState};
+
+        const double direction = (durationArray.accessLast() < 0.0) ? -1.0 : 1.0;
+
+        observeStep(aState.accessCoordinates(), 0.0, true);
+
+        AdamsBashforthMoultonStepper stepper = {absoluteTolerance_, relativeTolerance_, maximumOrder_};
+        stepper.initialize(aState.accessCoordinates(), 0.0, getSignedTimeStep(direction));
+
+        Array<State> states;
+        states.reserve(anInstantArray.getSize());
+
+        double previousDuration = 0.0;
+
+        for (Index i = 0; i < durationArray.getSize(); ++i)
+        {
+            const double duration = durationArray[i];
+
+            if ((direction * (duration - previousDuration)) < 0.0)
+            {
+                throw ostk::core::error::RuntimeError("Instants must be sorted in the integration direction.");
+            }
+
+            while ((direction * stepper.current_time()) < (direction * duration))
+            {
+                const std::pair<double, double> times = stepper.do_step(systemOfEquations);
+
+                if (diagnosticsEnabled_)
+                {
+                    RecordAcceptedStep(diagnostics_, times.second - times.first);
+                }
+
+                if (observeStep(stepper.current_state(), stepper.current_time(), false))
+                {
+                    stepper.restart();
+                }
+            }
+
+            NumericalSolver::StateVector stateVector(stepper.current_state());
+            stepper.calc_state(duration, stateVector);
+
+            states.add(stateBuilder.build(anInstantArray[i], stateVector));
+
+            previousDuration = duration;
+        }
+
+        if (diagnosticsEnabled_)
+        {
+            diagnostics_.rejectedStepCount += stepper.getRejectedStepCount();
+        }
+
+        nextTimeStep_ = std::abs(stepper.current_time_step());
+
+        return states;
+    }
+
+    // The base numerical solver does not report its next time step: only use it for its logging
+
     const Array<NumericalSolver::Solution> solutions =
-        MathNumericalSolver::integrateDuration(aState.accessCoordinates(), durationArray, aSystemOfEquations);
+        ((this->getLogType() == NumericalSolver::LogType::NoLog) || diagnosticsEnabled_ || (stepObserver_ != nullptr))
+            ? this->integrateDurationWithSteppers(aState.accessCoordinates(), durationArray, systemOfEquations)
+            : MathNumericalSolver::integrateDuration(aState.accessCoordinates(), durationArray, systemOfEquations);
 
     Array<State> states;
     states.reserve(solutions.getSize());
@@ -98,47 +1234,134 @@ Array<State> NumericalSolver::integrateTime(
         states.add(state);
     }
 
-    return states;
-}
+    return states;
+}
+
+State NumericalSolver::integrateTime(
+    const State& aState, const Instant& anEndTime, const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->instrumentSystemOfEquations(aSystemOfEquations);
+
+    this->startObservation(aState);
+
+    const ChronologicalOrderRestorer chronologicalOrderRestorer = {observedStates_};
+
+    const StateBuilder stateBuilder = {aState};
+
+    nextTimeStep_ = Real::Undefined();
+
+    if (this->isMultistep())
+    {
+        const double durationInSeconds = (anEndTime - aState.accessInstant()).inSeconds();
+
+        if (durationInSeconds == 0.0)
+        {
+            return aState;
+        }
+
+        const double direction = (durationInSeconds < 0.0) ? -1.0 : 1.0;
+
+        observeStep(aState.accessCoordinates(), 0.0, true);
+
+        AdamsBashforthMoultonStepper stepper = {absoluteTolerance_, relativeTolerance_, maximumOrder_};
+        stepper.initialize(aState.accessCoordinates(), 0.0, getSignedTimeStep(durationInSeconds));
+
+        while ((direction * stepper.current_time()) < (direction * durationInSeconds))
+        {
+            const std::pair<double, double> times = stepper.do_step(systemOfEquations);
+
+            if (diagnosticsEnabled_)
+            {
+                RecordAcceptedStep(diagnostics_, times.second - times.first);
+            }
+
+            if (observeStep(stepper.current_state(), stepper.current_time(), false))
+            {
+                stepper.restart();
+            }
+
+            if ((direction * stepper.current_time()) < (direction * durationInSeconds))
+            {
+                observeState(stateBuilder.build(
+                    aState.accessInstant() + Duration::Seconds(stepper.current_time()), stepper.current_state()
+                ));
+            }
+        }
+
+        // The last step may overshoot the end time, interpolate back to it
+
+        NumericalSolver::StateVector stateVector(stepper.current_state());
+        stepper.calc_state(durationInSeconds, stateVector);
+
+        if (diagnosticsEnabled_)
+        {
+            diagnostics_.rejectedStepCount += stepper.getRejectedStepCount();
+        }
+
+        nextTimeStep_ = std::abs(stepper.current_time_step());
+
+        const State endState = stateBuilder.build(anEndTime, stateVector);
+        observeState(endState);
+
+        return endState;
+    }
+
+    // The base numerical solver keeps every step in memory, and does not report its next time step: unless it is used
+    // for its logging, integrate with a step observer instead
 
-State NumericalSolver::integrateTime(
-    const State& aState, const Instant& anEndTime, const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
-)
-{
-    observedStates_ = {aState};
+    if ((this->getLogType() == NumericalSolver::LogType::NoLog) || diagnosticsEnabled_ ||
+        (stepObserver_ != nullptr) || (observedStates_.accessStateSink() != nullptr) ||
+        (observedStates_.accessObservationPolicy().getType() != NumericalSolver::ObservationPolicy::Type::All))
+    {
+        const Array<NumericalSolver::Solution> solutions = this->integrateDurationWithSteppers(
+            aState.accessCoordinates(),
+            {(anEndTime - aState.accessInstant()).inSeconds()},
+            systemOfEquations,
+            [this, &aState, &stateBuilder](const NumericalSolver::StateVector& aStateVector, const double& aTime
+            ) -> void
+            {
+                observedStates_.record(this->convertState(
+                    stateBuilder.build(aState.accessInstant() + Duration::Seconds(aTime), aStateVector)
+                ));
+            }
+        );
 
-    const StateBuilder stateBuilder = {aState};
+        return stateBuilder.build(anEndTime, solutions.accessFirst().first);
+    }
 
     const NumericalSolver::Solution solution = MathNumericalSolver::integrateDuration(
-        aState.accessCoordinates(), (anEndTime - aState.accessInstant()).inSeconds(), aSystemOfEquations
+        aState.accessCoordinates(), (anEndTime - aState.accessInstant()).inSeconds(), systemOfEquations
     );
 
     for (const auto& state : MathNumericalSolver::getObservedStateVectors())
     {
-        observedStates_.add(stateBuilder.build(aState.accessInstant() + Duration::Seconds(state.second), state.first));
+        observedStates_.record(this->convertState(
+            stateBuilder.build(aState.accessInstant() + Duration::Seconds(state.second), state.first)
+        ));
     }
 
     return stateBuilder.build(anEndTime, solution.first);
 }
 
-NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
+template <typename DenseStepper>
+NumericalSolver::ConditionSolution NumericalSolver::integrateTimeToCondition(
+    DenseStepper& aDenseStepper,
     const State& aState,
     const Instant& anInstant,
     const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
-    const EventCondition& anEventCondition
+    const EventCondition& anEventCondition,
+    const bool& isResumed,
+    const Array<Instant>& anOutputInstantArray,
+    Array<State>* anOutputStateArrayPtr
 )
 {
-    if (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5)
-    {
-        throw ostk::core::error::runtime::ToBeImplemented(
-            "Integrating with conditions is only supported with RungeKuttaDopri5 stepper type."
-        );
-    }
-
-    observedStates_ = {aState};
-
     const StateBuilder stateBuilder = {aState};
 
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        this->instrumentSystemOfEquations(aSystemOfEquations);
+
     const Real aDurationInSeconds = (anInstant - aState.accessInstant()).inSeconds();
 
     const auto createState = [&stateBuilder, &aState](const VectorXd& aStateVector, const double& aTime) -> State
@@ -146,34 +1369,41 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         return stateBuilder.build(aState.accessInstant() + Duration::Seconds(aTime), aStateVector);
     };
 
-    if (aDurationInSeconds.isZero())
-    {
-        return {
-            aState,
-            false,
-            0,
-            false,
-        };
-    }
+    // Interpolate the states at the output instants up to a time, if any
 
-    // Ensure that the time step is the correct sign
-    const double signedTimeStep = getSignedTimeStep(aDurationInSeconds);
+    const double direction = (aDurationInSeconds > 0.0) ? 1.0 : -1.0;
+    Index outputInstantIndex = 0;
 
-    // TBI: Adapt this to any dense stepper type
-    auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5());
+    const auto outputStatesUntil = [&anOutputInstantArray,
+                                    &anOutputStateArrayPtr,
+                                    &aDenseStepper,
+                                    &stateBuilder,
+                                    &aState,
+                                    &direction,
+                                    &outputInstantIndex](const double& aTime) -> void
+    {
+        if (anOutputStateArrayPtr == nullptr)
+        {
+            return;
+        }
 
-    // initialize stepper
-    double currentTime = 0.0;
-    stepper.initialize(aState.accessCoordinates(), currentTime, signedTimeStep);
+        while (outputInstantIndex < anOutputInstantArray.getSize())
+        {
+            const Instant& outputInstant = anOutputInstantArray[outputInstantIndex];
+            const double outputTime = (outputInstant - aState.accessInstant()).inSeconds();
 
-    // do first step
-    double previousTime;
-    std::tie(previousTime, currentTime) = stepper.do_step(aSystemOfEquations);
+            if ((direction * (outputTime - aTime)) > 0.0)
+            {
+                return;
+            }
 
-    State previousState = createState(stepper.current_state(), stepper.current_time());
-    observeState(previousState);
+            NumericalSolver::StateVector outputStateVector(aDenseStepper.current_state());
+            aDenseStepper.calc_state(outputTime, outputStateVector);
 
-    bool conditionSatisfied = false;
+            anOutputStateArrayPtr->add(stateBuilder.build(outputInstant, outputStateVector));
+            ++outputInstantIndex;
+        }
+    };
 
     // account for integration direction
     std::function<bool(const double&)> checkTimeLimit;
@@ -192,12 +1422,67 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         };
     }
 
+    // The last step may overshoot the end time, interpolate back to it
+
+    const auto createEndState = [&aDenseStepper, &createState, &aDurationInSeconds]() -> State
+    {
+        NumericalSolver::StateVector endStateVector(aDenseStepper.current_state());
+        aDenseStepper.calc_state(aDurationInSeconds, endStateVector);
+
+        return createState(endStateVector, aDurationInSeconds);
+    };
+
+    // Ensure that the time step is the correct sign
+    const double signedTimeStep = getSignedTimeStep(aDurationInSeconds);
+
+    // initialize stepper
+    double currentTime = 0.0;
+    observeStep(aState.accessCoordinates(), currentTime, true);
+    aDenseStepper.initialize(aState.accessCoordinates(), currentTime, signedTimeStep);
+
+    double previousTime = 0.0;
+    State previousState = aState;
+
+    // The condition is not evaluated over the first step, unless the integration resumes the last one
+
+    if (!isResumed)
+    {
+        std::tie(previousTime, currentTime) = aDenseStepper.do_step(systemOfEquations);
+
+        if (diagnosticsEnabled_)
+        {
+            RecordAcceptedStep(diagnostics_, currentTime - previousTime);
+        }
+
+        if (observeStep(aDenseStepper.current_state(), currentTime, false))
+        {
+            RestartAtCurrentState(aDenseStepper);
+        }
+
+        previousState = createState(aDenseStepper.current_state(), aDenseStepper.current_time());
+        observeState(checkTimeLimit(currentTime) ? previousState : createEndState());
+        outputStatesUntil(currentTime);
+    }
+
+    bool conditionSatisfied = false;
+
     State currentState = State::Undefined();
 
     while (checkTimeLimit(currentTime))
     {
-        std::tie(previousTime, currentTime) = stepper.do_step(aSystemOfEquations);
-        currentState = createState(stepper.current_state(), currentTime);
+        std::tie(previousTime, currentTime) = aDenseStepper.do_step(systemOfEquations);
+
+        if (diagnosticsEnabled_)
+        {
+            RecordAcceptedStep(diagnostics_, currentTime - previousTime);
+        }
+
+        if (observeStep(aDenseStepper.current_state(), currentTime, false))
+        {
+            RestartAtCurrentState(aDenseStepper);
+        }
+
+        currentState = createState(aDenseStepper.current_state(), currentTime);
 
         conditionSatisfied = anEventCondition.isSatisfied(currentState, previousState);
 
@@ -206,30 +1491,38 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
             break;
         }
 
-        observeState(currentState);
+        observeState(checkTimeLimit(currentTime) ? currentState : createEndState());
+        outputStatesUntil(currentTime);
         previousState = currentState;
     }
 
-    if (!conditionSatisfied)
+    if (diagnosticsEnabled_)
     {
-        NumericalSolver::StateVector currentStateVector(stepper.current_state());
-        stepper.calc_state(aDurationInSeconds, currentStateVector);
+        diagnostics_.rejectedStepCount += CountRejectedSteps(aDenseStepper);
+    }
+
+    // The step size proposed by the stepper is a sound first step for a continuation of the integration
 
+    const Real nextTimeStep = std::abs(aDenseStepper.current_time_step());
+
+    if (!conditionSatisfied)
+    {
         return {
-            createState(currentStateVector, aDurationInSeconds),
+            createEndState(),
             false,
             0,
             false,
+            nextTimeStep,
         };
     }
 
-    const auto checkCondition = [&anEventCondition, &stepper, &createState](const double& aTime) -> double
+    const auto checkCondition = [&anEventCondition, &aDenseStepper, &createState](const double& aTime) -> double
     {
-        NumericalSolver::StateVector stateVector(stepper.current_state());
-        stepper.calc_state(aTime, stateVector);
+        NumericalSolver::StateVector stateVector(aDenseStepper.current_state());
+        aDenseStepper.calc_state(aTime, stateVector);
 
         const bool isSatisfied = anEventCondition.isSatisfied(
-            createState(stateVector, aTime), createState(stepper.previous_state(), stepper.previous_time())
+            createState(stateVector, aTime), createState(aDenseStepper.previous_state(), aDenseStepper.previous_time())
         );
 
         return isSatisfied ? 1.0 : -1.0;
@@ -245,6 +1538,7 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
             true,
             0,
             true,
+            nextTimeStep,
         };
     }
 
@@ -252,10 +1546,18 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
     // Condition at currentTime => True
     // Search for the exact time of the condition change
     const RootSolver::Solution solution = rootSolver_.bisection(checkCondition, previousTime, currentTime);
+
+    if (diagnosticsEnabled_)
+    {
+        diagnostics_.rootSolverIterationCount += solution.iterationCount;
+    }
+
     NumericalSolver::StateVector solutionStateVector(aState.accessCoordinates().size());
     const double solutionTime = solution.root;
 
-    stepper.calc_state(solutionTime, solutionStateVector);
+    outputStatesUntil(solutionTime);
+
+    aDenseStepper.calc_state(solutionTime, solutionStateVector);
     const State solutionState = createState(solutionStateVector, solutionTime);
     observeState(solutionState);
 
@@ -264,9 +1566,132 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         true,
         solution.iterationCount,
         solution.hasConverged,
+        nextTimeStep,
     };
 }
 
+NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
+    const State& aState,
+    const Instant& anInstant,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const EventCondition& anEventCondition
+)
+{
+    if (!this->isMultistep() && (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5))
+    {
+        throw ostk::core::error::runtime::ToBeImplemented(
+            "Integrating with conditions is only supported with RungeKuttaDopri5 stepper type or multistep methods."
+        );
+    }
+
+    const bool isResumed = this->startObservation(aState);
+
+    const ChronologicalOrderRestorer chronologicalOrderRestorer = {observedStates_};
+
+    const Real aDurationInSeconds = (anInstant - aState.accessInstant()).inSeconds();
+
+    if (aDurationInSeconds.isZero())
+    {
+        return {
+            aState,
+            false,
+            0,
+            false,
+        };
+    }
+
+    if (this->isMultistep())
+    {
+        AdamsBashforthMoultonStepper stepper = {absoluteTolerance_, relativeTolerance_, maximumOrder_};
+
+        return integrateTimeToCondition(stepper, aState, anInstant, aSystemOfEquations, anEventCondition, isResumed);
+    }
+
+    auto stepper =
+        MakeDenseStepper(absoluteTolerance_, relativeTolerance_, diagnosticsEnabled_ ? &diagnostics_ : nullptr);
+
+    return integrateTimeToCondition(stepper, aState, anInstant, aSystemOfEquations, anEventCondition, isResumed);
+}
+
+NumericalSolver::ConditionSolution NumericalSolver::integrateTimesToCondition(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const EventCondition& anEventCondition,
+    Array<State>& anOutputStateArray
+)
+{
+    if (!this->isMultistep() && (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5))
+    {
+        throw ostk::core::error::runtime::ToBeImplemented(
+            "Integrating with conditions is only supported with RungeKuttaDopri5 stepper type or multistep methods."
+        );
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant array");
+    }
+
+    const bool isResumed = this->startObservation(aState);
+
+    const ChronologicalOrderRestorer chronologicalOrderRestorer = {observedStates_};
+
+    const Instant& endInstant = anInstantArray.accessLast();
+
+    // Instants at the start state are reached without integrating
+
+    Index instantIndex = 0;
+
+    while ((instantIndex < anInstantArray.getSize()) && (anInstantArray[instantIndex] == aState.accessInstant()))
+    {
+        anOutputStateArray.add(aState);
+        ++instantIndex;
+    }
+
+    if (instantIndex == anInstantArray.getSize())
+    {
+        return {
+            aState,
+            false,
+            0,
+            false,
+        };
+    }
+
+    const Array<Instant> outputInstants(anInstantArray.begin() + instantIndex, anInstantArray.end());
+
+    if (this->isMultistep())
+    {
+        AdamsBashforthMoultonStepper stepper = {absoluteTolerance_, relativeTolerance_, maximumOrder_};
+
+        return integrateTimeToCondition(
+            stepper,
+            aState,
+            endInstant,
+            aSystemOfEquations,
+            anEventCondition,
+            isResumed,
+            outputInstants,
+            &anOutputStateArray
+        );
+    }
+
+    auto stepper =
+        MakeDenseStepper(absoluteTolerance_, relativeTolerance_, diagnosticsEnabled_ ? &diagnostics_ : nullptr);
+
+    return integrateTimeToCondition(
+        stepper,
+        aState,
+        endInstant,
+        aSystemOfEquations,
+        anEventCondition,
+        isResumed,
+        outputInstants,
+        &anOutputStateArray
+    );
+}
+
 NumericalSolver NumericalSolver::Undefined()
 {
     return {
@@ -337,6 +1762,35 @@ NumericalSolver NumericalSolver::Conditional(
     };
 }
 
+NumericalSolver NumericalSolver::AdamsBashforthMoulton(
+    const Real& aTimeStep,
+    const Real& aRelativeTolerance,
+    const Real& anAbsoluteTolerance,
+    const Size& aMaximumOrder,
+    const std::function<void(const State&)>& stateLogger
+)
+{
+    if ((aMaximumOrder < 1) || (aMaximumOrder > 12))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum order");
+    }
+
+    const NumericalSolver::LogType logType =
+        stateLogger != nullptr ? NumericalSolver::LogType::LogAdaptive : NumericalSolver::LogType::NoLog;
+
+    return {
+        logType,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        aTimeStep,
+        aRelativeTolerance,
+        anAbsoluteTolerance,
+        RootSolver::Default(),
+        stateLogger,
+        NumericalSolver::MultistepType::AdamsBashforthMoulton,
+        aMaximumOrder,
+    };
+}
+
 NumericalSolver::NumericalSolver(
     const NumericalSolver::LogType& aLogType,
     const NumericalSolver::StepperType& aStepperType,
@@ -344,22 +1798,212 @@ NumericalSolver::NumericalSolver(
     const Real& aRelativeTolerance,
     const Real& anAbsoluteTolerance,
     const RootSolver& aRootSolver,
-    const std::function<void(const State& aState)>& stateLogger
+    const std::function<void(const State& aState)>& stateLogger,
+    const MultistepType& aMultistepType,
+    const Size& aMaximumOrder
 )
     : MathNumericalSolver(aLogType, aStepperType, aTimeStep, aRelativeTolerance, anAbsoluteTolerance),
       rootSolver_(aRootSolver),
-      observedStates_(),
-      stateLogger_(stateLogger)
+      observedStates_(NumericalSolver::ObservationPolicy::All()),
+      stateLogger_(stateLogger),
+      multistepType_(aMultistepType),
+      maximumOrder_(aMaximumOrder),
+      diagnosticsEnabled_(false),
+      diagnostics_(),
+      stepObserver_(nullptr),
+      stateConverter_(nullptr),
+      isResumed_(false),
+      nextTimeStep_(Real::Undefined())
+{
+}
+
+NumericalSolver NumericalSolver::createWorkspace() const
+{
+    NumericalSolver workspace = {
+        this->getLogType(),
+        this->getStepperType(),
+        this->getTimeStep(),
+        this->getRelativeTolerance(),
+        this->getAbsoluteTolerance(),
+        rootSolver_,
+        stateLogger_,
+        multistepType_,
+        maximumOrder_,
+    };
+
+    workspace.observedStates_ = {observedStates_.accessObservationPolicy(), observedStates_.accessStateSink()};
+    workspace.diagnosticsEnabled_ = diagnosticsEnabled_;
+
+    return workspace;
+}
+
+NumericalSolver::SystemOfEquationsWrapper NumericalSolver::instrumentSystemOfEquations(
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    if (!diagnosticsEnabled_)
+    {
+        return aSystemOfEquations;
+    }
+
+    return [this, aSystemOfEquations](
+               const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+           ) -> void
+    {
+        ++diagnostics_.systemOfEquationsEvaluationCount;
+
+        aSystemOfEquations(x, dxdt, t);
+    };
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::integrateDurationWithSteppers(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const std::function<void(const NumericalSolver::StateVector&, const double&)>& aStepObserver
+)
+{
+    if (aDurationArray.isEmpty())
+    {
+        return {};
+    }
+
+    const double timeStep = getSignedTimeStep(aDurationArray.accessLast());
+
+    observeStep(anInitialStateVector, 0.0, true);
+
+    Array<NumericalSolver::Solution> solutions;
+    solutions.reserve(aDurationArray.getSize());
+
+    const auto integrate = [&](auto aStepper) -> void
+    {
+        InstrumentedStepper<decltype(aStepper)> stepper = {
+            aStepper,
+            diagnosticsEnabled_ ? &diagnostics_ : nullptr,
+            (stepObserver_ != nullptr) ? &stepObserver_ : nullptr,
+            &nextTimeStep_,
+        };
+
+        NumericalSolver::StateVector stateVector = anInitialStateVector;
+
+        // Use the same integration loops as the base numerical solver, with an observer recording the steps
+
+        if (aStepObserver != nullptr)
+        {
+            integrate_adaptive(
+                stepper,
+                aSystemOfEquations,
+                stateVector,
+                0.0,
+                double(aDurationArray.accessFirst()),
+                timeStep,
+                [&aStepObserver](const NumericalSolver::StateVector& aStateVector, const double aTime) -> void
+                {
+                    if (aTime != 0.0)
+                    {
+                        aStepObserver(aStateVector, aTime);
+                    }
+                }
+            );
+
+            solutions.add({stateVector, double(aDurationArray.accessFirst())});
+
+            return;
+        }
+
+        std::vector<double> times = {0.0};
+        times.reserve(aDurationArray.getSize() + 1);
+
+        for (const Real& duration : aDurationArray)
+        {
+            times.push_back(duration);
+        }
+
+        Index timeIndex = 0;
+
+        integrate_times(
+            stepper,
+            aSystemOfEquations,
+            stateVector,
+            times.begin(),
+            times.end(),
+            timeStep,
+            [&solutions, &timeIndex](const NumericalSolver::StateVector& aStateVector, const double aTime) -> void
+            {
+                if (timeIndex++ > 0)
+                {
+                    solutions.add({aStateVector, aTime});
+                }
+            }
+        );
+    };
+
+    switch (stepperType_)
+    {
+        case NumericalSolver::StepperType::RungeKutta4:
+            integrate(runge_kutta4<NumericalSolver::StateVector>());
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            integrate(make_controlled(
+                absoluteTolerance_, relativeTolerance_, runge_kutta_cash_karp54<NumericalSolver::StateVector>()
+            ));
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            integrate(make_controlled(
+                absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<NumericalSolver::StateVector>()
+            ));
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            integrate(make_controlled(
+                absoluteTolerance_, relativeTolerance_, runge_kutta_dopri5<NumericalSolver::StateVector>()
+            ));
+            break;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+
+    return solutions;
+}
+
+bool NumericalSolver::observeStep(
+    const NumericalSolver::StateVector& aStateVector, const double& aTime, const bool& isStart
+) const
+{
+    return (stepObserver_ != nullptr) && stepObserver_(aStateVector, aTime, isStart);
+}
+
+bool NumericalSolver::startObservation(const State& anInitialState)
+{
+    if (isResumed_)
+    {
+        isResumed_ = false;
+
+        return true;
+    }
+
+    observedStates_.reset(this->convertState(anInitialState));
+
+    return false;
+}
+
+State NumericalSolver::convertState(const State& aState) const
 {
+    return (stateConverter_ != nullptr) ? stateConverter_(aState) : aState;
 }
 
 void NumericalSolver::observeState(const State& aState)
 {
-    observedStates_.add(aState);
+    const State observedState = this->convertState(aState);
+
+    observedStates_.record(observedState);
 
     if (stateLogger_ != nullptr && getLogType() != NumericalSolver::LogType::NoLog)
     {
-        stateLogger_(aState);
+        stateLogger_(observedState);
     }
 }
 
@@ -0,0 +1,412 @@
+/// Apache License 2.0
+
+#include <chrono>
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/Binary.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/CSV.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+
+namespace
+{
+
+/// @brief Sleep duration of the writer thread when the queue is empty
+const std::chrono::microseconds WriterIdleDuration = std::chrono::microseconds(50);
+
+/// @brief Sleep duration of a thread waiting for the writer thread
+const std::chrono::microseconds WaitDuration = std::chrono::microseconds(100);
+
+/// @brief Release a producer admitted to push a state, for the lifetime of this object
+class ProducerRelease
+{
+   public:
+    ProducerRelease(std::atomic<Size>& anActiveProducerCount)
+        : activeProducerCount_(anActiveProducerCount)
+    {
+    }
+
+    ~ProducerRelease()
+    {
+        activeProducerCount_.fetch_sub(1, std::memory_order_release);
+    }
+
+   private:
+    std::atomic<Size>& activeProducerCount_;
+};
+
+}  // namespace
+
+StateSink::StateSink(
+    const Shared<StateWriter>& aStateWriterSPtr, const Size& aQueueCapacity, const Size& aStepInterval
+)
+    : stateWriterSPtr_(aStateWriterSPtr),
+      stepInterval_(aStepInterval),
+      queueMask_(0),
+      slots_(nullptr),
+      enqueuePosition_(0),
+      dequeuePosition_(0),
+      pushedStateCount_(0),
+      enqueuedStateCount_(0),
+      writtenStateCount_(0),
+      stallCount_(0),
+      activeProducerCount_(0),
+      flushRequestCount_(0),
+      flushCount_(0),
+      isClosing_(false),
+      closeMutex_(),
+      writerThread_(),
+      writerErrorMutex_(),
+      writerError_(nullptr)
+{
+    if (stateWriterSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("State writer");
+    }
+
+    if (aQueueCapacity == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Queue capacity");
+    }
+
+    if (stepInterval_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Step interval");
+    }
+
+    std::size_t queueCapacity = 2;
+
+    while (queueCapacity < aQueueCapacity)
+    {
+        queueCapacity *= 2;
+    }
+
+    queueMask_ = queueCapacity - 1;
+    slots_.reset(new Slot[queueCapacity]);
+
+    for (std::size_t i = 0; i < queueCapacity; ++i)
+    {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    writerThread_ = std::thread(&StateSink::run, this);
+}
+
+StateSink::~StateSink()
+{
+    try
+    {
+        this->close();
+    }
+    catch (...)
+    {
+    }
+}
+
+bool StateSink::isOpen() const
+{
+    return !isClosing_.load(std::memory_order_acquire);
+}
+
+Size StateSink::getQueueCapacity() const
+{
+    return queueMask_ + 1;
+}
+
+Size StateSink::getStepInterval() const
+{
+    return stepInterval_;
+}
+
+Size StateSink::getPushedStateCount() const
+{
+    return pushedStateCount_.load(std::memory_order_relaxed);
+}
+
+Size StateSink::getWrittenStateCount() const
+{
+    return writtenStateCount_.load(std::memory_order_acquire);
+}
+
+Size StateSink::getStallCount() const
+{
+    return stallCount_.load(std::memory_order_relaxed);
+}
+
+void StateSink::push(const State& aState)
+{
+    // A producer is admitted before checking that the sink is open, so that the writer thread, once closing, waits for
+    // every admitted producer to be done before writing the last states
+
+    activeProducerCount_.fetch_add(1, std::memory_order_seq_cst);
+
+    const ProducerRelease producerRelease = {activeProducerCount_};
+
+    if (isClosing_.load(std::memory_order_seq_cst))
+    {
+        throw ostk::core::error::RuntimeError("State sink is closed.");
+    }
+
+    if ((pushedStateCount_.fetch_add(1, std::memory_order_relaxed) % stepInterval_) != 0)
+    {
+        return;
+    }
+
+    if (!this->tryEnqueue(aState))
+    {
+        stallCount_.fetch_add(1, std::memory_order_relaxed);
+
+        // The writer thread keeps draining the queue while admitted producers are pushing, even when closing
+
+        while (!this->tryEnqueue(aState))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    enqueuedStateCount_.fetch_add(1, std::memory_order_release);
+}
+
+void StateSink::flush()
+{
+    if (this->isOpen())
+    {
+        const Size flushRequest = flushRequestCount_.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+        // A concurrent close writes the remaining states itself
+
+        while ((flushCount_.load(std::memory_order_acquire) < flushRequest) && this->isOpen())
+        {
+            std::this_thread::sleep_for(WaitDuration);
+        }
+    }
+
+    this->throwWriterError();
+}
+
+void StateSink::close()
+{
+    {
+        const std::lock_guard<std::mutex> lock(closeMutex_);
+
+        isClosing_.store(true, std::memory_order_seq_cst);
+
+        if (writerThread_.joinable())
+        {
+            writerThread_.join();
+        }
+    }
+
+    this->throwWriterError();
+}
+
+Shared<StateSink> StateSink::CSV(const File& aFile, const Size& aStepInterval)
+{
+    return std::make_shared<StateSink>(std::make_shared<statewriters::CSV>(aFile), 1024, aStepInterval);
+}
+
+Shared<StateSink> StateSink::Binary(const File& aFile, const Size& aStepInterval)
+{
+    return std::make_shared<StateSink>(std::make_shared<statewriters::Binary>(aFile), 1024, aStepInterval);
+}
+
+bool StateSink::tryEnqueue(const State& aState)
+{
+    // Bounded multiple-producer queue (D. Vyukov): each slot carries a sequence number telling whether it is free for
+    // the current lap of the producers, or holds a state for the current lap of the consumer
+
+    std::size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+    Slot* slotPtr = nullptr;
+
+    while (true)
+    {
+        slotPtr = &slots_[position & queueMask_];
+
+        const std::size_t sequence = slotPtr->sequence.load(std::memory_order_acquire);
+        const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+        if (difference == 0)
+        {
+            if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = enqueuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slotPtr->state = aState;
+    slotPtr->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool StateSink::tryDequeue(State& aState)
+{
+    // Single consumer: the writer thread
+
+    const std::size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[position & queueMask_];
+
+    if (slot.sequence.load(std::memory_order_acquire) != (position + 1))
+    {
+        return false;
+    }
+
+    aState = slot.state;
+    slot.state = State::Undefined();
+
+    dequeuePosition_.store(position + 1, std::memory_order_relaxed);
+    slot.sequence.store(position + queueMask_ + 1, std::memory_order_release);
+
+    return true;
+}
+
+void StateSink::run()
+{
+    State state = State::Undefined();
+    Size dequeuedStateCount = 0;
+    bool hasFailed = false;
+
+    const auto writeState = [this, &state, &dequeuedStateCount, &hasFailed]() -> void
+    {
+        ++dequeuedStateCount;
+
+        if (hasFailed)
+        {
+            return;
+        }
+
+        try
+        {
+            stateWriterSPtr_->write(state);
+            writtenStateCount_.fetch_add(1, std::memory_order_release);
+        }
+        catch (...)
+        {
+            hasFailed = true;
+            this->setWriterError(std::current_exception());
+        }
+    };
+
+    // Write every state enqueued so far, waiting for producers that reserved a slot but have not filled it yet
+
+    const auto writeEnqueuedStates = [this, &state, &dequeuedStateCount, &hasFailed, &writeState]() -> void
+    {
+        const Size enqueuedStateCount = enqueuedStateCount_.load(std::memory_order_acquire);
+
+        while (dequeuedStateCount < enqueuedStateCount)
+        {
+            if (this->tryDequeue(state))
+            {
+                writeState();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (hasFailed)
+        {
+            return;
+        }
+
+        try
+        {
+            stateWriterSPtr_->flush();
+        }
+        catch (...)
+        {
+            hasFailed = true;
+            this->setWriterError(std::current_exception());
+        }
+    };
+
+    while (true)
+    {
+        const bool isClosing = isClosing_.load(std::memory_order_acquire);
+        const Size flushRequest = flushRequestCount_.load(std::memory_order_acquire);
+
+        bool isIdle = true;
+
+        while (this->tryDequeue(state))
+        {
+            writeState();
+            isIdle = false;
+        }
+
+        if (isClosing)
+        {
+            // Producers admitted before closing may still be pushing
+
+            while (activeProducerCount_.load(std::memory_order_seq_cst) != 0)
+            {
+                while (this->tryDequeue(state))
+                {
+                    writeState();
+                }
+
+                std::this_thread::yield();
+            }
+
+            writeEnqueuedStates();
+            flushCount_.store(flushRequestCount_.load(std::memory_order_acquire), std::memory_order_release);
+
+            return;
+        }
+
+        if (flushRequest != flushCount_.load(std::memory_order_relaxed))
+        {
+            writeEnqueuedStates();
+            flushCount_.store(flushRequest, std::memory_order_release);
+        }
+
+        if (isIdle)
+        {
+            std::this_thread::sleep_for(WriterIdleDuration);
+        }
+    }
+}
+
+void StateSink::setWriterError(const std::exception_ptr& anError)
+{
+    const std::lock_guard<std::mutex> lock(writerErrorMutex_);
+
+    if (writerError_ == nullptr)
+    {
+        writerError_ = anError;
+    }
+}
+
+void StateSink::throwWriterError() const
+{
+    const std::lock_guard<std::mutex> lock(writerErrorMutex_);
+
+    if (writerError_ != nullptr)
+    {
+        std::rethrow_exception(writerError_);
+    }
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
@@ -0,0 +1,19 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+
+StateWriter::~StateWriter() {}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
@@ -0,0 +1,89 @@
+/// Apache License 2.0
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/Binary.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+namespace statewriters
+{
+
+using ostk::physics::time::Instant;
+
+static const char BinaryMagic[8] = {'O', 'S', 'T', 'K', 'S', 'T', 'A', 'T'};
+static const std::uint32_t BinaryVersion = 1;
+
+Binary::Binary(const File& aFile)
+    : StateWriter(),
+      file_(aFile),
+      stream_()
+{
+    if (!file_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    stream_.open(file_.getPath().toString(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+    if (!stream_.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", file_.toString());
+    }
+
+    stream_.write(BinaryMagic, sizeof(BinaryMagic));
+    stream_.write(reinterpret_cast<const char*>(&BinaryVersion), sizeof(BinaryVersion));
+}
+
+Binary::~Binary()
+{
+    if (stream_.is_open())
+    {
+        stream_.close();
+    }
+}
+
+File Binary::getFile() const
+{
+    return file_;
+}
+
+void Binary::write(const State& aState)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    const double secondsSinceJ2000 = (aState.accessInstant() - Instant::J2000()).inSeconds();
+    const VectorXd& coordinates = aState.accessCoordinates();
+    const std::uint32_t coordinateCount = static_cast<std::uint32_t>(coordinates.size());
+
+    stream_.write(reinterpret_cast<const char*>(&secondsSinceJ2000), sizeof(secondsSinceJ2000));
+    stream_.write(reinterpret_cast<const char*>(&coordinateCount), sizeof(coordinateCount));
+    stream_.write(reinterpret_cast<const char*>(coordinates.data()), coordinateCount * sizeof(double));
+
+    if (!stream_.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write to file [{}].", file_.toString());
+    }
+}
+
+void Binary::flush()
+{
+    stream_.flush();
+}
+
+}  // namespace statewriters
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
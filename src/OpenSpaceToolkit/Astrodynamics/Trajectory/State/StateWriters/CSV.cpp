@@ -0,0 +1,115 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/CSV.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace state
+{
+namespace statewriters
+{
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Scale;
+
+CSV::CSV(const File& aFile, const Size& aPrecision)
+    : StateWriter(),
+      file_(aFile),
+      stream_(),
+      header_(String::Empty())
+{
+    if (!file_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (aPrecision == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Precision");
+    }
+
+    stream_.open(file_.getPath().toString(), std::ios::out | std::ios::trunc);
+
+    if (!stream_.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", file_.toString());
+    }
+
+    stream_.precision(aPrecision);
+}
+
+CSV::~CSV()
+{
+    if (stream_.is_open())
+    {
+        stream_.close();
+    }
+}
+
+File CSV::getFile() const
+{
+    return file_;
+}
+
+void CSV::write(const State& aState)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    String header = "Instant,Frame";
+
+    for (const auto& subsetSPtr : aState.accessCoordinatesBroker()->accessSubsets())
+    {
+        const Size subsetSize = subsetSPtr->getSize();
+
+        for (Size i = 0; i < subsetSize; ++i)
+        {
+            header += "," + subsetSPtr->getName() + ((subsetSize > 1) ? ("_" + std::to_string(i)) : "");
+        }
+    }
+
+    if (header != header_)
+    {
+        stream_ << header << '\n';
+        header_ = header;
+    }
+
+    stream_ << aState.accessInstant().getDateTime(Scale::UTC).toString(DateTime::Format::ISO8601) << ','
+            << aState.accessFrame()->getName();
+
+    const VectorXd& coordinates = aState.accessCoordinates();
+
+    for (Eigen::Index i = 0; i < coordinates.size(); ++i)
+    {
+        stream_ << ',' << coordinates[i];
+    }
+
+    stream_ << '\n';
+
+    if (!stream_.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write to file [{}].", file_.toString());
+    }
+}
+
+void CSV::flush()
+{
+    stream_.flush();
+}
+
+}  // namespace statewriters
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astro
+}  // namespace ostk
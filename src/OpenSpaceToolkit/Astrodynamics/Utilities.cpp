@@ -0,0 +1,92 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
+
+namespace ostk
+{
+namespace astro
+{
+namespace utilities
+{
+
+Size ResolveThreadCount(const Size& aThreadCount)
+{
+    return (aThreadCount == 0) ? std::max<Size>(1, std::thread::hardware_concurrency()) : aThreadCount;
+}
+
+void ParallelFor(const Size& aCount, const Size& aThreadCount, const std::function<void(const Index&)>& aFunction)
+{
+    const Size workerCount = std::min(ResolveThreadCount(aThreadCount), aCount);
+
+    if (workerCount <= 1)
+    {
+        for (Index index = 0; index < aCount; ++index)
+        {
+            aFunction(index);
+        }
+
+        return;
+    }
+
+    std::atomic<Size> nextIndex = {0};
+    std::vector<std::future<void>> workers;
+    workers.reserve(workerCount);
+
+    for (Size workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.push_back(std::async(
+            std::launch::async,
+            [&aFunction, &nextIndex, aCount]() -> void
+            {
+                for (Size index = nextIndex.fetch_add(1); index < aCount; index = nextIndex.fetch_add(1))
+                {
+                    try
+                    {
+                        aFunction(index);
+                    }
+                    catch (...)
+                    {
+                        // Stop handing out indices to the other workers
+
+                        nextIndex.store(aCount);
+
+                        throw;
+                    }
+                }
+            }
+        ));
+    }
+
+    std::exception_ptr error = nullptr;
+
+    for (std::future<void>& worker : workers)
+    {
+        try
+        {
+            worker.get();
+        }
+        catch (...)
+        {
+            if (error == nullptr)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace utilities
+}  // namespace astro
+}  // namespace ostk
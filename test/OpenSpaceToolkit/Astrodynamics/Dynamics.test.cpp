@@ -4,7 +4,11 @@
 
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 
 #include <Global.test.hpp>
 
@@ -15,14 +19,19 @@ using ostk::core::types::Shared;
 using ostk::core::types::Size;
 using ostk::core::types::String;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 
 using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::time::Instant;
 using ostk::physics::coord::Frame;
 
 using ostk::astro::trajectory::state::NumericalSolver;
 using ostk::astro::Dynamics;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::PositionDerivative;
 using ostk::astro::trajectory::state::CoordinatesBroker;
 using ostk::astro::trajectory::state::CoordinatesSubset;
 
@@ -88,3 +97,34 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, FromEnvironment)
         EXPECT_NO_THROW(Dynamics::FromEnvironment(Environment::Default()));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, ComputeJacobian)
+{
+    const Shared<Dynamics> positionDerivativeSPtr = std::make_shared<PositionDerivative>();
+    const Shared<Dynamics> centralBodyGravitySPtr =
+        std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical()));
+
+    const Array<Pair<Index, Size>> positionIndexes = {Pair<Index, Size>(0, 3)};
+    const Array<Pair<Index, Size>> velocityIndexes = {Pair<Index, Size>(3, 3)};
+
+    const Array<Dynamics::Context> contexts = {
+        Dynamics::Context(positionDerivativeSPtr, velocityIndexes, positionIndexes),
+        Dynamics::Context(centralBodyGravitySPtr, positionIndexes, velocityIndexes),
+    };
+
+    VectorXd stateVector(6);
+    stateVector << 7000000.0, 1000000.0, -500000.0, 100.0, 7546.05329, 50.0;
+
+    const MatrixXd jacobian = Dynamics::ComputeJacobian(contexts, Instant::J2000(), stateVector, Frame::GCRF());
+
+    EXPECT_EQ(6, jacobian.rows());
+    EXPECT_EQ(6, jacobian.cols());
+
+    EXPECT_TRUE(jacobian.block(0, 0, 3, 3).isZero());
+    EXPECT_TRUE(jacobian.block(0, 3, 3, 3).isIdentity());
+    EXPECT_TRUE(jacobian.block(3, 3, 3, 3).isZero());
+
+    EXPECT_TRUE(jacobian.block(3, 0, 3, 3).isApprox(
+        centralBodyGravitySPtr->computeContributionJacobian(Instant::J2000(), stateVector.head(3), Frame::GCRF())
+    ));
+}
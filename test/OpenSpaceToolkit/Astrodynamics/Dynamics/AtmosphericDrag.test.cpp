@@ -21,12 +21,15 @@
 #include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Moon.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 #include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag/DensityCache.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
@@ -47,6 +50,7 @@ using ostk::math::geometry::d3::objects::Composite;
 using ostk::math::geometry::d3::objects::Cuboid;
 using ostk::math::geometry::d3::objects::Point;
 using ostk::math::object::Matrix3d;
+using ostk::math::object::MatrixXd;
 using ostk::math::object::Vector3d;
 using ostk::math::object::VectorXd;
 
@@ -59,7 +63,9 @@ using ostk::physics::environment::object::celestial::Moon;
 using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::environment::ephemerides::Analytical;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::units::Mass;
 using ostk::physics::units::Length;
@@ -72,6 +78,7 @@ using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
 using ostk::astro::flight::system::SatelliteSystem;
 using ostk::astro::Dynamics;
 using ostk::astro::dynamics::AtmosphericDrag;
+using ostk::astro::dynamics::atmosphericdrag::DensityCache;
 using ostk::astro::dynamics::CentralBodyGravity;
 using ostk::astro::dynamics::PositionDerivative;
 using ostk::astro::trajectory::state::CoordinatesSubset;
@@ -245,3 +252,67 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContribut
     EXPECT_GT(5e-11, -0.0000278707803890 - contribution[1]);
     EXPECT_GT(5e-11, -0.0000000000197640 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, DensityCache)
+{
+    const Shared<const DensityCache> densityCacheSPtr = std::make_shared<DensityCache>(
+        earthSPtr_, Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0))
+    );
+
+    {
+        EXPECT_THROW(AtmosphericDrag(Shared<const DensityCache>(nullptr)), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        const AtmosphericDrag atmosphericDrag = {earthSPtr_};
+
+        EXPECT_FALSE(atmosphericDrag.hasDensityCache());
+        EXPECT_THROW(atmosphericDrag.getDensityCache(), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        const AtmosphericDrag atmosphericDrag = {densityCacheSPtr};
+
+        EXPECT_TRUE(atmosphericDrag.isDefined());
+        EXPECT_TRUE(atmosphericDrag.hasDensityCache());
+        EXPECT_EQ(densityCacheSPtr, atmosphericDrag.getDensityCache());
+        EXPECT_EQ(earthSPtr_, atmosphericDrag.getCelestial());
+    }
+
+    {
+        const AtmosphericDrag atmosphericDrag = {earthSPtr_};
+        const AtmosphericDrag cachedAtmosphericDrag = {densityCacheSPtr};
+
+        const VectorXd contribution =
+            atmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF());
+        const VectorXd cachedContribution =
+            cachedAtmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF());
+
+        EXPECT_EQ(3, cachedContribution.size());
+        EXPECT_TRUE(((cachedContribution - contribution).norm() / contribution.norm()) < 1e-2);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContributionJacobian)
+{
+    AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    const MatrixXd jacobian =
+        atmosphericDrag.computeContributionJacobian(startInstant_, startStateVector_, Frame::GCRF());
+
+    // Central differences, from the base dynamics
+    const MatrixXd expectedJacobian =
+        atmosphericDrag.Dynamics::computeContributionJacobian(startInstant_, startStateVector_, Frame::GCRF());
+
+    EXPECT_EQ(3, jacobian.rows());
+    EXPECT_EQ(9, jacobian.cols());
+    EXPECT_LT((jacobian - expectedJacobian).norm(), 1e-4 * expectedJacobian.norm());
+
+    // The drag acceleration is proportional to the surface area and the drag coefficient, and inversely proportional
+    // to the mass
+    const VectorXd contribution = atmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF());
+
+    EXPECT_TRUE(jacobian.col(6).isApprox(-contribution / startStateVector_[6], 1e-12));
+    EXPECT_TRUE(jacobian.col(7).isApprox(contribution / startStateVector_[7], 1e-12));
+    EXPECT_TRUE(jacobian.col(8).isApprox(contribution / startStateVector_[8], 1e-12));
+}
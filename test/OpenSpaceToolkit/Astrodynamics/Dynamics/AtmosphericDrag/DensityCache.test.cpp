@@ -0,0 +1,212 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Exponential.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemerides/Analytical.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag/DensityCache.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+
+using ostk::math::object::Vector3d;
+
+using ostk::physics::Unit;
+using ostk::physics::coord::Frame;
+using ostk::physics::coord::Position;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::environment::ephemerides::Analytical;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Length;
+using ostk::physics::units::Mass;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthMagneticModel = ostk::physics::environment::magnetic::Earth;
+using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
+
+using ostk::astro::dynamics::atmosphericdrag::DensityCache;
+
+class OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        earthSPtr_ = std::make_shared<Celestial>(earth_);
+    }
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0));
+
+    const Earth earth_ = {
+        EarthGravitationalModel::Spherical.gravitationalParameter_,
+        EarthGravitationalModel::Spherical.equatorialRadius_,
+        EarthGravitationalModel::Spherical.flattening_,
+        EarthGravitationalModel::Spherical.J2_,
+        EarthGravitationalModel::Spherical.J4_,
+        std::make_shared<Analytical>(Frame::ITRF()),
+        std::make_shared<EarthGravitationalModel>(EarthGravitationalModel::Type::Undefined),
+        std::make_shared<EarthMagneticModel>(EarthMagneticModel::Type::Undefined),
+        std::make_shared<EarthAtmosphericModel>(EarthAtmosphericModel::Type::Exponential),
+    };
+
+    Shared<Celestial> earthSPtr_ = nullptr;
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache, Constructor)
+{
+    {
+        EXPECT_NO_THROW(DensityCache densityCache(earthSPtr_, interval_));
+    }
+
+    {
+        EXPECT_NO_THROW(DensityCache densityCache(
+            earthSPtr_,
+            interval_,
+            Length::Kilometers(2.0),
+            Angle::Degrees(2.0),
+            Duration::Minutes(30.0),
+            Duration::Minutes(10.0),
+            1.0e-3
+        ));
+    }
+
+    {
+        EXPECT_THROW(DensityCache(nullptr, interval_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(DensityCache(earthSPtr_, Interval::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            DensityCache(earthSPtr_, interval_, Length::Kilometers(0.0)), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            DensityCache(earthSPtr_, interval_, Length::Kilometers(5.0), Angle::Degrees(-1.0)),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            DensityCache(earthSPtr_, interval_, Length::Kilometers(5.0), Angle::Degrees(5.0), Duration::Hours(5.0)),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            DensityCache(earthSPtr_, interval_, Length::Kilometers(5.0), Angle::Degrees(5.0), Duration::Seconds(20.0)),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            DensityCache(
+                earthSPtr_,
+                interval_,
+                Length::Kilometers(5.0),
+                Angle::Degrees(5.0),
+                Duration::Hours(1.0),
+                Duration::Zero()
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            DensityCache(
+                earthSPtr_,
+                interval_,
+                Length::Kilometers(5.0),
+                Angle::Degrees(5.0),
+                Duration::Hours(1.0),
+                Duration::Hours(1.0),
+                0.0
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache, StreamOperator)
+{
+    const DensityCache densityCache = {earthSPtr_, interval_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(std::cout << densityCache << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache, Getters)
+{
+    const DensityCache densityCache = {earthSPtr_, interval_};
+
+    EXPECT_TRUE(densityCache.isDefined());
+    EXPECT_EQ(earthSPtr_, densityCache.getCelestial());
+    EXPECT_EQ(interval_, densityCache.getInterval());
+    EXPECT_EQ(1.0e-2, densityCache.getRelativeTolerance());
+    EXPECT_EQ(0, densityCache.getNodeCount());
+    EXPECT_EQ(0, densityCache.getInterpolatedQueryCount());
+    EXPECT_EQ(0, densityCache.getDirectQueryCount());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag_DensityCache, GetDensityAt)
+{
+    DensityCache densityCache = {earthSPtr_, interval_};
+
+    const Unit massDensitySIUnit = Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+    const Vector3d positionCoordinates = {6855137.0, 10000.0, 250000.0};
+
+    {
+        for (const Duration& offset : {Duration::Minutes(10.0), Duration::Hours(5.5), Duration::Hours(23.0)})
+        {
+            const Instant instant = startInstant_ + offset;
+
+            const Real referenceDensity =
+                earthSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, Frame::ITRF()), instant)
+                    .inUnit(massDensitySIUnit)
+                    .getValue();
+
+            const Real density = densityCache.getDensityAt(positionCoordinates, instant);
+
+            EXPECT_NEAR(referenceDensity, density, 1.0e-2 * referenceDensity);
+        }
+
+        EXPECT_EQ(3, densityCache.getInterpolatedQueryCount());
+        EXPECT_EQ(0, densityCache.getDirectQueryCount());
+        EXPECT_LT(0, densityCache.getNodeCount());
+    }
+
+    {
+        const Instant instant = startInstant_ - Duration::Hours(1.0);
+
+        const Real referenceDensity =
+            earthSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, Frame::ITRF()), instant)
+                .inUnit(massDensitySIUnit)
+                .getValue();
+
+        EXPECT_EQ(referenceDensity, densityCache.getDensityAt(positionCoordinates, instant));
+        EXPECT_EQ(1, densityCache.getDirectQueryCount());
+    }
+
+    {
+        densityCache.clear();
+
+        EXPECT_EQ(0, densityCache.getNodeCount());
+        EXPECT_EQ(0, densityCache.getInterpolatedQueryCount());
+        EXPECT_EQ(0, densityCache.getDirectQueryCount());
+    }
+}
@@ -33,6 +33,7 @@ using ostk::core::types::Shared;
 using ostk::core::types::Size;
 using ostk::core::types::String;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 
 using ostk::physics::environment::object::Celestial;
@@ -225,3 +226,36 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContri
     EXPECT_GT(1e-15, 0.0 - contribution[1]);
     EXPECT_GT(1e-15, 0.0 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContributionJacobian)
+{
+    const VectorXd positionCoordinates = (VectorXd(3) << 7000000.0, 1000000.0, -500000.0).finished();
+
+    {
+        CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+        const MatrixXd jacobian =
+            centralBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        // Central differences, from the base dynamics
+        const MatrixXd expectedJacobian =
+            centralBodyGravity.Dynamics::computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        EXPECT_EQ(3, jacobian.rows());
+        EXPECT_EQ(3, jacobian.cols());
+        EXPECT_LT((jacobian - expectedJacobian).norm(), 1e-8 * expectedJacobian.norm());
+        EXPECT_LT((jacobian - jacobian.transpose()).norm(), 1e-12 * jacobian.norm());
+    }
+
+    {
+        CentralBodyGravity centralBodyGravity(std::make_shared<Celestial>(Earth::EGM2008(20, 20)));
+
+        const MatrixXd jacobian =
+            centralBodyGravity.computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        const MatrixXd expectedJacobian =
+            centralBodyGravity.Dynamics::computeContributionJacobian(startInstant_, positionCoordinates, Frame::GCRF());
+
+        EXPECT_LT((jacobian - expectedJacobian).norm(), 1e-6 * expectedJacobian.norm());
+    }
+}
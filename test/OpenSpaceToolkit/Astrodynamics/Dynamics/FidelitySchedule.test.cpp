@@ -0,0 +1,338 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/FidelitySchedule.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::Vector3d;
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::units::Length;
+
+using ostk::astro::Dynamics;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::FidelitySchedule;
+using ostk::astro::dynamics::PositionDerivative;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+class OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->centralBodyGravitySPtr_ = std::make_shared<CentralBodyGravity>(sphericalEarthSPtr_);
+
+        this->fidelitySchedule_ = std::make_shared<FidelitySchedule>(
+            sphericalEarthSPtr_,
+            FidelitySchedule::Criterion::Altitude,
+            Array<Length>({Length::Kilometers(1000.0), Length::Kilometers(2000.0)}),
+            Array<Array<Shared<Dynamics>>>({
+                {positionDerivativeSPtr_, centralBodyGravitySPtr_},
+                {positionDerivativeSPtr_},
+                {},
+            }),
+            Length::Kilometers(10.0)
+        );
+    }
+
+    const Instant instant_ = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC);
+    const Shared<const Frame> gcrfSPtr_ = Frame::GCRF();
+
+    const Shared<Celestial> sphericalEarthSPtr_ = std::make_shared<Celestial>(Earth::Spherical());
+    const Shared<Dynamics> positionDerivativeSPtr_ = std::make_shared<PositionDerivative>();
+    Shared<Dynamics> centralBodyGravitySPtr_ = nullptr;
+
+    Shared<FidelitySchedule> fidelitySchedule_ = nullptr;
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, Constructor)
+{
+    {
+        EXPECT_NO_THROW(FidelitySchedule(
+            sphericalEarthSPtr_, FidelitySchedule::Criterion::Distance, {}, {{centralBodyGravitySPtr_}}
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                nullptr,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(1000.0)},
+                {{centralBodyGravitySPtr_}, {}}
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                sphericalEarthSPtr_,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(1000.0)},
+                {{centralBodyGravitySPtr_}}
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                sphericalEarthSPtr_,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(2000.0), Length::Kilometers(1000.0)},
+                {{centralBodyGravitySPtr_}, {}, {}}
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                sphericalEarthSPtr_,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(1000.0), Length::Kilometers(2000.0)},
+                {{centralBodyGravitySPtr_}, {}, {}},
+                Length::Kilometers(500.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                sphericalEarthSPtr_,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(1000.0)},
+                {{centralBodyGravitySPtr_}, {}},
+                Length::Kilometers(-1.0)
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            FidelitySchedule(
+                sphericalEarthSPtr_,
+                FidelitySchedule::Criterion::Altitude,
+                {Length::Kilometers(1000.0)},
+                {{centralBodyGravitySPtr_}, {nullptr}}
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, IsDefined)
+{
+    EXPECT_TRUE(fidelitySchedule_->isDefined());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, StreamOperator)
+{
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(std::cout << *fidelitySchedule_ << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, Print)
+{
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(fidelitySchedule_->print(std::cout, true));
+    EXPECT_NO_THROW(fidelitySchedule_->print(std::cout, false));
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, Getters)
+{
+    EXPECT_EQ(fidelitySchedule_->getName(), "Fidelity Schedule");
+    EXPECT_EQ(fidelitySchedule_->getCelestial(), sphericalEarthSPtr_);
+    EXPECT_EQ(fidelitySchedule_->getCriterion(), FidelitySchedule::Criterion::Altitude);
+    EXPECT_DOUBLE_EQ(fidelitySchedule_->getHysteresis().inMeters(), 1.0e4);
+    EXPECT_EQ(fidelitySchedule_->getRegimeCount(), 3);
+
+    const Array<Length> thresholds = fidelitySchedule_->getThresholds();
+
+    ASSERT_EQ(thresholds.getSize(), 2);
+    EXPECT_DOUBLE_EQ(thresholds[0].inMeters(), 1.0e6);
+    EXPECT_DOUBLE_EQ(thresholds[1].inMeters(), 2.0e6);
+
+    EXPECT_EQ(fidelitySchedule_->getRegimeDynamics(0).getSize(), 2);
+    EXPECT_EQ(fidelitySchedule_->getRegimeDynamics(1).getSize(), 1);
+    EXPECT_TRUE(fidelitySchedule_->getRegimeDynamics(2).isEmpty());
+    EXPECT_THROW(fidelitySchedule_->getRegimeDynamics(3), ostk::core::error::runtime::Wrong);
+
+    for (Size i = 0; i < fidelitySchedule_->getRegimeCount(); ++i)
+    {
+        const Shared<Dynamics>& regimeSPtr = fidelitySchedule_->accessRegime(i);
+
+        EXPECT_EQ(regimeSPtr->getName(), fidelitySchedule_->getName());
+        EXPECT_EQ(regimeSPtr->getReadCoordinatesSubsets(), fidelitySchedule_->getReadCoordinatesSubsets());
+        EXPECT_EQ(regimeSPtr->getWriteCoordinatesSubsets(), fidelitySchedule_->getWriteCoordinatesSubsets());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, GetCoordinatesSubsets)
+{
+    const Array<Shared<const CoordinatesSubset>> readSubsets = fidelitySchedule_->getReadCoordinatesSubsets();
+
+    ASSERT_EQ(readSubsets.getSize(), 2);
+    EXPECT_TRUE(*readSubsets[0] == *CartesianPosition::Default());
+    EXPECT_TRUE(*readSubsets[1] == *CartesianVelocity::Default());
+
+    const Array<Shared<const CoordinatesSubset>> writeSubsets = fidelitySchedule_->getWriteCoordinatesSubsets();
+
+    ASSERT_EQ(writeSubsets.getSize(), 2);
+    EXPECT_TRUE(*writeSubsets[0] == *CartesianPosition::Default());
+    EXPECT_TRUE(*writeSubsets[1] == *CartesianVelocity::Default());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, CalculateCriterionValue)
+{
+    const Vector3d positionCoordinates = {7000000.0, 0.0, 0.0};
+    const Real equatorialRadius = sphericalEarthSPtr_->getEquatorialRadius().inMeters();
+
+    EXPECT_NEAR(
+        fidelitySchedule_->calculateCriterionValue(instant_, positionCoordinates, gcrfSPtr_),
+        7000000.0 - equatorialRadius,
+        1e-6
+    );
+
+    const FidelitySchedule distanceSchedule = {
+        sphericalEarthSPtr_, FidelitySchedule::Criterion::Distance, {}, {{centralBodyGravitySPtr_}}
+    };
+
+    EXPECT_NEAR(distanceSchedule.calculateCriterionValue(instant_, positionCoordinates, gcrfSPtr_), 7000000.0, 1e-6);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, CalculateRegimeIndex)
+{
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(-1.0e3), 0);
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(999.0e3), 0);
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(1000.0e3), 1);
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(1999.0e3), 1);
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(2000.0e3), 2);
+    EXPECT_EQ(fidelitySchedule_->calculateRegimeIndex(36000.0e3), 2);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, IsInRegime)
+{
+    // Regime ranges are widened by the hysteresis on both sides
+
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(-1.0e3, 0));
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(1005.0e3, 0));
+    EXPECT_FALSE(fidelitySchedule_->isInRegime(1010.0e3, 0));
+
+    EXPECT_FALSE(fidelitySchedule_->isInRegime(989.0e3, 1));
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(995.0e3, 1));
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(2005.0e3, 1));
+    EXPECT_FALSE(fidelitySchedule_->isInRegime(2010.0e3, 1));
+
+    EXPECT_FALSE(fidelitySchedule_->isInRegime(1989.0e3, 2));
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(1995.0e3, 2));
+    EXPECT_TRUE(fidelitySchedule_->isInRegime(36000.0e3, 2));
+
+    EXPECT_THROW(fidelitySchedule_->isInRegime(0.0, 3), ostk::core::error::runtime::Wrong);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, ComputeContribution)
+{
+    const Real equatorialRadius = sphericalEarthSPtr_->getEquatorialRadius().inMeters();
+
+    // Position and velocity, following the read coordinates subsets
+
+    const auto createStateVector = [](const double& aRadius) -> VectorXd
+    {
+        VectorXd x(6);
+        x << aRadius, 0.0, 0.0, 0.0, 7000.0, 0.0;
+
+        return x;
+    };
+
+    // Low altitude: position derivative and central body gravity
+
+    {
+        const VectorXd x = createStateVector(equatorialRadius + 500.0e3);
+
+        const VectorXd contribution = fidelitySchedule_->computeContribution(instant_, x, gcrfSPtr_);
+
+        VectorXd gravityStateVector(3);
+        gravityStateVector << x[0], x[1], x[2];
+
+        const VectorXd gravityContribution =
+            centralBodyGravitySPtr_->computeContribution(instant_, gravityStateVector, gcrfSPtr_);
+
+        ASSERT_EQ(contribution.size(), 6);
+        EXPECT_TRUE(contribution.segment(0, 3) == x.segment(3, 3));
+        EXPECT_TRUE(contribution.segment(3, 3) == gravityContribution);
+    }
+
+    // Intermediate altitude: position derivative only
+
+    {
+        const VectorXd x = createStateVector(equatorialRadius + 1500.0e3);
+
+        const VectorXd contribution = fidelitySchedule_->computeContribution(instant_, x, gcrfSPtr_);
+
+        ASSERT_EQ(contribution.size(), 6);
+        EXPECT_TRUE(contribution.segment(0, 3) == x.segment(3, 3));
+        EXPECT_TRUE(contribution.segment(3, 3) == VectorXd::Zero(3));
+    }
+
+    // High altitude: no contribution
+
+    {
+        const VectorXd x = createStateVector(equatorialRadius + 5000.0e3);
+
+        EXPECT_TRUE(fidelitySchedule_->computeContribution(instant_, x, gcrfSPtr_) == VectorXd::Zero(6));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_FidelitySchedule, StringFromCriterion)
+{
+    EXPECT_EQ(FidelitySchedule::StringFromCriterion(FidelitySchedule::Criterion::Altitude), "Altitude");
+    EXPECT_EQ(FidelitySchedule::StringFromCriterion(FidelitySchedule::Criterion::Distance), "Distance");
+}
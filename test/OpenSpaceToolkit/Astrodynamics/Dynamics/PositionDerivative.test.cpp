@@ -18,6 +18,7 @@
 using ostk::core::ctnr::Array;
 using ostk::core::types::Shared;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 
 using ostk::physics::coord::Frame;
@@ -108,3 +109,14 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_PositionDerivative, ComputeContri
     EXPECT_EQ(startStateVector_[4], contribution[1]);
     EXPECT_EQ(startStateVector_[5], contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_PositionDerivative, ComputeContributionJacobian)
+{
+    const MatrixXd jacobian = positionDerivative_.computeContributionJacobian(
+        startInstant_, startStateVector_.segment(3, 3), Frame::Undefined()
+    );
+
+    EXPECT_EQ(3, jacobian.rows());
+    EXPECT_EQ(3, jacobian.cols());
+    EXPECT_TRUE(jacobian.isIdentity());
+}
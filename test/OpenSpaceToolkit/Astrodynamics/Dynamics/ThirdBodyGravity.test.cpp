@@ -14,7 +14,9 @@
 #include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Moon.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -43,7 +45,9 @@ using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::environment::ephemerides::Analytical;
 using ostk::physics::coord::Frame;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::units::Length;
 using ostk::physics::units::Derived;
@@ -235,3 +239,74 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContribu
     EXPECT_GT(1e-15, 2.948717888154649e-07 - contribution[1]);
     EXPECT_GT(1e-15, 1.301648617451192e-07 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, PrecomputeEphemeris)
+{
+    {
+        ThirdBodyGravity thirdBodyGravity(sphericalMoonSPtr_);
+
+        EXPECT_FALSE(thirdBodyGravity.hasPrecomputedEphemeris());
+        EXPECT_FALSE(thirdBodyGravity.getPrecomputedEphemerisInterval().isDefined());
+
+        const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Days(3.0));
+
+        thirdBodyGravity.precomputeEphemeris(interval);
+
+        EXPECT_TRUE(thirdBodyGravity.hasPrecomputedEphemeris());
+        EXPECT_EQ(interval, thirdBodyGravity.getPrecomputedEphemerisInterval());
+
+        for (const Duration& offset : Array<Duration> {
+                 Duration::Zero(),
+                 Duration::Minutes(17.0),
+                 Duration::Hours(11.5),
+                 Duration::Days(1.0),
+                 Duration::Hours(61.3),
+                 Duration::Days(3.0),
+             })
+        {
+            const Instant instant = startInstant_ + offset;
+
+            const VectorXd referenceContribution =
+                defaultThirdBodyGravity_.computeContribution(instant, startStateVector_, Frame::GCRF());
+            const VectorXd contribution =
+                thirdBodyGravity.computeContribution(instant, startStateVector_, Frame::GCRF());
+
+            EXPECT_EQ(3, contribution.size());
+            EXPECT_GT(1e-8, (contribution - referenceContribution).norm() / referenceContribution.norm());
+        }
+
+        // Outside of the precomputed interval, fall back to the celestial gravitational model
+        {
+            const Instant instant = startInstant_ + Duration::Days(4.0);
+
+            EXPECT_EQ(
+                defaultThirdBodyGravity_.computeContribution(instant, startStateVector_, Frame::GCRF()),
+                thirdBodyGravity.computeContribution(instant, startStateVector_, Frame::GCRF())
+            );
+        }
+
+        thirdBodyGravity.clearPrecomputedEphemeris();
+
+        EXPECT_FALSE(thirdBodyGravity.hasPrecomputedEphemeris());
+    }
+
+    {
+        ThirdBodyGravity thirdBodyGravity(sphericalMoonSPtr_);
+
+        EXPECT_THROW(
+            thirdBodyGravity.precomputeEphemeris(Interval::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            thirdBodyGravity.precomputeEphemeris(
+                Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0)), Duration::Zero()
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            thirdBodyGravity.precomputeEphemeris(
+                Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0)), Duration::Days(1.0), 1
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
@@ -1,36 +1,53 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <cmath>
+
 #include <gmock/gmock.h>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 using ostk::core::types::Shared;
 using ostk::core::types::String;
 using ostk::core::types::Real;
 using ostk::core::types::Index;
+using ostk::core::types::Size;
 using ostk::core::ctnr::Array;
 
+using ostk::math::object::MatrixXd;
 using ostk::math::object::VectorXd;
 using ostk::math::object::Vector3d;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::coord::Frame;
 
 using ostk::astro::flight::system::SatelliteSystem;
 using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::Dynamics;
 using ostk::astro::GuidanceLaw;
+using ostk::astro::dynamics::PositionDerivative;
 using ostk::astro::dynamics::Thruster;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+using ostk::astro::trajectory::state::NumericalSolver;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
 
@@ -54,6 +71,55 @@ class MockGuidanceLaw : public GuidanceLaw
     }
 };
 
+// Thrust along a direction rotating with time, counting its evaluations
+class RotatingGuidanceLaw : public GuidanceLaw
+{
+   public:
+    RotatingGuidanceLaw()
+        : GuidanceLaw("rotating guidance law"),
+          evaluationCount(0)
+    {
+    }
+
+    Vector3d calculateThrustAccelerationAt(
+        const Instant& anInstant,
+        [[maybe_unused]] const Vector3d& aPositionCoordinates,
+        [[maybe_unused]] const Vector3d& aVelocityCoordinates,
+        const Real& aThrustAcceleration,
+        [[maybe_unused]] const Shared<const Frame>& outputFrameSPtr
+    ) const override
+    {
+        ++evaluationCount;
+
+        const double angle = (anInstant - Instant::J2000()).inSeconds() * 0.01;
+
+        return aThrustAcceleration * Vector3d(std::cos(angle), std::sin(angle), 0.0);
+    }
+
+    mutable std::atomic<Size> evaluationCount;
+};
+
+// Thrust along the velocity
+class ProgradeGuidanceLaw : public GuidanceLaw
+{
+   public:
+    ProgradeGuidanceLaw()
+        : GuidanceLaw("prograde guidance law")
+    {
+    }
+
+    Vector3d calculateThrustAccelerationAt(
+        [[maybe_unused]] const Instant& anInstant,
+        [[maybe_unused]] const Vector3d& aPositionCoordinates,
+        const Vector3d& aVelocityCoordinates,
+        const Real& aThrustAcceleration,
+        [[maybe_unused]] const Shared<const Frame>& outputFrameSPtr
+    ) const override
+    {
+        return aThrustAcceleration * aVelocityCoordinates.normalized();
+    }
+};
+
 class OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster : public ::testing::Test
 {
    protected:
@@ -163,4 +229,238 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, ComputeContribution)
     }
 }
 
-// Add more tests based on public methods of Thruster class
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, GuidanceUpdatePolicy)
+{
+    {
+        const Thruster::GuidanceUpdatePolicy policy = Thruster::GuidanceUpdatePolicy::Continuous();
+
+        EXPECT_EQ(Thruster::GuidanceUpdatePolicy::Type::Continuous, policy.getType());
+        EXPECT_FALSE(policy.getInterval().isDefined());
+        EXPECT_EQ(policy, defaultThruster_.getGuidanceUpdatePolicy());
+    }
+
+    {
+        const Thruster::GuidanceUpdatePolicy policy =
+            Thruster::GuidanceUpdatePolicy::FixedCadence(Duration::Seconds(10.0));
+
+        EXPECT_EQ(Thruster::GuidanceUpdatePolicy::Type::FixedCadence, policy.getType());
+        EXPECT_EQ(Duration::Seconds(10.0), policy.getInterval());
+        EXPECT_FALSE(policy == Thruster::GuidanceUpdatePolicy::FixedCadence(Duration::Seconds(20.0)));
+        EXPECT_FALSE(policy == Thruster::GuidanceUpdatePolicy::Continuous());
+    }
+
+    {
+        const Thruster::GuidanceUpdatePolicy policy = Thruster::GuidanceUpdatePolicy::StepStart();
+
+        EXPECT_EQ(Thruster::GuidanceUpdatePolicy::Type::StepStart, policy.getType());
+        EXPECT_FALSE(policy.getInterval().isDefined());
+        EXPECT_FALSE(policy == Thruster::GuidanceUpdatePolicy::Continuous());
+    }
+
+    {
+        EXPECT_THROW(
+            Thruster::GuidanceUpdatePolicy::FixedCadence(Duration::Zero()), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Thruster::GuidanceUpdatePolicy::FixedCadence(Duration::Undefined()), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        EXPECT_EQ(
+            "Continuous",
+            Thruster::GuidanceUpdatePolicy::StringFromType(Thruster::GuidanceUpdatePolicy::Type::Continuous)
+        );
+        EXPECT_EQ(
+            "StepStart",
+            Thruster::GuidanceUpdatePolicy::StringFromType(Thruster::GuidanceUpdatePolicy::Type::StepStart)
+        );
+        EXPECT_EQ(
+            "FixedCadence",
+            Thruster::GuidanceUpdatePolicy::StringFromType(Thruster::GuidanceUpdatePolicy::Type::FixedCadence)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, ComputeContribution_FixedCadence)
+{
+    const Shared<const RotatingGuidanceLaw> guidanceLawSPtr = std::make_shared<RotatingGuidanceLaw>();
+    const Shared<Thruster> thrusterSPtr = std::make_shared<Thruster>(
+        defaultSatelliteSystem_,
+        guidanceLawSPtr,
+        defaultName_,
+        Thruster::GuidanceUpdatePolicy::FixedCadence(Duration::Seconds(10.0))
+    );
+
+    const Array<Dynamics::Context> contexts = {
+        {thrusterSPtr, {{0, 3}, {3, 3}, {6, 1}}, {{3, 3}, {6, 1}}},
+    };
+
+    NumericalSolver::StateVector x(7);
+    x << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 200.0;
+
+    NumericalSolver::StateVector dxdt(7);
+
+    const auto thrustDirectionAt = [&](const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                       const double& aTime) -> Vector3d
+    {
+        aSystemOfEquations(x, dxdt, aTime);
+        return dxdt.segment(3, 3).normalized();
+    };
+
+    NumericalSolver::StepObserver stepObserver = nullptr;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        Dynamics::GetSystemOfEquations(contexts, Instant::J2000(), Frame::GCRF(), nullptr, &stepObserver);
+
+    ASSERT_TRUE(stepObserver != nullptr);
+
+    {
+        // Latched at the start of the integration
+
+        EXPECT_TRUE(stepObserver(x, 0.0, true));
+        EXPECT_EQ(1, guidanceLawSPtr->evaluationCount.load());
+
+        const Vector3d initialDirection = thrustDirectionAt(systemOfEquations, 0.0);
+
+        // Held at the intermediate stages and rejected steps, even beyond the window
+
+        for (const double time : {1.0, 5.0, 12.0, 30.0})
+        {
+            EXPECT_TRUE(thrustDirectionAt(systemOfEquations, time).isApprox(initialDirection, 1e-12));
+        }
+
+        EXPECT_EQ(1, guidanceLawSPtr->evaluationCount.load());
+
+        // Held at the accepted steps within the window
+
+        EXPECT_FALSE(stepObserver(x, 9.9, false));
+        EXPECT_EQ(1, guidanceLawSPtr->evaluationCount.load());
+
+        // Updated at the first accepted step of the next window
+
+        EXPECT_TRUE(stepObserver(x, 12.0, false));
+        EXPECT_EQ(2, guidanceLawSPtr->evaluationCount.load());
+
+        EXPECT_FALSE(thrustDirectionAt(systemOfEquations, 12.0).isApprox(initialDirection, 1e-6));
+
+        EXPECT_FALSE(stepObserver(x, 15.0, false));
+        EXPECT_EQ(2, guidanceLawSPtr->evaluationCount.load());
+    }
+
+    {
+        // Each system of equations holds its own thrust
+
+        NumericalSolver::StepObserver otherStepObserver = nullptr;
+
+        const NumericalSolver::SystemOfEquationsWrapper otherSystemOfEquations =
+            Dynamics::GetSystemOfEquations(contexts, Instant::J2000(), Frame::GCRF(), nullptr, &otherStepObserver);
+
+        const Vector3d direction = thrustDirectionAt(systemOfEquations, 15.0);
+
+        EXPECT_TRUE(otherStepObserver(x, 50.0, true));
+        EXPECT_EQ(3, guidanceLawSPtr->evaluationCount.load());
+
+        EXPECT_FALSE(thrustDirectionAt(otherSystemOfEquations, 50.0).isApprox(direction, 1e-6));
+        EXPECT_TRUE(thrustDirectionAt(systemOfEquations, 50.0).isApprox(direction, 1e-12));
+        EXPECT_EQ(3, guidanceLawSPtr->evaluationCount.load());
+    }
+
+    {
+        // Not held without a step observer, nor outside of an integration
+
+        const NumericalSolver::SystemOfEquationsWrapper unobservedSystemOfEquations =
+            Dynamics::GetSystemOfEquations(contexts, Instant::J2000(), Frame::GCRF());
+
+        thrustDirectionAt(unobservedSystemOfEquations, 1.0);
+        thrustDirectionAt(unobservedSystemOfEquations, 2.0);
+        EXPECT_EQ(5, guidanceLawSPtr->evaluationCount.load());
+
+        thrusterSPtr->computeContribution(Instant::J2000(), x, Frame::GCRF());
+        thrusterSPtr->computeContribution(Instant::J2000(), x, Frame::GCRF());
+        EXPECT_EQ(7, guidanceLawSPtr->evaluationCount.load());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, ComputeContribution_StepStart)
+{
+    const Shared<const RotatingGuidanceLaw> guidanceLawSPtr = std::make_shared<RotatingGuidanceLaw>();
+    const Shared<Thruster> thrusterSPtr = std::make_shared<Thruster>(
+        defaultSatelliteSystem_, guidanceLawSPtr, defaultName_, Thruster::GuidanceUpdatePolicy::StepStart()
+    );
+
+    const Array<Dynamics::Context> contexts = {
+        {std::make_shared<PositionDerivative>(), {{3, 3}}, {{0, 3}}},
+        {thrusterSPtr, {{0, 3}, {3, 3}, {6, 1}}, {{3, 3}, {6, 1}}},
+    };
+
+    NumericalSolver::StateVector x(7);
+    x << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 200.0;
+
+    const State state = {
+        Instant::J2000(),
+        x,
+        Frame::GCRF(),
+        std::make_shared<CoordinatesBroker>(CoordinatesBroker(
+            {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinatesSubset::Mass()}
+        )),
+    };
+
+    for (const NumericalSolver::StepperType& stepperType :
+         {NumericalSolver::StepperType::RungeKuttaDopri5, NumericalSolver::StepperType::RungeKuttaFehlberg78})
+    {
+        guidanceLawSPtr->evaluationCount = 0;
+
+        NumericalSolver numericalSolver = {NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-12, 1.0e-12};
+        numericalSolver.setDiagnosticsEnabled(true);
+
+        NumericalSolver::StepObserver stepObserver = nullptr;
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+            Dynamics::GetSystemOfEquations(contexts, Instant::J2000(), Frame::GCRF(), nullptr, &stepObserver);
+
+        numericalSolver.setStepObserver(stepObserver);
+
+        const State endState =
+            numericalSolver.integrateTime(state, Instant::J2000() + Duration::Minutes(10.0), systemOfEquations);
+
+        EXPECT_EQ(Instant::J2000() + Duration::Minutes(10.0), endState.accessInstant());
+
+        // The guidance law is evaluated at the start of the integration and at each accepted step only
+
+        const NumericalSolver::Diagnostics diagnostics = numericalSolver.getDiagnostics();
+
+        EXPECT_GT(diagnostics.acceptedStepCount, Size(0));
+        EXPECT_EQ(diagnostics.acceptedStepCount + 1, guidanceLawSPtr->evaluationCount.load());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, ComputeContributionJacobian)
+{
+    VectorXd coordinates(7);
+    coordinates << 7000000.0, 0.0, 0.0, 100.0, 7546.05329, 50.0, 105.0;
+
+    {
+        const Thruster thruster = {defaultSatelliteSystem_, std::make_shared<ProgradeGuidanceLaw>()};
+
+        const MatrixXd jacobian = thruster.computeContributionJacobian(Instant::J2000(), coordinates, Frame::GCRF());
+
+        // Central differences, from the base dynamics
+        const MatrixXd expectedJacobian =
+            thruster.Dynamics::computeContributionJacobian(Instant::J2000(), coordinates, Frame::GCRF());
+
+        EXPECT_EQ(4, jacobian.rows());
+        EXPECT_EQ(7, jacobian.cols());
+        EXPECT_LT((jacobian - expectedJacobian).norm(), 1e-6 * expectedJacobian.norm());
+
+        // Full thrust: constant mass flow rate
+        EXPECT_TRUE(jacobian.row(3).isZero(1e-12));
+    }
+
+    {
+        const MatrixXd jacobian =
+            defaultThruster_.computeContributionJacobian(Instant::J2000(), coordinates, Frame::GCRF());
+
+        EXPECT_TRUE(jacobian.isZero());
+    }
+}
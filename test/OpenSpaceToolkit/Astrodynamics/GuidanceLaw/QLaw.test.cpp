@@ -28,6 +28,7 @@ using ostk::core::ctnr::Array;
 using ostk::core::ctnr::Tuple;
 
 using ostk::math::object::Matrix3d;
+using ostk::math::object::MatrixXd;
 using ostk::math::object::Vector3d;
 using ostk::math::object::Vector6d;
 using ostk::math::object::VectorXd;
@@ -186,6 +187,14 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Constr
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, GetParameters)
 {
     EXPECT_NO_THROW(qlaw_.getParameters());
+
+    {
+        const Vector5d convergenceThresholds = qlaw_.getParameters().getConvergenceThresholds();
+
+        EXPECT_EQ(100.0, convergenceThresholds(0));
+        EXPECT_EQ(1e-3, convergenceThresholds(1));
+        EXPECT_EQ(1e-10, convergenceThresholds(2));
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, GetTargetCOE)
@@ -224,6 +233,30 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Comput
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, ComputeOrbitalElementsError)
+{
+    {
+        const Tuple<QLaw, Vector6d, Real> parameters = getQLawFullTargeting(QLaw::GradientStrategy::Analytical);
+        const QLaw qlaw = std::get<0>(parameters);
+        const Vector6d currentCOEVector = std::get<1>(parameters);
+
+        const Vector5d orbitalElementsError = qlaw.computeOrbitalElementsError(currentCOEVector.segment(0, 5));
+
+        const Vector5d expectedOrbitalElementsError = {
+            24505900.0 - 26500.0e3,
+            0.725 - 0.7,
+            currentCOEVector(2) - Angle::Degrees(116.0).inRadians(),
+            M_PI - currentCOEVector(3),
+            currentCOEVector(4) + M_PI / 2.0,
+        };
+
+        for (Size i = 0; i < 5; ++i)
+        {
+            EXPECT_NEAR(orbitalElementsError(i), expectedOrbitalElementsError(i), 1e-9);
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, ComputeQ)
 {
     {
@@ -490,6 +523,40 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Comput
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Compute_dQ_dOE_ConsistentWithQ)
+{
+    const Tuple<QLaw, Vector6d, Real> parameters = getQLawFullTargeting(QLaw::GradientStrategy::Analytical);
+    const QLaw qlaw = std::get<0>(parameters);
+    const Real thrustAcceleration = std::get<2>(parameters);
+
+    const Array<Vector5d> coeVectors = {
+        {24505900.0, 0.725, 0.6, 1.0, 2.0},
+        {30000000.0, 0.3, 1.2, 4.0, 5.0},
+    };
+
+    for (const Vector5d& coeVector : coeVectors)
+    {
+        const Vector5d dQ_dOE = qlaw.compute_dQ_dOE(coeVector, thrustAcceleration);
+
+        for (Size i = 0; i < 5; ++i)
+        {
+            const double step = 1e-6 * std::max(std::abs(coeVector(i)), 1e-2);
+
+            Vector5d forwardCOEVector = coeVector;
+            forwardCOEVector(i) += step;
+            Vector5d backwardCOEVector = coeVector;
+            backwardCOEVector(i) -= step;
+
+            const double expected_dQ_dOE =
+                (qlaw.computeQ(forwardCOEVector, thrustAcceleration) -
+                 qlaw.computeQ(backwardCOEVector, thrustAcceleration)) /
+                (2.0 * step);
+
+            EXPECT_LT(std::abs((dQ_dOE(i) - expected_dQ_dOE) / expected_dQ_dOE), 1e-6);
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, CalculateThrustAccelerationAt)
 {
     // Self-validated from the python code
@@ -583,3 +650,50 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Calcul
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, CalculateThrustAccelerationJacobianAt)
+{
+    const Tuple<QLaw, Vector6d, Real> parameters = getQLawFullTargeting(QLaw::GradientStrategy::Analytical);
+    const QLaw qlaw = std::get<0>(parameters);
+    const Real thrustAcceleration = std::get<2>(parameters);
+
+    const Array<COE> currentCOEs = {
+        {
+            Length::Meters(24505.9e3),
+            0.725,
+            Angle::Radians(0.6),
+            Angle::Radians(1.0),
+            Angle::Radians(2.0),
+            Angle::Radians(0.5),
+        },
+        {
+            Length::Meters(30000.0e3),
+            0.3,
+            Angle::Radians(1.2),
+            Angle::Radians(4.0),
+            Angle::Radians(5.0),
+            Angle::Radians(4.0),
+        },
+    };
+
+    for (const COE& currentCOE : currentCOEs)
+    {
+        const COE::CartesianState cartesianState = currentCOE.getCartesianState(gravitationalParameter_, Frame::GCRF());
+
+        const Vector3d positionCoordinates = cartesianState.first.getCoordinates();
+        const Vector3d velocityCoordinates = cartesianState.second.getCoordinates();
+
+        const MatrixXd jacobian = qlaw.calculateThrustAccelerationJacobianAt(
+            Instant::J2000(), positionCoordinates, velocityCoordinates, thrustAcceleration, Frame::GCRF()
+        );
+
+        // Central differences, from the base guidance law
+        const MatrixXd expectedJacobian = qlaw.GuidanceLaw::calculateThrustAccelerationJacobianAt(
+            Instant::J2000(), positionCoordinates, velocityCoordinates, thrustAcceleration, Frame::GCRF()
+        );
+
+        EXPECT_EQ(3, jacobian.rows());
+        EXPECT_EQ(7, jacobian.cols());
+        EXPECT_LT((jacobian - expectedJacobian).norm(), 1e-6 * expectedJacobian.norm());
+    }
+}
@@ -0,0 +1,444 @@
+/// Apache License 2.0
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/AngularCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/COECondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/DifferentialCorrector.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthCelestial = ostk::physics::environment::object::celestial::Earth;
+
+using ostk::astro::Dynamics;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::PositionDerivative;
+using ostk::astro::eventcondition::AngularCondition;
+using ostk::astro::eventcondition::COECondition;
+using ostk::astro::eventcondition::RealCondition;
+using ostk::astro::solvers::DifferentialCorrector;
+using ostk::astro::trajectory::Segment;
+using ostk::astro::trajectory::Sequence;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+using ControlVariable = DifferentialCorrector::ControlVariable;
+using Constraint = DifferentialCorrector::Constraint;
+
+class OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Shared<const CoordinatesBroker> coordinatesBrokerSPtr = std::make_shared<CoordinatesBroker>(
+            CoordinatesBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+        );
+
+        VectorXd coordinates(6);
+        coordinates << radius_, 0.0, 0.0, 0.0, std::sqrt(gravitationalParameter_SI_ / radius_), 0.0;
+
+        this->state_ = {
+            Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC),
+            coordinates,
+            Frame::GCRF(),
+            coordinatesBrokerSPtr,
+        };
+    }
+
+    /// Coast for the first control [s], or for a fixed duration if there is none
+    DifferentialCorrector::SequenceGenerator coastSequenceGenerator(const Real& aDefaultDuration) const
+    {
+        const Shared<Celestial> earthSPtr = earthSPtr_;
+        const NumericalSolver numericalSolver = numericalSolver_;
+
+        return [earthSPtr, numericalSolver, aDefaultDuration](const VectorXd& aControlVector) -> Sequence
+        {
+            const Real duration = aDefaultDuration.isDefined() ? aDefaultDuration : Real(aControlVector(0));
+
+            const Array<Shared<Dynamics>> dynamics = {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(earthSPtr),
+            };
+
+            return {
+                {Segment::Coast(
+                    "Coast",
+                    std::make_shared<RealCondition>(RealCondition::DurationCondition(
+                        RealCondition::Criterion::PositiveCrossing, Duration::Seconds(duration)
+                    )),
+                    dynamics,
+                    numericalSolver
+                )},
+                numericalSolver,
+                dynamics,
+            };
+        };
+    }
+
+    Shared<const RealCondition> semiMajorAxisCondition(const Length& aSemiMajorAxis) const
+    {
+        return std::make_shared<RealCondition>(COECondition::SemiMajorAxis(
+            RealCondition::Criterion::AnyCrossing, Frame::GCRF(), aSemiMajorAxis, gravitationalParameter_
+        ));
+    }
+
+    Shared<const RealCondition> yPositionCondition(const Real& aYPosition) const
+    {
+        return std::make_shared<RealCondition>(
+            "Y Position",
+            RealCondition::Criterion::AnyCrossing,
+            [](const State& aState) -> Real
+            {
+                return aState.getPosition().getCoordinates()(1);
+            },
+            aYPosition
+        );
+    }
+
+    const Real radius_ = 7000000.0;
+    const Derived gravitationalParameter_ = EarthGravitationalModel::Spherical.gravitationalParameter_;
+    const Real gravitationalParameter_SI_ = gravitationalParameter_.in(
+        Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)
+    );
+
+    const Shared<Celestial> earthSPtr_ = std::make_shared<Celestial>(EarthCelestial::Spherical());
+
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    State state_ = State::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, ControlVariable)
+{
+    {
+        const ControlVariable controlVariable = ControlVariable::Parameter("Duration", 600.0, 1.0, 0.0);
+
+        EXPECT_EQ("Duration", controlVariable.name);
+        EXPECT_EQ(600.0, controlVariable.initialValue);
+        EXPECT_EQ(1.0, controlVariable.perturbation);
+        EXPECT_EQ(0.0, controlVariable.lowerBound);
+        EXPECT_FALSE(controlVariable.upperBound.isDefined());
+        EXPECT_FALSE(controlVariable.isInitialStateCoordinate());
+    }
+
+    {
+        const ControlVariable controlVariable =
+            ControlVariable::InitialStateCoordinate(CartesianVelocity::Default(), 1, 1.0e-3);
+
+        EXPECT_FALSE(controlVariable.initialValue.isDefined());
+        EXPECT_EQ(CartesianVelocity::Default(), controlVariable.coordinatesSubset);
+        EXPECT_EQ(1, controlVariable.coordinateIndex);
+        EXPECT_TRUE(controlVariable.isInitialStateCoordinate());
+    }
+
+    {
+        EXPECT_THROW(
+            ControlVariable::Parameter("Duration", Real::Undefined(), 1.0), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(ControlVariable::Parameter("Duration", 600.0, 0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ControlVariable::Parameter("Duration", 600.0, 1.0, 1.0, 0.0), ostk::core::error::RuntimeError);
+        EXPECT_THROW(
+            ControlVariable::InitialStateCoordinate(nullptr, 0, 1.0), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            ControlVariable::InitialStateCoordinate(CartesianVelocity::Default(), 3, 1.0),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Constraint)
+{
+    {
+        const Constraint constraint = {this->yPositionCondition(1000.0), 1.0};
+
+        EXPECT_EQ(1.0, constraint.tolerance);
+        EXPECT_DOUBLE_EQ(-1000.0, constraint.evaluate(state_, state_));
+    }
+
+    // Relative targets are offset by the evaluation at the initial state
+
+    {
+        const Constraint constraint = {
+            std::make_shared<RealCondition>(RealCondition::DurationCondition(
+                RealCondition::Criterion::PositiveCrossing, Duration::Seconds(60.0)
+            )),
+            1.0,
+        };
+
+        const State finalState = {
+            state_.accessInstant() + Duration::Seconds(50.0),
+            state_.getCoordinates(),
+            state_.accessFrame(),
+            state_.accessCoordinatesBroker(),
+        };
+
+        EXPECT_NEAR(-10.0, constraint.evaluate(state_, finalState), 1.0e-6);
+    }
+
+    // Angular residuals are wrapped
+
+    {
+        const Constraint constraint = {
+            std::make_shared<AngularCondition>(
+                "Angle",
+                AngularCondition::Criterion::AnyCrossing,
+                [](const State&) -> Real
+                {
+                    return 0.1;
+                },
+                Angle::Radians(Real::TwoPi() - 0.1)
+            ),
+            1.0e-3,
+        };
+
+        EXPECT_NEAR(0.2, constraint.evaluate(state_, state_), 1.0e-12);
+    }
+
+    {
+        EXPECT_THROW(Constraint(nullptr, 1.0), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Constraint(this->yPositionCondition(0.0), 0.0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Constructor)
+{
+    {
+        const DifferentialCorrector differentialCorrector = {};
+
+        EXPECT_EQ(DifferentialCorrector::Method::Broyden, differentialCorrector.getMethod());
+        EXPECT_EQ(20, differentialCorrector.getMaximumIterationCount());
+        EXPECT_EQ(0, differentialCorrector.getThreadCount());
+    }
+
+    {
+        EXPECT_THROW(
+            DifferentialCorrector(DifferentialCorrector::Method::Newton, 0), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        EXPECT_EQ("Newton", DifferentialCorrector::StringFromMethod(DifferentialCorrector::Method::Newton));
+        EXPECT_EQ("Broyden", DifferentialCorrector::StringFromMethod(DifferentialCorrector::Method::Broyden));
+    }
+
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << DifferentialCorrector() << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Solve_InitialStateCoordinate)
+{
+    // Target the semi-major axis by changing the initial velocity, which is given by the vis-viva equation
+
+    const Length semiMajorAxis = Length::Kilometers(7100.0);
+
+    const Real expectedVelocity =
+        std::sqrt(gravitationalParameter_SI_ * (2.0 / radius_ - 1.0 / semiMajorAxis.inMeters()));
+
+    for (const DifferentialCorrector::Method& method :
+         {DifferentialCorrector::Method::Newton, DifferentialCorrector::Method::Broyden})
+    {
+        const DifferentialCorrector differentialCorrector = {method, 20, 1};
+
+        const DifferentialCorrector::Solution solution = differentialCorrector.solve(
+            state_,
+            this->coastSequenceGenerator(60.0),
+            {ControlVariable::InitialStateCoordinate(CartesianVelocity::Default(), 1, 1.0e-3)},
+            {{this->semiMajorAxisCondition(semiMajorAxis), 1.0}}
+        );
+
+        EXPECT_TRUE(solution.hasConverged);
+        EXPECT_LT(0, solution.iterationCount);
+        EXPECT_LE(1, solution.jacobianEvaluationCount);
+        EXPECT_NEAR(expectedVelocity, solution.controlVector(0), 1.0e-3);
+        EXPECT_NEAR(expectedVelocity, solution.initialState.getVelocity().getCoordinates()(1), 1.0e-3);
+        EXPECT_GE(1.0, std::abs(solution.residuals(0)));
+        EXPECT_TRUE(solution.sequenceSolution.executionIsComplete);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Solve_Parameters)
+{
+    // Target the semi-major axis and a crossing of the Y position, by changing the initial velocity and the duration
+    // of the coast
+
+    const Length semiMajorAxis = Length::Kilometers(7050.0);
+    const Real yPosition = 2000000.0;
+
+    const Real expectedVelocity =
+        std::sqrt(gravitationalParameter_SI_ * (2.0 / radius_ - 1.0 / semiMajorAxis.inMeters()));
+
+    const Array<ControlVariable> controlVariables = {
+        ControlVariable::Parameter("Coast Duration", 200.0, 1.0e-2, 1.0, 3000.0),
+        ControlVariable::InitialStateCoordinate(CartesianVelocity::Default(), 1, 1.0e-3),
+    };
+
+    const Array<Constraint> constraints = {
+        {this->semiMajorAxisCondition(semiMajorAxis), 1.0},
+        {this->yPositionCondition(yPosition), 1.0},
+    };
+
+    const DifferentialCorrector::Solution solution = DifferentialCorrector(
+        DifferentialCorrector::Method::Broyden, 20, 1
+    ).solve(state_, this->coastSequenceGenerator(Real::Undefined()), controlVariables, constraints);
+
+    EXPECT_TRUE(solution.hasConverged);
+    EXPECT_NEAR(expectedVelocity, solution.controlVector(1), 1.0e-3);
+    EXPECT_NEAR(
+        yPosition,
+        solution.sequenceSolution.segmentSolutions.accessLast().states.accessLast().getPosition().getCoordinates()(1),
+        1.0
+    );
+    EXPECT_NEAR(solution.controlVector(0), solution.sequenceSolution.getPropagationDuration().inSeconds(), 1.0e-6);
+
+    // Perturbed sequences solved concurrently give the same solution
+
+    {
+        const DifferentialCorrector::Solution concurrentSolution = DifferentialCorrector(
+            DifferentialCorrector::Method::Broyden, 20, 4
+        ).solve(state_, this->coastSequenceGenerator(Real::Undefined()), controlVariables, constraints);
+
+        EXPECT_EQ(solution.controlVector, concurrentSolution.controlVector);
+        EXPECT_EQ(solution.iterationCount, concurrentSolution.iterationCount);
+        EXPECT_EQ(solution.sequenceSolveCount, concurrentSolution.sequenceSolveCount);
+    }
+
+    // Broyden updates save Jacobian evaluations over Newton iterations
+
+    {
+        const DifferentialCorrector::Solution newtonSolution = DifferentialCorrector(
+            DifferentialCorrector::Method::Newton, 20, 0
+        ).solve(state_, this->coastSequenceGenerator(Real::Undefined()), controlVariables, constraints);
+
+        EXPECT_TRUE(newtonSolution.hasConverged);
+        EXPECT_EQ(newtonSolution.iterationCount, newtonSolution.jacobianEvaluationCount);
+        EXPECT_LE(solution.jacobianEvaluationCount, newtonSolution.jacobianEvaluationCount);
+    }
+
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << solution << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Solve_Bounds)
+{
+    // The Y position cannot be reached within the upper bound of the coast duration
+
+    const DifferentialCorrector::Solution solution = DifferentialCorrector(DifferentialCorrector::Method::Newton).solve(
+        state_,
+        this->coastSequenceGenerator(Real::Undefined()),
+        {ControlVariable::Parameter("Coast Duration", 100.0, 1.0e-2, 1.0, 150.0)},
+        {{this->yPositionCondition(2000000.0), 1.0}}
+    );
+
+    EXPECT_FALSE(solution.hasConverged);
+    EXPECT_DOUBLE_EQ(150.0, solution.controlVector(0));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_DifferentialCorrector, Solve_Failure)
+{
+    const DifferentialCorrector differentialCorrector = {};
+
+    const DifferentialCorrector::SequenceGenerator sequenceGenerator = this->coastSequenceGenerator(60.0);
+    const Array<ControlVariable> controlVariables = {
+        ControlVariable::InitialStateCoordinate(CartesianVelocity::Default(), 1, 1.0e-3),
+    };
+    const Array<Constraint> constraints = {{this->semiMajorAxisCondition(Length::Kilometers(7100.0)), 1.0}};
+
+    {
+        EXPECT_THROW(
+            differentialCorrector.solve(State::Undefined(), sequenceGenerator, controlVariables, constraints),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            differentialCorrector.solve(state_, nullptr, controlVariables, constraints),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            differentialCorrector.solve(state_, sequenceGenerator, {}, constraints),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            differentialCorrector.solve(state_, sequenceGenerator, controlVariables, {}),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            differentialCorrector.solve(
+                state_,
+                sequenceGenerator,
+                {ControlVariable::InitialStateCoordinate(CoordinatesSubset::Mass(), 0, 1.0)},
+                constraints
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
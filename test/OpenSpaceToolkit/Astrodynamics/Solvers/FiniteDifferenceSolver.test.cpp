@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <complex>
+
 #include <gtest/gtest.h>
 
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
@@ -19,6 +22,8 @@ using ostk::physics::coord::Frame;
 
 using ostk::math::object::VectorXd;
 using ostk::math::object::MatrixXd;
+using Eigen::VectorXcd;
+using Eigen::MatrixXcd;
 
 using ostk::astro::solvers::FiniteDifferenceSolver;
 using ostk::astro::trajectory::State;
@@ -125,6 +130,14 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, Getters)
     {
         EXPECT_EQ(defaultStepDuration_, defaultSolver_.getStepDuration());
     }
+
+    {
+        EXPECT_EQ(1, defaultSolver_.getThreadCount());
+
+        const FiniteDifferenceSolver parallelSolver = {defaultType_, defaultStepPercentage_, defaultStepDuration_, 4};
+
+        EXPECT_EQ(4, parallelSolver.getThreadCount());
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeJacobian)
@@ -215,6 +228,123 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeJac
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeJacobian_Evaluations)
+{
+    const Array<Instant> instants = {
+        Instant::J2000() + Duration::Seconds(100.0),
+        Instant::J2000() + Duration::Seconds(200.0),
+    };
+
+    // One-sided schemes evaluate the unperturbed coordinates once, on any number of threads
+
+    for (const Size threadCount : Array<Size>({1, 2, 0}))
+    {
+        for (const FiniteDifferenceSolver::Type type :
+             {FiniteDifferenceSolver::Type::Forward,
+              FiniteDifferenceSolver::Type::Backward,
+              FiniteDifferenceSolver::Type::Central})
+        {
+            std::atomic<Size> evaluationCount = {0};
+
+            const auto countingGenerateStatesCoordinates =
+                [this, &evaluationCount](const State& aState, const Array<Instant>& anInstantArray) -> MatrixXd
+            {
+                ++evaluationCount;
+                return generateStatesCoordinates(aState, anInstantArray);
+            };
+
+            const FiniteDifferenceSolver solver = {type, defaultStepPercentage_, defaultStepDuration_, threadCount};
+
+            const MatrixXd jacobian =
+                solver.computeJacobian(initialState_, instants, countingGenerateStatesCoordinates, 2);
+
+            const FiniteDifferenceSolver serialSolver = {type, defaultStepPercentage_, defaultStepDuration_};
+
+            EXPECT_EQ(jacobian, serialSolver.computeJacobian(initialState_, instants, generateStatesCoordinates, 2));
+            EXPECT_EQ((type == FiniteDifferenceSolver::Type::Central) ? 4 : 3, evaluationCount.load());
+        }
+    }
+
+    // Errors raised by the generator are propagated
+
+    {
+        const FiniteDifferenceSolver solver = {defaultType_, defaultStepPercentage_, defaultStepDuration_, 2};
+
+        EXPECT_THROW(
+            solver.computeJacobian(
+                initialState_,
+                instants,
+                [](const State&, const Array<Instant>&) -> MatrixXd
+                {
+                    throw ostk::core::error::RuntimeError("Generator failure.");
+                },
+                2
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeComplexStepJacobian)
+{
+    const Array<Instant> instants = {
+        Instant::J2000() + Duration::Seconds(100.0),
+        Instant::J2000() + Duration::Seconds(200.0),
+        Instant::J2000() + Duration::Seconds(300.0),
+    };
+
+    const auto generateComplexStatesCoordinates = [](const VectorXcd& aCoordinates,
+                                                     const Array<Instant>& anInstantArray) -> MatrixXcd
+    {
+        MatrixXcd statesCoordinates(2, anInstantArray.size());
+
+        Size i = 0;
+        for (const Instant& instant : anInstantArray)
+        {
+            const double t = (instant - Instant::J2000()).inSeconds();
+
+            statesCoordinates(0, i) = aCoordinates(0) * std::cos(t) + aCoordinates(1) * std::sin(t);
+            statesCoordinates(1, i) = -aCoordinates(0) * std::sin(t) + aCoordinates(1) * std::cos(t);
+            ++i;
+        }
+
+        return statesCoordinates;
+    };
+
+    MatrixXd expectedJacobian(2 * instants.getSize(), 2);
+
+    expectedJacobian << std::cos(100.0), std::sin(100.0), std::sin(-100.0), std::cos(100.0), std::cos(200.0),
+        std::sin(200.0), std::sin(-200.0), std::cos(200.0), std::cos(300.0), std::sin(300.0), std::sin(-300.0),
+        std::cos(300.0);
+
+    for (const Size threadCount : Array<Size>({1, 2}))
+    {
+        const FiniteDifferenceSolver solver = {defaultType_, defaultStepPercentage_, defaultStepDuration_, threadCount};
+
+        const MatrixXd jacobian =
+            solver.computeComplexStepJacobian(initialState_, instants, generateComplexStatesCoordinates, 2);
+
+        EXPECT_TRUE(jacobian.isApprox(expectedJacobian, 1e-14));
+    }
+
+    // Derivatives of a non-linear function are exact to machine precision
+
+    {
+        const auto generateSquaredCoordinates = [](const VectorXcd& aCoordinates, const Array<Instant>&) -> MatrixXcd
+        {
+            return aCoordinates.array().square().matrix();
+        };
+
+        const MatrixXd jacobian =
+            defaultSolver_.computeComplexStepJacobian(initialState_, {Instant::J2000()}, generateSquaredCoordinates, 2);
+
+        MatrixXd expectedSquaredJacobian(2, 2);
+        expectedSquaredJacobian << 2.0, 0.0, 0.0, 0.0;
+
+        EXPECT_TRUE(jacobian.isApprox(expectedSquaredJacobian, 1e-15));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeGradient)
 {
     VectorXd expectedGradient(2);
@@ -0,0 +1,522 @@
+/// Apache License 2.0
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/MonteCarloSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::math::geometry::d3::objects::Composite;
+using ostk::math::geometry::d3::objects::Cuboid;
+using ostk::math::geometry::d3::objects::Point;
+using ostk::math::object::Matrix3d;
+using ostk::math::object::MatrixXd;
+using ostk::math::object::Vector3d;
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::units::Mass;
+
+using ostk::astro::Dynamics;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::PositionDerivative;
+using ostk::astro::eventcondition::RealCondition;
+using ostk::astro::flight::system::PropulsionSystem;
+using ostk::astro::flight::system::SatelliteSystem;
+using ostk::astro::solvers::MonteCarloSolver;
+using ostk::astro::trajectory::Segment;
+using ostk::astro::trajectory::Sequence;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+using StateDispersion = MonteCarloSolver::StateDispersion;
+using SatelliteSystemDispersion = MonteCarloSolver::SatelliteSystemDispersion;
+
+class OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Shared<const CoordinatesBroker> coordinatesBrokerSPtr = std::make_shared<CoordinatesBroker>(
+            CoordinatesBroker({CartesianPosition::Default(), CartesianVelocity::Default(), CoordinatesSubset::Mass()})
+        );
+
+        VectorXd coordinates(7);
+        coordinates << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 100.0;
+
+        this->state_ = {
+            Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC),
+            coordinates,
+            Frame::GCRF(),
+            coordinatesBrokerSPtr,
+        };
+
+        const Composite satelliteGeometry(Cuboid(
+            {0.0, 0.0, 0.0},
+            {Vector3d {1.0, 0.0, 0.0}, Vector3d {0.0, 1.0, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+            {1.0, 2.0, 3.0}
+        ));
+
+        this->satelliteSystem_ = {
+            Mass::Kilograms(90.0),
+            satelliteGeometry,
+            Matrix3d::Identity(),
+            1.0,
+            2.2,
+            PropulsionSystem(1.0, 1500.0),
+        };
+    }
+
+    MonteCarloSolver::SequenceGenerator coastSequenceGenerator(const Duration& aDuration) const
+    {
+        const Shared<Celestial> earthSPtr = earthSPtr_;
+        const NumericalSolver numericalSolver = numericalSolver_;
+
+        return [earthSPtr, numericalSolver, aDuration](const SatelliteSystem&) -> Sequence
+        {
+            const Array<Shared<Dynamics>> dynamics = {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(earthSPtr),
+            };
+
+            return {
+                {Segment::Coast(
+                    "Coast",
+                    std::make_shared<RealCondition>(
+                        RealCondition::DurationCondition(RealCondition::Criterion::PositiveCrossing, aDuration)
+                    ),
+                    dynamics,
+                    numericalSolver
+                )},
+                numericalSolver,
+                dynamics,
+            };
+        };
+    }
+
+    const Shared<Celestial> earthSPtr_ = std::make_shared<Celestial>(Earth::Spherical());
+
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    State state_ = State::Undefined();
+    SatelliteSystem satelliteSystem_ = SatelliteSystem::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, StateDispersion)
+{
+    {
+        const StateDispersion stateDispersion = StateDispersion::Normal(CartesianPosition::Default(), {1.0, 2.0, 3.0});
+
+        EXPECT_EQ(stateDispersion.coordinatesSubset, CartesianPosition::Default());
+        EXPECT_EQ(stateDispersion.distribution, MonteCarloSolver::Distribution::Normal);
+        EXPECT_EQ(stateDispersion.scaleMatrix, MatrixXd(Vector3d(1.0, 2.0, 3.0).asDiagonal()));
+    }
+
+    {
+        const StateDispersion stateDispersion = StateDispersion::Uniform(CoordinatesSubset::Mass(), VectorXd::Ones(1));
+
+        EXPECT_EQ(stateDispersion.distribution, MonteCarloSolver::Distribution::Uniform);
+        EXPECT_EQ(stateDispersion.scaleMatrix, MatrixXd::Ones(1, 1));
+    }
+
+    {
+        MatrixXd covariance(3, 3);
+        covariance << 4.0, 1.0, 0.0, 1.0, 9.0, 2.0, 0.0, 2.0, 16.0;
+
+        const StateDispersion stateDispersion = StateDispersion::Covariance(CartesianPosition::Default(), covariance);
+
+        EXPECT_TRUE(
+            (stateDispersion.scaleMatrix * stateDispersion.scaleMatrix.transpose()).isApprox(covariance, 1.0e-12)
+        );
+        EXPECT_EQ(0.0, stateDispersion.scaleMatrix(0, 1));
+    }
+
+    {
+        EXPECT_THROW(StateDispersion::Normal(nullptr, {1.0}), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            StateDispersion::Normal(CartesianPosition::Default(), {1.0, 2.0}), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            StateDispersion::Covariance(CartesianPosition::Default(), -MatrixXd::Identity(3, 3)),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, SatelliteSystemDispersion)
+{
+    {
+        const SatelliteSystemDispersion satelliteSystemDispersion =
+            SatelliteSystemDispersion::Normal(SatelliteSystemDispersion::Parameter::Thrust, 0.1);
+
+        EXPECT_EQ(satelliteSystemDispersion.parameter, SatelliteSystemDispersion::Parameter::Thrust);
+        EXPECT_EQ(satelliteSystemDispersion.distribution, MonteCarloSolver::Distribution::Normal);
+        EXPECT_EQ(satelliteSystemDispersion.scale, 0.1);
+    }
+
+    {
+        EXPECT_THROW(
+            SatelliteSystemDispersion::Uniform(SatelliteSystemDispersion::Parameter::DryMass, -1.0),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            SatelliteSystemDispersion::Uniform(SatelliteSystemDispersion::Parameter::DryMass, Real::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_EQ(
+            "Dry Mass", SatelliteSystemDispersion::StringFromParameter(SatelliteSystemDispersion::Parameter::DryMass)
+        );
+        EXPECT_EQ(
+            "Specific Impulse",
+            SatelliteSystemDispersion::StringFromParameter(SatelliteSystemDispersion::Parameter::SpecificImpulse)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, Constructor)
+{
+    const MonteCarloSolver::SequenceGenerator sequenceGenerator = this->coastSequenceGenerator(Duration::Minutes(1.0));
+
+    {
+        EXPECT_NO_THROW(MonteCarloSolver(state_, satelliteSystem_, sequenceGenerator));
+
+        EXPECT_NO_THROW(MonteCarloSolver(
+            state_,
+            SatelliteSystem::Undefined(),
+            sequenceGenerator,
+            {StateDispersion::Normal(CartesianVelocity::Default(), {0.1, 0.1, 0.1})}
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            MonteCarloSolver(State::Undefined(), satelliteSystem_, sequenceGenerator),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(MonteCarloSolver(state_, satelliteSystem_, nullptr), ostk::core::error::runtime::Undefined);
+    }
+
+    // Dispersed subset is not in the nominal state
+
+    {
+        EXPECT_THROW(
+            MonteCarloSolver(
+                state_,
+                satelliteSystem_,
+                sequenceGenerator,
+                {StateDispersion::Normal(CoordinatesSubset::DragCoefficient(), {0.1})}
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Dispersed satellite system is undefined, or has no propulsion system
+
+    {
+        const Array<SatelliteSystemDispersion> satelliteSystemDispersions = {
+            SatelliteSystemDispersion::Normal(SatelliteSystemDispersion::Parameter::Thrust, 0.1),
+        };
+
+        EXPECT_THROW(
+            MonteCarloSolver(state_, SatelliteSystem::Undefined(), sequenceGenerator, {}, satelliteSystemDispersions),
+            ostk::core::error::runtime::Undefined
+        );
+
+        const SatelliteSystem satelliteSystem = {
+            satelliteSystem_.getMass(),
+            satelliteSystem_.getGeometry(),
+            satelliteSystem_.getInertiaTensor(),
+            satelliteSystem_.getCrossSectionalSurfaceArea(),
+            satelliteSystem_.getDragCoefficient(),
+        };
+
+        EXPECT_THROW(
+            MonteCarloSolver(state_, satelliteSystem, sequenceGenerator, {}, satelliteSystemDispersions),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, Getters)
+{
+    const Array<StateDispersion> stateDispersions = {
+        StateDispersion::Normal(CartesianPosition::Default(), {10.0, 10.0, 10.0}),
+    };
+    const Array<SatelliteSystemDispersion> satelliteSystemDispersions = {
+        SatelliteSystemDispersion::Normal(SatelliteSystemDispersion::Parameter::Thrust, 0.1),
+    };
+
+    const MonteCarloSolver monteCarloSolver = {
+        state_,
+        satelliteSystem_,
+        this->coastSequenceGenerator(Duration::Minutes(1.0)),
+        stateDispersions,
+        satelliteSystemDispersions,
+        42,
+    };
+
+    EXPECT_EQ(state_, monteCarloSolver.getNominalState());
+    EXPECT_EQ(satelliteSystem_, monteCarloSolver.getNominalSatelliteSystem());
+    EXPECT_EQ(1, monteCarloSolver.getStateDispersions().getSize());
+    EXPECT_EQ(1, monteCarloSolver.getSatelliteSystemDispersions().getSize());
+    EXPECT_EQ(42, monteCarloSolver.getSeed());
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(std::cout << monteCarloSolver << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, GenerateSample)
+{
+    const Vector3d positionStandardDeviation = {10.0, 20.0, 30.0};
+
+    const MonteCarloSolver monteCarloSolver = {
+        state_,
+        satelliteSystem_,
+        this->coastSequenceGenerator(Duration::Minutes(1.0)),
+        {
+            StateDispersion::Normal(CartesianPosition::Default(), positionStandardDeviation),
+            StateDispersion::Uniform(CoordinatesSubset::Mass(), VectorXd::Constant(1, 5.0)),
+        },
+        {
+            SatelliteSystemDispersion::Normal(SatelliteSystemDispersion::Parameter::Thrust, 0.1),
+        },
+        7,
+    };
+
+    // Samples are reproducible, and independent from each other
+
+    {
+        const MonteCarloSolver::Sample sample = monteCarloSolver.generateSample(3);
+
+        EXPECT_EQ(3, sample.index);
+        EXPECT_EQ(sample.state, monteCarloSolver.generateSample(3).state);
+        EXPECT_EQ(sample.satelliteSystem, monteCarloSolver.generateSample(3).satelliteSystem);
+        EXPECT_NE(sample.state, monteCarloSolver.generateSample(4).state);
+
+        EXPECT_EQ(sample.state.accessInstant(), state_.accessInstant());
+        EXPECT_EQ(sample.state.accessFrame(), state_.accessFrame());
+        EXPECT_EQ(sample.state.getVelocity(), state_.getVelocity());
+
+        EXPECT_NE(
+            sample.satelliteSystem.getPropulsionSystem().getThrust(),
+            satelliteSystem_.getPropulsionSystem().getThrust()
+        );
+        EXPECT_EQ(sample.satelliteSystem.getMass(), satelliteSystem_.getMass());
+    }
+
+    // Samples follow the dispersions
+
+    {
+        const Size sampleCount = 4000;
+
+        VectorXd positionSum = VectorXd::Zero(3);
+        VectorXd positionSquaredSum = VectorXd::Zero(3);
+
+        for (Size i = 0; i < sampleCount; ++i)
+        {
+            const MonteCarloSolver::Sample sample = monteCarloSolver.generateSample(i);
+
+            const VectorXd positionDispersion =
+                sample.state.getPosition().getCoordinates() - state_.getPosition().getCoordinates();
+
+            positionSum += positionDispersion;
+            positionSquaredSum += positionDispersion.cwiseProduct(positionDispersion);
+
+            const Real massDispersion = sample.state.extractCoordinate(CoordinatesSubset::Mass())(0) - 100.0;
+
+            EXPECT_LE(std::abs(massDispersion), 5.0);
+        }
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            const double mean = positionSum(i) / double(sampleCount);
+            const double standardDeviation = std::sqrt(positionSquaredSum(i) / double(sampleCount));
+
+            EXPECT_NEAR(0.0, mean, 4.0 * positionStandardDeviation(i) / std::sqrt(double(sampleCount)));
+            EXPECT_NEAR(positionStandardDeviation(i), standardDeviation, 0.05 * positionStandardDeviation(i));
+        }
+    }
+
+    // Samples depend on the seed
+
+    {
+        const MonteCarloSolver otherMonteCarloSolver = {
+            state_,
+            satelliteSystem_,
+            this->coastSequenceGenerator(Duration::Minutes(1.0)),
+            monteCarloSolver.getStateDispersions(),
+            monteCarloSolver.getSatelliteSystemDispersions(),
+            8,
+        };
+
+        EXPECT_NE(monteCarloSolver.generateSample(0).state, otherMonteCarloSolver.generateSample(0).state);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, Solve)
+{
+    const MonteCarloSolver monteCarloSolver = {
+        state_,
+        satelliteSystem_,
+        this->coastSequenceGenerator(Duration::Minutes(10.0)),
+        {
+            StateDispersion::Normal(CartesianPosition::Default(), {100.0, 100.0, 100.0}),
+            StateDispersion::Normal(CartesianVelocity::Default(), {0.1, 0.1, 0.1}),
+        },
+    };
+
+    const Size sampleCount = 24;
+
+    const MonteCarloSolver::Solution solution = monteCarloSolver.solve(sampleCount, 1);
+
+    {
+        EXPECT_EQ(sampleCount, solution.sampleCount);
+        EXPECT_EQ(sampleCount, solution.completeSampleCount);
+        EXPECT_EQ(0, solution.incompleteSampleCount);
+        EXPECT_EQ(0, solution.failedSampleCount);
+        EXPECT_EQ(Array<Real>({5.0, 50.0, 95.0}), solution.percentiles);
+        EXPECT_EQ(Frame::GCRF(), solution.frame);
+
+        EXPECT_EQ(7, solution.finalCoordinates.mean.size());
+        EXPECT_EQ(7, solution.finalCoordinates.covariance.rows());
+        EXPECT_EQ(3, solution.finalCoordinates.percentiles.rows());
+        EXPECT_EQ(7, solution.finalCoordinates.percentiles.cols());
+
+        EXPECT_NEAR(100.0, solution.finalCoordinates.mean(6), 1.0e-12);
+
+        EXPECT_EQ(0.0, solution.deltaV.mean(0));
+        EXPECT_NEAR(600.0, solution.propagationDuration.mean(0), 1.0e-3);
+
+        for (Size i = 0; i < 7; ++i)
+        {
+            EXPECT_LE(solution.finalCoordinates.percentiles(0, i), solution.finalCoordinates.percentiles(1, i));
+            EXPECT_LE(solution.finalCoordinates.percentiles(1, i), solution.finalCoordinates.percentiles(2, i));
+        }
+    }
+
+    // Solutions are the same regardless of the thread count
+
+    {
+        const MonteCarloSolver::Solution concurrentSolution = monteCarloSolver.solve(sampleCount, 4);
+
+        EXPECT_EQ(solution.finalCoordinates.mean, concurrentSolution.finalCoordinates.mean);
+        EXPECT_EQ(solution.finalCoordinates.covariance, concurrentSolution.finalCoordinates.covariance);
+        EXPECT_EQ(solution.finalCoordinates.percentiles, concurrentSolution.finalCoordinates.percentiles);
+        EXPECT_EQ(solution.propagationDuration.mean, concurrentSolution.propagationDuration.mean);
+    }
+
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << solution << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+
+    {
+        EXPECT_THROW(monteCarloSolver.solve(0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(monteCarloSolver.solve(1, 1, {0.0}), ostk::core::error::RuntimeError);
+        EXPECT_THROW(monteCarloSolver.solve(1, 1, {100.0}), ostk::core::error::RuntimeError);
+        EXPECT_THROW(monteCarloSolver.solve(1, 1, {50.0}, nullptr), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, Solve_Percentiles)
+{
+    // The mass is not changed by a coast, and is dispersed uniformly over [90, 110]
+
+    const MonteCarloSolver monteCarloSolver = {
+        state_,
+        satelliteSystem_,
+        this->coastSequenceGenerator(Duration::Seconds(1.0)),
+        {StateDispersion::Uniform(CoordinatesSubset::Mass(), VectorXd::Constant(1, 10.0))},
+    };
+
+    const MonteCarloSolver::Solution solution = monteCarloSolver.solve(1000, 0, {10.0, 50.0, 90.0});
+
+    EXPECT_EQ(1000, solution.completeSampleCount);
+
+    EXPECT_NEAR(100.0, solution.finalCoordinates.mean(6), 0.5);
+    EXPECT_NEAR(100.0 / 3.0, solution.finalCoordinates.covariance(6, 6), 3.0);
+
+    EXPECT_NEAR(92.0, solution.finalCoordinates.percentiles(0, 6), 0.5);
+    EXPECT_NEAR(100.0, solution.finalCoordinates.percentiles(1, 6), 0.5);
+    EXPECT_NEAR(108.0, solution.finalCoordinates.percentiles(2, 6), 0.5);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_MonteCarloSolver, Solve_FailedSamples)
+{
+    const MonteCarloSolver monteCarloSolver = {
+        state_,
+        satelliteSystem_,
+        [](const SatelliteSystem&) -> Sequence
+        {
+            throw ostk::core::error::RuntimeError("Cannot generate sequence.");
+        },
+    };
+
+    const MonteCarloSolver::Solution solution = monteCarloSolver.solve(4, 2);
+
+    EXPECT_EQ(4, solution.sampleCount);
+    EXPECT_EQ(0, solution.completeSampleCount);
+    EXPECT_EQ(4, solution.failedSampleCount);
+    EXPECT_EQ(0, solution.finalCoordinates.mean.size());
+}
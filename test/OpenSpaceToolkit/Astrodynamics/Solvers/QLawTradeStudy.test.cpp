@@ -0,0 +1,427 @@
+/// Apache License 2.0
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solvers/QLawTradeStudy.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::math::geometry::d3::objects::Composite;
+using ostk::math::geometry::d3::objects::Cuboid;
+using ostk::math::object::Matrix3d;
+using ostk::math::object::Vector3d;
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Length;
+using ostk::physics::units::Mass;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astro::Dynamics;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::PositionDerivative;
+using ostk::astro::flight::system::PropulsionSystem;
+using ostk::astro::flight::system::SatelliteSystem;
+using ostk::astro::guidancelaw::QLaw;
+using ostk::astro::solvers::QLawTradeStudy;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::orbit::models::kepler::COE;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+class OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const COE initialCOE = {
+            Length::Kilometers(7000.0),
+            0.01,
+            Angle::Degrees(0.05),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const COE::CartesianState cartesianState = initialCOE.getCartesianState(gravitationalParameter_, Frame::GCRF());
+
+        VectorXd coordinates(7);
+        coordinates << cartesianState.first.getCoordinates(), cartesianState.second.getCoordinates(), 100.0;
+
+        this->state_ = {
+            Instant::J2000(),
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinatesSubset::Mass()},
+        };
+
+        const Composite satelliteGeometry(Cuboid(
+            {0.0, 0.0, 0.0},
+            {Vector3d {1.0, 0.0, 0.0}, Vector3d {0.0, 1.0, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+            {1.0, 2.0, 3.0}
+        ));
+
+        this->satelliteSystem_ = {
+            Mass::Kilograms(90.0),
+            satelliteGeometry,
+            Matrix3d::Identity(),
+            1.0,
+            2.2,
+            PropulsionSystem(1.0, 1500.0),
+        };
+    }
+
+    COE targetCOE(const Length& aSemiMajorAxis) const
+    {
+        return {
+            aSemiMajorAxis,
+            0.01,
+            Angle::Degrees(0.05),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+    }
+
+    QLawTradeStudy tradeStudy(const Duration& aMaximumTimeOfFlight = Duration::Hours(1.0)) const
+    {
+        return {
+            state_,
+            satelliteSystem_,
+            environmentDynamics_,
+            numericalSolver_,
+            gravitationalParameter_,
+            aMaximumTimeOfFlight,
+        };
+    }
+
+    const Derived gravitationalParameter_ = EarthGravitationalModel::EGM2008.gravitationalParameter_;
+
+    const Array<Shared<Dynamics>> environmentDynamics_ = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+    };
+
+    const NumericalSolver numericalSolver_ = NumericalSolver::DefaultConditional();
+
+    const QLaw::Parameters parameters_ = {
+        {
+            {COE::Element::SemiMajorAxis, {1.0, 100.0}},
+        },
+        3,
+        4,
+        2,
+        0.01,
+        100,
+        1.0,
+        Length::Kilometers(6578.0),
+    };
+
+    State state_ = State::Undefined();
+    SatelliteSystem satelliteSystem_ = SatelliteSystem::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, Constructor)
+{
+    {
+        EXPECT_NO_THROW(tradeStudy());
+    }
+
+    {
+        EXPECT_THROW(
+            QLawTradeStudy(
+                State::Undefined(),
+                satelliteSystem_,
+                environmentDynamics_,
+                numericalSolver_,
+                gravitationalParameter_,
+                Duration::Hours(1.0)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        const State stateWithoutMass = {
+            state_.accessInstant(),
+            state_.getPosition(),
+            state_.getVelocity(),
+        };
+
+        EXPECT_THROW(
+            QLawTradeStudy(
+                stateWithoutMass,
+                satelliteSystem_,
+                environmentDynamics_,
+                numericalSolver_,
+                gravitationalParameter_,
+                Duration::Hours(1.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            QLawTradeStudy(
+                state_,
+                SatelliteSystem::Undefined(),
+                environmentDynamics_,
+                numericalSolver_,
+                gravitationalParameter_,
+                Duration::Hours(1.0)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            QLawTradeStudy(
+                state_,
+                satelliteSystem_,
+                environmentDynamics_,
+                numericalSolver_,
+                Derived::Undefined(),
+                Duration::Hours(1.0)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(tradeStudy(Duration::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(tradeStudy(Duration::Zero()), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, Getters)
+{
+    const QLawTradeStudy study = tradeStudy();
+
+    EXPECT_EQ(state_, study.getInitialState());
+    EXPECT_EQ(satelliteSystem_, study.getSatelliteSystem());
+    EXPECT_EQ(environmentDynamics_.getSize(), study.getEnvironmentDynamics().getSize());
+    EXPECT_EQ(numericalSolver_, study.getNumericalSolver());
+    EXPECT_EQ(Duration::Hours(1.0), study.getMaximumTimeOfFlight());
+    EXPECT_EQ(QLaw::GradientStrategy::Analytical, study.getGradientStrategy());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, Cases)
+{
+    {
+        const Array<QLaw::Parameters> parametersArray = {parameters_, parameters_, parameters_};
+
+        const Array<QLawTradeStudy::Case> cases =
+            QLawTradeStudy::ParameterCases(targetCOE(Length::Kilometers(7010.0)), parametersArray);
+
+        EXPECT_EQ(3, cases.getSize());
+
+        for (const QLawTradeStudy::Case& aCase : cases)
+        {
+            EXPECT_EQ(targetCOE(Length::Kilometers(7010.0)), aCase.targetCOE);
+        }
+    }
+
+    {
+        const Array<COE> targetCOEs = {
+            targetCOE(Length::Kilometers(7010.0)),
+            targetCOE(Length::Kilometers(7020.0)),
+        };
+
+        const Array<QLawTradeStudy::Case> cases = QLawTradeStudy::TargetCases(targetCOEs, parameters_);
+
+        EXPECT_EQ(2, cases.getSize());
+        EXPECT_EQ(targetCOEs[0], cases[0].targetCOE);
+        EXPECT_EQ(targetCOEs[1], cases[1].targetCOE);
+    }
+
+    {
+        EXPECT_TRUE(QLawTradeStudy::ParameterCases(targetCOE(Length::Kilometers(7010.0)), {}).isEmpty());
+        EXPECT_TRUE(QLawTradeStudy::TargetCases({}, parameters_).isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, StringFromStatus)
+{
+    EXPECT_EQ("Converged", QLawTradeStudy::StringFromStatus(QLawTradeStudy::Status::Converged));
+    EXPECT_EQ("Not Converged", QLawTradeStudy::StringFromStatus(QLawTradeStudy::Status::NotConverged));
+    EXPECT_EQ("Failed", QLawTradeStudy::StringFromStatus(QLawTradeStudy::Status::Failed));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, SolveCase)
+{
+    const QLawTradeStudy study = tradeStudy();
+
+    {
+        const QLawTradeStudy::Result result =
+            study.solveCase({targetCOE(Length::Kilometers(7010.0)), parameters_}, 3);
+
+        EXPECT_EQ(3, result.index);
+        EXPECT_EQ(QLawTradeStudy::Status::Converged, result.status);
+        EXPECT_GT(result.timeOfFlight, Duration::Zero());
+        EXPECT_LT(result.timeOfFlight, study.getMaximumTimeOfFlight());
+        EXPECT_GT(result.deltaV, 0.0);
+        EXPECT_GT(result.propellantMass.inKilograms(), 0.0);
+        EXPECT_LE(std::abs(result.finalElementsError(0)), 100.0);
+        EXPECT_TRUE(result.trajectory.isEmpty());
+    }
+
+    {
+        const QLawTradeStudy::Result result = study.solveCase({targetCOE(Length::Kilometers(7500.0)), parameters_});
+
+        EXPECT_EQ(0, result.index);
+        EXPECT_EQ(QLawTradeStudy::Status::NotConverged, result.status);
+        EXPECT_EQ(study.getMaximumTimeOfFlight(), result.timeOfFlight);
+        EXPECT_GT(std::abs(result.finalElementsError(0)), 100.0);
+    }
+
+    {
+        const QLawTradeStudy::Result fullResult =
+            study.solveCase({targetCOE(Length::Kilometers(7010.0)), parameters_}, 0, 1);
+        const QLawTradeStudy::Result decimatedResult =
+            study.solveCase({targetCOE(Length::Kilometers(7010.0)), parameters_}, 0, 4);
+
+        const Size stateCount = fullResult.trajectory.getSize();
+
+        ASSERT_GT(stateCount, 1);
+
+        EXPECT_EQ(
+            (stateCount + 3) / 4 + (((stateCount - 1) % 4 != 0) ? 1 : 0), decimatedResult.trajectory.getSize()
+        );
+        EXPECT_EQ(fullResult.trajectory.accessFirst(), decimatedResult.trajectory.accessFirst());
+        EXPECT_EQ(fullResult.trajectory.accessLast(), decimatedResult.trajectory.accessLast());
+        EXPECT_EQ(state_.accessInstant(), decimatedResult.trajectory.accessFirst().accessInstant());
+        EXPECT_EQ(
+            state_.accessInstant() + decimatedResult.timeOfFlight,
+            decimatedResult.trajectory.accessLast().accessInstant()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, Solve)
+{
+    const QLawTradeStudy study = tradeStudy();
+
+    const Array<QLawTradeStudy::Case> cases = QLawTradeStudy::TargetCases(
+        {
+            targetCOE(Length::Kilometers(7010.0)),
+            targetCOE(Length::Kilometers(7500.0)),
+            targetCOE(Length::Kilometers(6990.0)),
+        },
+        parameters_
+    );
+
+    {
+        EXPECT_TRUE(study.solve({}).isEmpty());
+    }
+
+    {
+        const Array<QLawTradeStudy::Result> serialResults = study.solve(cases, 1);
+        const Array<QLawTradeStudy::Result> parallelResults = study.solve(cases, 2);
+
+        ASSERT_EQ(cases.getSize(), serialResults.getSize());
+        ASSERT_EQ(cases.getSize(), parallelResults.getSize());
+
+        EXPECT_EQ(QLawTradeStudy::Status::Converged, parallelResults[0].status);
+        EXPECT_EQ(QLawTradeStudy::Status::NotConverged, parallelResults[1].status);
+        EXPECT_EQ(QLawTradeStudy::Status::Converged, parallelResults[2].status);
+
+        for (Size i = 0; i < cases.getSize(); ++i)
+        {
+            EXPECT_EQ(i, parallelResults[i].index);
+            EXPECT_EQ(serialResults[i].status, parallelResults[i].status);
+            EXPECT_EQ(serialResults[i].timeOfFlight, parallelResults[i].timeOfFlight);
+            EXPECT_EQ(serialResults[i].deltaV, parallelResults[i].deltaV);
+            EXPECT_TRUE(serialResults[i].finalElementsError.isApprox(parallelResults[i].finalElementsError));
+        }
+    }
+
+    {
+        const Array<QLawTradeStudy::Result> results = study.solve(cases, 0, 10);
+
+        for (const QLawTradeStudy::Result& result : results)
+        {
+            EXPECT_FALSE(result.trajectory.isEmpty());
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_QLawTradeStudy, Solve_FailedCases)
+{
+    // Not enough propellant to complete the transfer
+
+    VectorXd coordinates = state_.getCoordinates();
+    coordinates(6) = 90.001;
+
+    const State state = {
+        state_.accessInstant(),
+        coordinates,
+        state_.accessFrame(),
+        state_.accessCoordinatesBroker(),
+    };
+
+    const QLawTradeStudy study = {
+        state,
+        satelliteSystem_,
+        environmentDynamics_,
+        numericalSolver_,
+        gravitationalParameter_,
+        Duration::Hours(1.0),
+    };
+
+    const Array<QLawTradeStudy::Result> results =
+        study.solve(QLawTradeStudy::TargetCases({targetCOE(Length::Kilometers(7500.0))}, parameters_), 2);
+
+    ASSERT_EQ(1, results.getSize());
+
+    EXPECT_EQ(0, results[0].index);
+    EXPECT_EQ(QLawTradeStudy::Status::Failed, results[0].status);
+    EXPECT_FALSE(results[0].timeOfFlight.isDefined());
+    EXPECT_FALSE(results[0].deltaV.isDefined());
+    EXPECT_FALSE(results[0].propellantMass.isDefined());
+    EXPECT_TRUE(results[0].trajectory.isEmpty());
+}
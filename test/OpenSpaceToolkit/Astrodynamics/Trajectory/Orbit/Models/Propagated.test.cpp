@@ -501,6 +501,16 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, Calcul
         EXPECT_EQ(defaultRevolutionNumber_ - 2, orbit.getRevolutionNumberAt(instant_before1));
         EXPECT_EQ(defaultRevolutionNumber_ + 1, orbit.getRevolutionNumberAt(instant_after1));
         EXPECT_EQ(defaultRevolutionNumber_ + 2, orbit.getRevolutionNumberAt(instant_after2));
+
+        // The default state lies on the ascending node, and the orbital period is about 97 minutes
+
+        const Array<Instant> ascendingNodeInstants = propagatedModel.getAscendingNodeInstantArray();
+
+        ASSERT_EQ(3, ascendingNodeInstants.getSize());
+        EXPECT_EQ(defaultInstant_, ascendingNodeInstants[1]);
+        EXPECT_LT(
+            std::abs((ascendingNodeInstants[2] - (defaultInstant_ + Duration::Minutes(97.14))).inSeconds()), 5.0
+        );
     }
 
     // Test accuracy of calculateRevolutionNumber at by checking that it returns results accurate to the force model
@@ -543,17 +553,20 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, Calcul
         const Duration currentOrbitalPeriod =
             Duration::Seconds(Real::TwoPi() * std::sqrt(std::pow(semiMajorAxis, 3) / gravitationalParameter_SI));
 
-        // Calculate revolution number at instant
+        // Calculate revolution number at instant. The start state lies on the ascending node, and the nodal period of
+        // the full gravity model is about 14 s shorter than the two-body period at this inclination: sample between
+        // their fifth ascending nodes before start, rather than on the two-body one.
         const int propagationRevolutions = 5;
-        const Instant endInstant = startInstant - currentOrbitalPeriod * propagationRevolutions;
+        const Instant endInstant =
+            startInstant - currentOrbitalPeriod * propagationRevolutions + Duration::Seconds(30.0);
 
         const Integer revolutionNumber_twobody = propagatedModel_twobody.calculateRevolutionNumberAt(endInstant);
         const Integer revolutionNumber_fullgrav = propagatedModel_fullgrav.calculateRevolutionNumberAt(endInstant);
 
-        // Check that revolution numbers for two body are exact, for full grav are 1 higher due to losses (which are
-        // gains in negative time), and that they are not equal
-        EXPECT_EQ(-propagationRevolutions - 1, revolutionNumber_twobody);
-        EXPECT_EQ(-propagationRevolutions, revolutionNumber_fullgrav);
+        // Check that revolution numbers for two body are exact, for full grav are 1 lower as ascending nodes come
+        // earlier (which is later in negative time), and that they are not equal
+        EXPECT_EQ(-propagationRevolutions, revolutionNumber_twobody);
+        EXPECT_EQ(-propagationRevolutions - 1, revolutionNumber_fullgrav);
 
         EXPECT_FALSE(revolutionNumber_twobody == revolutionNumber_fullgrav);
     }
@@ -738,3 +751,244 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, Propag
         ASSERT_EQ(estimatedState, states[1]);
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, Checkpointing)
+{
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        EXPECT_FALSE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_FALSE(propagatedModel.getCheckpointInterval().isDefined());
+        EXPECT_EQ(0, propagatedModel.getMaximumCheckpointCount());
+
+        EXPECT_THROW(propagatedModel.enableCheckpointing(Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            propagatedModel.enableCheckpointing(Duration::Minutes(30.0), 1), ostk::core::error::runtime::Wrong
+        );
+
+        propagatedModel.enableCheckpointing();
+
+        EXPECT_TRUE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_EQ(1000, propagatedModel.getMaximumCheckpointCount());
+
+        // Default interval is the orbital period at epoch
+
+        EXPECT_GT(propagatedModel.getCheckpointInterval().inMinutes(), 90.0);
+        EXPECT_LT(propagatedModel.getCheckpointInterval().inMinutes(), 110.0);
+
+        propagatedModel.disableCheckpointing();
+
+        EXPECT_FALSE(propagatedModel.isCheckpointingEnabled());
+        EXPECT_FALSE(propagatedModel.getCheckpointInterval().isDefined());
+    }
+
+    {
+        const Propagated referenceModel = {propagator_, defaultState_};
+
+        Propagated propagatedModel = {propagator_, defaultState_};
+        propagatedModel.enableCheckpointing(Duration::Minutes(30.0));
+
+        const Array<Instant> backwardInstants =
+            Interval::Closed(defaultInstant_ - Duration::Hours(3.0), defaultInstant_)
+                .generateGrid(Duration::Minutes(17.0));
+        const Array<Instant> forwardInstants =
+            Interval::Closed(defaultInstant_, defaultInstant_ + Duration::Days(1.0))
+                .generateGrid(Duration::Minutes(41.0));
+
+        const auto expectStatesNear = [](const Array<State>& aStateArray, const Array<State>& aReferenceStateArray)
+        {
+            ASSERT_EQ(aReferenceStateArray.getSize(), aStateArray.getSize());
+
+            for (Size i = 0; i < aStateArray.getSize(); ++i)
+            {
+                EXPECT_EQ(aReferenceStateArray[i].accessInstant(), aStateArray[i].accessInstant());
+                EXPECT_LT(
+                    (aStateArray[i].getPosition().accessCoordinates() -
+                     aReferenceStateArray[i].getPosition().accessCoordinates())
+                        .norm(),
+                    1e-3
+                );
+            }
+        };
+
+        expectStatesNear(
+            propagatedModel.calculateStatesAt(forwardInstants), referenceModel.calculateStatesAt(forwardInstants)
+        );
+
+        // Checkpoints are stored every interval, up to the farthest instant
+
+        const Array<State> checkpointStateArray = propagatedModel.getCheckpointStateArray();
+
+        EXPECT_EQ(48, checkpointStateArray.getSize());
+        EXPECT_EQ(defaultInstant_ + Duration::Minutes(30.0), checkpointStateArray.accessFirst().accessInstant());
+        EXPECT_EQ(defaultInstant_ + Duration::Days(1.0), checkpointStateArray.accessLast().accessInstant());
+
+        // Checkpoints do not alter the cached state array, nor equality
+
+        EXPECT_EQ(1, propagatedModel.accessCachedStateArray().getSize());
+        EXPECT_EQ(referenceModel, propagatedModel);
+
+        // Later queries start from checkpoints
+
+        const Instant instant = defaultInstant_ + Duration::Hours(20.0) + Duration::Minutes(5.0);
+
+        EXPECT_LT(
+            (propagatedModel.calculateStateAt(instant).getPosition().accessCoordinates() -
+             referenceModel.calculateStateAt(instant).getPosition().accessCoordinates())
+                .norm(),
+            1e-3
+        );
+
+        expectStatesNear(
+            propagatedModel.calculateStatesAt(backwardInstants), referenceModel.calculateStatesAt(backwardInstants)
+        );
+
+        EXPECT_EQ(54, propagatedModel.getCheckpointStateArray().getSize());
+        EXPECT_EQ(
+            defaultInstant_ - Duration::Hours(3.0),
+            propagatedModel.getCheckpointStateArray().accessFirst().accessInstant()
+        );
+
+        // Copies carry checkpoints over
+
+        const Propagated propagatedModelCopy = {propagatedModel};
+
+        EXPECT_TRUE(propagatedModelCopy.isCheckpointingEnabled());
+        EXPECT_EQ(54, propagatedModelCopy.getCheckpointStateArray().getSize());
+
+        // Setting the cached state array clears checkpoints
+
+        propagatedModel.setCachedStateArray({defaultState_});
+
+        EXPECT_TRUE(propagatedModel.getCheckpointStateArray().isEmpty());
+    }
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+        propagatedModel.enableCheckpointing(Duration::Minutes(30.0), 10);
+
+        propagatedModel.calculateStateAt(defaultInstant_ + Duration::Days(1.0));
+
+        // Every other checkpoint is dropped when the maximum count is exceeded, and the interval is doubled
+
+        EXPECT_LE(propagatedModel.getCheckpointStateArray().getSize(), 10);
+        EXPECT_EQ(Duration::Hours(4.0), propagatedModel.getCheckpointInterval());
+
+        propagatedModel.calculateStateAt(defaultInstant_ + Duration::Days(2.0));
+
+        EXPECT_LE(propagatedModel.getCheckpointStateArray().getSize(), 10);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, InterpolationType)
+{
+    {
+        EXPECT_EQ("Blended", Propagated::StringFromInterpolationType(Propagated::InterpolationType::Blended));
+        EXPECT_EQ(
+            "ContinuityCorrected",
+            Propagated::StringFromInterpolationType(Propagated::InterpolationType::ContinuityCorrected)
+        );
+    }
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        EXPECT_EQ(Propagated::InterpolationType::Blended, propagatedModel.getInterpolationType());
+        EXPECT_EQ(1, propagatedModel.getThreadCount());
+
+        propagatedModel.setInterpolationType(Propagated::InterpolationType::ContinuityCorrected);
+        propagatedModel.setThreadCount(4);
+
+        EXPECT_EQ(Propagated::InterpolationType::ContinuityCorrected, propagatedModel.getInterpolationType());
+        EXPECT_EQ(4, propagatedModel.getThreadCount());
+
+        const Propagated propagatedModelCopy = {propagatedModel};
+
+        EXPECT_EQ(Propagated::InterpolationType::ContinuityCorrected, propagatedModelCopy.getInterpolationType());
+        EXPECT_EQ(4, propagatedModelCopy.getThreadCount());
+
+        EXPECT_NE(Propagated(propagator_, defaultState_), propagatedModel);
+    }
+
+    {
+        const Table referenceData = Table::Load(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/"
+                                   "Propagated/CalculateStatesAt_StateValidation.csv")),
+            Table::Format::CSV,
+            true
+        );
+
+        Array<Instant> instantArray = Array<Instant>::Empty();
+        Array<State> referenceStateArray = Array<State>::Empty();
+
+        for (const auto& referenceRow : referenceData)
+        {
+            const Instant instant = Instant::DateTime(DateTime::Parse(referenceRow[0].accessString()), Scale::UTC);
+
+            instantArray.add(instant);
+            referenceStateArray.add({
+                instant,
+                Position::Meters(
+                    {referenceRow[1].accessReal(), referenceRow[2].accessReal(), referenceRow[3].accessReal()},
+                    gcrfSPtr_
+                ),
+                Velocity::MetersPerSecond(
+                    {referenceRow[4].accessReal(), referenceRow[5].accessReal(), referenceRow[6].accessReal()},
+                    gcrfSPtr_
+                ),
+            });
+        }
+
+        // Cache every tenth reference state, so that most instants lie between cached states
+
+        Array<State> cachedStateArray = Array<State>::Empty();
+
+        for (Size i = 0; i < referenceStateArray.getSize(); i += 10)
+        {
+            cachedStateArray.add(referenceStateArray[i]);
+        }
+
+        const Array<State> serialBlendedStateArray =
+            Propagated(propagator_, cachedStateArray).calculateStatesAt(instantArray);
+
+        for (const auto& interpolationType :
+             {Propagated::InterpolationType::Blended, Propagated::InterpolationType::ContinuityCorrected})
+        {
+            for (const Size threadCount : {1, 4, 0})
+            {
+                Propagated propagatedModel = {propagator_, cachedStateArray};
+                propagatedModel.setInterpolationType(interpolationType);
+                propagatedModel.setThreadCount(threadCount);
+
+                const Array<State> propagatedStateArray = propagatedModel.calculateStatesAt(instantArray);
+
+                ASSERT_EQ(referenceStateArray.getSize(), propagatedStateArray.getSize());
+
+                // Concurrent propagation gives the same results as sequential propagation
+
+                if (interpolationType == Propagated::InterpolationType::Blended)
+                {
+                    EXPECT_EQ(serialBlendedStateArray, propagatedStateArray);
+                }
+
+                for (Size i = 0; i < propagatedStateArray.getSize(); ++i)
+                {
+                    EXPECT_EQ(instantArray[i], propagatedStateArray[i].getInstant());
+
+                    EXPECT_GT(
+                        2e-7,
+                        (propagatedStateArray[i].getPosition().accessCoordinates() -
+                         referenceStateArray[i].getPosition().accessCoordinates())
+                            .norm()
+                    );
+                    EXPECT_GT(
+                        2e-10,
+                        (propagatedStateArray[i].getVelocity().accessCoordinates() -
+                         referenceStateArray[i].getVelocity().accessCoordinates())
+                            .norm()
+                    );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,550 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Moon.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/SemiAnalytic.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::types::Integer;
+using ostk::core::types::Real;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::coord::Position;
+using ostk::physics::coord::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::environment::object::celestial::Moon;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::units::Angle;
+using ostk::physics::units::Derived;
+using ostk::physics::units::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthMagneticModel = ostk::physics::environment::magnetic::Earth;
+using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
+
+using ostk::astro::Dynamics;
+using ostk::astro::dynamics::AtmosphericDrag;
+using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::PositionDerivative;
+using ostk::astro::trajectory::Orbit;
+using ostk::astro::trajectory::Propagator;
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::orbit::models::Kepler;
+using ostk::astro::trajectory::orbit::models::SemiAnalytic;
+using ostk::astro::trajectory::orbit::models::kepler::COE;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
+using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->earthSpherical_ = std::make_shared<Celestial>(Earth::Spherical());
+        this->earthWithAtmosphere_ = std::make_shared<Celestial>(Earth::FromModels(
+            std::make_shared<EarthGravitationalModel>(EarthGravitationalModel::Type::Spherical),
+            std::make_shared<EarthMagneticModel>(EarthMagneticModel::Type::Undefined),
+            std::make_shared<EarthAtmosphericModel>(EarthAtmosphericModel::Type::Exponential)
+        ));
+
+        this->defaultState_ = this->stateFromCOE(
+            {Length::Kilometers(7000.0),
+             0.001,
+             Angle::Degrees(50.0),
+             Angle::Degrees(30.0),
+             Angle::Degrees(40.0),
+             Angle::Degrees(10.0)},
+            earthSpherical_
+        );
+    }
+
+    State stateFromCOE(const COE& aCOE, const Shared<const Celestial>& aCelestialSPtr) const
+    {
+        const COE::CartesianState cartesianState =
+            aCOE.getCartesianState(aCelestialSPtr->getGravitationalParameter(), gcrfSPtr_);
+
+        return {defaultInstant_, cartesianState.first, cartesianState.second};
+    }
+
+    State dragStateFromState(const State& aState, const Real& aMass, const Real& aSurfaceArea) const
+    {
+        const Shared<const CoordinatesBroker> coordinatesBrokerSPtr =
+            std::make_shared<CoordinatesBroker>(CoordinatesBroker({
+                CartesianPosition::Default(),
+                CartesianVelocity::Default(),
+                CoordinatesSubset::Mass(),
+                CoordinatesSubset::SurfaceArea(),
+                CoordinatesSubset::DragCoefficient(),
+            }));
+
+        VectorXd coordinates(9);
+        coordinates << aState.getCoordinates(), aMass, aSurfaceArea, 2.2;
+
+        return {aState.accessInstant(), coordinates, gcrfSPtr_, coordinatesBrokerSPtr};
+    }
+
+    const Shared<const Frame> gcrfSPtr_ = Frame::GCRF();
+    const Instant defaultInstant_ = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    Shared<Celestial> earthSpherical_ = nullptr;
+    Shared<Celestial> earthWithAtmosphere_ = nullptr;
+
+    State defaultState_ = State::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, Constructor)
+{
+    {
+        EXPECT_NO_THROW(SemiAnalytic(defaultState_, earthSpherical_));
+        EXPECT_NO_THROW(SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Hours(6.0), 32, false));
+    }
+
+    {
+        const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_};
+
+        EXPECT_NO_THROW(Orbit(semiAnalytic, earthSpherical_));
+    }
+
+    {
+        EXPECT_NO_THROW(SemiAnalytic(
+            this->dragStateFromState(defaultState_, 100.0, 1.0),
+            earthWithAtmosphere_,
+            {std::make_shared<AtmosphericDrag>(earthWithAtmosphere_)}
+        ));
+    }
+
+    {
+        EXPECT_THROW(SemiAnalytic(State::Undefined(), earthSpherical_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(SemiAnalytic(defaultState_, nullptr), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Zero()), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Days(1.0), 2), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {nullptr}), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    // Central body gravity is modeled by the semi-analytic model itself
+
+    {
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {std::make_shared<CentralBodyGravity>(earthSpherical_)}),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Perturbations must only write to the velocity
+
+    {
+        EXPECT_THROW(
+            SemiAnalytic(defaultState_, earthSpherical_, {std::make_shared<PositionDerivative>()}),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Perturbations must read coordinates held by the state
+
+    {
+        EXPECT_THROW(
+            SemiAnalytic(
+                defaultState_, earthWithAtmosphere_, {std::make_shared<AtmosphericDrag>(earthWithAtmosphere_)}
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Mean perigee below the surface
+
+    {
+        const State state = this->stateFromCOE(
+            {Length::Kilometers(6000.0),
+             0.0,
+             Angle::Degrees(50.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(0.0)},
+            earthSpherical_
+        );
+
+        EXPECT_THROW(
+            SemiAnalytic(state, earthSpherical_, {}, Duration::Days(1.0), 16, false), ostk::core::error::RuntimeError
+        );
+    }
+
+    // Short-period recovery with another central body than the Earth
+
+    {
+        const Shared<const Celestial> moonSPtr = std::make_shared<Celestial>(Moon::Default());
+
+        const State state = this->stateFromCOE(
+            {Length::Kilometers(2000.0),
+             0.01,
+             Angle::Degrees(50.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(0.0)},
+            moonSPtr
+        );
+
+        EXPECT_THROW(SemiAnalytic(state, moonSPtr), ostk::core::error::RuntimeError);
+        EXPECT_NO_THROW(SemiAnalytic(state, moonSPtr, {}, Duration::Days(1.0), 16, false));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, EqualToOperator)
+{
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_};
+
+    {
+        EXPECT_TRUE(semiAnalytic == semiAnalytic);
+        EXPECT_TRUE(semiAnalytic == SemiAnalytic(defaultState_, earthSpherical_));
+        EXPECT_FALSE(semiAnalytic != SemiAnalytic(defaultState_, earthSpherical_));
+    }
+
+    {
+        EXPECT_FALSE(semiAnalytic == SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Hours(6.0)));
+        EXPECT_FALSE(semiAnalytic == SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Days(1.0), 32));
+        EXPECT_FALSE(semiAnalytic == SemiAnalytic(defaultState_, earthSpherical_, {}, Duration::Days(1.0), 16, false));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, StreamOperator)
+{
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(std::cout << semiAnalytic << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, Print)
+{
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(semiAnalytic.print(std::cout, true));
+    EXPECT_NO_THROW(semiAnalytic.print(std::cout, false));
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, Getters)
+{
+    const Shared<Dynamics> atmosphericDragSPtr = std::make_shared<AtmosphericDrag>(earthWithAtmosphere_);
+
+    const SemiAnalytic semiAnalytic = {
+        this->dragStateFromState(defaultState_, 100.0, 1.0),
+        earthWithAtmosphere_,
+        {atmosphericDragSPtr},
+        Duration::Hours(12.0),
+        24,
+        false,
+    };
+
+    EXPECT_TRUE(semiAnalytic.isDefined());
+    EXPECT_EQ(semiAnalytic.getEpoch(), defaultInstant_);
+    EXPECT_EQ(semiAnalytic.getRevolutionNumberAtEpoch(), 1);
+    EXPECT_EQ(semiAnalytic.getState().getSize(), 9);
+    EXPECT_EQ(semiAnalytic.getCelestial(), earthWithAtmosphere_);
+    EXPECT_EQ(semiAnalytic.getPerturbations().getSize(), 1);
+    EXPECT_EQ(semiAnalytic.getPerturbations().accessFirst(), atmosphericDragSPtr);
+    EXPECT_EQ(semiAnalytic.getStepDuration(), Duration::Hours(12.0));
+    EXPECT_EQ(semiAnalytic.getQuadraturePointCount(), 24);
+    EXPECT_FALSE(semiAnalytic.isShortPeriodRecoveryEnabled());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, CalculateStateAt)
+{
+    // Without perturbations, the mean elements of a spherical central body are the Keplerian ones
+
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_, {}, Duration::Days(1.0), 16, false};
+
+    const Kepler kepler = {
+        COE::Cartesian(
+            {defaultState_.getPosition(), defaultState_.getVelocity()}, earthSpherical_->getGravitationalParameter()
+        ),
+        defaultInstant_,
+        *earthSpherical_,
+        Kepler::PerturbationType::None,
+    };
+
+    {
+        const State state = semiAnalytic.calculateStateAt(defaultInstant_);
+
+        EXPECT_EQ(state.accessInstant(), defaultInstant_);
+        EXPECT_EQ(state.accessFrame(), gcrfSPtr_);
+        EXPECT_LT((state.getPosition().getCoordinates() - defaultState_.getPosition().getCoordinates()).norm(), 1e-3);
+        EXPECT_LT((state.getVelocity().getCoordinates() - defaultState_.getVelocity().getCoordinates()).norm(), 1e-6);
+    }
+
+    for (const Duration& duration :
+         {Duration::Hours(-30.5), Duration::Hours(1.0), Duration::Hours(13.7), Duration::Days(10.0)})
+    {
+        const Instant instant = defaultInstant_ + duration;
+
+        const State state = semiAnalytic.calculateStateAt(instant);
+        const State referenceState = kepler.calculateStateAt(instant);
+
+        EXPECT_EQ(state.accessInstant(), instant);
+        EXPECT_LT((state.getPosition().getCoordinates() - referenceState.getPosition().getCoordinates()).norm(), 1e-2);
+        EXPECT_LT((state.getVelocity().getCoordinates() - referenceState.getVelocity().getCoordinates()).norm(), 1e-5);
+    }
+
+    // Coordinates other than the position and velocity are carried over
+
+    {
+        const SemiAnalytic dragSemiAnalytic = {
+            this->dragStateFromState(defaultState_, 100.0, 1.0),
+            earthWithAtmosphere_,
+            {std::make_shared<AtmosphericDrag>(earthWithAtmosphere_)},
+        };
+
+        const State state = dragSemiAnalytic.calculateStateAt(defaultInstant_ + Duration::Days(3.0));
+
+        EXPECT_EQ(state.getSize(), 9);
+        EXPECT_EQ(state.accessCoordinates()[6], 100.0);
+        EXPECT_EQ(state.accessCoordinates()[7], 1.0);
+        EXPECT_EQ(state.accessCoordinates()[8], 2.2);
+    }
+
+    {
+        EXPECT_THROW(semiAnalytic.calculateStateAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, CalculateMeanElementsAt)
+{
+    // Secular drift of the right ascension of the ascending node due to J2
+
+    const Shared<const Celestial> earthSPtr = std::make_shared<Celestial>(Earth::Default());
+
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSPtr};
+
+    const COE epochMeanElements = semiAnalytic.calculateMeanElementsAt(defaultInstant_);
+
+    const Real semiMajorAxis = epochMeanElements.getSemiMajorAxis().inMeters();
+    const Real eccentricity = epochMeanElements.getEccentricity();
+    const Real semiLatusRectum = semiMajorAxis * (1.0 - eccentricity * eccentricity);
+    const Real meanMotion = std::sqrt(
+        earthSPtr->getGravitationalParameter().in(
+            Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)
+        ) /
+        (semiMajorAxis * semiMajorAxis * semiMajorAxis)
+    );
+    const Real raanRate = -1.5 * meanMotion * earthSPtr->getJ2() *
+                          std::pow(earthSPtr->getEquatorialRadius().inMeters() / semiLatusRectum, 2) *
+                          std::cos(epochMeanElements.getInclination().inRadians());
+
+    const Duration duration = Duration::Days(30.0);
+
+    const COE meanElements = semiAnalytic.calculateMeanElementsAt(defaultInstant_ + duration);
+
+    const Real raanDrift = meanElements.getRaan().inRadians() - epochMeanElements.getRaan().inRadians();
+    const Real expectedRaanDrift = raanRate * duration.inSeconds();
+
+    EXPECT_NEAR(std::remainder(raanDrift - expectedRaanDrift, 2.0 * M_PI), 0.0, 0.01 * std::abs(expectedRaanDrift));
+
+    // The mean semi-major axis has no secular variation due to zonal harmonics
+
+    EXPECT_NEAR(meanElements.getSemiMajorAxis().inMeters(), semiMajorAxis, 1e-3);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, AtmosphericDrag)
+{
+    // Semi-major axis decay, against a numerical propagation averaged over the last revolution
+
+    const State state = this->dragStateFromState(
+        this->stateFromCOE(
+            {Length::Kilometers(6378.137 + 350.0),
+             0.001,
+             Angle::Degrees(51.6),
+             Angle::Degrees(30.0),
+             Angle::Degrees(40.0),
+             Angle::Degrees(10.0)},
+            earthWithAtmosphere_
+        ),
+        100.0,
+        1.0
+    );
+
+    const Shared<Dynamics> atmosphericDragSPtr = std::make_shared<AtmosphericDrag>(earthWithAtmosphere_);
+
+    const SemiAnalytic semiAnalytic = {
+        state, earthWithAtmosphere_, {atmosphericDragSPtr}, Duration::Days(1.0), 16, false
+    };
+
+    const Propagator propagator = {
+        NumericalSolver::DefaultConditional(),
+        {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(earthWithAtmosphere_),
+            atmosphericDragSPtr,
+        },
+    };
+
+    const Duration duration = Duration::Days(1.0);
+    const Derived gravitationalParameter = earthWithAtmosphere_->getGravitationalParameter();
+
+    const Real semiMajorAxisDecay =
+        semiAnalytic.calculateMeanElementsAt(defaultInstant_ + duration).getSemiMajorAxis().inMeters() -
+        semiAnalytic.calculateMeanElementsAt(defaultInstant_).getSemiMajorAxis().inMeters();
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Size i = 0; i < 60; ++i)
+    {
+        instants.add(defaultInstant_ + duration - Duration::Minutes(1.5 * double(i)));
+    }
+
+    std::reverse(instants.begin(), instants.end());
+
+    Real semiMajorAxisSum = 0.0;
+
+    for (const State& propagatedState : propagator.calculateStatesAt(state, instants))
+    {
+        semiMajorAxisSum +=
+            COE::Cartesian({propagatedState.getPosition(), propagatedState.getVelocity()}, gravitationalParameter)
+                .getSemiMajorAxis()
+                .inMeters();
+    }
+
+    const Real referenceSemiMajorAxisDecay =
+        (semiMajorAxisSum / Real(instants.getSize())) -
+        COE::Cartesian({state.getPosition(), state.getVelocity()}, gravitationalParameter)
+            .getSemiMajorAxis()
+            .inMeters();
+
+    EXPECT_LT(semiMajorAxisDecay, -100.0);
+    EXPECT_NEAR(semiMajorAxisDecay, referenceSemiMajorAxisDecay, 0.05 * std::abs(referenceSemiMajorAxisDecay));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, CalculateRevolutionNumberAt)
+{
+    const SemiAnalytic semiAnalytic = {defaultState_, earthSpherical_, {}, Duration::Days(1.0), 16, false};
+
+    // Epoch 50 degrees of argument of latitude after the ascending node
+
+    const Real gravitationalParameter_SI = earthSpherical_->getGravitationalParameter().in(
+        Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)
+    );
+    const Duration period =
+        Duration::Seconds(2.0 * M_PI * std::sqrt(std::pow(7000.0e3, 3) / gravitationalParameter_SI));
+
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_), 1);
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_ + period * 0.5), 1);
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_ + period * 1.5), 2);
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_ + period * 10.5), 11);
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_ - period * 0.5), 0);
+    EXPECT_EQ(semiAnalytic.calculateRevolutionNumberAt(defaultInstant_ - period * 2.5), -2);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_SemiAnalytic, CalculateDecayInstant)
+{
+    const State state = this->dragStateFromState(
+        this->stateFromCOE(
+            {Length::Kilometers(6378.137 + 300.0),
+             0.0005,
+             Angle::Degrees(51.6),
+             Angle::Degrees(30.0),
+             Angle::Degrees(40.0),
+             Angle::Degrees(10.0)},
+            earthWithAtmosphere_
+        ),
+        100.0,
+        1.0
+    );
+
+    const SemiAnalytic semiAnalytic = {
+        state,
+        earthWithAtmosphere_,
+        {std::make_shared<AtmosphericDrag>(earthWithAtmosphere_)},
+        Duration::Days(1.0),
+        16,
+        false,
+    };
+
+    {
+        EXPECT_FALSE(semiAnalytic.calculateDecayInstant(defaultInstant_ + Duration::Days(1.0)).isDefined());
+    }
+
+    {
+        const Instant decayInstant = semiAnalytic.calculateDecayInstant(defaultInstant_ + Duration::Days(365.0));
+
+        ASSERT_TRUE(decayInstant.isDefined());
+        EXPECT_GT(decayInstant, defaultInstant_ + Duration::Days(2.0));
+
+        EXPECT_NO_THROW(semiAnalytic.calculateStateAt(decayInstant - Duration::Days(2.0)));
+        EXPECT_THROW(
+            semiAnalytic.calculateStateAt(decayInstant + Duration::Days(2.0)), ostk::core::error::RuntimeError
+        );
+
+        // Mean perigee altitude is decreasing towards the decay altitude
+
+        const COE meanElements = semiAnalytic.calculateMeanElementsAt(decayInstant - Duration::Days(2.0));
+
+        EXPECT_LT(
+            meanElements.getPeriapsisRadius().inMeters() - 6378137.0,
+            semiAnalytic.calculateMeanElementsAt(defaultInstant_).getPeriapsisRadius().inMeters() - 6378137.0
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            semiAnalytic.calculateDecayInstant(defaultInstant_ - Duration::Days(1.0)), ostk::core::error::RuntimeError
+        );
+    }
+}
@@ -1,6 +1,9 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <limits>
 #include <numeric>
+#include <thread>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Containers/Table.hpp>
@@ -31,10 +34,12 @@
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
 #include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/FidelitySchedule.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
@@ -45,6 +50,8 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
 
 #include <Global.test.hpp>
 
@@ -87,11 +94,13 @@ using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
+using ostk::physics::units::Length;
 using ostk::physics::units::Mass;
 
 using ostk::astro::Dynamics;
 using ostk::astro::dynamics::PositionDerivative;
 using ostk::astro::dynamics::CentralBodyGravity;
+using ostk::astro::dynamics::FidelitySchedule;
 using ostk::astro::dynamics::ThirdBodyGravity;
 using ostk::astro::dynamics::AtmosphericDrag;
 using ostk::astro::flight::system::PropulsionSystem;
@@ -105,6 +114,8 @@ using ostk::astro::trajectory::state::CoordinatesSubset;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianPosition;
 using ostk::astro::trajectory::state::coordinatessubsets::CartesianVelocity;
 using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::StateSink;
+using ostk::astro::trajectory::state::StateWriter;
 
 /* UNIT TESTS */
 class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator : public ::testing::Test
@@ -196,6 +207,9 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, EqualT
         };
         const Propagator propagator_1 = {numericalSolver_1, defaultDynamics_};
         EXPECT_FALSE(defaultPropagator_ == propagator_1);
+
+        const Propagator propagator_2 = {defaultNumericalSolver_, defaultDynamics_, Propagator::Formulation::Encke};
+        EXPECT_FALSE(defaultPropagator_ == propagator_2);
     }
 }
 
@@ -282,6 +296,46 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Access
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, GetNumericalSolver)
+{
+    {
+        EXPECT_EQ(defaultPropagator_.accessNumericalSolver(), defaultPropagator_.getNumericalSolver());
+    }
+
+    {
+        EXPECT_ANY_THROW(Propagator::Undefined().getNumericalSolver());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, GetObservedStatesAndDiagnostics)
+{
+    {
+        const State state = {
+            Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+            Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+        };
+
+        defaultPropagator_.calculateStateAt(state, state.accessInstant() + Duration::Minutes(10.0));
+
+        const Tuple<Array<State>, NumericalSolver::Diagnostics> observedStatesAndDiagnostics =
+            defaultPropagator_.getObservedStatesAndDiagnostics();
+
+        EXPECT_FALSE(std::get<0>(observedStatesAndDiagnostics).isEmpty());
+        EXPECT_EQ(
+            defaultPropagator_.accessNumericalSolver().accessObservedStates(), std::get<0>(observedStatesAndDiagnostics)
+        );
+        EXPECT_EQ(
+            defaultPropagator_.accessNumericalSolver().accessDiagnostics().acceptedStepCount,
+            std::get<1>(observedStatesAndDiagnostics).acceptedStepCount
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(Propagator::Undefined().getObservedStatesAndDiagnostics());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Getters)
 {
     {
@@ -291,6 +345,10 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Getter
     {
         EXPECT_TRUE(defaultPropagator_.getDynamics().getSize() == 2);
     }
+
+    {
+        EXPECT_EQ(defaultPropagator_.getFormulation(), Propagator::Formulation::Cowell);
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, SetDynamics)
@@ -793,6 +851,847 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Calcul
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Encke)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({42164000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 3070.0, 50.0}, gcrfSPtr_),
+    };
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(earthSpherical_),
+        std::make_shared<ThirdBodyGravity>(std::make_shared<Celestial>(Moon::Default())),
+    };
+
+    // The tolerances apply to the deviation from the reference orbit, and can be looser
+
+    const NumericalSolver enckeNumericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Propagator cowellPropagator = {defaultNumericalSolver_, dynamics};
+    const Propagator enckePropagator = {enckeNumericalSolver, dynamics, Propagator::Formulation::Encke};
+
+    // Central body gravity is required
+
+    {
+        const Propagator propagator = {
+            enckeNumericalSolver,
+            {std::make_shared<PositionDerivative>()},
+            Propagator::Formulation::Encke,
+        };
+
+        EXPECT_THROW(
+            propagator.calculateStateAt(state, state.accessInstant() + Duration::Hours(1.0)),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Calculate state at an instant, forward and backward, over several rectification checks
+
+    {
+        for (const Duration& duration : {Duration::Days(2.0), Duration::Days(-1.0)})
+        {
+            const Instant instant = state.accessInstant() + duration;
+
+            const State cowellState = cowellPropagator.calculateStateAt(state, instant);
+            const State enckeState = enckePropagator.calculateStateAt(state, instant);
+
+            EXPECT_EQ(enckeState.accessInstant(), instant);
+            EXPECT_LT(
+                (enckeState.getPosition().getCoordinates() - cowellState.getPosition().getCoordinates()).norm(), 1e-2
+            );
+            EXPECT_LT(
+                (enckeState.getVelocity().getCoordinates() - cowellState.getVelocity().getCoordinates()).norm(), 1e-6
+            );
+        }
+    }
+
+    // Calculate states at instants, on both sides of the initial state
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (int i = -12; i <= 36; i += 3)
+        {
+            instants.add(state.accessInstant() + Duration::Hours(i));
+        }
+
+        const Array<State> cowellStates = cowellPropagator.calculateStatesAt(state, instants);
+        const Array<State> enckeStates = enckePropagator.calculateStatesAt(state, instants);
+
+        ASSERT_EQ(enckeStates.getSize(), instants.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(enckeStates[i].accessInstant(), instants[i]);
+            EXPECT_LT(
+                (enckeStates[i].getPosition().getCoordinates() - cowellStates[i].getPosition().getCoordinates()).norm(),
+                1e-2
+            );
+        }
+    }
+
+    // Calculate state to a condition, after several rectification checks
+
+    {
+        const NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        const Propagator propagator = {numericalSolver, dynamics, Propagator::Formulation::Encke};
+
+        const InstantCondition condition = {
+            InstantCondition::Criterion::StrictlyPositive,
+            state.accessInstant() + Duration::Hours(30.0),
+        };
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            propagator.calculateStateToCondition(state, state.accessInstant() + Duration::Days(2.0), condition);
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_LT((conditionSolution.state.accessInstant() - condition.getInstant()).inSeconds(), 1e-7);
+
+        const State cowellState = cowellPropagator.calculateStateAt(state, conditionSolution.state.accessInstant());
+
+        EXPECT_LT(
+            (conditionSolution.state.getPosition().getCoordinates() - cowellState.getPosition().getCoordinates())
+                .norm(),
+            1e-2
+        );
+
+        const Array<State> observedStates = propagator.accessNumericalSolver().accessObservedStates();
+
+        EXPECT_EQ(observedStates.accessFirst().accessInstant(), state.accessInstant());
+        EXPECT_EQ(observedStates.accessLast().accessInstant(), conditionSolution.state.accessInstant());
+
+        for (Size i = 1; i < observedStates.getSize(); ++i)
+        {
+            EXPECT_TRUE(observedStates[i].accessInstant() > observedStates[i - 1].accessInstant());
+        }
+    }
+
+    // Observed states are full states, spanning the same propagation as with the Cowell formulation
+
+    {
+        const NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        const Propagator cowellConditionalPropagator = {numericalSolver, dynamics};
+        const Propagator enckeConditionalPropagator = {numericalSolver, dynamics, Propagator::Formulation::Encke};
+
+        const InstantCondition condition = {
+            InstantCondition::Criterion::StrictlyPositive,
+            state.accessInstant() + Duration::Hours(30.0),
+        };
+
+        const auto checkObservedStates = [&state, &cowellPropagator](
+                                             const Array<State>& anEnckeObservedStateArray,
+                                             const Array<State>& aCowellObservedStateArray
+                                         ) -> void
+        {
+            ASSERT_GT(anEnckeObservedStateArray.getSize(), 2);
+
+            EXPECT_EQ(anEnckeObservedStateArray.accessFirst().accessInstant(), state.accessInstant());
+            EXPECT_LT(
+                std::abs((anEnckeObservedStateArray.accessLast().accessInstant() -
+                          aCowellObservedStateArray.accessLast().accessInstant())
+                             .inSeconds()),
+                1e-7
+            );
+
+            for (Size i = 1; i < anEnckeObservedStateArray.getSize(); ++i)
+            {
+                EXPECT_TRUE(
+                    anEnckeObservedStateArray[i].accessInstant() > anEnckeObservedStateArray[i - 1].accessInstant()
+                );
+            }
+
+            const Array<Instant> observedInstants = anEnckeObservedStateArray.map<Instant>(
+                [](const State& aState) -> Instant
+                {
+                    return aState.accessInstant();
+                }
+            );
+
+            const Array<State> cowellStates = cowellPropagator.calculateStatesAt(state, observedInstants);
+
+            for (Size i = 0; i < anEnckeObservedStateArray.getSize(); ++i)
+            {
+                EXPECT_LT(
+                    (anEnckeObservedStateArray[i].getPosition().getCoordinates() -
+                     cowellStates[i].getPosition().getCoordinates())
+                        .norm(),
+                    1e-2
+                );
+            }
+        };
+
+        cowellConditionalPropagator.calculateStateToCondition(
+            state, state.accessInstant() + Duration::Days(2.0), condition
+        );
+        enckeConditionalPropagator.calculateStateToCondition(
+            state, state.accessInstant() + Duration::Days(2.0), condition
+        );
+
+        checkObservedStates(
+            enckeConditionalPropagator.getNumericalSolver().getObservedStates(),
+            cowellConditionalPropagator.getNumericalSolver().getObservedStates()
+        );
+
+        cowellConditionalPropagator.calculateStateAt(state, state.accessInstant() + Duration::Days(2.0));
+        enckeConditionalPropagator.calculateStateAt(state, state.accessInstant() + Duration::Days(2.0));
+
+        checkObservedStates(
+            enckeConditionalPropagator.getNumericalSolver().getObservedStates(),
+            cowellConditionalPropagator.getNumericalSolver().getObservedStates()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, KustaanheimoStiefel)
+{
+    // Highly eccentric orbit (e = 0.8, 300 km perigee altitude), starting at apogee
+
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({60102000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 1000.0, 570.0}, gcrfSPtr_),
+    };
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(earthSpherical_),
+        std::make_shared<ThirdBodyGravity>(std::make_shared<Celestial>(Moon::Default())),
+    };
+
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Propagator cowellPropagator = {numericalSolver, dynamics};
+    const Propagator kustaanheimoStiefelPropagator = {
+        numericalSolver, dynamics, Propagator::Formulation::KustaanheimoStiefel
+    };
+
+    // Central body gravity is required
+
+    {
+        const Propagator propagator = {
+            numericalSolver,
+            {std::make_shared<PositionDerivative>()},
+            Propagator::Formulation::KustaanheimoStiefel,
+        };
+
+        EXPECT_THROW(
+            propagator.calculateStateAt(state, state.accessInstant() + Duration::Hours(1.0)),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Calculate state at an instant, forward and backward, over several perigee passes
+
+    {
+        for (const Duration& duration : {Duration::Days(2.0), Duration::Days(-1.0)})
+        {
+            const Instant instant = state.accessInstant() + duration;
+
+            const State cowellState = cowellPropagator.calculateStateAt(state, instant);
+            const State kustaanheimoStiefelState = kustaanheimoStiefelPropagator.calculateStateAt(state, instant);
+
+            EXPECT_EQ(kustaanheimoStiefelState.accessInstant(), instant);
+            EXPECT_LT(
+                (kustaanheimoStiefelState.getPosition().getCoordinates() - cowellState.getPosition().getCoordinates())
+                    .norm(),
+                1e-1
+            );
+            EXPECT_LT(
+                (kustaanheimoStiefelState.getVelocity().getCoordinates() - cowellState.getVelocity().getCoordinates())
+                    .norm(),
+                1e-4
+            );
+        }
+    }
+
+    // Calculate states at instants, on both sides of the initial state
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (int i = -12; i <= 36; i += 3)
+        {
+            instants.add(state.accessInstant() + Duration::Hours(i));
+        }
+
+        const Array<State> cowellStates = cowellPropagator.calculateStatesAt(state, instants);
+        const Array<State> kustaanheimoStiefelStates = kustaanheimoStiefelPropagator.calculateStatesAt(state, instants);
+
+        ASSERT_EQ(kustaanheimoStiefelStates.getSize(), instants.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(kustaanheimoStiefelStates[i].accessInstant(), instants[i]);
+            EXPECT_LT(
+                (kustaanheimoStiefelStates[i].getPosition().getCoordinates() -
+                 cowellStates[i].getPosition().getCoordinates())
+                    .norm(),
+                1e-1
+            );
+        }
+    }
+
+    // Calculate state to a condition
+
+    {
+        const NumericalSolver conditionalNumericalSolver = NumericalSolver::Conditional(5.0, 1.0e-12, 1.0e-12, nullptr);
+
+        const Propagator cowellConditionalPropagator = {conditionalNumericalSolver, dynamics};
+        const Propagator propagator = {
+            conditionalNumericalSolver, dynamics, Propagator::Formulation::KustaanheimoStiefel
+        };
+
+        // Condition satisfied
+
+        {
+            const InstantCondition condition = {
+                InstantCondition::Criterion::StrictlyPositive,
+                state.accessInstant() + Duration::Hours(30.0),
+            };
+
+            const NumericalSolver::ConditionSolution conditionSolution =
+                propagator.calculateStateToCondition(state, state.accessInstant() + Duration::Days(2.0), condition);
+
+            EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+            EXPECT_LT(
+                std::abs((conditionSolution.state.accessInstant() - condition.getInstant()).inSeconds()), 1e-6
+            );
+
+            const State cowellState =
+                cowellPropagator.calculateStateAt(state, conditionSolution.state.accessInstant());
+
+            EXPECT_LT(
+                (conditionSolution.state.getPosition().getCoordinates() - cowellState.getPosition().getCoordinates())
+                    .norm(),
+                1e-1
+            );
+
+            const Array<State> observedStates = propagator.accessNumericalSolver().accessObservedStates();
+
+            EXPECT_EQ(observedStates.accessFirst().accessInstant(), state.accessInstant());
+            EXPECT_EQ(observedStates.accessLast().accessInstant(), conditionSolution.state.accessInstant());
+
+            for (Size i = 1; i < observedStates.getSize(); ++i)
+            {
+                EXPECT_TRUE(observedStates[i].accessInstant() > observedStates[i - 1].accessInstant());
+            }
+        }
+
+        // Condition not satisfied: the propagation stops at the end instant, with far fewer steps than Cowell
+
+        {
+            const Instant endInstant = state.accessInstant() + Duration::Days(2.0);
+
+            const InstantCondition condition = {
+                InstantCondition::Criterion::StrictlyPositive,
+                state.accessInstant() + Duration::Days(3.0),
+            };
+
+            const NumericalSolver::ConditionSolution conditionSolution =
+                propagator.calculateStateToCondition(state, endInstant, condition);
+            const NumericalSolver::ConditionSolution cowellConditionSolution =
+                cowellConditionalPropagator.calculateStateToCondition(state, endInstant, condition);
+
+            EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+            EXPECT_EQ(conditionSolution.state.accessInstant(), endInstant);
+            EXPECT_LT(
+                (conditionSolution.state.getPosition().getCoordinates() -
+                 cowellConditionSolution.state.getPosition().getCoordinates())
+                    .norm(),
+                1e-1
+            );
+
+            const Array<State> observedStates = propagator.accessNumericalSolver().accessObservedStates();
+            const Array<State> cowellObservedStates =
+                cowellConditionalPropagator.accessNumericalSolver().accessObservedStates();
+
+            EXPECT_EQ(observedStates.accessLast().accessInstant(), endInstant);
+            EXPECT_LT(2 * observedStates.getSize(), cowellObservedStates.getSize());
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, FidelitySchedule)
+{
+    /// Dynamics without contribution, recording the distances at which it is evaluated
+    class DistanceRecorder : public Dynamics
+    {
+       public:
+        DistanceRecorder()
+            : Dynamics("Distance Recorder")
+        {
+        }
+
+        virtual bool isDefined() const override
+        {
+            return true;
+        }
+
+        virtual Array<Shared<const CoordinatesSubset>> getReadCoordinatesSubsets() const override
+        {
+            return {CartesianPosition::Default()};
+        }
+
+        virtual Array<Shared<const CoordinatesSubset>> getWriteCoordinatesSubsets() const override
+        {
+            return {CartesianVelocity::Default()};
+        }
+
+        virtual VectorXd computeContribution(const Instant&, const VectorXd& x, const Shared<const Frame>&)
+            const override
+        {
+            ++evaluationCount;
+            minimumDistance = std::min(minimumDistance, x.norm());
+            maximumDistance = std::max(maximumDistance, x.norm());
+
+            return VectorXd::Zero(3);
+        }
+
+        mutable Size evaluationCount = 0;
+        mutable double minimumDistance = std::numeric_limits<double>::max();
+        mutable double maximumDistance = 0.0;
+    };
+
+    // Eccentric orbit, between distances of about 7000 km and 17200 km, crossing the 10000 km threshold twice per
+    // revolution
+
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 9000.0, 0.0}, gcrfSPtr_),
+    };
+
+    const Shared<DistanceRecorder> lowDistanceRecorderSPtr = std::make_shared<DistanceRecorder>();
+    const Shared<DistanceRecorder> highDistanceRecorderSPtr = std::make_shared<DistanceRecorder>();
+
+    const Shared<Dynamics> centralBodyGravitySPtr = std::make_shared<CentralBodyGravity>(earthSpherical_);
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<FidelitySchedule>(
+            earthSpherical_,
+            FidelitySchedule::Criterion::Distance,
+            Array<Length>({Length::Kilometers(10000.0)}),
+            Array<Array<Shared<Dynamics>>>({
+                {centralBodyGravitySPtr, lowDistanceRecorderSPtr},
+                {centralBodyGravitySPtr, highDistanceRecorderSPtr},
+            }),
+            Length::Kilometers(100.0)
+        ),
+    };
+
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Propagator propagator = {numericalSolver, dynamics};
+
+    // Both regimes model the same forces: restarting the integration at the switches keeps the accuracy
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (int i = 0; i <= 12; ++i)
+        {
+            instants.add(state.accessInstant() + Duration::Hours(i));
+        }
+
+        const Array<State> referenceStates = defaultPropagator_.calculateStatesAt(state, instants);
+        const Array<State> states = propagator.calculateStatesAt(state, instants);
+
+        ASSERT_EQ(states.getSize(), instants.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(states[i].accessInstant(), instants[i]);
+            EXPECT_LT(
+                (states[i].getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm(),
+                1.0
+            );
+        }
+
+        // Each regime is only evaluated around its range, up to the stages of the steps crossing a switch
+
+        EXPECT_GT(lowDistanceRecorderSPtr->evaluationCount, 0);
+        EXPECT_GT(highDistanceRecorderSPtr->evaluationCount, 0);
+        EXPECT_LT(lowDistanceRecorderSPtr->maximumDistance, 11000.0e3);
+        EXPECT_GT(highDistanceRecorderSPtr->minimumDistance, 9000.0e3);
+    }
+
+    // Calculate state to a condition, after several switches
+
+    {
+        const InstantCondition condition = {
+            InstantCondition::Criterion::StrictlyPositive,
+            state.accessInstant() + Duration::Hours(10.0),
+        };
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            propagator.calculateStateToCondition(state, state.accessInstant() + Duration::Days(1.0), condition);
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_LT((conditionSolution.state.accessInstant() - condition.getInstant()).inSeconds(), 1e-7);
+
+        const State referenceState =
+            defaultPropagator_.calculateStateAt(state, conditionSolution.state.accessInstant());
+
+        EXPECT_LT(
+            (conditionSolution.state.getPosition().getCoordinates() - referenceState.getPosition().getCoordinates())
+                .norm(),
+            1.0
+        );
+
+        const Array<State> observedStates = propagator.accessNumericalSolver().accessObservedStates();
+
+        EXPECT_EQ(observedStates.accessFirst().accessInstant(), state.accessInstant());
+        EXPECT_EQ(observedStates.accessLast().accessInstant(), conditionSolution.state.accessInstant());
+
+        for (Size i = 1; i < observedStates.getSize(); ++i)
+        {
+            EXPECT_TRUE(observedStates[i].accessInstant() > observedStates[i - 1].accessInstant());
+        }
+    }
+
+    // Fidelity schedules are only supported with the Cowell formulation
+
+    {
+        const Propagator enckePropagator = {numericalSolver, dynamics, Propagator::Formulation::Encke};
+
+        EXPECT_THROW(
+            enckePropagator.calculateStateAt(state, state.accessInstant() + Duration::Hours(1.0)),
+            ostk::core::error::runtime::ToBeImplemented
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, StringFromFormulation)
+{
+    {
+        EXPECT_EQ(Propagator::StringFromFormulation(Propagator::Formulation::Cowell), "Cowell");
+        EXPECT_EQ(Propagator::StringFromFormulation(Propagator::Formulation::Encke), "Encke");
+        EXPECT_EQ(
+            Propagator::StringFromFormulation(Propagator::Formulation::KustaanheimoStiefel), "KustaanheimoStiefel"
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Diagnostics)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(earthSpherical_),
+    };
+
+    const Instant endInstant = state.accessInstant() + Duration::Hours(1.0);
+
+    // Disabled by default
+
+    {
+        const Propagator propagator = {defaultNumericalSolver_, dynamics};
+
+        propagator.calculateStateAt(state, endInstant);
+
+        EXPECT_FALSE(propagator.accessNumericalSolver().isDiagnosticsEnabled());
+        EXPECT_EQ(0, propagator.accessNumericalSolver().accessDiagnostics().systemOfEquationsEvaluationCount);
+        EXPECT_TRUE(propagator.accessNumericalSolver().accessDiagnostics().dynamicsWallTimes.empty());
+    }
+
+    NumericalSolver numericalSolver = NumericalSolver::DefaultConditional();
+    numericalSolver.setDiagnosticsEnabled(true);
+
+    const auto validateDiagnostics = [&dynamics](const NumericalSolver::Diagnostics& aDiagnostics) -> void
+    {
+        Size histogramCount = 0;
+
+        for (const auto& bin : aDiagnostics.stepSizeHistogram)
+        {
+            histogramCount += bin.second;
+        }
+
+        EXPECT_GT(aDiagnostics.acceptedStepCount, 0);
+        EXPECT_GT(aDiagnostics.systemOfEquationsEvaluationCount, aDiagnostics.acceptedStepCount);
+        EXPECT_EQ(aDiagnostics.acceptedStepCount, histogramCount);
+
+        ASSERT_EQ(dynamics.getSize(), aDiagnostics.dynamicsWallTimes.size());
+
+        for (const Shared<Dynamics>& dynamicsSPtr : dynamics)
+        {
+            ASSERT_TRUE(aDiagnostics.dynamicsWallTimes.count(dynamicsSPtr->getName()) == 1);
+            EXPECT_TRUE(aDiagnostics.dynamicsWallTimes.at(dynamicsSPtr->getName()) > Duration::Zero());
+        }
+    };
+
+    for (const Propagator::Formulation& formulation :
+         {Propagator::Formulation::Cowell,
+          Propagator::Formulation::Encke,
+          Propagator::Formulation::KustaanheimoStiefel})
+    {
+        const Propagator propagator = {numericalSolver, dynamics, formulation};
+
+        // Diagnostics are reset at the start of each propagation
+
+        {
+            propagator.calculateStateAt(state, endInstant);
+
+            const NumericalSolver::Diagnostics diagnostics = propagator.accessNumericalSolver().getDiagnostics();
+
+            validateDiagnostics(diagnostics);
+
+            propagator.calculateStateAt(state, endInstant);
+
+            EXPECT_EQ(
+                diagnostics.systemOfEquationsEvaluationCount,
+                propagator.accessNumericalSolver().accessDiagnostics().systemOfEquationsEvaluationCount
+            );
+        }
+
+        {
+            propagator.calculateStatesAt(state, {state.accessInstant() - Duration::Minutes(30.0), endInstant});
+
+            validateDiagnostics(propagator.accessNumericalSolver().accessDiagnostics());
+        }
+
+        {
+            const InstantCondition condition = {
+                InstantCondition::Criterion::StrictlyPositive,
+                state.accessInstant() + Duration::Minutes(30.0),
+            };
+
+            const NumericalSolver::ConditionSolution conditionSolution =
+                propagator.calculateStateToCondition(state, endInstant, condition);
+
+            EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+
+            validateDiagnostics(propagator.accessNumericalSolver().accessDiagnostics());
+
+            EXPECT_GT(propagator.accessNumericalSolver().accessDiagnostics().rootSolverIterationCount, 0);
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, StateSink)
+{
+    // Record streamed states in memory
+
+    struct ArrayStateWriter : public StateWriter
+    {
+        Array<State> states;
+
+        void write(const State& aState) override
+        {
+            states.add(aState);
+        }
+
+        void flush() override {}
+    };
+
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(earthSpherical_),
+    };
+
+    const InstantCondition condition = {
+        InstantCondition::Criterion::StrictlyPositive,
+        state.accessInstant() + Duration::Minutes(30.0),
+    };
+
+    for (const Propagator::Formulation& formulation :
+         {Propagator::Formulation::Cowell,
+          Propagator::Formulation::Encke,
+          Propagator::Formulation::KustaanheimoStiefel})
+    {
+        const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+        const Shared<StateSink> stateSinkSPtr = std::make_shared<StateSink>(stateWriterSPtr);
+
+        NumericalSolver numericalSolver = NumericalSolver::DefaultConditional();
+        numericalSolver.setStateSink(stateSinkSPtr);
+        numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+        const Propagator propagator = {numericalSolver, dynamics, formulation};
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            propagator.calculateStateToCondition(state, state.accessInstant() + Duration::Hours(1.0), condition);
+
+        stateSinkSPtr->flush();
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_EQ(2, propagator.accessNumericalSolver().getObservedStates().getSize());
+        EXPECT_EQ(stateSinkSPtr, propagator.accessNumericalSolver().getStateSink());
+
+        // Streamed states are full states, whatever the formulation
+
+        const Array<State>& streamedStates = stateWriterSPtr->states;
+
+        ASSERT_GT(streamedStates.getSize(), 2);
+        EXPECT_EQ(state.accessInstant(), streamedStates.accessFirst().accessInstant());
+        EXPECT_EQ(conditionSolution.state.accessInstant(), streamedStates.accessLast().accessInstant());
+
+        for (const State& streamedState : streamedStates)
+        {
+            EXPECT_EQ(6, streamedState.accessCoordinates().size());
+            EXPECT_NEAR(7000000.0, streamedState.getPosition().getCoordinates().norm(), 10.0);
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, ConcurrentQueries)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Array<Instant> instants = {
+        state.accessInstant() - Duration::Minutes(20.0),
+        state.accessInstant() + Duration::Minutes(10.0),
+        state.accessInstant() + Duration::Minutes(45.0),
+        state.accessInstant() + Duration::Minutes(90.0),
+    };
+
+    const InstantCondition condition = {
+        InstantCondition::Criterion::StrictlyPositive,
+        state.accessInstant() + Duration::Minutes(30.0),
+    };
+
+    const Size threadCount = 4;
+    const Size queryCount = 3;
+
+    for (const Propagator::Formulation& formulation :
+         {Propagator::Formulation::Cowell,
+          Propagator::Formulation::Encke,
+          Propagator::Formulation::KustaanheimoStiefel})
+    {
+        NumericalSolver numericalSolver = NumericalSolver::DefaultConditional();
+        numericalSolver.setDiagnosticsEnabled(true);
+
+        const Propagator propagator = {numericalSolver, defaultDynamics_, formulation};
+
+        // Queries on a shared propagator from several threads yield the same states as sequential queries
+
+        const Array<State> expectedStates = propagator.calculateStatesAt(state, instants);
+        const State expectedState = propagator.calculateStateAt(state, instants.accessLast());
+        const State expectedConditionState =
+            propagator.calculateStateToCondition(state, instants.accessLast(), condition).state;
+
+        Array<Array<State>> statesArrays(threadCount * queryCount, Array<State>::Empty());
+        Array<State> states(threadCount * queryCount, State::Undefined());
+        Array<State> conditionStates(threadCount * queryCount, State::Undefined());
+
+        Array<std::thread> threads;
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]() -> void
+                {
+                    for (Size k = threadIndex * queryCount; k < (threadIndex + 1) * queryCount; ++k)
+                    {
+                        statesArrays[k] = propagator.calculateStatesAt(state, instants);
+                        states[k] = propagator.calculateStateAt(state, instants.accessLast());
+                        conditionStates[k] =
+                            propagator.calculateStateToCondition(state, instants.accessLast(), condition).state;
+                    }
+                }
+            );
+        }
+
+        // Copies of the numerical solver can be taken while the queries run
+
+        std::atomic<bool> queriesAreDone = {false};
+        std::atomic<Size> emptyObservedStatesCount = {0};
+
+        std::thread reader(
+            [&]() -> void
+            {
+                while (!queriesAreDone)
+                {
+                    if (propagator.getNumericalSolver().getObservedStates().isEmpty())
+                    {
+                        ++emptyObservedStatesCount;
+                    }
+                }
+            }
+        );
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        queriesAreDone = true;
+        reader.join();
+
+        EXPECT_EQ(Size(0), emptyObservedStatesCount.load());
+
+        for (Size k = 0; k < threadCount * queryCount; ++k)
+        {
+            EXPECT_EQ(expectedStates, statesArrays[k]);
+            EXPECT_EQ(expectedState, states[k]);
+            EXPECT_EQ(expectedConditionState, conditionStates[k]);
+        }
+
+        // Observed states and diagnostics are those of the last completed query, which is a condition query
+
+        EXPECT_EQ(
+            expectedConditionState.accessInstant(),
+            propagator.getNumericalSolver().getObservedStates().accessLast().accessInstant()
+        );
+        EXPECT_GT(propagator.getNumericalSolver().getDiagnostics().acceptedStepCount, 0);
+
+        // Copies do not share the numerical solver
+
+        const Propagator propagatorCopy = propagator;
+
+        EXPECT_EQ(propagator, propagatorCopy);
+        EXPECT_EQ(expectedState, propagatorCopy.calculateStateAt(state, instants.accessLast()));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Default)
 {
     {
@@ -14,6 +14,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/COECondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/ConstantThrust.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubsets/CartesianVelocity.hpp>
@@ -49,6 +50,7 @@ using ostk::astro::flight::system::SatelliteSystem;
 using ostk::astro::dynamics::Thruster;
 using ostk::astro::guidancelaw::ConstantThrust;
 using ostk::astro::trajectory::Segment;
+using ostk::astro::trajectory::Propagator;
 using ostk::astro::trajectory::LocalOrbitalFrameDirection;
 using ostk::astro::trajectory::LocalOrbitalFrameFactory;
 using ostk::astro::Dynamics;
@@ -486,6 +488,70 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_GetAll
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_GetAllDynamicsContributions_Cached)
+{
+    // Enough states to be split across several workers
+
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 1000; ++i)
+    {
+        states.add(State(
+            defaultState_.accessInstant() + Duration::Seconds(double(i)),
+            Position::Meters({7000000.0 + double(i), 0.0, 0.0}, Frame::GCRF()),
+            defaultState_.getVelocity()
+        ));
+    }
+
+    const Shared<const Frame> stateFrame = defaultState_.accessFrame();
+
+    {
+        const Segment::Solution referenceSolution =
+            Segment::Solution(defaultName_, defaultDynamics_, states, true, Segment::Type::Coast);
+        const Segment::Solution segmentSolution =
+            Segment::Solution(defaultName_, defaultDynamics_, states, true, Segment::Type::Coast);
+
+        const Map<Shared<Dynamics>, MatrixXd> contributions =
+            segmentSolution.getAllDynamicsContributions(stateFrame, 4);
+
+        for (const Shared<Dynamics>& dynamics : defaultDynamics_)
+        {
+            EXPECT_EQ(referenceSolution.getDynamicsContribution(dynamics, stateFrame), contributions.at(dynamics));
+        }
+
+        EXPECT_EQ(contributions, segmentSolution.getAllDynamicsContributions(stateFrame, 1));
+
+        // Served from the cache, and sliced to the requested coordinates subsets
+
+        EXPECT_EQ(
+            contributions.at(defaultDynamics_[1]),
+            segmentSolution.getDynamicsAccelerationContribution(defaultDynamics_[1], stateFrame)
+        );
+    }
+
+    {
+        Segment::Solution segmentSolution =
+            Segment::Solution(defaultName_, defaultDynamics_, states, true, Segment::Type::Coast);
+
+        EXPECT_EQ(
+            states.getSize(), segmentSolution.getAllDynamicsContributions(stateFrame).at(defaultDynamics_[0]).rows()
+        );
+
+        // Recomputed when the states have changed
+
+        segmentSolution.states.add(State(
+            states.accessLast().accessInstant() + Duration::Seconds(1.0),
+            states.accessLast().getPosition(),
+            states.accessLast().getVelocity()
+        ));
+
+        EXPECT_EQ(
+            states.getSize() + 1,
+            segmentSolution.getAllDynamicsContributions(stateFrame).at(defaultDynamics_[0]).rows()
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_Print)
 {
     {
@@ -581,6 +647,23 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, GetType)
     EXPECT_EQ(Segment::Type::Coast, defaultCoastSegment_.getType());
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, GetFormulation)
+{
+    EXPECT_EQ(Propagator::Formulation::Cowell, defaultCoastSegment_.getFormulation());
+
+    {
+        const Segment segment = Segment::Coast(
+            defaultName_,
+            defaultInstantCondition_,
+            defaultDynamics_,
+            defaultNumericalSolver_,
+            Propagator::Formulation::Encke
+        );
+
+        EXPECT_EQ(Propagator::Formulation::Encke, segment.getFormulation());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, AccessEventCondition)
 {
     EXPECT_TRUE(defaultCoastSegment_.accessEventCondition() == defaultInstantCondition_);
@@ -634,6 +717,135 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve)
         EXPECT_TRUE(solution.states.getSize() > 0);
         EXPECT_FALSE(solution.conditionIsSatisfied);
     }
+
+    {
+        const Segment segment = Segment::Coast(
+            defaultName_,
+            defaultInstantCondition_,
+            defaultDynamics_,
+            defaultNumericalSolver_,
+            Propagator::Formulation::Encke
+        );
+
+        const Segment::Solution solution = segment.solve(defaultState_);
+        const Segment::Solution cowellSolution = defaultCoastSegment_.solve(defaultState_);
+
+        EXPECT_TRUE(solution.conditionIsSatisfied);
+        EXPECT_LT(
+            (solution.states.accessLast().getInstant() - defaultInstantCondition_->getInstant()).inSeconds(), 1e-7
+        );
+        EXPECT_LT(
+            (solution.states.accessLast().getPosition().getCoordinates() -
+             cowellSolution.states.accessLast().getPosition().getCoordinates())
+                .norm(),
+            1e-3
+        );
+
+        for (Size i = 1; i < solution.states.getSize(); ++i)
+        {
+            EXPECT_TRUE(solution.states[i].accessInstant() > solution.states[i - 1].accessInstant());
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve_DenseOutput)
+{
+    {
+        const Segment::Solution solution = defaultCoastSegment_.solve(defaultState_);
+
+        EXPECT_TRUE(solution.denseOutputIsAvailable);
+
+        const Array<VectorXd> stateDerivatives = solution.getStateDerivatives();
+
+        ASSERT_EQ(solution.states.getSize(), stateDerivatives.getSize());
+
+        // Derivatives of the position are the velocities
+
+        for (Size i = 0; i < solution.states.getSize(); ++i)
+        {
+            EXPECT_TRUE(
+                stateDerivatives[i].head(3).isApprox(solution.states[i].getVelocity().getCoordinates(), 1e-12)
+            );
+        }
+
+        // Interpolated states match re-propagated states
+
+        Segment::Solution propagatedSolution = solution;
+        propagatedSolution.denseOutputIsAvailable = false;
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 0; i < 900; i += 7)
+        {
+            instants.add(defaultState_.accessInstant() + Duration::Seconds(double(i)));
+        }
+
+        const Array<State> interpolatedStates = solution.calculateStatesAt(instants, defaultNumericalSolver_);
+        const Array<State> propagatedStates =
+            propagatedSolution.calculateStatesAt(instants, defaultNumericalSolver_);
+
+        ASSERT_EQ(instants.getSize(), interpolatedStates.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], interpolatedStates[i].accessInstant());
+            EXPECT_LT(
+                (interpolatedStates[i].getPosition().getCoordinates() -
+                 propagatedStates[i].getPosition().getCoordinates())
+                    .norm(),
+                1e-2
+            );
+            EXPECT_LT(
+                (interpolatedStates[i].getVelocity().getCoordinates() -
+                 propagatedStates[i].getVelocity().getCoordinates())
+                    .norm(),
+                1e-5
+            );
+        }
+
+        EXPECT_EQ(solution.states.accessFirst(), interpolatedStates.accessFirst());
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultNumericalSolver_;
+        numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+        const Segment segment =
+            Segment::Coast(defaultName_, defaultInstantCondition_, defaultDynamics_, numericalSolver);
+
+        const Segment::Solution solution = segment.solve(defaultState_);
+
+        EXPECT_FALSE(solution.denseOutputIsAvailable);
+        EXPECT_TRUE(solution.getStateDerivatives().isEmpty());
+    }
+
+    // Thrust held over the steps is re-propagated
+
+    {
+        const Shared<Thruster> thrusterSPtr = std::make_shared<Thruster>(
+            SatelliteSystem::Default(),
+            constantThrustSPtr_,
+            "Thruster",
+            Thruster::GuidanceUpdatePolicy::StepStart()
+        );
+
+        const Segment segment = Segment::Maneuver(
+            defaultName_,
+            std::make_shared<InstantCondition>(
+                InstantCondition::Criterion::AnyCrossing,
+                initialStateWithMass_.accessInstant() + Duration::Minutes(5.0)
+            ),
+            thrusterSPtr,
+            defaultDynamics_,
+            defaultNumericalSolver_
+        );
+
+        const Segment::Solution solution = segment.solve(initialStateWithMass_);
+
+        EXPECT_TRUE(solution.conditionIsSatisfied);
+        EXPECT_FALSE(solution.denseOutputIsAvailable);
+        EXPECT_TRUE(solution.getStateDerivatives().isEmpty());
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Print)
@@ -25,10 +25,12 @@
 #include <Global.test.hpp>
 
 using ostk::core::ctnr::Array;
+using ostk::core::types::Integer;
 using ostk::core::types::Shared;
 using ostk::core::types::Size;
 using ostk::core::types::Index;
 using ostk::core::types::Real;
+using ostk::core::types::String;
 
 using ostk::math::geometry::d3::objects::Composite;
 using ostk::math::geometry::d3::objects::Cuboid;
@@ -537,6 +539,294 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SolveToCondition)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_CarryIntegratorState)
+{
+    NumericalSolver numericalSolver = defaultNumericalSolver_;
+    numericalSolver.setDiagnosticsEnabled(true);
+
+    const Segment coastSegment = Segment::Coast("Coast", defaultCondition_, defaultDynamics_, numericalSolver);
+
+    const Sequence sequence = {
+        {coastSegment},
+        numericalSolver,
+        defaultDynamics_,
+        defaultMaximumPropagationDuration_,
+    };
+
+    const Size repetitionCount = 3;
+
+    const Sequence::Solution solution = sequence.solve(defaultState_, repetitionCount);
+
+    ASSERT_TRUE(solution.executionIsComplete);
+    ASSERT_EQ(repetitionCount, solution.segmentSolutions.getSize());
+
+    // The first segment starts with the step size of the numerical solver, the following ones with the step size
+    // reached at the end of the previous segment, instead of growing it again
+
+    const Integer smallestStepSizeDecade = -3;
+
+    EXPECT_EQ(1, solution.segmentSolutions[0].diagnostics.stepSizeHistogram.count(smallestStepSizeDecade));
+
+    for (Size i = 1; i < repetitionCount; ++i)
+    {
+        const Segment::Solution& segmentSolution = solution.segmentSolutions[i];
+
+        EXPECT_EQ(0, segmentSolution.diagnostics.stepSizeHistogram.count(smallestStepSizeDecade));
+
+        // Solving the segment on its own from the same state costs more evaluations, for the same final state
+
+        const Segment::Solution standaloneSegmentSolution =
+            coastSegment.solve(solution.segmentSolutions[i - 1].states.accessLast());
+
+        EXPECT_LT(
+            segmentSolution.diagnostics.systemOfEquationsEvaluationCount,
+            standaloneSegmentSolution.diagnostics.systemOfEquationsEvaluationCount
+        );
+
+        EXPECT_NEAR(
+            0.0,
+            (segmentSolution.states.accessLast().getPosition().getCoordinates() -
+             standaloneSegmentSolution.states.accessLast().getPosition().getCoordinates())
+                .norm(),
+            1.0e-3
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_SegmentNumericalSolvers)
+{
+    const Shared<RealCondition> durationConditionSPtr = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::PositiveCrossing, Duration::Minutes(20.0))
+    );
+
+    const Segment firstSegment =
+        Segment::Coast("First", durationConditionSPtr, defaultDynamics_, defaultNumericalSolver_);
+
+    // Numerical solvers with the same integration settings as the first segment, differing in one setting only
+
+    NumericalSolver boundariesNumericalSolver = defaultNumericalSolver_;
+    boundariesNumericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+    NumericalSolver diagnosticsNumericalSolver = defaultNumericalSolver_;
+    diagnosticsNumericalSolver.setDiagnosticsEnabled(true);
+
+    const Array<NumericalSolver> numericalSolvers = {
+        NumericalSolver::AdamsBashforthMoulton(
+            defaultNumericalSolver_.getTimeStep(),
+            defaultNumericalSolver_.getRelativeTolerance(),
+            defaultNumericalSolver_.getAbsoluteTolerance()
+        ),
+        boundariesNumericalSolver,
+        diagnosticsNumericalSolver,
+    };
+
+    for (const NumericalSolver& numericalSolver : numericalSolvers)
+    {
+        const Segment secondSegment =
+            Segment::Coast("Second", durationConditionSPtr, defaultDynamics_, numericalSolver);
+
+        const Sequence sequence = {{firstSegment, secondSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+        const Sequence::Solution solution = sequence.solve(defaultState_);
+
+        ASSERT_TRUE(solution.executionIsComplete);
+        ASSERT_EQ(2, solution.segmentSolutions.getSize());
+
+        // The second segment is solved with its own numerical solver, from scratch, as if solved on its own
+
+        const Segment::Solution& segmentSolution = solution.segmentSolutions[1];
+        const Segment::Solution standaloneSegmentSolution =
+            secondSegment.solve(solution.segmentSolutions[0].states.accessLast());
+
+        EXPECT_EQ(standaloneSegmentSolution.states.getSize(), segmentSolution.states.getSize());
+        EXPECT_EQ(
+            standaloneSegmentSolution.diagnostics.systemOfEquationsEvaluationCount,
+            segmentSolution.diagnostics.systemOfEquationsEvaluationCount
+        );
+        EXPECT_NEAR(
+            0.0,
+            (segmentSolution.states.accessLast().getPosition().getCoordinates() -
+             standaloneSegmentSolution.states.accessLast().getPosition().getCoordinates())
+                .norm(),
+            1.0e-6
+        );
+    }
+
+    {
+        const Segment secondSegment =
+            Segment::Coast("Second", durationConditionSPtr, defaultDynamics_, boundariesNumericalSolver);
+
+        const Sequence sequence = {{firstSegment, secondSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+        EXPECT_EQ(2, sequence.solve(defaultState_).segmentSolutions[1].states.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_SolutionCache)
+{
+    const auto durationSegment = [this](const String& aName, const Duration& aDuration) -> Segment
+    {
+        return Segment::Coast(
+            aName,
+            std::make_shared<RealCondition>(
+                RealCondition::DurationCondition(RealCondition::Criterion::PositiveCrossing, aDuration)
+            ),
+            defaultDynamics_,
+            defaultNumericalSolver_
+        );
+    };
+
+    const Segment firstSegment = durationSegment("First", Duration::Minutes(20.0));
+    const Segment secondSegment = durationSegment("Second", Duration::Minutes(30.0));
+
+    Sequence::SolutionCache solutionCache;
+
+    EXPECT_EQ(0, solutionCache.getSize());
+    EXPECT_EQ(0, solutionCache.getReuseCount());
+
+    {
+        const Sequence sequence = {{firstSegment, secondSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+        const Sequence::Solution solution = sequence.solve(defaultState_, solutionCache);
+
+        EXPECT_TRUE(solution.executionIsComplete);
+        EXPECT_EQ(2, solutionCache.getSize());
+        EXPECT_EQ(0, solutionCache.getReuseCount());
+    }
+
+    // Editing the last segment re-solves it only, from the cached boundary state, with the same result as without
+    // cache
+
+    for (const Duration& duration : {Duration::Minutes(40.0), Duration::Minutes(25.0)})
+    {
+        const Sequence sequence = {
+            {firstSegment, durationSegment("Second", duration)},
+            defaultNumericalSolver_,
+            defaultDynamics_,
+        };
+
+        const Size reuseCount = solutionCache.getReuseCount();
+
+        const Sequence::Solution solution = sequence.solve(defaultState_, solutionCache);
+        const Sequence::Solution referenceSolution = sequence.solve(defaultState_);
+
+        EXPECT_EQ(reuseCount + 1, solutionCache.getReuseCount());
+        EXPECT_EQ(2, solutionCache.getSize());
+
+        ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+
+        for (Size i = 0; i < solution.segmentSolutions.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceSolution.segmentSolutions[i].name, solution.segmentSolutions[i].name);
+            EXPECT_EQ(referenceSolution.segmentSolutions[i].states, solution.segmentSolutions[i].states);
+        }
+    }
+
+    // Solving again without edits reuses all segment solutions
+
+    {
+        const Sequence sequence = {{firstSegment, secondSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+        const Size reuseCount = solutionCache.getReuseCount();
+
+        sequence.solve(defaultState_, solutionCache);
+
+        EXPECT_EQ(reuseCount + 1, solutionCache.getReuseCount());  // The last segment changed since the first solve
+
+        const Sequence::Solution solution = sequence.solve(defaultState_, solutionCache);
+
+        EXPECT_EQ(reuseCount + 3, solutionCache.getReuseCount());
+        EXPECT_EQ(solution.getStates(), sequence.solve(defaultState_).getStates());
+    }
+
+    // Editing the first segment, or the initial state, re-solves everything
+
+    {
+        const Sequence sequence = {
+            {durationSegment("First", Duration::Minutes(10.0)), secondSegment},
+            defaultNumericalSolver_,
+            defaultDynamics_,
+        };
+
+        const Size reuseCount = solutionCache.getReuseCount();
+
+        sequence.solve(defaultState_, solutionCache);
+
+        EXPECT_EQ(reuseCount, solutionCache.getReuseCount());
+
+        sequence.solve(
+            State(
+                defaultState_.accessInstant(),
+                Position::Meters({7000001.0, 0.0, 0.0}, Frame::GCRF()),
+                defaultState_.getVelocity()
+            ),
+            solutionCache
+        );
+
+        EXPECT_EQ(reuseCount, solutionCache.getReuseCount());
+    }
+
+    // Editing any setting of the numerical solver of a segment re-solves it, including the multistep method and the
+    // observation policy, which do not change the integration tolerances
+
+    {
+        NumericalSolver boundariesNumericalSolver = defaultNumericalSolver_;
+        boundariesNumericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+        const Array<NumericalSolver> numericalSolvers = {
+            NumericalSolver::AdamsBashforthMoulton(
+                defaultNumericalSolver_.getTimeStep(),
+                defaultNumericalSolver_.getRelativeTolerance(),
+                defaultNumericalSolver_.getAbsoluteTolerance()
+            ),
+            boundariesNumericalSolver,
+        };
+
+        for (const NumericalSolver& numericalSolver : numericalSolvers)
+        {
+            const Sequence sequence = {{firstSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+            sequence.solve(defaultState_, solutionCache);
+
+            const Sequence editedSequence = {
+                {Segment::Coast("First", firstSegment.accessEventCondition(), defaultDynamics_, numericalSolver)},
+                defaultNumericalSolver_,
+                defaultDynamics_,
+            };
+
+            const Size reuseCount = solutionCache.getReuseCount();
+
+            const Sequence::Solution solution = editedSequence.solve(defaultState_, solutionCache);
+
+            EXPECT_EQ(reuseCount, solutionCache.getReuseCount());
+            EXPECT_EQ(
+                editedSequence.solve(defaultState_).segmentSolutions[0].states, solution.segmentSolutions[0].states
+            );
+        }
+    }
+
+    // Repetitions are cached in order
+
+    {
+        const Sequence sequence = {{firstSegment}, defaultNumericalSolver_, defaultDynamics_};
+
+        solutionCache.clear();
+
+        EXPECT_EQ(0, solutionCache.getSize());
+        EXPECT_EQ(0, solutionCache.getReuseCount());
+
+        sequence.solve(defaultState_, solutionCache, 2);
+
+        EXPECT_EQ(2, solutionCache.getSize());
+
+        const Sequence::Solution solution = sequence.solve(defaultState_, solutionCache, 3);
+
+        EXPECT_EQ(2, solutionCache.getReuseCount());
+        EXPECT_EQ(3, solutionCache.getSize());
+        EXPECT_EQ(solution.getStates(), sequence.solve(defaultState_, 3).getStates());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_2)
 {
     // dynamics
@@ -5,14 +5,18 @@
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriter.hpp>
 
 #include <Global.test.hpp>
 
@@ -22,6 +26,7 @@ using ostk::core::types::Integer;
 using ostk::core::types::Real;
 using ostk::core::types::String;
 using ostk::core::types::Shared;
+using ostk::core::types::Size;
 
 using ostk::math::object::VectorXd;
 
@@ -31,10 +36,13 @@ using ostk::physics::time::DateTime;
 using ostk::physics::time::Scale;
 using ostk::physics::coord::Frame;
 
+using ostk::astro::RootSolver;
 using ostk::astro::trajectory::state::CoordinatesBroker;
 using ostk::astro::trajectory::state::CoordinatesSubset;
 using ostk::astro::eventcondition::RealCondition;
 using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::StateSink;
+using ostk::astro::trajectory::state::StateWriter;
 using ostk::astro::trajectory::State;
 
 // Simple duration based condition
@@ -73,6 +81,19 @@ struct XCrossingCondition : public RealCondition
     }
 };
 
+// Discarding state writer
+
+struct NullStateWriter : public StateWriter
+{
+    void write(const State &) override {}
+
+    void flush() override {}
+};
+
+void LogNothing(const State &) {}
+
+void LogNothingElse(const State &) {}
+
 class OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver : public ::testing::Test
 {
     void SetUp() override
@@ -179,6 +200,97 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Accessor
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, EqualToOperator)
+{
+    {
+        EXPECT_TRUE(defaultRKD5_ == defaultRKD5_);
+        EXPECT_FALSE(defaultRKD5_ == defaultRK54_);
+        EXPECT_FALSE(defaultRKD5_ != defaultRKD5_);
+        EXPECT_TRUE(defaultRKD5_ != defaultRK54_);
+    }
+
+    // Same integration settings, different multistep method
+
+    {
+        const NumericalSolver rungeKuttaSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+        const NumericalSolver adamsBashforthMoultonSolver =
+            NumericalSolver::AdamsBashforthMoulton(1e-3, 1.0e-12, 1.0e-12);
+
+        EXPECT_TRUE(adamsBashforthMoultonSolver == NumericalSolver::AdamsBashforthMoulton(1e-3, 1.0e-12, 1.0e-12));
+        EXPECT_FALSE(rungeKuttaSolver == adamsBashforthMoultonSolver);
+        EXPECT_FALSE(
+            adamsBashforthMoultonSolver == NumericalSolver::AdamsBashforthMoulton(1e-3, 1.0e-12, 1.0e-12, 6)
+        );
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRKD5_;
+        numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+        EXPECT_FALSE(numericalSolver == defaultRKD5_);
+    }
+
+    {
+        const Shared<StateSink> stateSinkSPtr = std::make_shared<StateSink>(std::make_shared<NullStateWriter>());
+
+        NumericalSolver numericalSolver = defaultRKD5_;
+        numericalSolver.setStateSink(stateSinkSPtr);
+
+        EXPECT_FALSE(numericalSolver == defaultRKD5_);
+
+        NumericalSolver otherNumericalSolver = defaultRKD5_;
+        otherNumericalSolver.setStateSink(stateSinkSPtr);
+
+        EXPECT_TRUE(numericalSolver == otherNumericalSolver);
+
+        otherNumericalSolver.setStateSink(std::make_shared<StateSink>(std::make_shared<NullStateWriter>()));
+
+        EXPECT_FALSE(numericalSolver == otherNumericalSolver);
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRKD5_;
+        numericalSolver.setDiagnosticsEnabled(true);
+
+        EXPECT_FALSE(numericalSolver == defaultRKD5_);
+    }
+
+    {
+        const NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            1e-3,
+            1.0e-15,
+            1.0e-15,
+            RootSolver(10, 1e-6),
+        };
+
+        EXPECT_FALSE(numericalSolver == defaultRKD5_);
+    }
+
+    // State loggers are compared by function pointer, other callables are never equal
+
+    {
+        const NumericalSolver numericalSolver = NumericalSolver::Conditional(5.0, 1e-12, 1e-12, LogNothing);
+
+        EXPECT_TRUE(numericalSolver == NumericalSolver::Conditional(5.0, 1e-12, 1e-12, LogNothing));
+        EXPECT_FALSE(numericalSolver == NumericalSolver::Conditional(5.0, 1e-12, 1e-12, LogNothingElse));
+        EXPECT_FALSE(numericalSolver == NumericalSolver::Conditional(5.0, 1e-12, 1e-12, nullptr));
+
+        const std::function<void(const State &)> stateLogger = [](const State &) -> void {};
+
+        const NumericalSolver lambdaNumericalSolver = NumericalSolver::Conditional(5.0, 1e-12, 1e-12, stateLogger);
+
+        EXPECT_FALSE(lambdaNumericalSolver == lambdaNumericalSolver);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime)
 {
     const Array<Instant> endInstants = {
@@ -438,3 +550,492 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Conditio
         EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, AdamsBashforthMoulton)
+{
+    {
+        EXPECT_FALSE(defaultRKD5_.isMultistep());
+        EXPECT_EQ(NumericalSolver::MultistepType::Undefined, defaultRKD5_.getMultistepType());
+        EXPECT_THROW(defaultRKD5_.getMaximumOrder(), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        EXPECT_THROW(NumericalSolver::AdamsBashforthMoulton(1e-3, 1e-12, 1e-12, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            NumericalSolver::AdamsBashforthMoulton(1e-3, 1e-12, 1e-12, 13), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    NumericalSolver numericalSolver = NumericalSolver::AdamsBashforthMoulton(1e-3, 1e-12, 1e-12);
+
+    {
+        EXPECT_TRUE(numericalSolver.isDefined());
+        EXPECT_TRUE(numericalSolver.isMultistep());
+        EXPECT_EQ(NumericalSolver::MultistepType::AdamsBashforthMoulton, numericalSolver.getMultistepType());
+        EXPECT_EQ(12, numericalSolver.getMaximumOrder());
+    }
+
+    {
+        for (const Instant &endInstant :
+             {defaultState_.accessInstant() + defaultDuration_, defaultState_.accessInstant() - defaultDuration_})
+        {
+            const State propagatedState = numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_);
+
+            EXPECT_EQ(endInstant, propagatedState.accessInstant());
+            EXPECT_FALSE(numericalSolver.getObservedStates().isEmpty());
+            EXPECT_EQ(endInstant, numericalSolver.getObservedStates().accessLast().accessInstant());
+
+            validatePropagatedStates({endInstant}, {propagatedState}, 2e-8);
+        }
+    }
+
+    {
+        const Array<Instant> instants = {
+            defaultState_.accessInstant(),
+            defaultState_.accessInstant() + Duration::Seconds(100.0),
+            defaultState_.accessInstant() + Duration::Seconds(400.0),
+            defaultState_.accessInstant() + Duration::Seconds(1000.0),
+        };
+
+        const Array<State> propagatedStates = numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+        validatePropagatedStates(instants, propagatedStates, 2e-8);
+
+        EXPECT_THROW(
+            numericalSolver.integrateTime(
+                defaultState_,
+                {defaultState_.accessInstant() + Duration::Seconds(100.0), defaultState_.accessInstant()},
+                systemOfEquations_
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        for (const Duration &duration : {defaultDuration_, -defaultDuration_})
+        {
+            const Instant endInstant = defaultStartInstant_ + duration;
+            const Instant targetInstant = defaultStartInstant_ + duration / 2.0;
+
+            const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+                defaultState_,
+                endInstant,
+                systemOfEquations_,
+                InstantCondition(targetInstant, RealCondition::Criterion::AnyCrossing)
+            );
+
+            const NumericalSolver::StateVector propagatedStateVector = conditionSolution.state.accessCoordinates();
+            const Real propagatedTime = (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+            EXPECT_LT(std::abs((conditionSolution.state.accessInstant() - targetInstant).inSeconds()), 1e-6);
+            EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+            EXPECT_TRUE(conditionSolution.rootSolverHasConverged);
+
+            EXPECT_NEAR(propagatedStateVector[0], std::sin(propagatedTime), 1e-9);
+            EXPECT_NEAR(propagatedStateVector[1], std::cos(propagatedTime), 1e-9);
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Diagnostics)
+{
+    const auto histogramCount = [](const NumericalSolver::Diagnostics &aDiagnostics) -> Size
+    {
+        Size count = 0;
+
+        for (const auto &bin : aDiagnostics.stepSizeHistogram)
+        {
+            count += bin.second;
+        }
+
+        return count;
+    };
+
+    const Instant endInstant = defaultState_.accessInstant() + defaultDuration_;
+
+    {
+        EXPECT_FALSE(defaultRK54_.isDiagnosticsEnabled());
+
+        defaultRK54_.integrateTime(defaultState_, endInstant, systemOfEquations_);
+
+        EXPECT_EQ(0, defaultRK54_.accessDiagnostics().systemOfEquationsEvaluationCount);
+        EXPECT_EQ(0, defaultRK54_.accessDiagnostics().acceptedStepCount);
+        EXPECT_TRUE(defaultRK54_.accessDiagnostics().stepSizeHistogram.empty());
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRK54_;
+        numericalSolver.setDiagnosticsEnabled(true);
+
+        EXPECT_TRUE(numericalSolver.isDiagnosticsEnabled());
+
+        const State propagatedState = numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_);
+
+        validatePropagatedStates({endInstant}, {propagatedState}, 2e-8);
+
+        EXPECT_EQ(endInstant, numericalSolver.getObservedStates().accessLast().accessInstant());
+
+        const NumericalSolver::Diagnostics diagnostics = numericalSolver.getDiagnostics();
+
+        EXPECT_GT(diagnostics.acceptedStepCount, 0);
+        EXPECT_EQ(diagnostics.acceptedStepCount, histogramCount(diagnostics));
+        EXPECT_GE(diagnostics.systemOfEquationsEvaluationCount, 6 * diagnostics.acceptedStepCount);
+        EXPECT_EQ(diagnostics.acceptedStepCount + 1, numericalSolver.getObservedStates().getSize());
+
+        // Diagnostics accumulate until reset
+
+        const Array<Instant> instants = {endInstant, endInstant + defaultDuration_};
+
+        validatePropagatedStates(
+            instants, numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_), 2e-8
+        );
+
+        EXPECT_GT(numericalSolver.accessDiagnostics().acceptedStepCount, diagnostics.acceptedStepCount);
+
+        numericalSolver.resetDiagnostics();
+
+        EXPECT_EQ(0, numericalSolver.accessDiagnostics().systemOfEquationsEvaluationCount);
+        EXPECT_EQ(0, numericalSolver.accessDiagnostics().acceptedStepCount);
+    }
+
+    {
+        for (NumericalSolver numericalSolver :
+             {defaultRKD5_, NumericalSolver::AdamsBashforthMoulton(1e-3, 1e-12, 1e-12)})
+        {
+            numericalSolver.setDiagnosticsEnabled(true);
+
+            const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+                defaultState_,
+                endInstant,
+                systemOfEquations_,
+                InstantCondition(defaultStartInstant_ + defaultDuration_ / 2.0, RealCondition::Criterion::AnyCrossing)
+            );
+
+            const NumericalSolver::Diagnostics &diagnostics = numericalSolver.accessDiagnostics();
+
+            EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+            EXPECT_GT(diagnostics.systemOfEquationsEvaluationCount, diagnostics.acceptedStepCount);
+            EXPECT_EQ(diagnostics.acceptedStepCount, histogramCount(diagnostics));
+            EXPECT_EQ(conditionSolution.iterationCount, diagnostics.rootSolverIterationCount);
+        }
+    }
+
+    // Rejected steps are recorded as the dense output stepper rejects them
+
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            100.0,
+            1.0e-15,
+            1.0e-15,
+        };
+        numericalSolver.setDiagnosticsEnabled(true);
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            defaultState_,
+            endInstant,
+            systemOfEquations_,
+            InstantCondition(defaultStartInstant_ + defaultDuration_ / 2.0, RealCondition::Criterion::AnyCrossing)
+        );
+
+        const NumericalSolver::Diagnostics &diagnostics = numericalSolver.accessDiagnostics();
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_GT(diagnostics.rejectedStepCount, 0);
+
+        // The system of equations is evaluated once at initialization, then 6 times per attempted step
+
+        EXPECT_EQ(
+            diagnostics.systemOfEquationsEvaluationCount,
+            1 + 6 * (diagnostics.acceptedStepCount + diagnostics.rejectedStepCount)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, ObservationPolicy)
+{
+    {
+        EXPECT_EQ(NumericalSolver::ObservationPolicy::All(), defaultRK54_.getObservationPolicy());
+
+        EXPECT_THROW(NumericalSolver::ObservationPolicy::EveryNthStep(0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(NumericalSolver::ObservationPolicy::RingBuffer(0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            NumericalSolver::ObservationPolicy::FixedSpacing(Duration::Zero()), ostk::core::error::runtime::Wrong
+        );
+
+        EXPECT_EQ(
+            "EveryNthStep",
+            NumericalSolver::ObservationPolicy::StringFromType(NumericalSolver::ObservationPolicy::Type::EveryNthStep)
+        );
+    }
+
+    const Instant endInstant = defaultState_.accessInstant() + Duration::Seconds(100.0);
+
+    NumericalSolver numericalSolver = defaultRK54_;
+
+    const State referenceState = numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_);
+    const Array<State> referenceObservedStates = numericalSolver.getObservedStates();
+
+    ASSERT_GT(referenceObservedStates.getSize(), 20);
+
+    const auto integrate = [&](const NumericalSolver::ObservationPolicy &anObservationPolicy) -> Array<State>
+    {
+        numericalSolver.setObservationPolicy(anObservationPolicy);
+
+        EXPECT_EQ(anObservationPolicy, numericalSolver.getObservationPolicy());
+        EXPECT_TRUE(numericalSolver.getObservedStates().isEmpty());
+
+        const State propagatedState = numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_);
+
+        EXPECT_EQ(endInstant, propagatedState.accessInstant());
+        EXPECT_TRUE(propagatedState.accessCoordinates().isApprox(referenceState.accessCoordinates(), 1e-12));
+
+        return numericalSolver.getObservedStates();
+    };
+
+    {
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::All());
+
+        EXPECT_EQ(referenceObservedStates.getSize(), observedStates.getSize());
+    }
+
+    {
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::None());
+
+        EXPECT_TRUE(observedStates.isEmpty());
+    }
+
+    {
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::Boundaries());
+
+        ASSERT_EQ(2, observedStates.getSize());
+        EXPECT_EQ(defaultStartInstant_, observedStates.accessFirst().accessInstant());
+        EXPECT_EQ(endInstant, observedStates.accessLast().accessInstant());
+    }
+
+    {
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::EveryNthStep(10));
+
+        EXPECT_LE(observedStates.getSize(), referenceObservedStates.getSize() / 10 + 2);
+        EXPECT_GE(observedStates.getSize(), referenceObservedStates.getSize() / 10);
+        EXPECT_EQ(defaultStartInstant_, observedStates.accessFirst().accessInstant());
+        EXPECT_EQ(endInstant, observedStates.accessLast().accessInstant());
+    }
+
+    {
+        const Duration spacing = Duration::Seconds(10.0);
+
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::FixedSpacing(spacing));
+
+        EXPECT_EQ(defaultStartInstant_, observedStates.accessFirst().accessInstant());
+        EXPECT_EQ(endInstant, observedStates.accessLast().accessInstant());
+
+        for (Size i = 1; i + 1 < observedStates.getSize(); ++i)
+        {
+            EXPECT_GE(observedStates[i].accessInstant() - observedStates[i - 1].accessInstant(), spacing);
+        }
+    }
+
+    {
+        const Array<State> observedStates = integrate(NumericalSolver::ObservationPolicy::RingBuffer(5));
+
+        ASSERT_EQ(5, observedStates.getSize());
+        EXPECT_EQ(endInstant, observedStates.accessLast().accessInstant());
+
+        for (Size i = 1; i < observedStates.getSize(); ++i)
+        {
+            EXPECT_GT(observedStates[i].accessInstant(), observedStates[i - 1].accessInstant());
+        }
+    }
+
+    {
+        numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::EveryNthStep(10));
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            defaultState_,
+            endInstant,
+            systemOfEquations_,
+            InstantCondition(defaultStartInstant_ + Duration::Seconds(50.0), RealCondition::Criterion::AnyCrossing)
+        );
+
+        const Array<State> observedStates = numericalSolver.getObservedStates();
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_LT(observedStates.getSize(), referenceObservedStates.getSize() / 2);
+        EXPECT_EQ(defaultStartInstant_, observedStates.accessFirst().accessInstant());
+        EXPECT_EQ(conditionSolution.state.accessInstant(), observedStates.accessLast().accessInstant());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Resume)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    EXPECT_THROW(numericalSolver.setTimeStep(Real::Undefined()), ostk::core::error::runtime::Undefined);
+
+    // Observed states are converted, integrated states are not
+
+    numericalSolver.setStateConverter(
+        [](const State &aState) -> State
+        {
+            return {
+                aState.accessInstant(),
+                2.0 * aState.accessCoordinates(),
+                aState.accessFrame(),
+                aState.accessCoordinatesBroker(),
+            };
+        }
+    );
+
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant arcEndInstant = defaultStartInstant_ + Duration::Seconds(4.0);
+
+    const NumericalSolver::ConditionSolution arcSolution = numericalSolver.integrateTime(
+        state,
+        arcEndInstant,
+        systemOfEquations_,
+        InstantCondition(defaultStartInstant_ + Duration::Seconds(50.0), RealCondition::Criterion::AnyCrossing)
+    );
+
+    const Array<State> arcObservedStates = numericalSolver.getObservedStates();
+
+    EXPECT_FALSE(arcSolution.conditionIsSatisfied);
+    EXPECT_EQ(arcEndInstant, arcSolution.state.accessInstant());
+    EXPECT_NEAR(arcSolution.state.accessCoordinates()[0], std::sin(4.0), 1e-9);
+
+    ASSERT_GT(arcObservedStates.getSize(), 2);
+    EXPECT_EQ(arcEndInstant, arcObservedStates.accessLast().accessInstant());
+    EXPECT_TRUE(arcObservedStates.accessFirst().accessCoordinates().isApprox(2.0 * state.accessCoordinates(), 1e-12));
+    EXPECT_TRUE(
+        arcObservedStates.accessLast().accessCoordinates().isApprox(2.0 * arcSolution.state.accessCoordinates(), 1e-12)
+    );
+
+    // The condition is crossed during the first step of the next integration
+
+    const Instant targetInstant = arcEndInstant + Duration::Microseconds(100.0);
+    const InstantCondition condition = {targetInstant, RealCondition::Criterion::AnyCrossing};
+
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    {
+        NumericalSolver restartedNumericalSolver = numericalSolver;
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            restartedNumericalSolver.integrateTime(arcSolution.state, endInstant, systemOfEquations_, condition);
+
+        EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+        EXPECT_EQ(arcEndInstant, restartedNumericalSolver.getObservedStates().accessFirst().accessInstant());
+    }
+
+    numericalSolver.resume(arcSolution.nextTimeStep);
+
+    const NumericalSolver::ConditionSolution conditionSolution =
+        numericalSolver.integrateTime(arcSolution.state, endInstant, systemOfEquations_, condition);
+
+    const Real propagatedTime = (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+    EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+    EXPECT_LT(std::abs((conditionSolution.state.accessInstant() - targetInstant).inSeconds()), 1e-6);
+    EXPECT_NEAR(conditionSolution.state.accessCoordinates()[0], std::sin(propagatedTime), 1e-9);
+
+    // The observed states of both integrations are kept, without repeating the end of the first one
+
+    const Array<State> observedStates = numericalSolver.getObservedStates();
+
+    ASSERT_EQ(arcObservedStates.getSize() + 1, observedStates.getSize());
+    EXPECT_EQ(defaultStartInstant_, observedStates.accessFirst().accessInstant());
+    EXPECT_EQ(conditionSolution.state.accessInstant(), observedStates.accessLast().accessInstant());
+    EXPECT_TRUE(observedStates.accessLast().accessCoordinates().isApprox(
+        2.0 * conditionSolution.state.accessCoordinates(), 1e-12
+    ));
+
+    for (Size i = 1; i < observedStates.getSize(); ++i)
+    {
+        EXPECT_GT(observedStates[i].accessInstant(), observedStates[i - 1].accessInstant());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, GetNextTimeStep)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant arcEndInstant = defaultStartInstant_ + Duration::Seconds(4.0);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        EXPECT_FALSE(numericalSolver.getNextTimeStep().isDefined());
+
+        const State arcEndState = numericalSolver.integrateTime(state, arcEndInstant, systemOfEquations_);
+
+        // The step size grows from the initial time step, and is carried over to the next arc
+
+        const Real nextTimeStep = numericalSolver.getNextTimeStep();
+
+        ASSERT_TRUE(nextTimeStep.isDefined());
+        EXPECT_GT(nextTimeStep, 1e-3);
+
+        const Size arcObservedStateCount = numericalSolver.getObservedStates().getSize();
+
+        numericalSolver.resume(nextTimeStep);
+
+        const State endState = numericalSolver.integrateTime(arcEndState, endInstant, systemOfEquations_);
+
+        EXPECT_EQ(endInstant, endState.accessInstant());
+        EXPECT_NEAR(endState.accessCoordinates()[0], std::sin(defaultDuration_.inSeconds()), 1e-9);
+
+        // The second arc does not restart from the initial time step
+
+        NumericalSolver restartedNumericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        restartedNumericalSolver.integrateTime(arcEndState, endInstant, systemOfEquations_);
+
+        EXPECT_LT(
+            numericalSolver.getObservedStates().getSize() - arcObservedStateCount,
+            restartedNumericalSolver.getObservedStates().getSize() - 1
+        );
+    }
+
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaDopri5,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        numericalSolver.integrateTime(state, Array<Instant>({arcEndInstant, endInstant}), systemOfEquations_);
+
+        ASSERT_TRUE(numericalSolver.getNextTimeStep().isDefined());
+        EXPECT_GT(numericalSolver.getNextTimeStep(), 1e-3);
+    }
+
+    {
+        NumericalSolver numericalSolver =
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-2);
+
+        numericalSolver.integrateTime(state, arcEndInstant, systemOfEquations_);
+
+        EXPECT_FALSE(numericalSolver.getNextTimeStep().isDefined());
+    }
+}
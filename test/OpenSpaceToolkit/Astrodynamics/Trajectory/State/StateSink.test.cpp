@@ -0,0 +1,356 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinatesSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateSink.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::ctnr::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::types::Shared;
+using ostk::core::types::Size;
+using ostk::core::types::String;
+
+using ostk::math::object::VectorXd;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::CoordinatesBroker;
+using ostk::astro::trajectory::state::CoordinatesSubset;
+using ostk::astro::trajectory::state::NumericalSolver;
+using ostk::astro::trajectory::state::StateSink;
+using ostk::astro::trajectory::state::StateWriter;
+
+// Record written states in memory
+
+struct ArrayStateWriter : public StateWriter
+{
+    Array<State> states;
+    Size flushCount = 0;
+    bool isFailing = false;
+
+    void write(const State& aState) override
+    {
+        if (isFailing)
+        {
+            throw ostk::core::error::RuntimeError("Cannot write.");
+        }
+
+        states.add(aState);
+    }
+
+    void flush() override
+    {
+        ++flushCount;
+    }
+};
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink : public ::testing::Test
+{
+   protected:
+    const Shared<const CoordinatesBroker> coordinatesBrokerSPtr_ =
+        std::make_shared<CoordinatesBroker>(CoordinatesBroker({std::make_shared<CoordinatesSubset>("Test", 2)}));
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    State stateAt(const Size& anIndex) const
+    {
+        VectorXd coordinates(2);
+        coordinates << double(anIndex), 0.0;
+
+        return {
+            startInstant_ + Duration::Seconds(double(anIndex)),
+            coordinates,
+            Frame::GCRF(),
+            coordinatesBrokerSPtr_,
+        };
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, Constructor)
+{
+    {
+        EXPECT_NO_THROW(StateSink(std::make_shared<ArrayStateWriter>()));
+    }
+
+    {
+        EXPECT_THROW(StateSink(nullptr), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(StateSink(std::make_shared<ArrayStateWriter>(), 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(StateSink(std::make_shared<ArrayStateWriter>(), 16, 0), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        const StateSink stateSink = {std::make_shared<ArrayStateWriter>(), 100, 3};
+
+        EXPECT_TRUE(stateSink.isOpen());
+        EXPECT_EQ(128, stateSink.getQueueCapacity());
+        EXPECT_EQ(3, stateSink.getStepInterval());
+        EXPECT_EQ(0, stateSink.getPushedStateCount());
+        EXPECT_EQ(0, stateSink.getWrittenStateCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, Push)
+{
+    {
+        const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+
+        StateSink stateSink = {stateWriterSPtr, 4};
+
+        for (Size i = 0; i < 1000; ++i)
+        {
+            stateSink.push(this->stateAt(i));
+        }
+
+        stateSink.flush();
+
+        EXPECT_EQ(1000, stateSink.getPushedStateCount());
+        EXPECT_EQ(1000, stateSink.getWrittenStateCount());
+        EXPECT_EQ(1, stateWriterSPtr->flushCount);
+
+        ASSERT_EQ(1000, stateWriterSPtr->states.getSize());
+
+        for (Size i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(this->stateAt(i), stateWriterSPtr->states[i]);
+        }
+
+        stateSink.close();
+
+        EXPECT_FALSE(stateSink.isOpen());
+        EXPECT_THROW(stateSink.push(this->stateAt(0)), ostk::core::error::RuntimeError);
+        EXPECT_NO_THROW(stateSink.close());
+    }
+
+    // Decimation
+
+    {
+        const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+
+        {
+            StateSink stateSink = {stateWriterSPtr, 1024, 10};
+
+            for (Size i = 0; i < 95; ++i)
+            {
+                stateSink.push(this->stateAt(i));
+            }
+        }
+
+        ASSERT_EQ(10, stateWriterSPtr->states.getSize());
+        EXPECT_EQ(this->stateAt(90), stateWriterSPtr->states.accessLast());
+    }
+
+    // Several pushing threads
+
+    {
+        const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+
+        StateSink stateSink = {stateWriterSPtr, 8};
+
+        Array<std::thread> threads;
+
+        for (Size t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(
+                [this, &stateSink, t]() -> void
+                {
+                    for (Size i = 0; i < 500; ++i)
+                    {
+                        stateSink.push(this->stateAt((t * 1000) + i));
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        stateSink.flush();
+
+        EXPECT_EQ(2000, stateWriterSPtr->states.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, ConcurrentPushAndClose)
+{
+    // Pushes racing with close are either written or rejected
+
+    {
+        const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+
+        StateSink stateSink = {stateWriterSPtr, 8};
+
+        std::atomic<Size> acceptedStateCount = {0};
+
+        Array<std::thread> threads;
+
+        for (Size t = 0; t < 4; ++t)
+        {
+            threads.emplace_back(
+                [this, &stateSink, &acceptedStateCount, t]() -> void
+                {
+                    for (Size i = 0; i < 100000; ++i)
+                    {
+                        try
+                        {
+                            stateSink.push(this->stateAt((t * 100000) + i));
+                        }
+                        catch (const ostk::core::error::RuntimeError&)
+                        {
+                            return;
+                        }
+
+                        ++acceptedStateCount;
+                    }
+                }
+            );
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        stateSink.close();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(acceptedStateCount.load(), stateWriterSPtr->states.getSize());
+        EXPECT_EQ(acceptedStateCount.load(), stateSink.getWrittenStateCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, WriterError)
+{
+    const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+    stateWriterSPtr->isFailing = true;
+
+    StateSink stateSink = {stateWriterSPtr, 4};
+
+    for (Size i = 0; i < 100; ++i)
+    {
+        EXPECT_NO_THROW(stateSink.push(this->stateAt(i)));
+    }
+
+    EXPECT_THROW(stateSink.flush(), ostk::core::error::RuntimeError);
+    EXPECT_THROW(stateSink.close(), ostk::core::error::RuntimeError);
+
+    EXPECT_EQ(0, stateSink.getWrittenStateCount());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, Files)
+{
+    const File csvFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_StateSink.csv"));
+    const File binaryFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_StateSink.bin"));
+
+    for (const Shared<StateSink>& stateSinkSPtr : {StateSink::CSV(csvFile, 2), StateSink::Binary(binaryFile, 2)})
+    {
+        EXPECT_EQ(2, stateSinkSPtr->getStepInterval());
+
+        for (Size i = 0; i < 10; ++i)
+        {
+            stateSinkSPtr->push(this->stateAt(i));
+        }
+
+        stateSinkSPtr->close();
+
+        EXPECT_EQ(5, stateSinkSPtr->getWrittenStateCount());
+    }
+
+    EXPECT_TRUE(csvFile.exists());
+    EXPECT_TRUE(binaryFile.exists());
+
+    const String csvContents = csvFile.getContents();
+
+    EXPECT_EQ(6, std::count(csvContents.begin(), csvContents.end(), '\n'));
+
+    csvFile.remove();
+    binaryFile.remove();
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateSink, NumericalSolver)
+{
+    const std::function<void(const NumericalSolver::StateVector&, NumericalSolver::StateVector&, const double)>
+        systemOfEquations = [](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double
+                            ) -> void
+    {
+        dxdt[0] = x[1];
+        dxdt[1] = -x[0];
+    };
+
+    const State initialState = this->stateAt(0);
+    const Instant endInstant = startInstant_ + Duration::Seconds(100.0);
+
+    NumericalSolver numericalSolver = NumericalSolver::DefaultConditional();
+
+    EXPECT_EQ(nullptr, numericalSolver.getStateSink());
+
+    const Shared<ArrayStateWriter> stateWriterSPtr = std::make_shared<ArrayStateWriter>();
+    const Shared<StateSink> stateSinkSPtr = std::make_shared<StateSink>(stateWriterSPtr);
+
+    numericalSolver.setStateSink(stateSinkSPtr);
+
+    EXPECT_EQ(stateSinkSPtr, numericalSolver.getStateSink());
+
+    // States are streamed regardless of the observation policy, which does not reset the sink
+
+    numericalSolver.setObservationPolicy(NumericalSolver::ObservationPolicy::Boundaries());
+
+    EXPECT_EQ(stateSinkSPtr, numericalSolver.getStateSink());
+
+    const State endState = numericalSolver.integrateTime(initialState, endInstant, systemOfEquations);
+
+    stateSinkSPtr->flush();
+
+    EXPECT_EQ(2, numericalSolver.getObservedStates().getSize());
+    ASSERT_GT(stateWriterSPtr->states.getSize(), 2);
+    EXPECT_EQ(initialState, stateWriterSPtr->states.accessFirst());
+    EXPECT_EQ(endState, stateWriterSPtr->states.accessLast());
+
+    // Copies share the sink
+
+    const Size writtenStateCount = stateWriterSPtr->states.getSize();
+
+    NumericalSolver numericalSolverCopy = numericalSolver;
+    numericalSolverCopy.setObservationPolicy(NumericalSolver::ObservationPolicy::All());
+
+    numericalSolverCopy.integrateTime(initialState, endInstant, systemOfEquations);
+
+    stateSinkSPtr->flush();
+
+    EXPECT_EQ(writtenStateCount, numericalSolverCopy.getObservedStates().getSize());
+    EXPECT_EQ(2 * writtenStateCount, stateWriterSPtr->states.getSize());
+
+    numericalSolver.setStateSink(nullptr);
+
+    EXPECT_EQ(nullptr, numericalSolver.getStateSink());
+}
@@ -0,0 +1,108 @@
+/// Apache License 2.0
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/Binary.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::coord::Position;
+using ostk::physics::coord::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::statewriters::Binary;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_Binary : public ::testing::Test
+{
+   protected:
+    const File file_ = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_StateWriters_Binary.bin"));
+
+    const State state_ = {
+        Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 7500.0, 0.0}, Frame::GCRF()),
+    };
+
+    void TearDown() override
+    {
+        if (file_.exists())
+        {
+            file_.remove();
+        }
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_Binary, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Binary binary(file_));
+    }
+
+    {
+        EXPECT_THROW(Binary binary(File::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Binary binary(File::Path(Path::Parse("/does/not/exist/states.bin"))), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_Binary, Write)
+{
+    {
+        Binary binary = {file_};
+
+        EXPECT_EQ(file_, binary.getFile());
+
+        binary.write(state_);
+        binary.flush();
+
+        EXPECT_THROW(binary.write(State::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        std::ifstream stream(file_.getPath().toString(), std::ios::binary);
+
+        char magic[8];
+        std::uint32_t version = 0;
+        double secondsSinceJ2000 = 0.0;
+        std::uint32_t coordinateCount = 0;
+        double coordinates[6];
+
+        stream.read(magic, sizeof(magic));
+        stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        stream.read(reinterpret_cast<char*>(&secondsSinceJ2000), sizeof(secondsSinceJ2000));
+        stream.read(reinterpret_cast<char*>(&coordinateCount), sizeof(coordinateCount));
+
+        ASSERT_EQ(6, coordinateCount);
+
+        stream.read(reinterpret_cast<char*>(coordinates), sizeof(coordinates));
+
+        EXPECT_TRUE(stream.good());
+        EXPECT_EQ(0, std::memcmp(magic, "OSTKSTAT", 8));
+        EXPECT_EQ(1, version);
+        EXPECT_DOUBLE_EQ((state_.accessInstant() - Instant::J2000()).inSeconds(), secondsSinceJ2000);
+        EXPECT_EQ(7000000.0, coordinates[0]);
+        EXPECT_EQ(7500.0, coordinates[4]);
+
+        stream.peek();
+        EXPECT_TRUE(stream.eof());
+    }
+}
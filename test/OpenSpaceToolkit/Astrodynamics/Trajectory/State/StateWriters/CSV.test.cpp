@@ -0,0 +1,108 @@
+/// Apache License 2.0
+
+#include <fstream>
+#include <sstream>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateWriters/CSV.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::types::String;
+
+using ostk::physics::coord::Frame;
+using ostk::physics::coord::Position;
+using ostk::physics::coord::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astro::trajectory::State;
+using ostk::astro::trajectory::state::statewriters::CSV;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_CSV : public ::testing::Test
+{
+   protected:
+    const File file_ = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_StateWriters_CSV.csv"));
+
+    const State state_ = {
+        Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 7500.0, 0.0}, Frame::GCRF()),
+    };
+
+    void TearDown() override
+    {
+        if (file_.exists())
+        {
+            file_.remove();
+        }
+    }
+
+    String readFile() const
+    {
+        std::ifstream stream(file_.getPath().toString());
+        std::stringstream contents;
+        contents << stream.rdbuf();
+
+        return contents.str();
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_CSV, Constructor)
+{
+    {
+        EXPECT_NO_THROW(CSV csv(file_));
+    }
+
+    {
+        EXPECT_THROW(CSV csv(File::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(CSV csv(file_, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(CSV csv(File::Path(Path::Parse("/does/not/exist/states.csv"))), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateWriters_CSV, Write)
+{
+    {
+        CSV csv = {file_};
+
+        EXPECT_EQ(file_, csv.getFile());
+
+        csv.write(state_);
+        csv.write(state_);
+        csv.flush();
+
+        EXPECT_THROW(csv.write(State::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        std::istringstream contents(this->readFile());
+        String line;
+
+        std::getline(contents, line);
+        EXPECT_EQ(
+            "Instant,Frame,CARTESIAN_POSITION_0,CARTESIAN_POSITION_1,CARTESIAN_POSITION_2,CARTESIAN_VELOCITY_0,"
+            "CARTESIAN_VELOCITY_1,CARTESIAN_VELOCITY_2",
+            line
+        );
+
+        std::getline(contents, line);
+        EXPECT_EQ("2018-01-01T00:00:00,GCRF,7000000,0,0,0,7500,0", line);
+
+        std::getline(contents, line);
+        EXPECT_EQ("2018-01-01T00:00:00,GCRF,7000000,0,0,0,7500,0", line);
+
+        EXPECT_FALSE(std::getline(contents, line));
+    }
+}
@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Utilities.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::types::Index;
+using ostk::core::types::Size;
+
+using ostk::astro::utilities::ParallelFor;
+using ostk::astro::utilities::ResolveThreadCount;
+
+TEST(OpenSpaceToolkit_Astrodynamics_Utilities, ResolveThreadCount)
+{
+    {
+        EXPECT_EQ(1, ResolveThreadCount(1));
+        EXPECT_EQ(3, ResolveThreadCount(3));
+    }
+
+    {
+        EXPECT_EQ(std::max<Size>(1, std::thread::hardware_concurrency()), ResolveThreadCount(0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Utilities, ParallelFor)
+{
+    {
+        bool isCalled = false;
+
+        ParallelFor(
+            0,
+            4,
+            [&isCalled](const Index&) -> void
+            {
+                isCalled = true;
+            }
+        );
+
+        EXPECT_FALSE(isCalled);
+    }
+
+    {
+        for (const Size threadCount : {0, 1, 2, 4, 64})
+        {
+            std::vector<std::atomic<Size>> callCounts(50);
+
+            ParallelFor(
+                callCounts.size(),
+                threadCount,
+                [&callCounts](const Index& anIndex) -> void
+                {
+                    callCounts[anIndex].fetch_add(1);
+                }
+            );
+
+            for (const std::atomic<Size>& callCount : callCounts)
+            {
+                EXPECT_EQ(1, callCount.load());
+            }
+        }
+    }
+
+    {
+        const std::thread::id callingThreadId = std::this_thread::get_id();
+
+        ParallelFor(
+            10,
+            1,
+            [callingThreadId](const Index&) -> void
+            {
+                EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+            }
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Utilities, ParallelFor_Exception)
+{
+    for (const Size threadCount : {1, 4})
+    {
+        std::atomic<Size> callCount = {0};
+
+        EXPECT_THROW(
+            ParallelFor(
+                1000,
+                threadCount,
+                [&callCount](const Index& anIndex) -> void
+                {
+                    callCount.fetch_add(1);
+
+                    if (anIndex == 3)
+                    {
+                        throw ostk::core::error::RuntimeError("Failure.");
+                    }
+                }
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        // Indices are no longer handed out once a call has thrown
+
+        EXPECT_LT(callCount.load(), 1000);
+    }
+}